@@ -3,20 +3,22 @@
 * @brief Reaching definitions analysis (RDA) builds UD and DU chains.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 *
-* Right now, this works on an entire module. But we could insert an another layer
-* that represents functions. Then it would be possible to associate BBs with
-* functions that own them and recompute RDA only for the selected function.
+* The analysis is computed for each function separately. Once it is run on
+* a module, it can be updated after the module changes -- only functions that
+* were changed are recomputed.
 */
 
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
 #define RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
 
+#include <atomic>
 #include <map>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include <llvm/ADT/BitVector.h>
 #include <llvm/ADT/SmallPtrSet.h>
 #include <llvm/IR/Module.h>
 
@@ -55,6 +57,9 @@ class Definition
 		/// Defined value -- store's pointer operand or alloca itself.
 		llvm::Value* src;
 		UseSet uses;
+		/// Index of the definition in its function -- used in the dataflow
+		/// bit vectors.
+		unsigned id = 0;
 };
 
 class Use
@@ -83,8 +88,11 @@ class BasicBlockEntry
 				std::ostream& out,
 				const BasicBlockEntry& bbe);
 
-		void initializeKillDefSets();
-		Changed initDefsOut();
+		void initializeKillDefSets(std::size_t defCount);
+		Changed initDefsOut(
+				const std::unordered_map<const llvm::Value*, llvm::BitVector>& src2defs,
+				llvm::BitVector& tmp);
+		void getDefsIn(llvm::BitVector& defsIn) const;
 
 		const DefSet& defsFromUse(const llvm::Instruction* I) const;
 		const UseSet& usesFromDef(const llvm::Instruction* I) const;
@@ -99,16 +107,20 @@ class BasicBlockEntry
 
 		BBEntrySet prevBBs;
 
+		// Sets of definitions indexed by Definition::id.
 		// defsIn is union of prevBBs' defsOuts
-		DefSet defsOut;
-		DefSet genDefs;
-		std::unordered_set<llvm::Value*> killDefs;
+		llvm::BitVector defsOut;
+		llvm::BitVector genDefs;
+		/// Values defined in this block -- all their other definitions
+		/// are killed.
+		std::vector<const llvm::Value*> killDefs;
 
-		bool changed = false;
+		/// Basic block is in the propagation work list.
+		bool queued = false;
 
 	private:
 		unsigned id;
-	    static int newUID;
+	    static std::atomic<int> newUID;
 };
 
 class ReachingDefinitionsAnalysis
@@ -122,6 +134,12 @@ class ReachingDefinitionsAnalysis
 				llvm::Function& F,
 				Abi* abi = nullptr,
 				bool trackFlagRegs = false);
+		bool update(
+				llvm::Module& M,
+				Abi* abi = nullptr,
+				bool trackFlagRegs = false);
+		void invalidateFunction(const llvm::Function* F);
+		void setJobs(std::size_t jobs);
 		void clear();
 		bool wasRun() const;
 
@@ -146,22 +164,68 @@ class ReachingDefinitionsAnalysis
 				llvm::Instruction* I);
 
 	private:
-		void run();
+		using BBEntryMap = std::map<const llvm::BasicBlock*, BasicBlockEntry>;
+
+		/// Numbering of definitions in one function.
+		struct DefIndex
+		{
+			/// Definitions indexed by their IDs.
+			std::vector<Definition*> defs;
+			/// <defined value, all its definitions in the function>
+			std::unordered_map<const llvm::Value*, llvm::BitVector> src2defs;
+		};
+
+	private:
+		void analyzeFunctions(const std::vector<llvm::Function*>& fncs);
+		void run(const llvm::Function* F, BBEntryMap& bbs);
 		const BasicBlockEntry& getBasicBlockEntry(const llvm::Instruction* I) const;
-		void initializeBasicBlocks(llvm::Module& M);
-		void initializeBasicBlocks(llvm::Function& F);
-		void initializeBasicBlocksPrev();
-		void initializeKillGenSets();
-		void propagate();
-		void initializeDefsAndUses();
-		void clearInternal();
+		void initializeBasicBlocks(llvm::Function& F, BBEntryMap& bbs);
+		void initializeBasicBlocksPrev(BBEntryMap& bbs);
+		void initializeKillGenSets(BBEntryMap& bbs, DefIndex& index);
+		void propagate(
+				const llvm::Function* F,
+				BBEntryMap& bbs,
+				const DefIndex& index);
+		void initializeDefsAndUses(BBEntryMap& bbs, const DefIndex& index);
+		void clearInternal(BBEntryMap& bbs);
+		std::size_t getFunctionHash(const llvm::Function& F) const;
 
 	private:
-		std::map<const llvm::Function*, std::map<const llvm::BasicBlock*, BasicBlockEntry>> bbMap;
+
+		std::map<const llvm::Function*, BBEntryMap> bbMap;
+		/// Hashes of functions' contents at the time they were analyzed.
+		std::map<const llvm::Function*, std::size_t> _fncHashes;
+		/// Functions reported as changed since they were analyzed.
+		std::set<const llvm::Function*> _invalidFncs;
+		const llvm::Module* _module = nullptr;
 		bool _trackFlagRegs = false;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		bool _run = false;
 		Abi* _abi = nullptr;
+		std::size_t _jobs = 1;
+};
+
+/**
+ * Reaching definitions analyses shared by all the passes that run on
+ * a module. A shared analysis is updated each time it is requested, so only
+ * functions changed since the last request are recomputed.
+ */
+class ReachingDefinitionsProvider
+{
+	public:
+		static ReachingDefinitionsAnalysis* getRda(
+				llvm::Module* m,
+				Abi* abi = nullptr,
+				bool trackFlagRegs = false);
+		static void invalidateFunction(llvm::Function* f);
+		static void clear();
+
+	private:
+		/// <module, track flag registers>
+		using Key = std::pair<const llvm::Module*, bool>;
+
+	private:
+		static std::map<Key, ReachingDefinitionsAnalysis> _module2rda;
 };
 
 } // namespace bin2llvmir
@@ -29,6 +29,7 @@
 #include "retdec/bin2llvmir/providers/names.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_debug.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_ranges.h"
+#include "retdec/bin2llvmir/optimizations/decoder/dry_run_insn_cache.h"
 #include "retdec/bin2llvmir/optimizations/decoder/jump_targets.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/symbolic_tree_match.h"
@@ -64,7 +65,6 @@ class Decoder : public llvm::ModulePass
 	//
 	private:
 		void initTranslator();
-		void initDryRunCsInstruction();
 		void initEnvironment();
 		void initEnvironmentAsm2LlvmMapping();
 		void initEnvironmentPseudoFunctions();
@@ -91,6 +91,8 @@ class Decoder : public llvm::ModulePass
 				const JumpTarget& jt,
 				ByteData bytes,
 				bool strict = false);
+		cs_insn* disasmDryRun(csh ce, ByteData& bytes, uint64_t& a);
+		cs_insn* takeDryRunInsn(ByteData& bytes, utils::Address addr);
 		cs_mode determineMode(cs_insn* insn, utils::Address& target);
 		capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne
 				translate(
@@ -290,7 +292,7 @@ class Decoder : public llvm::ModulePass
 		ReachingDefinitionsAnalysis _RDA;
 
 		std::unique_ptr<capstone2llvmir::Capstone2LlvmIrTranslator> _c2l;
-		cs_insn* _dryCsInsn = nullptr;
+		DryRunInsnCache _dryRunInsns;
 
 		llvm::IRBuilder<>* _irb;
 
@@ -0,0 +1,57 @@
+/**
+* @file include/retdec/bin2llvmir/optimizations/decoder/dry_run_insn_cache.h
+* @brief Instructions disassembled by decoder's dry runs.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DRY_RUN_INSN_CACHE_H
+#define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DRY_RUN_INSN_CACHE_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <capstone/capstone.h>
+
+#include "retdec/utils/address.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Instructions disassembled by the last dry run, so that they do not have
+ * to be disassembled again when they are translated.
+ *
+ * Instructions dropped by clear() are reused by the following dry runs,
+ * so that a dry run does not allocate an instruction for every
+ * disassembled instruction.
+ */
+class DryRunInsnCache
+{
+	public:
+		DryRunInsnCache() = default;
+		DryRunInsnCache(const DryRunInsnCache&) = delete;
+		DryRunInsnCache& operator=(const DryRunInsnCache&) = delete;
+		~DryRunInsnCache();
+
+		cs_insn* getScratch(csh ce);
+		cs_insn* keepScratch(utils::Address a, cs_mode m);
+		cs_insn* take(utils::Address a, cs_mode m, std::size_t maxSize);
+		void clear();
+
+		std::size_t size() const;
+		std::size_t freeSize() const;
+
+	private:
+		/// Instruction into which the next instruction is disassembled.
+		cs_insn* _scratch = nullptr;
+		/// Mapping: (address, basic mode) -> instruction.
+		std::map<std::pair<utils::Address, cs_mode>, cs_insn*> _insns;
+		/// Instructions of the previous dry runs that can be reused.
+		std::vector<cs_insn*> _free;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
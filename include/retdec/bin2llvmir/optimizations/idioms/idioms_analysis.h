@@ -8,6 +8,8 @@
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_IDIOMS_IDIOMS_ANALYSIS_H
 
 #include <cstdio>
+#include <initializer_list>
+#include <vector>
 
 #include <llvm/ADT/Statistic.h>
 #include <llvm/IR/BasicBlock.h>
@@ -43,12 +45,32 @@ public:
 	IdiomsAnalysis(llvm::Module * M, CC_compiler cc, CC_arch arch)
 	{
 		init(M, cc, arch);
+		initExchangers();
 	}
 	virtual bool doAnalysis(llvm::Function & f, llvm::Pass * p) override;
 
 private:
+	using Exchanger = llvm::Instruction * (IdiomsAnalysis::*)(llvm::BasicBlock::iterator) const;
+
+	/**
+	 * @brief Instruction idiom exchanger applicable to the given compiler and
+	 * architecture
+	 */
+	struct IdiomExchanger {
+		std::vector<unsigned> opcodes; ///< Opcodes of roots of the idioms.
+		Exchanger exchanger;
+		const char * name; ///< For debug purpose only.
+	};
+
+	void initExchangers();
+	void addExchanger(unsigned opcode, Exchanger exchanger, const char * fname);
+	void addExchanger(std::initializer_list<unsigned> opcodes, Exchanger exchanger, const char * fname);
 	bool analyse(llvm::Function & f, llvm::Pass * p, int (IdiomsAnalysis::*exchanger)(llvm::Function &, llvm::Pass *) const, const char * fname);
-	bool analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname);
+	bool analyse(llvm::BasicBlock & bb);
+	void replaceInstruction(llvm::Instruction * insn, llvm::Instruction * res) const;
+
+	/// Exchangers in the order in which they have to be applied.
+	std::vector<IdiomExchanger> m_exchangers;
 };
 
 } // namespace bin2llvmir
@@ -10,6 +10,8 @@
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
+#include "retdec/config/config.h"
+
 namespace retdec {
 namespace bin2llvmir {
 
@@ -17,9 +19,16 @@ class ProviderInitialization : public llvm::ModulePass
 {
 	public:
 		static char ID;
-		ProviderInitialization();
+		ProviderInitialization(retdec::config::Config* c = nullptr);
 		virtual bool runOnModule(llvm::Module& m) override;
 		virtual bool doFinalization(llvm::Module& m) override;
+
+		static void clear();
+
+	private:
+		/// Config DB used instead of the -config-path file, if set.
+		/// It is updated with the final config on finalization.
+		retdec::config::Config* _config = nullptr;
 };
 
 } // namespace bin2llvmir
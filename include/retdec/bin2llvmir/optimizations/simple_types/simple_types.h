@@ -207,6 +207,8 @@ class SimpleTypesAnalysis : public llvm::ModulePass
 		virtual bool runOnModule(llvm::Module& m) override;
 		virtual void getAnalysisUsage(llvm::AnalysisUsage& AU) const override;
 
+		static void clear();
+
 	private:
 		void buildEqSets(llvm::Module& M);
 		void buildEquations();
@@ -221,13 +223,16 @@ class SimpleTypesAnalysis : public llvm::ModulePass
 		EqSetContainer eqSets;
 		ValuePairList val2PtrVal;
 
-		ReachingDefinitionsAnalysis RDA;
+		ReachingDefinitionsAnalysis* RDA = nullptr;
 		llvm::Module* module = nullptr;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		Config* config = nullptr;
 		FileImage* objf = nullptr;
 
 		std::unordered_set<llvm::Instruction*> instToErase;
+
+		/// Modules on which the full analysis has already been run.
+		static std::set<const llvm::Module*> _analysedModules;
 };
 
 } // namespace bin2llvmir
@@ -13,8 +13,10 @@
 #include "retdec/capstone2llvmir/powerpc/powerpc_defs.h"
 #include "retdec/capstone2llvmir/x86/x86_defs.h"
 
+#include <llvm/ADT/DenseMap.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
+#include <llvm/IR/ValueHandle.h>
 
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/utils/address.h"
@@ -23,7 +25,49 @@
 namespace retdec {
 namespace bin2llvmir {
 
-using Llvm2CapstoneInsnMap = typename std::map<llvm::StoreInst*, cs_insn*>;
+/**
+ * Mapping of LLVM IR special instructions to Capstone instructions.
+ *
+ * Capstone instructions are not kept in the memory allocated by Capstone.
+ * They are copied into a compact arena owned by this map. Only the part of
+ * @c cs_detail used by the set architecture is stored, which is a fraction
+ * of the full structure (e.g. x86 instructions do not need space for ARM
+ * operands). The stored instructions are valid until the map is cleared or
+ * destroyed.
+ */
+class Llvm2CapstoneInsnMap
+{
+	public:
+		Llvm2CapstoneInsnMap() = default;
+		Llvm2CapstoneInsnMap(const Llvm2CapstoneInsnMap&) = delete;
+		Llvm2CapstoneInsnMap(Llvm2CapstoneInsnMap&&) = default;
+		Llvm2CapstoneInsnMap& operator=(const Llvm2CapstoneInsnMap&) = delete;
+		Llvm2CapstoneInsnMap& operator=(Llvm2CapstoneInsnMap&&) = default;
+
+		void setArchitecture(cs_arch arch);
+
+		cs_insn* emplace(llvm::StoreInst* llvmInsn, cs_insn* insn);
+		cs_insn* find(const llvm::StoreInst* llvmInsn) const;
+
+		std::size_t size() const;
+		bool empty() const;
+		void clear();
+
+	private:
+		cs_insn* copyInsn(const cs_insn* insn);
+		void* allocate(std::size_t size);
+
+	private:
+		/// Size of the arena blocks.
+		static const std::size_t BLOCK_SIZE = 256 * 1024;
+
+		/// Number of bytes of @c cs_detail stored for each instruction.
+		std::size_t _detailSize = sizeof(cs_detail);
+		std::vector<std::unique_ptr<std::uint8_t[]>> _blocks;
+		std::size_t _blockUsed = 0;
+		std::size_t _blockCapacity = 0;
+		llvm::DenseMap<const llvm::StoreInst*, cs_insn*> _index;
+};
 
 /**
  * Assembly instruction representation.
@@ -160,6 +204,7 @@ class AsmInstruction
 		static void setLlvmToAsmGlobalVariable(
 				const llvm::Module* m,
 				llvm::GlobalVariable* gv);
+		static void addLlvmToAsmInstruction(llvm::StoreInst* s);
 		static retdec::utils::Address getInstructionAddress(
 				llvm::Instruction* inst);
 		static retdec::utils::Address getBasicBlockAddress(
@@ -169,10 +214,22 @@ class AsmInstruction
 		static bool isLlvmToAsmInstruction(const llvm::Value* inst);
 		static void clear();
 
+	private:
+		/// Mapping: address -> special LLVM IR instruction.
+		using AddressToAsmInstructionMap = llvm::DenseMap<
+				std::uint64_t,
+				llvm::WeakVH>;
+
 	private:
 		const llvm::GlobalVariable* getLlvmToAsmGlobalVariablePrivate(
 				llvm::Module* m) const;
 		bool isLlvmToAsmInstructionPrivate(llvm::Value* inst) const;
+		static bool isLlvmToAsmInstruction(
+				const llvm::Value* inst,
+				const llvm::GlobalVariable* gv);
+		static AddressToAsmInstructionMap& getAddressIndex(
+				const llvm::Module* m);
+		static bool isIndexableAddress(std::uint64_t addr);
 
 	private:
 		using ModuleGlobalPair = std::pair<
@@ -180,12 +237,17 @@ class AsmInstruction
 				llvm::GlobalVariable*>;
 		using ModuleInstructionMap = std::pair<
 				const llvm::Module*,
-				std::map<llvm::StoreInst*, cs_insn*>>;
+				Llvm2CapstoneInsnMap>;
+		/// Index is @c nullptr until it is needed for the first time.
+		using ModuleAddressIndex = std::pair<
+				const llvm::Module*,
+				std::unique_ptr<AddressToAsmInstructionMap>>;
 
 	private:
 		llvm::StoreInst* _llvmToAsmInstr = nullptr;
 		static std::vector<ModuleGlobalPair> _module2global;
 		static std::vector<ModuleInstructionMap> _module2instMap;
+		static std::vector<ModuleAddressIndex> _module2addrIndex;
 
 	public:
 		template<
@@ -24,6 +24,9 @@ class Config
 		static Config empty(llvm::Module* m);
 		static Config fromFile(llvm::Module* m, const std::string& path);
 		static Config fromJsonString(llvm::Module* m, const std::string& json);
+		static Config fromConfig(
+				llvm::Module* m,
+				const retdec::config::Config& config);
 
 		void doFinalization();
 
@@ -182,6 +185,7 @@ class Config
 				llvm::Type*& type) const;
 
 	private:
+		void initialize();
 		void tagFunctionsWithUsedCryptoGlobals();
 
 	public:
@@ -213,6 +217,9 @@ class ConfigProvider
 		static Config* addConfigJsonString(
 				llvm::Module* m,
 				const std::string& json);
+		static Config* addConfig(
+				llvm::Module* m,
+				const retdec::config::Config& config);
 		static Config* getConfig(llvm::Module* m);
 		static bool getConfig(llvm::Module* m, Config*& c);
 		static void doFinalization(llvm::Module* m);
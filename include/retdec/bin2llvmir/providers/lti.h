@@ -7,6 +7,11 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include <llvm/IR/Module.h>
 
 #include "retdec/ctypes/context.h"
@@ -70,7 +75,6 @@ class Lti
 				Config* c,
 				retdec::loader::Image* objf);
 
-		bool hasLtiFunction(const std::string& name);
 		std::shared_ptr<retdec::ctypes::Function> getLtiFunction(
 				const std::string& name);
 		llvm::FunctionType* getLlvmFunctionType(const std::string& name);
@@ -79,6 +83,8 @@ class Lti
 		FunctionPair getPairFunction(const std::string& name);
 		llvm::Function* getLlvmFunction(const std::string& name);
 
+		static void preloadLtiFiles(const std::set<std::string>& filePaths);
+
 	private:
 		void loadLtiFile(const std::string& filePath);
 		llvm::Type* getLlvmType(std::shared_ptr<retdec::ctypes::Type> type);
@@ -87,8 +93,19 @@ class Lti
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
 		retdec::loader::Image* _image = nullptr;
+		/// Functions from LTI files that have been asked for so far.
 		std::unique_ptr<retdec::ctypes::Module> _ltiModule;
-		ctypesparser::JSONCTypesParser _ltiParser;
+		/// One parser per loaded LTI file, in the order of their priority.
+		/// Functions are parsed from them lazily, see getLtiFunction().
+		std::vector<ctypesparser::JSONCTypesParser> _ltiParsers;
+
+		/// <path to LTI file, its indexed JSON>
+		/// Filled by preloadLtiFiles() and shared (read-only) by the parsers
+		/// of all instances.
+		static std::map<
+				std::string,
+				std::shared_ptr<const ctypesparser::JSONCTypesParser::IndexedJson>>
+				_preloadedFiles;
 };
 
 class LtiProvider
@@ -8,8 +8,11 @@
 #define RETDEC_BIN2LLVMIR_PROVIDERS_NAMES_H
 
 #include <map>
+#include <memory>
 #include <set>
 
+#include <llvm/Support/MemoryBuffer.h>
+
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/debugformat.h"
 #include "retdec/bin2llvmir/providers/demangler.h"
@@ -140,6 +143,41 @@ class Names
 		static Name _emptyName;
 };
 
+/**
+ * Read-only database of names of functions imported by ordinal numbers.
+ *
+ * It is generated from the ordinal files (@c *.ord) of one directory when
+ * RetDec is installed (see support/install-ordinals.py for its layout).
+ * The file is memory-mapped and looked up in place, so nothing is parsed
+ * or allocated for libraries that are never imported.
+ */
+class ImportOrdDatabase
+{
+	public:
+		static std::unique_ptr<ImportOrdDatabase> fromFile(
+				const std::string& filePath);
+		static std::unique_ptr<ImportOrdDatabase> fromBuffer(
+				std::unique_ptr<llvm::MemoryBuffer> buffer);
+
+		bool hasLibrary(const std::string& libName) const;
+		std::string getFunctionName(const std::string& libName, int ord) const;
+
+	public:
+		/// Name of the database file in a directory with ordinal files.
+		static const std::string fileName;
+
+	private:
+		ImportOrdDatabase(
+				std::unique_ptr<llvm::MemoryBuffer> buffer,
+				uint32_t slotCount);
+
+		const char* findLibrarySlot(const std::string& libName) const;
+
+	private:
+		std::unique_ptr<llvm::MemoryBuffer> _buffer;
+		uint32_t _slotCount = 0;
+};
+
 /**
  * Names container.
  */
@@ -163,6 +201,8 @@ class NameContainer
 		const Names& getNamesForAddress(retdec::utils::Address a);
 		const Name& getPreferredNameForAddress(retdec::utils::Address a);
 
+		static void preloadImportOrds(const std::string& dir);
+
 	private:
 		void initFromConfig();
 		void initFromDebug();
@@ -172,6 +212,7 @@ class NameContainer
 				const std::string& libName,
 				int ord);
 		bool loadImportOrds(const std::string& libName);
+		const ImportOrdDatabase* getImportOrdDatabase();
 
 	private:
 		/// <ordinal number, function name>
@@ -186,6 +227,18 @@ class NameContainer
 		std::map<retdec::utils::Address, Names> _data;
 		/// <library name without suffix ".dll", map with ordinals>
 		std::map<std::string, ImportOrdMap> _dllOrds;
+
+		/// Database of ordinals in the ordinal numbers directory, if there is one.
+		std::shared_ptr<const ImportOrdDatabase> _ordDatabase;
+		bool _ordDatabaseOpened = false;
+
+		/// <path to ordinal file, map with ordinals>
+		/// Filled by preloadImportOrds() and shared by all containers.
+		static std::map<std::string, ImportOrdMap> _preloadedOrds;
+		/// <ordinal numbers directory, its database>
+		/// Filled by preloadImportOrds() and shared by all containers.
+		static std::map<std::string, std::shared_ptr<const ImportOrdDatabase>>
+				_preloadedOrdDatabases;
 };
 
 /**
@@ -0,0 +1,29 @@
+/**
+ * @file include/retdec/bin2llvmir/utils/parallel.h
+ * @brief Running function-local work on several threads.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+#define RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <llvm/IR/Module.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+std::size_t getFunctionJobs(llvm::Module* m);
+
+void runOnFunctions(
+		const std::vector<llvm::Function*>& fncs,
+		std::size_t jobs,
+		const std::function<void(llvm::Function*)>& work);
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
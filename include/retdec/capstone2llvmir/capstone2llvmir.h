@@ -432,6 +432,21 @@ class Capstone2LlvmIrTranslator
 				std::size_t& size,
 				retdec::utils::Address& a,
 				llvm::IRBuilder<>& irb) = 0;
+		/**
+		 * Translate one already disassembled assembly instruction.
+		 * @param insn Capstone instruction to translate. It must have been
+		 *             disassembled by the Capstone engine of this translator
+		 *             in its current mode. It is returned in the result,
+		 *             i.e. it must have been allocated by @c cs_malloc() and
+		 *             it must be freed by caller.
+		 * @param irb  LLVM IR builder used to create LLVM IR translation.
+		 *             Translated LLVM IR instructions are created at its
+		 *             current position.
+		 * @return See @c TranslationResult structure.
+		 */
+		virtual TranslationResultOne translateOne(
+				cs_insn* insn,
+				llvm::IRBuilder<>& irb) = 0;
 //
 //==============================================================================
 // Capstone related getters and query methods.
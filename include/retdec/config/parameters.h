@@ -37,12 +37,18 @@ class Parameters
 		void setIsSelectedDecodeOnly(bool b);
 		void setOutputFile(const std::string& n);
 		void setOrdinalNumbersDirectory(const std::string& n);
+		void setYaraCacheDirectory(const std::string& n);
+		void setStaticCodeJobs(std::size_t n);
+		void setFunctionJobs(std::size_t n);
 		/// @}
 
 		/// @name Parameters get methods.
 		/// @{
 		std::string getOutputFile() const;
 		std::string getOrdinalNumbersDirectory() const;
+		std::string getYaraCacheDirectory() const;
+		std::size_t getStaticCodeJobs() const;
+		std::size_t getFunctionJobs() const;
 		/// @}
 
 		Json::Value getJsonValue() const;
@@ -84,6 +90,19 @@ class Parameters
 
 		std::string _outputFile;
 		std::string _ordinalNumbersDirectory;
+
+		/// Directory with compiled YARA rules shared between runs.
+		/// If empty, the rules are compiled on every run.
+		std::string _yaraCacheDirectory;
+
+		/// Number of static code signature files scanned concurrently
+		/// (@c 0 means one per hardware thread).
+		std::size_t _staticCodeJobs = 1;
+
+		/// Number of functions processed concurrently (@c 0 means one per
+		/// hardware thread). In bin2llvmir, only reaching definitions are
+		/// built concurrently, passes that modify the IR run serially.
+		std::size_t _functionJobs = 1;
 };
 
 } // namespace config
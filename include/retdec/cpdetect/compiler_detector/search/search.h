@@ -7,6 +7,8 @@
 #ifndef RETDEC_CPDETECT_COMPILER_DETECTOR_SEARCH_SEARCH_H
 #define RETDEC_CPDETECT_COMPILER_DETECTOR_SEARCH_SEARCH_H
 
+#include <unordered_map>
+
 #include "retdec/cpdetect/cptypes.h"
 #include "retdec/fileformat/file_format/file_format.h"
 
@@ -39,9 +41,31 @@ class Search
 				/// @}
 		};
 	private:
+		/**
+		 * Signature without slashes compiled for comparison of whole bytes
+		 */
+		struct BytePattern
+		{
+			std::vector<unsigned char> values; ///< values of significant bits of bytes
+			std::vector<unsigned char> masks;  ///< significant bits of bytes
+		};
+
+		/**
+		 * Signature without slashes compiled for both possible positions of its
+		 * first nibble in a byte
+		 */
+		struct CompiledSignature
+		{
+			bool valid = false;      ///< @c false if signature cannot match any content
+			BytePattern patterns[2]; ///< patterns starting in the high and in the low nibble
+		};
+
 		retdec::fileformat::FileFormat &parser; ///< parser of input file
-		std::string nibbles;             ///< content of file in hexadecimal string representation
+		const unsigned char *content;    ///< content of file in byte order of search (two nibbles per byte)
+		std::vector<unsigned char> swappedContent; ///< content of big endian file converted to little endian
+		std::size_t nibbleCount;         ///< number of nibbles in content
 		std::string plain;               ///< content of file as plain string
+		mutable std::unordered_map<std::string, CompiledSignature> compiledSignatures; ///< cache of compiled signatures
 		std::vector<RelativeJump> jumps; ///< representation of supported relative jumps
 		std::size_t averageSlashLen;     ///< average length of one slash representation
 		bool fileLoaded;                 ///< @c true if file was successfully loaded, @c false otherwise
@@ -50,6 +74,9 @@ class Search
 		/// @name Auxiliary methods
 		/// @{
 		bool haveSlashes() const;
+		char getNibble(std::size_t nibbleIndex) const;
+		bool hasNibblesOnPosition(const std::string &hexString, std::size_t nibbleIndex) const;
+		const CompiledSignature& getCompiledSignature(const std::string &signPattern) const;
 		std::size_t nibblesFromBytes(std::size_t nBytes) const;
 		std::size_t bytesFromNibbles(std::size_t nNibbles) const;
 		/// @}
@@ -65,7 +92,6 @@ class Search
 
 		/// @name Getters
 		/// @{
-		const std::string& getNibbles() const;
 		const std::string& getPlainString() const;
 		/// @}
 
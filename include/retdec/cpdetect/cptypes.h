@@ -113,6 +113,8 @@ struct DetectParams
 
 	std::size_t epBytesCount;
 
+	std::string yaraCacheDirectory;  ///< directory with compiled rules (empty means no caching)
+
 	DetectParams(SearchType searchType_, bool internal_, bool external_, std::size_t epBytesCount_ = EP_BYTES_SIZE);
 	~DetectParams();
 };
@@ -10,6 +10,7 @@
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <rapidjson/document.h>
 
@@ -37,9 +38,29 @@ class JSONCTypesParser: public CTypesParser
 			const TypeWidths &typeWidths = {},
 			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention()) override;
 
+		/// @name Lazy parsing.
+		/// @{
+		struct IndexedJson;
+		static std::shared_ptr<const IndexedJson> indexJson(
+			std::istream &stream);
+		void indexFunctions(
+			const std::shared_ptr<const IndexedJson> &json,
+			const std::shared_ptr<retdec::ctypes::Context> &context,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		void indexFunctions(
+			std::istream &stream,
+			const std::shared_ptr<retdec::ctypes::Context> &context,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		bool hasIndexedFunction(const std::string &name) const;
+		std::shared_ptr<retdec::ctypes::Function> parseIndexedFunction(
+			const std::string &name);
+		/// @}
+
 	private:
-		std::string loadJson(std::istream &stream) const;
-		std::unique_ptr<rapidjson::Document> parseJson(char *buffer) const;
+		static std::string loadJson(std::istream &stream);
+		static std::unique_ptr<rapidjson::Document> parseJson(char *buffer);
 		void parseJsonIntoModule(
 			const std::unique_ptr<rapidjson::Document> &root,
 			std::unique_ptr<retdec::ctypes::Module> &module);
@@ -47,7 +68,7 @@ class JSONCTypesParser: public CTypesParser
 
 		/// @name Parsing methods.
 		/// @{
-		void handleParsingFailure(const rapidjson::ParseResult &err) const;
+		static void handleParsingFailure(const rapidjson::ParseResult &err);
 		std::shared_ptr<retdec::ctypes::Function> getOrParseFunction(
 			const std::string &name,
 			const rapidjson::Value &jsonFunction
@@ -129,6 +150,7 @@ class JSONCTypesParser: public CTypesParser
 	private:
 		using ParserContext = std::unordered_map<std::string, std::shared_ptr<retdec::ctypes::Type>>;
 		using TypesMap = std::unordered_map<std::string, rapidjson::Value::ConstMemberIterator>;
+		using FunctionsMap = std::unordered_map<std::string, rapidjson::Value::ConstMemberIterator>;
 
 	private:
 		/// Context for the parser (to speedup the parsing).
@@ -136,6 +158,32 @@ class JSONCTypesParser: public CTypesParser
 
 		/// Map used to store pointers to JSON types (to speedup the parsing).
 		TypesMap typesMap;
+
+		/// JSON whose functions are indexed by indexFunctions().
+		std::shared_ptr<const IndexedJson> indexedJson;
+};
+
+/**
+* @brief JSON with C-types whose functions and types are indexed by their
+*        names, see JSONCTypesParser::indexJson().
+*
+* It is only read by parsers, so one instance can be shared by several
+* parsers, even in different threads.
+*/
+struct JSONCTypesParser::IndexedJson
+{
+	/// Text of the JSON (it is parsed in-situ, so it has to be kept as long
+	/// as @c root).
+	std::vector<char> text;
+
+	/// Parsed JSON.
+	std::unique_ptr<rapidjson::Document> root;
+
+	/// Types in @c root by their keys.
+	TypesMap types;
+
+	/// Functions in @c root by their names.
+	FunctionsMap functions;
 };
 
 } // namespace ctypesparser
@@ -0,0 +1,98 @@
+/**
+ * @file include/retdec/decompiler/decompiler.h
+ * @brief Single-process decompilation of a binary file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_DECOMPILER_DECOMPILER_H
+#define RETDEC_DECOMPILER_DECOMPILER_H
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "retdec/config/config.h"
+#include "retdec/llvmir2hll/decompiler.h"
+
+namespace retdec {
+namespace decompiler {
+
+/**
+ * Parameters of the decompilation.
+ *
+ * They correspond to the options of the retdec-decompiler.py script that
+ * are relevant for the decompilation of a (non-packed) binary file.
+ */
+struct DecompilationParams
+{
+	/// Path to the input binary file.
+	std::string inputFile;
+	/// Path to the output file with the generated high-level code.
+	std::string outputFile;
+	/// If nonempty, the final config is written into this file.
+	std::string outputConfigFile;
+	/// If nonempty, the initial config is read from this file.
+	std::string inputConfigFile;
+	/// Path to the file with PDB debugging information.
+	std::string pdbFile;
+	/// Path to the installed support directory. If empty, the directory
+	/// next to the running binary is used.
+	std::string supportDirectory;
+	/// Target architecture. If empty, it is detected from the input.
+	std::string arch;
+
+	/// Do not remove functions that are unreachable from the entry point.
+	bool keepUnreachableFuncs = false;
+	/// Do not use the default signatures of statically linked code.
+	bool noDefaultStaticSignatures = false;
+	/// Additional (user) signatures of statically linked code.
+	std::set<std::string> userStaticSignatures;
+	/// Use also the extra external YARA crypto patterns.
+	bool useAllExternalPatterns = false;
+	/// If nonempty, compiled YARA rules are cached in this directory.
+	std::string yaraCacheDirectory;
+	/// Number of static code signature files scanned concurrently
+	/// (0 means one per hardware thread).
+	std::size_t staticCodeJobs = 1;
+	/// Number of functions whose reaching definitions are built in bin2llvmir
+	/// and that are optimized in llvmir2hll concurrently (0 means one per
+	/// hardware thread).
+	std::size_t functionJobs = 1;
+
+	/// Decode only the selected functions and ranges.
+	bool selectedDecodeOnly = false;
+	/// Names of the selected functions.
+	std::set<std::string> selectedFunctions;
+	/// Selected address ranges in the form 0xstart-0xend.
+	std::set<std::string> selectedRanges;
+
+	/// Also write the optimized LLVM IR (.ll) next to the output file.
+	bool emitLlvmIr = false;
+
+	/// Limit maximal memory to the given number of bytes (0 means no limit).
+	unsigned long long maxMemory = 0;
+	/// Limit maximal memory to half of system RAM.
+	bool maxMemoryHalfRAM = false;
+
+	/// Parameters of the back-end (llvmir2hll).
+	retdec::llvmir2hll::DecompilerParams backend;
+};
+
+/**
+ * Return codes of decompile().
+ */
+enum class ReturnCode
+{
+	OK = 0,
+	FAILED = 1
+};
+
+void initializeSharedResources(const DecompilationParams& params);
+ReturnCode decompile(const DecompilationParams& params);
+
+const std::vector<std::string>& getDefaultBin2llvmirPasses();
+
+} // namespace decompiler
+} // namespace retdec
+
+#endif
@@ -19,7 +19,7 @@
 namespace retdec {
 namespace llvmir2hll {
 
-class CFGBuilder;
+class CFGCache;
 class Function;
 class Module;
 class ValueAnalysis;
@@ -152,8 +152,8 @@ private:
 	/// Visitor for obtaining uses of variables.
 	ShPtr<VarUsesVisitor> vuv;
 
-	/// The used builder of CFGs.
-	ShPtr<CFGBuilder> cfgBuilder;
+	/// The used cache of CFGs.
+	ShPtr<CFGCache> cfgCache;
 };
 
 } // namespace llvmir2hll
@@ -193,6 +193,10 @@ private:
 
 	/// Are there any struct accesses?
 	bool containsStructAccesses;
+
+	/// Version of the value from which the data were computed.
+	// It is not considered when comparing two objects.
+	unsigned valueVersion;
 };
 
 /**
@@ -201,13 +205,23 @@ private:
 * Use create() to create instances of this class. Instances of this class have
 * reference object semantics.
 *
-* When you change a module in a way that may affect the results returned by
-* getValueData() when caching is enabled, you have to call invalidate(). This
-* will bring the analysis into an invalid state so other users of a shared
-* analysis will know that they have to validate the analysis before using it.
-* Upon calling clearCache(), the analysis gets validated automatically. If you
-* modify or remove a statement and call removeFromCache(), then you do not have
-* to call invalidate().
+* When caching is enabled, the cached results are kept until the values from
+* which they were computed are changed. Every cached result remembers the
+* version of its value (see Value::getVersion()). Since changes of expressions
+* change the versions of the expressions and statements containing them, a
+* cached result of a changed value is recomputed upon the next call to
+* getValueData() while the results of unchanged values are reused. Therefore,
+* there is no need to clear the cache after a module is changed. The only
+* exception is a change of the used alias analysis, which is handled by
+* initAliasAnalysis().
+*
+* The results for functions are not cached because they depend on the bodies
+* of the functions. Results of values that have been removed from the module
+* can be freed by calling removeUnusedValuesFromCache().
+*
+* For backward compatibility, the analysis still provides invalidate() and
+* clearCache(). Upon calling clearCache(), the analysis gets validated
+* automatically.
 */
 class ValueAnalysis: private OrderedAllVisitor,
 	private retdec::utils::NonCopyable, public ValidState,
@@ -223,6 +237,7 @@ public:
 	/// @{
 	void clearCache();
 	void removeFromCache(ShPtr<Value> value, bool recursive = true);
+	void removeUnusedValuesFromCache();
 	/// @}
 
 	/// @name Access To Alias Analysis
@@ -233,6 +248,8 @@ public:
 	bool mayBePointed(ShPtr<Variable> var) const;
 	/// @}
 
+	ShPtr<ValueAnalysis> clone() const;
+
 	static ShPtr<ValueAnalysis> create(ShPtr<AliasAnalysis> aliasAnalysis,
 		bool enableCaching = false);
 
@@ -0,0 +1,216 @@
+/**
+* @file include/retdec/llvmir2hll/decompiler.h
+* @brief Conversion of LLVM IR into the specified target high-level language.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_DECOMPILER_H
+#define RETDEC_LLVMIR2HLL_DECOMPILER_H
+
+#include <cstddef>
+#include <string>
+
+#include <llvm/IR/Module.h>
+#include <llvm/Pass.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "retdec/llvmir2hll/pattern/pattern_finder_runner.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class AliasAnalysis;
+class ArithmExprEvaluator;
+class CallInfoObtainer;
+class Config;
+class HLLWriter;
+class Module;
+class Semantics;
+class VarNameGen;
+class VarRenamer;
+
+/**
+* @brief Parameters of the decompilation of LLVM IR into a target HLL.
+*
+* Every member corresponds to one command-line parameter of llvmir2hll. The
+* default values are the same as the defaults of these parameters.
+*/
+struct DecompilerParams {
+	/// Name of the target HLL.
+	std::string targetHll = "!bad!";
+	/// Emit debugging messages, like information about the current phase.
+	bool debug = false;
+	/// The used semantics in the form 'sem1,sem2,...'.
+	std::string semantics;
+	/// Path to the configuration file.
+	std::string configPath;
+	/// Emit debugging comments in the generated code.
+	bool emitDebugComments = false;
+	/// A comma separated list of optimizations to be enabled.
+	std::string enabledOpts;
+	/// A comma separated list of optimizations to be disabled.
+	std::string disabledOpts;
+	/// Disable all optimizations.
+	bool noOpts = false;
+	/// Enable aggressive optimizations.
+	bool aggressiveOpts = false;
+	/// Number of functions optimized in parallel (0 means one per hardware
+	/// thread).
+	std::size_t functionJobs = 1;
+	/// Disable renaming of variables.
+	bool noVarRenaming = false;
+	/// Disable conversion of constants into symbolic names.
+	bool noSymbolicNames = false;
+	/// Keep all brackets in the generated code.
+	bool keepAllBrackets = false;
+	/// Keep functions from standard libraries.
+	bool keepLibraryFunctions = false;
+	/// Do not emit time-varying information, like dates.
+	bool noTimeVaryingInfo = false;
+	/// Do not emit compound operators (like +=).
+	bool noCompoundOperators = false;
+	/// Validate the resulting module before generating the target code.
+	bool validateModule = false;
+	/// Comma-separated pattern finders to be run ('all' to run all of them).
+	std::string findPatterns;
+	/// Name of the used alias analysis.
+	std::string aliasAnalysis = "simple";
+	/// Name of the used generator of variable names.
+	std::string varNameGen = "fruit";
+	/// Prefix for all variable names returned by the generator.
+	std::string varNameGenPrefix;
+	/// Name of the used renamer of variable names.
+	std::string varRenamer = "readable";
+	/// Emit a control-flow graph for each function.
+	bool emitCFGs = false;
+	/// Name of the used CFG writer.
+	std::string cfgWriter = "dot";
+	/// Emit a call graph for the decompiled module.
+	bool emitCG = false;
+	/// Name of the used CG writer.
+	std::string cgWriter = "dot";
+	/// Name of the used obtainer of information about function calls.
+	std::string callInfoObtainer = "optim";
+	/// Name of the used evaluator of arithmetical expressions.
+	std::string arithmExprEvaluator = "c";
+	/// If nonempty, overwrites the module name detected by the front-end.
+	std::string forcedModuleName;
+	/// Force strict FPU semantics to be used.
+	bool strictFPUSemantics = false;
+	/// Limit maximal memory to the given number of bytes (0 means no limit).
+	unsigned long long maxMemoryLimit = 0;
+	/// Limit maximal memory to half of system RAM.
+	bool maxMemoryLimitHalfRAM = false;
+	/// Base name of the output files (CFGs and CGs are emitted next to it).
+	std::string outputFilename;
+};
+
+/**
+* @brief This class is the main chunk of code that converts an LLVM
+*        module to the specified high-level language (HLL).
+*
+* The decompilation is composed of the following steps:
+* 1) The pass is instantiated with the output stream, where the target code
+*    will be emitted, and with the decompilation parameters.
+* 2) The function runOnModule() is called, which decompiles the given
+*    LLVM IR into BIR (backend IR).
+* 3) The resulting IR is then converted into the requested HLL at the end of
+*    runOnModule().
+*
+* When a config is passed to the constructor, it is used instead of loading
+* the config from @c DecompilerParams::configPath. This allows the pass to be
+* run in the same process as the front-end without any intermediate files.
+*/
+class Decompiler: public llvm::ModulePass {
+public:
+	Decompiler(llvm::raw_pwrite_stream &out, const DecompilerParams &params,
+		ShPtr<Config> config = nullptr);
+
+	virtual llvm::StringRef getPassName() const override { return "Decompiler"; }
+	virtual bool runOnModule(llvm::Module &m) override;
+
+public:
+	/// Class identification.
+	static char ID;
+
+private:
+	virtual void getAnalysisUsage(llvm::AnalysisUsage &au) const override;
+
+	bool initialize(llvm::Module &m);
+	bool limitMaximalMemoryIfRequested();
+	void createSemantics();
+	void createSemanticsFromParameter();
+	void createSemanticsFromLLVMIR();
+	bool loadConfig();
+	void saveConfig();
+	bool convertLLVMIRToBIR();
+	void removeLibraryFuncs();
+	void removeCodeUnreachableInCFG();
+	void removeFuncsPrefixedWith(const StringSet &prefixes);
+	void fixSignedUnsignedTypes();
+	void convertLLVMIntrinsicFunctions();
+	void obtainDebugInfo();
+	void initAliasAnalysis();
+	void runOptimizations();
+	void renameVariables();
+	void convertConstantsToSymbolicNames();
+	void validateResultingModule();
+	void findPatterns();
+	void emitCFGs();
+	void emitCG();
+	void emitTargetHLLCode();
+	void finalize();
+	void cleanup();
+
+	StringSet parseListOfOpts(const std::string &opts) const;
+	std::string getTypeOfRunOptimizations() const;
+	StringVector getIdsOfPatternFindersToBeRun() const;
+	PatternFinderRunner::PatternFinders instantiatePatternFinders(
+		const StringVector &pfsIds);
+	ShPtr<PatternFinderRunner> instantiatePatternFinderRunner() const;
+	StringSet getPrefixesOfFuncsToBeRemoved() const;
+
+private:
+	/// Output stream into which the generated code will be emitted.
+	llvm::raw_pwrite_stream &out;
+
+	/// Parameters of the decompilation.
+	DecompilerParams params;
+
+	/// The input LLVM module.
+	llvm::Module *llvmModule;
+
+	/// The resulting module in BIR.
+	ShPtr<Module> resModule;
+
+	/// The used semantics.
+	ShPtr<Semantics> semantics;
+
+	/// The used config.
+	ShPtr<Config> config;
+
+	/// The used HLL writer.
+	ShPtr<HLLWriter> hllWriter;
+
+	/// The used alias analysis.
+	ShPtr<AliasAnalysis> aliasAnalysis;
+
+	/// The used obtainer of information about function and function calls.
+	ShPtr<CallInfoObtainer> cio;
+
+	/// The used evaluator of arithmetical expressions.
+	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
+
+	/// The used generator of variable names.
+	ShPtr<VarNameGen> varNameGen;
+
+	/// The used renamer of variables.
+	ShPtr<VarRenamer> varRenamer;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -0,0 +1,96 @@
+/**
+* @file include/retdec/llvmir2hll/graphs/cfg/cfg_cache.h
+* @brief A cache of control-flow graphs (CFGs) of functions.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_GRAPHS_CFG_CFG_CACHE_H
+#define RETDEC_LLVMIR2HLL_GRAPHS_CFG_CFG_CACHE_H
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class CFG;
+class CFGBuilder;
+class Function;
+class Module;
+class Value;
+
+/**
+* @brief A cache of control-flow graphs (CFGs) of functions.
+*
+* getCFG() returns the same CFG of a function for as long as the function stays
+* unchanged. When the body or the parameters of the function are changed (a
+* statement is added, removed, or moved, an expression in a statement is
+* changed, etc.), a new CFG is built upon the next request.
+*
+* To detect changes, the cache remembers the layout of the function from which
+* the CFG has been built, i.e. its parameters and the statements of its body
+* together with their versions (see Value::getVersion()). Checking the layout
+* is much cheaper than building a new CFG.
+*
+* A CFG obtained from the cache may be shared by several users, so it should
+* be modified only together with the function (see, e.g., the copy propagation
+* optimizer).
+*
+* Instances of this class have reference object semantics.
+*/
+class CFGCache: private retdec::utils::NonCopyable {
+public:
+	ShPtr<CFG> getCFG(ShPtr<Function> func);
+	bool hasCFG(ShPtr<Function> func) const;
+	std::size_t getNumOfCFGs() const;
+	void removeCFG(ShPtr<Function> func);
+	void removeCFGsOfFuncsNotInModule(ShPtr<Module> module);
+	void clear();
+
+	static ShPtr<CFGCache> create(ShPtr<CFGBuilder> cfgBuilder);
+
+private:
+	/// Layout of a function from which its CFG has been built.
+	// Every statement is stored together with its version. Ends of lists of
+	// statements are marked by entries with the null pointer. The values are
+	// stored in strong pointers to prevent their addresses from being reused
+	// by new values.
+	using FuncLayout = std::vector<std::pair<ShPtr<Value>, unsigned>>;
+
+	/**
+	* @brief A cached CFG.
+	*/
+	struct CachedCFG {
+		/// The CFG.
+		ShPtr<CFG> cfg;
+
+		/// Layout of the function from which the CFG has been built.
+		FuncLayout layout;
+	};
+
+	/// Mapping of a function into its cached CFG.
+	using FuncCFGMap = std::map<ShPtr<Function>, CachedCFG>;
+
+private:
+	explicit CFGCache(ShPtr<CFGBuilder> cfgBuilder);
+
+	static FuncLayout getFuncLayout(ShPtr<Function> func);
+	static bool hasFuncLayout(ShPtr<Function> func, const FuncLayout &layout);
+
+private:
+	/// The used builder of CFGs.
+	ShPtr<CFGBuilder> cfgBuilder;
+
+	/// Cached CFGs.
+	FuncCFGMap cachedCFGs;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -38,6 +38,10 @@ public:
 	ShPtr<Expression> getBase() const;
 	ShPtr<Expression> getIndex() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ArrayIndexOpExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -41,6 +41,10 @@ public:
 	Dimensions getDimensions() const;
 	bool hasEmptyDimensions() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ArrayType;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
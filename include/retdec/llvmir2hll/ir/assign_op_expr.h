@@ -34,6 +34,10 @@ public:
 	virtual bool isEqualTo(ShPtr<Value> otherValue) const override;
 	virtual ShPtr<Value> clone() override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::AssignOpExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
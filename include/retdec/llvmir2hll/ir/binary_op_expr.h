@@ -22,6 +22,11 @@ class BinaryOpExpr: public Expression {
 public:
 	virtual ~BinaryOpExpr() = 0;
 
+	static bool classof(const Value *value) {
+		return value->getKind() >= ValueKind::FirstBinaryOpExpr &&
+			value->getKind() <= ValueKind::LastBinaryOpExpr;
+	}
+
 	virtual ShPtr<Type> getType() const override;
 	virtual void replace(ShPtr<Expression> oldExpr,
 		ShPtr<Expression> newExpr) override;
@@ -39,7 +44,8 @@ public:
 	/// @}
 
 protected:
-	BinaryOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2);
+	BinaryOpExpr(ValueKind kind, ShPtr<Expression> op1,
+		ShPtr<Expression> op2);
 
 protected:
 	/// First operand.
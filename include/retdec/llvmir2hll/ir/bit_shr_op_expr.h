@@ -46,6 +46,10 @@ public:
 	bool isLogical() const;
 	bool isArithmetical() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::BitShrOpExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
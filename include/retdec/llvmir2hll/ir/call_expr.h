@@ -54,6 +54,10 @@ public:
 		ShPtr<Value> arg = nullptr) override;
 	/// @}
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::CallExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -44,6 +44,10 @@ public:
 	virtual void update(ShPtr<Value> subject, ShPtr<Value> arg = nullptr) override;
 	/// @}
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::CallStmt;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
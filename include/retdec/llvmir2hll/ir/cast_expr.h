@@ -26,6 +26,11 @@ class CastExpr: public Expression {
 public:
 	virtual ~CastExpr() override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() >= ValueKind::FirstCastExpr &&
+			value->getKind() <= ValueKind::LastCastExpr;
+	}
+
 	virtual ShPtr<Type> getType() const override;
 	virtual void replace(ShPtr<Expression> oldExpr,
 		ShPtr<Expression> newExpr) override;
@@ -40,7 +45,7 @@ public:
 	/// @}
 
 protected:
-	CastExpr(ShPtr<Expression> op, ShPtr<Type> dstType);
+	CastExpr(ValueKind kind, ShPtr<Expression> op, ShPtr<Type> dstType);
 
 protected:
 	/// Operand.
@@ -67,6 +67,10 @@ public:
 		ShPtr<Value> arg = nullptr) override;
 	/// @}
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstArray;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -44,6 +44,10 @@ public:
 	bool isTrue() const;
 	bool isFalse() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstBool;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -60,6 +60,10 @@ public:
 	bool isPositive() const;
 	bool isZero() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstFloat;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -63,6 +63,10 @@ public:
 	bool isOne() const;
 	bool isMoreReadableInHexa() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstInt;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
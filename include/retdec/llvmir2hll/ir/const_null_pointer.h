@@ -36,6 +36,10 @@ public:
 	virtual void replace(ShPtr<Expression> oldExpr,
 		ShPtr<Expression> newExpr) override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstNullPointer;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -56,6 +56,10 @@ public:
 	bool is8BitString() const;
 	bool isWideString() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstString;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -55,6 +55,10 @@ public:
 		ShPtr<Value> arg = nullptr) override;
 	/// @}
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstStruct;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
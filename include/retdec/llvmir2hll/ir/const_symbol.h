@@ -40,6 +40,10 @@ public:
 	const std::string &getName() const;
 	ShPtr<Constant> getValue() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ConstSymbol;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -21,8 +21,13 @@ class Constant: public Expression {
 public:
 	virtual ~Constant() = 0;
 
+	static bool classof(const Value *value) {
+		return value->getKind() >= ValueKind::FirstConstant &&
+			value->getKind() <= ValueKind::LastConstant;
+	}
+
 protected:
-	Constant();
+	explicit Constant(ValueKind kind);
 };
 
 } // namespace llvmir2hll
@@ -44,6 +44,10 @@ public:
 
 	Variant getVariant() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::DivOpExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -32,6 +32,10 @@ public:
 
 	virtual ~EmptyStmt() override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::EmptyStmt;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -24,6 +24,11 @@ class Expression: public Value {
 public:
 	virtual ~Expression() override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() >= ValueKind::FirstExpression &&
+			value->getKind() <= ValueKind::LastExpression;
+	}
+
 	/**
 	* @brief Returns the type of the expression.
 	*
@@ -54,7 +59,7 @@ public:
 		ShPtr<Expression> newExpr);
 
 protected:
-	Expression();
+	explicit Expression(ValueKind kind);
 };
 
 } // namespace llvmir2hll
@@ -42,6 +42,10 @@ public:
 
 	Variant getVariant() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::ExtCastExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -39,6 +39,10 @@ public:
 
 	bool existsFloatType() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::FloatType;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -8,6 +8,7 @@
 #define RETDEC_LLVMIR2HLL_IR_FUNCTION_TYPE_H
 
 #include <cstddef>
+#include <vector>
 
 #include "retdec/llvmir2hll/ir/type.h"
 #include "retdec/llvmir2hll/ir/void_type.h"
@@ -64,6 +65,10 @@ public:
 	bool isVarArg() const;
 	/// @}
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::FunctionType;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -43,6 +43,10 @@ public:
 
 	Variant getVariant() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::GtEqOpExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -78,6 +78,10 @@ public:
 	void removeElseClause();
 	/// @}
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::IfStmt;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -41,6 +41,10 @@ public:
 
 	Variant getVariant() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::IntToFPCastExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
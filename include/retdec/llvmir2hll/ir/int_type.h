@@ -37,6 +37,10 @@ public:
 	bool isUnsigned() const;
 	bool isBool() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::IntType;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
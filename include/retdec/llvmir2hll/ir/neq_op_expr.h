@@ -35,6 +35,10 @@ public:
 	virtual ShPtr<Value> clone() override;
 	virtual ShPtr<Type> getType() const override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::NeqOpExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
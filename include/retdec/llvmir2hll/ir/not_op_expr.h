@@ -34,6 +34,10 @@ public:
 	virtual ShPtr<Value> clone() override;
 	virtual ShPtr<Type> getType() const override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::NotOpExpr;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -34,6 +34,10 @@ public:
 	void setContainedType(ShPtr<Type> newContainedType);
 	ShPtr<Type> getContainedType() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::PointerType;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -44,6 +44,11 @@ public:
 public:
 	virtual ~Statement() override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() >= ValueKind::FirstStatement &&
+			value->getKind() <= ValueKind::LastStatement;
+	}
+
 	/**
 	* @brief Replaces all occurrences of @a oldExpr with @a newExpr in the
 	*        current statement.
@@ -135,7 +140,7 @@ public:
 	static ShPtr<Statement> getLastStatement(ShPtr<Statement> stmts);
 
 protected:
-	Statement();
+	explicit Statement(ValueKind kind);
 
 protected:
 	/// Successor statement.
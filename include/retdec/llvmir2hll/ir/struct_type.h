@@ -44,6 +44,10 @@ public:
 	bool hasName() const;
 	const std::string &getName() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::StructType;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -21,8 +21,13 @@ class Type: public Value {
 public:
 	virtual ~Type() = 0;
 
+	static bool classof(const Value *value) {
+		return value->getKind() >= ValueKind::FirstType &&
+			value->getKind() <= ValueKind::LastType;
+	}
+
 protected:
-	Type();
+	explicit Type(ValueKind kind);
 };
 
 } // namespace llvmir2hll
@@ -22,6 +22,11 @@ class UnaryOpExpr: public Expression {
 public:
 	virtual ~UnaryOpExpr() override = 0;
 
+	static bool classof(const Value *value) {
+		return value->getKind() >= ValueKind::FirstUnaryOpExpr &&
+			value->getKind() <= ValueKind::LastUnaryOpExpr;
+	}
+
 	virtual ShPtr<Type> getType() const override;
 	virtual void replace(ShPtr<Expression> oldExpr,
 		ShPtr<Expression> newExpr) override;
@@ -37,7 +42,7 @@ public:
 	/// @}
 
 protected:
-	explicit UnaryOpExpr(ShPtr<Expression> op);
+	UnaryOpExpr(ValueKind kind, ShPtr<Expression> op);
 
 protected:
 	/// Operand.
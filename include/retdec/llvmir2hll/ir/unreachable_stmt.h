@@ -31,6 +31,10 @@ public:
 	virtual void replace(ShPtr<Expression> oldExpr, ShPtr<Expression> newExpr) override;
 	virtual ShPtr<Expression> asExpression() const override;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::UnreachableStmt;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
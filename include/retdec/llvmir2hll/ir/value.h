@@ -7,6 +7,7 @@
 #ifndef RETDEC_LLVMIR2HLL_IR_VALUE_H
 #define RETDEC_LLVMIR2HLL_IR_VALUE_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <string>
 
@@ -22,10 +23,129 @@
 namespace retdec {
 namespace llvmir2hll {
 
+/**
+* @brief Kinds of values.
+*
+* Every class derived from Value that can be instantiated has its own kind.
+* Kinds of subclasses of an abstract class (e.g. Expression) form a contiguous
+* range, so a check whether a value is an instance of the abstract class is
+* just a comparison of its kind with the bounds of the range (see classof()
+* in the classes derived from Value).
+*/
+enum class ValueKind {
+	// Expressions
+	Variable,
+	CallExpr,
+	TernaryOpExpr,
+	// Expressions: constants
+	ConstArray,
+	ConstBool,
+	ConstFloat,
+	ConstInt,
+	ConstNullPointer,
+	ConstString,
+	ConstStruct,
+	ConstSymbol,
+	// Expressions: binary operators
+	AddOpExpr,
+	AndOpExpr,
+	ArrayIndexOpExpr,
+	AssignOpExpr,
+	BitAndOpExpr,
+	BitOrOpExpr,
+	BitShlOpExpr,
+	BitShrOpExpr,
+	BitXorOpExpr,
+	CommaOpExpr,
+	DivOpExpr,
+	EqOpExpr,
+	GtEqOpExpr,
+	GtOpExpr,
+	LtEqOpExpr,
+	LtOpExpr,
+	ModOpExpr,
+	MulOpExpr,
+	NeqOpExpr,
+	OrOpExpr,
+	StructIndexOpExpr,
+	SubOpExpr,
+	// Expressions: unary operators
+	AddressOpExpr,
+	DerefOpExpr,
+	NegOpExpr,
+	NotOpExpr,
+	// Expressions: casts
+	BitCastExpr,
+	ExtCastExpr,
+	FPToIntCastExpr,
+	IntToFPCastExpr,
+	IntToPtrCastExpr,
+	PtrToIntCastExpr,
+	TruncCastExpr,
+	// Statements
+	AssignStmt,
+	BreakStmt,
+	CallStmt,
+	ContinueStmt,
+	EmptyStmt,
+	ForLoopStmt,
+	GotoStmt,
+	IfStmt,
+	ReturnStmt,
+	SwitchStmt,
+	UForLoopStmt,
+	UnreachableStmt,
+	VarDefStmt,
+	WhileLoopStmt,
+	// Types
+	ArrayType,
+	FloatType,
+	FunctionType,
+	IntType,
+	PointerType,
+	StringType,
+	StructType,
+	UnknownType,
+	VoidType,
+	// Other values
+	Function,
+	GlobalVarDef,
+
+	// Ranges of subclasses of abstract classes
+	FirstExpression = Variable,
+	LastExpression = TruncCastExpr,
+	FirstConstant = ConstArray,
+	LastConstant = ConstSymbol,
+	FirstBinaryOpExpr = AddOpExpr,
+	LastBinaryOpExpr = SubOpExpr,
+	FirstUnaryOpExpr = AddressOpExpr,
+	LastUnaryOpExpr = NotOpExpr,
+	FirstCastExpr = BitCastExpr,
+	LastCastExpr = TruncCastExpr,
+	FirstStatement = AssignStmt,
+	LastStatement = WhileLoopStmt,
+	FirstType = ArrayType,
+	LastType = VoidType
+};
+
 /**
 * @brief A base class of all objects a module can contain.
 *
 * Instances of this class have reference object semantics.
+*
+* Memory for values is obtained from ValueAllocator.
+*
+* Every value has a kind (see ValueKind), which allows cast<>() and isa<>() to
+* check the type of a value without RTTI. To this end, every subclass provides
+* a static member function @c classof(const Value *) returning @c true if the
+* given value is an instance of the subclass.
+*
+* Every value also has a version (see getVersion()), which is changed whenever
+* the parts of the value that analyses compute their results from are changed.
+* For example, a change of an operand of an expression changes the versions of
+* the expression, all the expressions containing it, and the statement in which
+* the expressions appear. This allows analyses to keep their cached results
+* until the analyzed value is changed (see ValueAnalysis).
 */
 class Value: public Visitable, public Metadatable<std::string>,
 		public SharableFromThis<Value>, public Observer<Value>,
@@ -68,8 +188,36 @@ public:
 
 	std::string getTextRepr();
 
+	/**
+	* @brief Returns the kind of the value.
+	*/
+	ValueKind getKind() const {
+		return kind;
+	}
+
+	/**
+	* @brief Returns the version of the value.
+	*
+	* See the class description for more details.
+	*/
+	unsigned getVersion() const {
+		return version;
+	}
+
+	static void *operator new(std::size_t size);
+	static void operator delete(void *ptr, std::size_t size) noexcept;
+
 protected:
-	Value();
+	explicit Value(ValueKind kind);
+
+	void updateVersion();
+
+private:
+	/// Kind of the value.
+	const ValueKind kind;
+
+	/// Version of the value.
+	unsigned version;
 };
 
 /// @name Emission To Streams
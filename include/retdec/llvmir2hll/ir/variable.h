@@ -49,6 +49,10 @@ public:
 	void markAsInternal();
 	void markAsExternal();
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::Variable;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -36,6 +36,10 @@ public:
 
 	std::size_t getSize() const;
 
+	static bool classof(const Value *value) {
+		return value->getKind() == ValueKind::VoidType;
+	}
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
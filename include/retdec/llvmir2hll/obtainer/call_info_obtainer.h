@@ -20,7 +20,7 @@ namespace retdec {
 namespace llvmir2hll {
 
 class CFG;
-class CFGBuilder;
+class CFGCache;
 class CallExpr;
 class Function;
 class Module;
@@ -212,6 +212,9 @@ protected:
 * underlying module is changed in a way that affects the call graph, the init()
 * member function has to be called.
 *
+* After init() returns, getCallInfo(), getFuncInfo(), and getCFGForFunc() may be
+* called from several threads at once (functions may be optimized in parallel).
+*
 * Instances of this class have reference object semantics.
 */
 class CallInfoObtainer: public SharableFromThis<CallInfoObtainer>,
@@ -221,6 +224,7 @@ public:
 
 	ShPtr<CG> getCG() const;
 	ShPtr<CFG> getCFGForFunc(ShPtr<Function> func) const;
+	ShPtr<CFGCache> getCFGCache() const;
 
 	virtual void init(ShPtr<CG> cg, ShPtr<ValueAnalysis> va);
 	virtual bool isInitialized() const;
@@ -321,8 +325,8 @@ protected:
 	/// Mapping of a function into its CFG.
 	FuncCFGMap funcCFGMap;
 
-	/// The used builder of CFGs.
-	ShPtr<CFGBuilder> cfgBuilder;
+	/// Cache of CFGs that is used to obtain CFGs of functions.
+	ShPtr<CFGCache> cfgCache;
 
 private:
 	/**
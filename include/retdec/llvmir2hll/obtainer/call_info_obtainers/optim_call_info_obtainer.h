@@ -9,6 +9,7 @@
 #define RETDEC_LLVMIR2HLL_OBTAINER_CALL_INFO_OBTAINERS_OPTIM_CALL_INFO_OBTAINER_H
 
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "retdec/llvmir2hll/obtainer/call_info_obtainer.h"
@@ -181,6 +182,9 @@ private:
 	/// Mapping of a call into its info.
 	CallInfoMap callInfoMap;
 
+	/// Guards callInfoMap (functions may be optimized in parallel).
+	std::mutex callInfoMapMutex;
+
 	/// Global variables in the module, including functions.
 	VarSet globalVars;
 };
@@ -7,6 +7,8 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_FUNC_OPTIMIZER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_FUNC_OPTIMIZER_H
 
+#include <vector>
+
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 
@@ -39,12 +41,20 @@ class Module;
 * The functions are not optimized in any particular order. Optimizations for a
 * single function should not affect optimizations of other functions.
 *
+* Functions may be optimized in parallel by workers added by addWorker(). A
+* worker is another instance of the same optimizer, and it only gets its
+* runOnFunction() called. Therefore, workers can be added only to optimizers
+* whose runOnFunction() modifies nothing but the optimized function and data
+* owned by the optimizer itself (the used analyses included).
+*
 * Instances of this class have reference object semantics.
 */
 class FuncOptimizer: public Optimizer {
 public:
 	virtual ~FuncOptimizer() override;
 
+	void addWorker(ShPtr<FuncOptimizer> worker);
+
 protected:
 	FuncOptimizer(ShPtr<Module> module);
 
@@ -73,6 +83,13 @@ protected:
 protected:
 	/// Function that is currently being optimized.
 	ShPtr<Function> currFunc;
+
+private:
+	void runOnFunctionsInParallel();
+
+private:
+	/// Other optimizers optimizing functions in parallel with this one.
+	std::vector<ShPtr<FuncOptimizer>> workers;
 };
 
 } // namespace llvmir2hll
@@ -7,6 +7,8 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 
+#include <cstddef>
+
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
@@ -33,7 +35,8 @@ public:
 	OptimizerManager(const StringSet &enabledOpts, const StringSet &disabledOpts,
 		ShPtr<HLLWriter> hllWriter, ShPtr<ValueAnalysis> va,
 		ShPtr<CallInfoObtainer> cio, ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
-		bool enableAggressiveOpts, bool enableDebug = false);
+		bool enableAggressiveOpts, bool enableDebug = false,
+		std::size_t funcJobs = 1);
 	~OptimizerManager();
 
 	void optimize(ShPtr<Module> m);
@@ -46,6 +49,8 @@ private:
 
 	template<typename Optimization, typename... Args>
 	void run(ShPtr<Module> m, Args &&... args);
+	template<typename Optimization, typename... Args>
+	void runInParallel(ShPtr<Module> m, Args &&... args);
 
 private:
 	/// No other optimization than these will be run.
@@ -72,6 +77,9 @@ private:
 	/// Enable emission of debug messages?
 	bool enableDebug;
 
+	/// Number of functions optimized in parallel.
+	std::size_t funcJobs;
+
 	/// Should we recover from out-of-memory errors during optimizations?
 	bool recoverFromOutOfMemory;
 
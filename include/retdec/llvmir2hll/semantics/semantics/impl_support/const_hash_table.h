@@ -0,0 +1,139 @@
+/**
+* @file include/retdec/llvmir2hll/semantics/semantics/impl_support/const_hash_table.h
+* @brief A read-only hash table that is built at compile time.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_CONST_HASH_TABLE_H
+#define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_CONST_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+
+/**
+* @brief Computes the FNV-1a hash of the given null-terminated string.
+*
+* @param[in] str String to be hashed.
+* @param[in] hash Hash of the data preceding @a str.
+*/
+constexpr std::uint32_t hashCString(const char *str,
+		std::uint32_t hash = 2166136261u) {
+	for (; *str != '\0'; ++str) {
+		hash = (hash ^ static_cast<unsigned char>(*str)) * 16777619u;
+	}
+	return hash;
+}
+
+/**
+* @brief Returns @c true if the given null-terminated strings are equal, @c
+*        false otherwise.
+*/
+constexpr bool equalCStrings(const char *str1, const char *str2) {
+	for (; *str1 != '\0' && *str1 == *str2; ++str1, ++str2) {}
+	return *str1 == *str2;
+}
+
+/**
+* @brief An entry mapping a string into another string.
+*/
+struct StringStringEntry {
+	const char *key;
+	const char *value;
+};
+
+constexpr std::uint32_t hashEntryKey(const StringStringEntry &entry) {
+	return hashCString(entry.key);
+}
+
+constexpr bool equalEntryKeys(const StringStringEntry &entry1,
+		const StringStringEntry &entry2) {
+	return equalCStrings(entry1.key, entry2.key);
+}
+
+/**
+* @brief Returns the number of slots of ConstHashTable for the given number of
+*        entries.
+*
+* It is the smallest power of two that keeps the table at most half full.
+*/
+constexpr std::size_t constHashTableSize(std::size_t numOfEntries) {
+	std::size_t size = 1;
+	while (size < 2 * numOfEntries) {
+		size <<= 1;
+	}
+	return size;
+}
+
+/**
+* @brief A read-only hash table of entries that is built at compile time.
+*
+* @tparam Entry Type of the entries. The functions <tt>hashEntryKey(const
+*         Entry &)</tt> and <tt>equalEntryKeys(const Entry &, const Entry
+*         &)</tt> have to be @c constexpr and found by argument-dependent
+*         lookup.
+* @tparam N Number of the entries.
+*
+* Semantics databases are written as arrays of entries. When such an array and
+* the table are both @c constexpr, the table ends up in read-only data, so
+* there is no initialization at run time. The table refers to the entries by
+* their indexes in the array, so the array has to outlive the table. When there
+* are more entries with the same key, the last one is used.
+*
+* The table uses open addressing with linear probing.
+*/
+template<typename Entry, std::size_t N>
+class ConstHashTable {
+public:
+	/**
+	* @brief Builds the table from the given entries.
+	*/
+	constexpr ConstHashTable(const Entry (&entries)[N]):
+			entries(entries), slots() {
+		for (std::size_t i = 0; i < N; ++i) {
+			slots[findSlot(entries[i])] = static_cast<std::uint32_t>(i + 1);
+		}
+	}
+
+	/**
+	* @brief Returns the entry with the same key as @a key, @c nullptr if there
+	*        is no such entry.
+	*/
+	const Entry *find(const Entry &key) const {
+		std::uint32_t index = slots[findSlot(key)];
+		return index != 0 ? &entries[index - 1] : nullptr;
+	}
+
+private:
+	/// Number of slots.
+	static constexpr std::size_t SIZE = constHashTableSize(N);
+
+private:
+	/**
+	* @brief Returns the slot containing the entry with the same key as @a key
+	*        or an empty slot where such an entry belongs.
+	*/
+	constexpr std::size_t findSlot(const Entry &key) const {
+		std::size_t slot = hashEntryKey(key) & (SIZE - 1);
+		while (slots[slot] != 0 && !equalEntryKeys(entries[slots[slot] - 1], key)) {
+			slot = (slot + 1) & (SIZE - 1);
+		}
+		return slot;
+	}
+
+private:
+	/// Entries in the table.
+	const Entry *entries;
+
+	/// Indexes of the entries increased by one (zero marks an empty slot).
+	std::uint32_t slots[SIZE];
+};
+
+} // namespace semantics
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
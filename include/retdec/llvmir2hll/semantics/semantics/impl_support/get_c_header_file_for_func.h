@@ -8,31 +8,24 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_C_HEADER_FILE_FOR_FUNC_H
 
 #include <cstddef>
+#include <string>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/const_hash_table.h"
 #include "retdec/llvmir2hll/support/maybe.h"
-#include "retdec/llvmir2hll/support/types.h"
-#include "retdec/utils/array.h"
-
-/**
-* @brief Maps all the functions from array @a funcs into @a header by adding
-*        them into @a map.
-*
-* @param[in] funcs Statically allocated array of function names
-*                  (<tt>const char *</tt>).
-* @param[in] header The name of the header file (<tt>const char *</tt>).
-* @param[out] map A map into which the mappings will be stored.
-*/
-#define ADD_FUNCS_TO_C_HEADER_MAP(funcs, header, map) \
-	for (std::size_t i = 0, e = retdec::utils::arraySize(funcs); i != e; ++i) { \
-		map[funcs[i]] = header; \
-	}
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-Maybe<std::string> getCHeaderFileForFuncFromMap(const std::string &funcName,
-		const StringStringUMap &map);
+/**
+* @brief Returns the header name for the given function from the given table.
+*/
+template<std::size_t N>
+Maybe<std::string> getCHeaderFileForFuncFromTable(const std::string &funcName,
+		const ConstHashTable<StringStringEntry, N> &table) {
+	auto entry = table.find({funcName.c_str(), nullptr});
+	return entry ? Just(std::string(entry->value)) : Nothing<std::string>();
+}
 
 } // namespace semantics
 } // namespace llvmir2hll
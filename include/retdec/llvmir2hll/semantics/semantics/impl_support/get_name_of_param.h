@@ -8,40 +8,45 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_PARAM_H
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/const_hash_table.h"
 #include "retdec/llvmir2hll/support/maybe.h"
 
-/**
-* @brief Sets a name of the given parameter for the given function.
-*/
-#define ADD_PARAM_NAME(funcName, paramPos, paramName) \
-	funcParamNamesMap[FuncParamPosPair(funcName, paramPos)] = paramName;
-
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-/// A pair of function name and parameter position.
-using FuncParamPosPair = std::pair<std::string, unsigned>;
-
 /**
-* @brief A hashing functor for FuncParamPosPair.
+* @brief A name of the parameter of a function on the given position.
 */
-struct FuncParamPosPairHasher {
-	std::size_t operator()(const FuncParamPosPair &p) const {
-		return std::hash<std::string>()(p.first) + p.second;
-	}
+struct FuncParamName {
+	const char *funcName;
+	unsigned paramPos;
+	const char *paramName;
 };
 
-/// Mapping of a function name and parameter position into the name of this
-/// parameter.
-using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
-	FuncParamPosPairHasher>;
+constexpr std::uint32_t hashEntryKey(const FuncParamName &entry) {
+	return (hashCString(entry.funcName) ^ entry.paramPos) * 16777619u;
+}
 
-Maybe<std::string> getNameOfParamFromMap(const std::string &funcName,
-	unsigned paramPos, const FuncParamNamesMap &map);
+constexpr bool equalEntryKeys(const FuncParamName &entry1,
+		const FuncParamName &entry2) {
+	return entry1.paramPos == entry2.paramPos &&
+		equalCStrings(entry1.funcName, entry2.funcName);
+}
+
+/**
+* @brief Returns the name of the given parameter of the given function from the
+*        given table.
+*/
+template<std::size_t N>
+Maybe<std::string> getNameOfParamFromTable(const std::string &funcName,
+		unsigned paramPos, const ConstHashTable<FuncParamName, N> &table) {
+	auto entry = table.find({funcName.c_str(), paramPos, nullptr});
+	return entry ? Just(std::string(entry->paramName)) : Nothing<std::string>();
+}
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -7,15 +7,27 @@
 #ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_VAR_STORING_RESULT_H
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_VAR_STORING_RESULT_H
 
+#include <cstddef>
+#include <string>
+
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/const_hash_table.h"
 #include "retdec/llvmir2hll/support/maybe.h"
-#include "retdec/llvmir2hll/support/types.h"
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-Maybe<std::string> getNameOfVarStoringResultFromMap(
-	const std::string &funcName, const StringStringUMap &map);
+/**
+* @brief Returns the name of the variable storing the result of the given
+*        function from the given table.
+*/
+template<std::size_t N>
+Maybe<std::string> getNameOfVarStoringResultFromTable(
+		const std::string &funcName,
+		const ConstHashTable<StringStringEntry, N> &table) {
+	auto entry = table.find({funcName.c_str(), nullptr});
+	return entry ? Just(std::string(entry->value)) : Nothing<std::string>();
+}
 
 } // namespace semantics
 } // namespace llvmir2hll
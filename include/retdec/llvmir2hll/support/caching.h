@@ -7,6 +7,7 @@
 #ifndef RETDEC_LLVMIR2HLL_SUPPORT_CACHING_H
 #define RETDEC_LLVMIR2HLL_SUPPORT_CACHING_H
 
+#include <cstddef>
 #include <unordered_map>
 
 namespace retdec {
@@ -89,6 +90,29 @@ public:
 		cache.erase(key);
 	}
 
+	/**
+	* @brief Removes all the cached values satisfying the given predicate.
+	*
+	* @tparam Predicate Binary predicate taking a <tt>const CachedKey &</tt>
+	*                   and a <tt>const CachedValue &</tt>.
+	*
+	* The keys of the removed values are removed as well. Returns the number of
+	* removed values.
+	*/
+	template<typename Predicate>
+	std::size_t removeFromCacheIf(Predicate pred) {
+		std::size_t numOfRemovedValues = 0;
+		for (auto i = cache.begin(); i != cache.end(); ) {
+			if (pred(i->first, i->second)) {
+				i = cache.erase(i);
+				++numOfRemovedValues;
+			} else {
+				++i;
+			}
+		}
+		return numOfRemovedValues;
+	}
+
 	/**
 	* @brief Returns @c true if caching is enabled, @c false otherwise.
 	*/
@@ -7,6 +7,9 @@
 #ifndef RETDEC_LLVMIR2HLL_SUPPORT_METADATABLE_H
 #define RETDEC_LLVMIR2HLL_SUPPORT_METADATABLE_H
 
+#include <memory>
+#include <utility>
+
 namespace retdec {
 namespace llvmir2hll {
 
@@ -14,6 +17,9 @@ namespace llvmir2hll {
 * @brief A mixin providing metadata attached to objects.
 *
 * @tparam T Type of metadata.
+*
+* Most objects have no metadata, so the metadata are stored outside of the
+* object, which is then smaller.
 */
 template<typename T>
 class Metadatable {
@@ -29,21 +35,21 @@ public:
 	* @param[in] data Metadata to be attached.
 	*/
 	void setMetadata(T data) {
-		this->data = data;
+		this->data = std::make_unique<T>(std::move(data));
 	}
 
 	/**
 	* @brief Returns the attached metadata.
 	*/
 	T getMetadata() const {
-		return data;
+		return data ? *data : T();
 	}
 
 	/**
 	* @brief Are there any non-empty metadata?
 	*/
 	bool hasMetadata() const {
-		return !data.empty();
+		return data && !data->empty();
 	}
 
 protected:
@@ -53,8 +59,8 @@ protected:
 	Metadatable(): data() {}
 
 private:
-	/// Attached metadata.
-	T data;
+	/// Attached metadata (@c nullptr if there are none).
+	std::unique_ptr<T> data;
 };
 
 } // namespace llvmir2hll
@@ -9,6 +9,8 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace retdec {
 namespace llvmir2hll {
@@ -48,6 +50,69 @@ protected:
 	using std::enable_shared_from_this<ForClass>::shared_from_this;
 };
 
+/**
+* @brief Checks whether @c To provides a static member function @c classof()
+*        that can be used to check if an instance of @c From is an instance of
+*        @c To.
+*
+* This is the case for all classes derived from Value (see ValueKind).
+*/
+template<typename To, typename From, typename = void>
+struct HasClassof: std::false_type {};
+
+template<typename To, typename From>
+struct HasClassof<To, From, decltype(static_cast<void>(
+	To::classof(std::declval<const From *>())))>: std::true_type {};
+
+/**
+* @brief Implementation of cast<>() and isa<>() for raw pointers.
+*
+* @tparam To Output type.
+* @tparam From Input type.
+* @tparam UseClassof Use @c To::classof() instead of @c dynamic_cast<>?
+*/
+template<typename To, typename From,
+	bool UseClassof = HasClassof<To, From>::value>
+struct Caster {
+	static bool isa(const From *ptr) noexcept {
+		return ptr && To::classof(ptr);
+	}
+
+	static To *cast(From *ptr) noexcept {
+		return isa(ptr) ? static_cast<To *>(ptr) : nullptr;
+	}
+};
+
+template<typename To, typename From>
+struct Caster<To, From, false> {
+	static bool isa(const From *ptr) noexcept {
+		return dynamic_cast<const To *>(ptr) != nullptr;
+	}
+
+	static To *cast(From *ptr) noexcept {
+		return dynamic_cast<To *>(ptr);
+	}
+};
+
+/**
+* @brief Equivalent of dynamic_cast<> for raw pointers.
+*
+* @param[in] ptr Pointer to be casted.
+*
+* @tparam To Output type.
+* @tparam From Input type.
+*
+* When @c To provides @c classof() (see HasClassof), the check is just a
+* comparison of kinds instead of a traversal of the class hierarchy.
+*
+* The returned pointer does not own the object, so no reference counts are
+* touched. Use this variant when the result is needed only temporarily.
+*/
+template<typename To, typename From>
+To *cast(From *ptr) noexcept {
+	return Caster<To, From>::cast(ptr);
+}
+
 /**
 * @brief Equivalent of dynamic_cast<> for shared pointers.
 *
@@ -58,10 +123,13 @@ protected:
 *
 * The purpose of this function is to provide a more concise notation. Indeed,
 * @c cast<X>(ptr) is more concise than @c std::dynamic_pointer_cast<X>(ptr).
+*
+* The returned pointer shares the ownership with @a ptr.
 */
 template<typename To, typename From>
 ShPtr<To> cast(const ShPtr<From> &ptr) noexcept {
-	return std::dynamic_pointer_cast<To>(ptr);
+	To *castedPtr = cast<To>(ptr.get());
+	return castedPtr ? ShPtr<To>(ptr, castedPtr) : ShPtr<To>();
 }
 
 /**
@@ -105,8 +173,19 @@ ShPtr<To> ucast(const ShPtr<From> &ptr) noexcept {
 * @endcode
 */
 template<typename To, typename From>
+bool isa(const From *ptr) noexcept {
+	return Caster<To, From>::isa(ptr);
+}
+
+/**
+* @brief Returns @c true if @a ptr is of type @c To or can be casted from @c
+*        From to @c To, @c false otherwise.
+*
+* Unlike cast<>(), no reference counts are touched.
+*/
+template<typename To, typename From>
 bool isa(const ShPtr<From> &ptr) noexcept {
-	return cast<To>(ptr) != nullptr;
+	return isa<To>(ptr.get());
 }
 
 /**
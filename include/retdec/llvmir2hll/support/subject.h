@@ -8,7 +8,11 @@
 #define RETDEC_LLVMIR2HLL_SUPPORT_SUBJECT_H
 
 #include <algorithm>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <llvm/ADT/SmallVector.h>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 
@@ -37,6 +41,11 @@ namespace llvmir2hll {
 * };
 * @endcode
 *
+* Subjects may be shared by functions that are optimized in parallel (e.g.
+* global variables), so addObserver(), removeObserver(), removeObservers(), and
+* notifyObservers() may be called from several threads at once. Observers are
+* notified without holding any lock.
+*
 * @see Observer
 */
 template<typename SubjectType, typename ArgType = SubjectType>
@@ -89,6 +98,7 @@ public:
 	* @param[in] observer Observer to be added.
 	*/
 	void addObserver(ObserverPtr observer) {
+		std::lock_guard<std::mutex> lock(getObserversMutex());
 		observers.push_back(observer);
 	}
 
@@ -105,6 +115,7 @@ public:
 	* @brief Removes all observers.
 	*/
 	void removeObservers() {
+		std::lock_guard<std::mutex> lock(getObserversMutex());
 		observers.clear();
 	}
 
@@ -125,7 +136,7 @@ public:
 	void notifyObservers(ShPtr<ArgType> arg = nullptr) {
 		// We have to iterate over a copy of the container because it can be
 		// modified during the iteration (either by us or in an update() call).
-		for (const auto &observer : ObserverContainer(observers)) {
+		for (const auto &observer : getObservers()) {
 			notifyObserverOrRemoveItIfNotExists(observer, arg);
 		}
 	}
@@ -133,8 +144,10 @@ public:
 protected:
 	/// A container to store observers.
 	// Note that the used container has to preserve the order in which
-	// observers are added to it.
-	using ObserverContainer = std::vector<ObserverPtr>;
+	// observers are added to it. Most subjects have a single observer (e.g.
+	// the statement containing an expression), which is stored without any
+	// additional allocation.
+	using ObserverContainer = llvm::SmallVector<ObserverPtr, 1>;
 
 	// Observer iterator.
 	using observer_iterator = typename ObserverContainer::const_iterator;
@@ -142,6 +155,9 @@ protected:
 protected:
 	/**
 	* @brief Returns a constant iterator to the first observer.
+	*
+	* The iteration is not guarded, so use it only for subjects that are not
+	* shared by several functions (e.g. statements).
 	*/
 	observer_iterator observer_begin() const {
 		return observers.begin();
@@ -154,7 +170,33 @@ protected:
 		return observers.end();
 	}
 
+	/**
+	* @brief Returns a copy of the list of observers.
+	*
+	* Unlike observer_begin() and observer_end(), it is guarded.
+	*/
+	ObserverContainer getObservers() const {
+		std::lock_guard<std::mutex> lock(getObserversMutex());
+		return observers;
+	}
+
+private:
+	/// Number of mutexes guarding lists of observers.
+	static constexpr std::size_t NUM_OF_OBSERVERS_MUTEXES = 64;
+
 private:
+	/**
+	* @brief Returns the mutex guarding the list of observers.
+	*
+	* Every subject having its own mutex would make values considerably
+	* larger, so subjects share a fixed number of mutexes chosen by their
+	* addresses.
+	*/
+	std::mutex &getObserversMutex() const {
+		static std::mutex mutexes[NUM_OF_OBSERVERS_MUTEXES];
+		auto address = reinterpret_cast<std::uintptr_t>(this);
+		return mutexes[(address >> 4) % NUM_OF_OBSERVERS_MUTEXES];
+	}
 
 	/**
 	* @brief Notifies the given observer (if it exists) or removes it (if it
@@ -189,11 +231,16 @@ private:
 	* @brief Removes the given observer and all the non-existing observers.
 	*/
 	void removeObserverAndNonExistingObservers(ObserverPtr observer) {
+		// Observers are compared by their owners instead of by locking them.
+		// Otherwise, we might end up destroying the last reference to an
+		// observer while holding the lock.
+		std::lock_guard<std::mutex> lock(getObserversMutex());
 		observers.erase(std::remove_if(observers.begin(), observers.end(),
 			[&observer](const auto &other) {
-				return other.expired() || observer.lock() == other.lock();
+				return other.expired() || (!observer.owner_before(other) &&
+					!other.owner_before(observer));
 			}
-		));
+		), observers.end());
 	}
 
 private:
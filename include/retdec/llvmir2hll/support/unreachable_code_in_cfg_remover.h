@@ -15,7 +15,7 @@ namespace retdec {
 namespace llvmir2hll {
 
 class CFG;
-class CFGBuilder;
+class CFGCache;
 class Module;
 
 /**
@@ -32,10 +32,12 @@ public:
 	// It needs to be public so it can be called in ShPtr's destructor.
 	virtual ~UnreachableCodeInCFGRemover() override;
 
-	static void removeCode(ShPtr<Module> module);
+	static void removeCode(ShPtr<Module> module,
+		ShPtr<CFGCache> cfgCache = nullptr);
 
 private:
-	UnreachableCodeInCFGRemover(ShPtr<Module> module);
+	UnreachableCodeInCFGRemover(ShPtr<Module> module,
+		ShPtr<CFGCache> cfgCache);
 
 	void performRemoval();
 	void performRemovalInFunc(ShPtr<Function> func);
@@ -54,8 +56,8 @@ private:
 	/// The CFG of the current function.
 	ShPtr<CFG> cfg;
 
-	/// The used builder of CFGs.
-	ShPtr<CFGBuilder> cfgBuilder;
+	/// The used cache of CFGs.
+	ShPtr<CFGCache> cfgCache;
 };
 
 } // namespace llvmir2hll
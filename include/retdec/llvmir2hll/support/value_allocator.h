@@ -0,0 +1,52 @@
+/**
+* @file include/retdec/llvmir2hll/support/value_allocator.h
+* @brief A pooling allocator of memory for values.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SUPPORT_VALUE_ALLOCATOR_H
+#define RETDEC_LLVMIR2HLL_SUPPORT_VALUE_ALLOCATOR_H
+
+#include <cstddef>
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief A pooling allocator of memory for values.
+*
+* Modules consist of a huge number of small values (expressions, statements,
+* types, etc.) that are created and destroyed all the time by optimizers. The
+* general-purpose allocator is not suitable for that, so values are allocated
+* by this allocator (see Value::operator new()).
+*
+* Memory is obtained in large slabs, which are split into blocks of a fixed
+* size. Every block size has its own list of free blocks. Freed blocks are
+* reused for new values. Slabs all of whose blocks are free are returned only
+* by releaseUnusedMemory(), which is called when a module is destroyed. Each
+* thread has its own lists of free blocks, so no locking is needed except when
+* a thread finishes and its free blocks are handed over to other threads.
+* A block may be freed by a different thread than the one that allocated it.
+*
+* Requests for blocks larger than getMaxPooledSize() are passed to the global
+* operator new.
+*
+* This class is not meant to be instantiated.
+*/
+class ValueAllocator {
+public:
+	static void *allocate(std::size_t size);
+	static void deallocate(void *ptr, std::size_t size) noexcept;
+	static void releaseUnusedMemory() noexcept;
+
+	static std::size_t getNumOfSlabs();
+
+	static std::size_t getMaxPooledSize();
+
+	ValueAllocator() = delete;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -7,7 +7,10 @@
 #ifndef RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 #define RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 
+#include <atomic>
+#include <climits>
 #include <memory>
+#include <mutex>
 
 #include "retdec/utils/byte_value_storage.h"
 #include "retdec/fileformat/fftypes.h"
@@ -45,6 +48,12 @@ public:
 	virtual bool setXByte(std::uint64_t address, std::uint64_t x, std::uint64_t val, retdec::utils::Endianness e = retdec::utils::Endianness::UNKNOWN) override;
 	virtual bool setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& res) override;
 
+	using retdec::utils::ByteValueStorage::getWord;
+	template <std::size_t N, retdec::utils::Endianness E = retdec::utils::Endianness::UNKNOWN>
+	bool getWord(std::uint64_t address, std::uint64_t& res) const;
+	template <std::size_t N, retdec::utils::Endianness E = retdec::utils::Endianness::UNKNOWN>
+	bool getWords(std::uint64_t address, std::uint64_t* res, std::size_t count) const;
+
 	retdec::fileformat::FileFormat* getFileFormat();
 	const retdec::fileformat::FileFormat* getFileFormat() const;
 	std::weak_ptr<retdec::fileformat::FileFormat> getFileFormatWptr() const;
@@ -81,10 +90,29 @@ protected:
 	void removeSegment(Segment* segment);
 	void nameSegment(Segment* segment);
 	void sortSegments();
+	void invalidateSegmentIndex();
 
 	void setStatusMessage(const std::string& message);
 
 private:
+	/**
+	 * Continuous address range which belongs to a single segment.
+	 */
+	struct SegmentIndexEntry
+	{
+		std::uint64_t start;
+		std::uint64_t end;
+		const Segment* segment;
+	};
+
+	void buildSegmentIndex() const;
+
+	template <std::size_t N, retdec::utils::Endianness E>
+	static std::uint64_t decodeWord(const std::uint8_t* data);
+	template <retdec::utils::Endianness E>
+	bool getXByteImpl(std::uint64_t address, std::uint64_t x, std::uint64_t& res) const;
+	const std::uint8_t* getDataOnAddress(std::uint64_t address, std::uint64_t size, std::uint8_t* buffer) const;
+
 	const Segment* _getSegment(std::size_t index) const;
 	const Segment* _getSegment(const std::string& name) const;
 	const Segment* _getSegmentWithIndex(std::size_t index) const;
@@ -95,8 +123,106 @@ private:
 	std::uint64_t _baseAddress;
 	NameGenerator _namelessSegNameGen;
 	std::string _statusMessage;
+
+	/// Sorted non-overlapping address ranges of segments (built lazily).
+	mutable std::vector<SegmentIndexEntry> _segmentIndex;
+	mutable std::atomic<bool> _segmentIndexValid;
+	mutable std::mutex _segmentIndexMutex;
+	/// Index of the last entry found in @c _segmentIndex.
+	mutable std::atomic<std::size_t> _lastSegmentIndexHit;
 };
 
+/**
+ * Get @a N bytes long integer located at provided address without any dynamic allocation.
+ * Bytes are assumed to be 8 bits long.
+ *
+ * @tparam N Number of bytes of the integer (1 to 8).
+ * @tparam E Endian - if specified it is used, otherwise file's endian is used.
+ *
+ * @param address Address to get integer from.
+ * @param res Result integer.
+ *
+ * @return Status of operation (@c true if all is OK, @c false otherwise).
+ */
+template <std::size_t N, retdec::utils::Endianness E>
+bool Image::getWord(std::uint64_t address, std::uint64_t& res) const
+{
+	static_assert(N >= 1 && N <= sizeof(std::uint64_t), "unsupported size of word");
+
+	if (E == retdec::utils::Endianness::UNKNOWN)
+	{
+		if (isLittleEndian())
+			return getWord<N, retdec::utils::Endianness::LITTLE>(address, res);
+		else if (isBigEndian())
+			return getWord<N, retdec::utils::Endianness::BIG>(address, res);
+		else
+			return false;
+	}
+
+	std::uint8_t buffer[N];
+	const auto* data = getDataOnAddress(address, N, buffer);
+	if (!data)
+		return false;
+
+	res = decodeWord<N, E>(data);
+	return true;
+}
+
+/**
+ * Get @a count consecutive @a N bytes long integers located at provided address without any dynamic allocation.
+ *
+ * @tparam N Number of bytes of each integer (1 to 8).
+ * @tparam E Endian - if specified it is used, otherwise file's endian is used.
+ *
+ * @param address Address of the first integer.
+ * @param res Array of at least @a count integers where the result is stored.
+ * @param count Number of integers to get.
+ *
+ * @return Status of operation (@c true if all integers were read, @c false otherwise).
+ */
+template <std::size_t N, retdec::utils::Endianness E>
+bool Image::getWords(std::uint64_t address, std::uint64_t* res, std::size_t count) const
+{
+	static_assert(N >= 1 && N <= sizeof(std::uint64_t), "unsupported size of word");
+
+	if (E == retdec::utils::Endianness::UNKNOWN)
+	{
+		if (isLittleEndian())
+			return getWords<N, retdec::utils::Endianness::LITTLE>(address, res, count);
+		else if (isBigEndian())
+			return getWords<N, retdec::utils::Endianness::BIG>(address, res, count);
+		else
+			return false;
+	}
+
+	// Fast path -- all the words are in the physical data of a single segment.
+	if (const auto* data = getDataOnAddress(address, N * count, nullptr))
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			res[i] = decodeWord<N, E>(data + i * N);
+
+		return true;
+	}
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		if (!getWord<N, E>(address + i * N, res[i]))
+			return false;
+	}
+
+	return true;
+}
+
+template <std::size_t N, retdec::utils::Endianness E>
+std::uint64_t Image::decodeWord(const std::uint8_t* data)
+{
+	std::uint64_t value = 0;
+	for (std::size_t i = 0; i < N; ++i)
+		value |= static_cast<std::uint64_t>(data[i]) << (CHAR_BIT * (E == retdec::utils::Endianness::LITTLE ? i : N - i - 1));
+
+	return value;
+}
+
 } // namespace loader
 } // namespace retdec
 
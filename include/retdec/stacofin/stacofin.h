@@ -124,6 +124,9 @@ class Finder
 		void search(
 				const retdec::loader::Image& image,
 				const std::set<std::string>& yaraFiles);
+		void search(
+				const retdec::loader::Image& image,
+				const std::vector<std::string>& yaraFiles);
 		void search(
 				const retdec::loader::Image& image,
 				const retdec::config::Config& config);
@@ -132,8 +135,15 @@ class Finder
 				const retdec::config::Config& config);
 		/// @}
 
+		/// @name Setters.
+		/// @{
+		void setYaraCacheDirectory(const std::string& dir);
+		void setJobs(std::size_t jobs);
+		/// @}
+
 		/// @name Getters.
 		/// @{
+		std::size_t getJobs() const;
 		CoveredCode getCoveredCode();
 		const DetectedFunctionsMultimap& getAllDetections() const;
 		const DetectedFunctionsPtrMap& getConfirmedDetections() const;
@@ -163,6 +173,9 @@ class Finder
 
 	private:
 		bool initDisassembler();
+		void addDetections(
+				const retdec::fileformat::FileFormat& fileFormat,
+				const std::vector<DetectedFunction>& detections);
 		void solveReferences();
 
 		utils::Address getAddressFromRef(utils::Address ref);
@@ -189,6 +202,11 @@ class Finder
 
 		std::map<utils::Address, std::string> _imports;
 		std::set<std::string> _sectionNames;
+
+		/// Directory with compiled signatures (empty means no caching).
+		std::string _yaraCacheDirectory;
+		/// Number of signature files scanned concurrently.
+		std::size_t _jobs = 1;
 };
 
 } // namespace stacofin
@@ -39,6 +39,9 @@ public:
 	BitParserN(const BitParser&) = delete;
 	virtual ~BitParserN() override {}
 
+	T getValue() const { return _value; }
+	void setValue(T value) { _value = value; }
+
 protected:
 	T _value;
 
@@ -55,18 +58,23 @@ public:
 
 	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
 	{
-		bit = (_value >> 7) & 1;
-		_value <<= 1;
-		if ((_value & 0xFF) == 0)
+		return parseBit(bit, _value, data.getRawBuffer(), data.getRealDataSize(), pos);
+	}
+
+	static bool parseBit(uint8_t& bit, uint32_t& value, const uint8_t* data, uint32_t size, uint32_t& pos)
+	{
+		bit = (value >> 7) & 1;
+		value <<= 1;
+		if ((value & 0xFF) == 0)
 		{
-			if (pos >= data.getRealDataSize())
+			if (pos >= size)
 				return false;
 
-			_value = data.read<uint8_t>(pos++, retdec::utils::Endianness::LITTLE);
+			value = data[pos++];
 
-			bit = (_value >> 7) & 1;
-			_value <<= 1;
-			_value += 1;
+			bit = (value >> 7) & 1;
+			value <<= 1;
+			value += 1;
 		}
 
 		return true;
@@ -82,19 +90,34 @@ public:
 
 	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
 	{
-		bit = (_value >> 31) & 1;
-		_value <<= 1;
-		if (_value == 0)
+		return parseBit(bit, _value, data.getRawBuffer(), data.getRealDataSize(), pos);
+	}
+
+	static bool parseBit(uint8_t& bit, uint32_t& value, const uint8_t* data, uint32_t size, uint32_t& pos)
+	{
+		bit = (value >> 31) & 1;
+		value <<= 1;
+		if (value == 0)
 		{
-			if (pos >= data.getRealDataSize())
+			if (pos >= size)
 				return false;
 
-			_value = data.read<uint32_t>(pos, retdec::utils::Endianness::LITTLE);
+			if (size - pos >= 4)
+			{
+				value = static_cast<uint32_t>(data[pos]) | (static_cast<uint32_t>(data[pos + 1]) << 8)
+					| (static_cast<uint32_t>(data[pos + 2]) << 16) | (static_cast<uint32_t>(data[pos + 3]) << 24);
+			}
+			else
+			{
+				// Missing bytes at the end of data are read as 0
+				for (uint32_t i = 0; i < size - pos; ++i)
+					value |= static_cast<uint32_t>(data[pos + i]) << (i << 3);
+			}
 			pos += 4;
 
-			bit = (_value >> 31) & 1;
-			_value <<= 1;
-			_value += 1;
+			bit = (value >> 31) & 1;
+			value <<= 1;
+			value += 1;
 		}
 
 		return true;
@@ -29,6 +29,8 @@ public:
 
 private:
 	Nrv2eData& operator =(const Nrv2eData&);
+
+	template <typename BitReaderT> bool decompressImpl(BitReaderT& bits, uint8_t* output, uint32_t outputSize);
 };
 
 } // namespace unpacker
@@ -7,12 +7,59 @@
 #ifndef RETDEC_UNPACKER_DECOMPRESSION_NRV_NRV_DATA_H
 #define RETDEC_UNPACKER_DECOMPRESSION_NRV_NRV_DATA_H
 
+#include <algorithm>
+#include <cstring>
+
 #include "retdec/unpacker/decompression/compressed_data.h"
 #include "retdec/unpacker/decompression/nrv/bit_parsers.h"
 
 namespace retdec {
 namespace unpacker {
 
+/**
+ * Reader of the bits from the compressed data using the bit parser of known type. The state of the bit parser
+ * is kept in local variable and the bits are parsed without any virtual calls. The state is given back
+ * to the bit parser when the reader is destroyed.
+ *
+ * @tparam BitParserT Type of the bit parser providing static parseBit().
+ */
+template <typename BitParserT> class NrvBitReader
+{
+public:
+	NrvBitReader(BitParserT* bitParser, const DynamicBuffer& data) : _bitParser(bitParser), _value(bitParser->getValue()),
+		_data(data.getRawBuffer()), _size(data.getRealDataSize()) {}
+	NrvBitReader(const NrvBitReader&) = delete;
+	~NrvBitReader() { _bitParser->setValue(_value); }
+
+	bool getBit(uint8_t& bit, uint32_t& pos) { return BitParserT::parseBit(bit, _value, _data, _size, pos); }
+
+private:
+	NrvBitReader& operator =(const NrvBitReader&);
+
+	BitParserT* _bitParser;
+	uint32_t _value;
+	const uint8_t* _data;
+	uint32_t _size;
+};
+
+/**
+ * Reader of the bits from the compressed data using the bit parser of unknown type.
+ */
+template <> class NrvBitReader<BitParser>
+{
+public:
+	NrvBitReader(BitParser* bitParser, const DynamicBuffer& data) : _bitParser(bitParser), _data(data) {}
+	NrvBitReader(const NrvBitReader&) = delete;
+
+	bool getBit(uint8_t& bit, uint32_t& pos) { return _bitParser->getBit(bit, _data, pos); }
+
+private:
+	NrvBitReader& operator =(const NrvBitReader&);
+
+	BitParser* _bitParser;
+	const DynamicBuffer& _data;
+};
+
 class NrvData : public CompressedData
 {
 public:
@@ -29,6 +76,93 @@ public:
 	}
 
 protected:
+	/**
+	 * Runs the decompression algorithm with the bit reader matching the bit parser. The output buffer is extended
+	 * to its capacity and the data are decompressed directly into its raw memory. The output buffer is shrunk back
+	 * to the decompressed bytes at the end (but never below its original size), even if the decompression fails.
+	 *
+	 * @tparam DecompressT Generic callable taking the bit reader, the raw output and its size.
+	 *
+	 * @param outputBuffer The buffer in which the data is decompressed.
+	 * @param decompressImpl Decompression algorithm.
+	 *
+	 * @return True if the decompression ended up successfully, otherwise false.
+	 */
+	template <typename DecompressT> bool decompressWith(DynamicBuffer& outputBuffer, DecompressT decompressImpl)
+	{
+		uint32_t originalSize = outputBuffer.getRealDataSize();
+		uint32_t outputSize = outputBuffer.getCapacity();
+		if (originalSize < outputSize)
+			outputBuffer.setRealDataSize(outputSize);
+
+		uint8_t* output = outputBuffer.getRawBuffer();
+		bool result;
+		if (auto bitParser = dynamic_cast<BitParser8*>(_bitParser))
+		{
+			NrvBitReader<BitParser8> bits(bitParser, _buffer);
+			result = decompressImpl(bits, output, outputSize);
+		}
+		else if (auto bitParser = dynamic_cast<BitParserLe32*>(_bitParser))
+		{
+			NrvBitReader<BitParserLe32> bits(bitParser, _buffer);
+			result = decompressImpl(bits, output, outputSize);
+		}
+		else
+		{
+			NrvBitReader<BitParser> bits(_bitParser, _buffer);
+			result = decompressImpl(bits, output, outputSize);
+		}
+
+		if (originalSize < outputSize)
+			outputBuffer.setRealDataSize(std::max(originalSize, _writePos));
+		return result;
+	}
+
+	/**
+	 * Copies the match from already decompressed data. Bytes outside of the output are read as 0.
+	 *
+	 * @param output Raw output.
+	 * @param outputSize Size of the raw output.
+	 * @param dist Distance of the match from the current write position.
+	 * @param count Number of bytes to copy.
+	 *
+	 * @return True if the match fits into the output, otherwise false.
+	 */
+	bool copyMatch(uint8_t* output, uint32_t outputSize, int32_t dist, int32_t count)
+	{
+		uint32_t amount = static_cast<uint32_t>(count);
+		if (dist > 0 && static_cast<uint32_t>(dist) <= _writePos && amount != 0 && amount <= outputSize - _writePos)
+		{
+			uint8_t* dest = output + _writePos;
+			const uint8_t* src = dest - dist;
+			if (static_cast<uint32_t>(dist) >= amount)
+				std::memcpy(dest, src, amount);
+			else
+			{
+				// Overlapping match repeats the last dist bytes
+				for (uint32_t i = 0; i < amount; ++i)
+					dest[i] = src[i];
+			}
+
+			_writePos += amount;
+			return true;
+		}
+
+		uint32_t srcPos = _writePos - dist;
+		do
+		{
+			if (_writePos >= outputSize)
+				return false;
+
+			output[_writePos] = srcPos < outputSize ? output[srcPos] : 0;
+			srcPos++;
+			_writePos++;
+		}
+		while (--count);
+
+		return true;
+	}
+
 	uint32_t _readPos, _writePos;
 	BitParser* _bitParser;
 
@@ -55,6 +55,8 @@ namespace unpacker {
  */
 class Signature
 {
+	friend class SignatureAutomaton;
+
 public:
 	/**
 	 * Class that represents the settings for matching a signature. The settings contains the offset of where to
@@ -0,0 +1,84 @@
+/**
+ * @file include/retdec/unpacker/signature_automaton.h
+ * @brief Declaration of class for matching many signatures at once.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UNPACKER_SIGNATURE_AUTOMATON_H
+#define RETDEC_UNPACKER_SIGNATURE_AUTOMATON_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "retdec/unpacker/signature.h"
+#include "retdec/utils/dynamic_buffer.h"
+
+namespace retdec {
+namespace unpacker {
+
+/**
+ * Class for matching a set of signatures in one pass over the data.
+ *
+ * Every signature is represented in the automaton by its anchor, which is the run of exact bytes
+ * (capped at @ref MAX_ANCHOR_SIZE bytes) that is the longest in the signature. Anchors of all signatures are
+ * compiled into an Aho-Corasick automaton. The data are scanned only once and every occurence of an anchor is
+ * verified with the whole signature including its wildcard and capture bytes.
+ *
+ * Results are the same as if the signatures were matched one after another using Signature::match() in the order
+ * in which they were added. The first added signature that matches wins and if it is searched, the nearest occurence
+ * is taken.
+ *
+ * Signatures are only referenced, so they have to outlive the automaton.
+ */
+class SignatureAutomaton
+{
+public:
+	static const uint64_t MAX_ANCHOR_SIZE = 8; ///< Maximum size of anchor in bytes.
+
+	SignatureAutomaton();
+	~SignatureAutomaton();
+
+	void addSignature(const Signature* signature, uint64_t searchDistance = 0);
+	void build();
+
+	uint64_t getNumberOfSignatures() const;
+	uint64_t getMatchedAreaSize() const;
+
+	int64_t match(const std::vector<uint8_t>& bytesToMatch, uint64_t offset, retdec::utils::DynamicBuffer* capturedData = nullptr) const;
+
+private:
+	/**
+	 * Signature in the automaton.
+	 */
+	struct Entry
+	{
+		const Signature* signature; ///< Matched signature.
+		uint64_t searchDistance; ///< Maximum searching distance. No searching if this is set 0.
+		uint64_t anchorOffset; ///< Offset of the anchor in the signature.
+		uint64_t anchorSize; ///< Size of the anchor. Signatures without exact bytes have no anchor.
+	};
+
+	/**
+	 * Node of the automaton.
+	 */
+	struct Node
+	{
+		std::array<uint32_t, 256> next; ///< Transitions (goto function extended with failure transitions after build()).
+		std::vector<uint64_t> entries; ///< Entries whose anchors end in this node or in any of its suffixes.
+	};
+
+	bool isExact(const Signature::Byte& byte) const;
+	bool matchesOnOffset(const Entry& entry, const std::vector<uint8_t>& bytesToMatch, uint64_t offset) const;
+
+	std::vector<Entry> _entries; ///< All signatures in order of priority.
+	std::vector<Node> _nodes; ///< Nodes of the automaton, the root is the first one.
+	std::vector<uint64_t> _unanchored; ///< Entries without anchor.
+	uint64_t _matchedAreaSize; ///< Maximum number of bytes from offset any signature may span.
+	bool _built; ///< Whether the failure transitions are computed.
+};
+
+} // namespace unpacker
+} // namespace retdec
+
+#endif
@@ -47,11 +47,13 @@ public:
 	retdec::utils::Endianness getEndianness() const;
 
 	uint32_t getRealDataSize() const;
+	void setRealDataSize(uint32_t size);
 
 	void erase(uint32_t startPos, uint32_t amount);
 
 	const uint8_t* getRawBuffer() const;
-	std::vector<uint8_t> getBuffer() const;
+	uint8_t* getRawBuffer();
+	const std::vector<uint8_t>& getBuffer() const;
 
 	void forEach(const std::function<void(uint8_t&)>& func);
 	void forEachReverse(const std::function<void(uint8_t&)>& func);
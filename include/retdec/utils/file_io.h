@@ -61,6 +61,30 @@ template <typename N> bool readBytes(std::istream& fileStream, std::vector<N>& r
 	return true;
 }
 
+/**
+ * Get the number of bytes between the current position and the end of
+ * @a fileStream. Returns @c 0 if the stream is not seekable.
+ */
+inline std::size_t getRemainingSize(std::istream& fileStream)
+{
+	const auto pos = fileStream.tellg();
+	if (pos < 0)
+		return 0;
+
+	fileStream.seekg(0, std::ios::end);
+	const auto end = fileStream.tellg();
+	fileStream.clear();
+	fileStream.seekg(pos);
+	if (end < pos || !fileStream.good())
+	{
+		fileStream.clear();
+		fileStream.seekg(pos);
+		return 0;
+	}
+
+	return static_cast<std::size_t>(end - pos);
+}
+
 template <typename N> bool writeBytes(std::ostream& fileStream, const std::vector<N>& data, std::size_t desiredSize)
 {
 	// We can write directly to the file without any conversions.
@@ -102,9 +126,18 @@ template <typename N> bool readFile(std::istream& fileStream, std::vector<N>& re
 	if (!fileStream.good())
 		return false;
 
-	const bool untilEof = !desiredSize;
+	bool untilEof = !desiredSize;
 	if (untilEof)
-		desiredSize = FILE_BURST_READ_LENGTH;
+	{
+		// Read the whole rest of a seekable stream at once. Reading it in
+		// bursts would grow the result geometrically and temporarily need
+		// up to twice as much memory as the file itself.
+		desiredSize = getRemainingSize(fileStream);
+		if (desiredSize)
+			untilEof = false;
+		else
+			desiredSize = FILE_BURST_READ_LENGTH;
+	}
 
 	result.clear();
 	std::size_t alreadyRead = 0;
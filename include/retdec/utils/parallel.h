@@ -0,0 +1,24 @@
+/**
+* @file include/retdec/utils/parallel.h
+* @brief Running independent work items on several threads.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_PARALLEL_H
+#define RETDEC_UTILS_PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+
+namespace retdec {
+namespace utils {
+
+std::size_t getHardwareJobs();
+
+void runInParallel(std::size_t count, std::size_t jobs,
+	const std::function<void(std::size_t)> &work);
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -0,0 +1,52 @@
+/**
+ * @file include/retdec/yara-cache/yara_rule_cache.h
+ * @brief Persistent cache of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_YARA_CACHE_YARA_RULE_CACHE_H
+#define RETDEC_YARA_CACHE_YARA_RULE_CACHE_H
+
+#include <string>
+
+namespace retdec {
+namespace yara_cache {
+
+/**
+ * Persistent cache of compiled YARA rules.
+ *
+ * Every text rule file (.yar, .yara) is compiled into a .yarac file inside
+ * the cache directory, so it can be reused by all the following runs (in
+ * the same or other processes) until the rule file changes. Rules that are
+ * already compiled are used directly.
+ *
+ * The name of a compiled file contains the hash of the rule file contents
+ * and the YARA version, so its contents never change once it exists. A key
+ * file per rule file (named after its absolute path) stores the modification
+ * time, size and hash of the rule file, so an unchanged rule file does not
+ * have to be read. Both files are written into temporary files that are then
+ * renamed, so processes sharing the cache directory never pair a key with
+ * rules compiled from other contents. Rules compiled from previous contents
+ * of a rule file are not removed, as other processes may still use them.
+ *
+ * The cache never fails hard: whenever a rule file cannot be cached (e.g.
+ * the cache directory does not exist or the rule file contains errors),
+ * the original rule file is returned and the caller compiles it as before.
+ */
+class YaraRuleCache
+{
+	public:
+		YaraRuleCache(const std::string& cacheDirectory);
+
+		std::string getRuleFile(const std::string& ruleFile) const;
+		const std::string& getCacheDirectory() const;
+
+	private:
+		/// Directory with the compiled rules (empty means no caching).
+		std::string _cacheDirectory;
+};
+
+} // namespace yara_cache
+} // namespace retdec
+
+#endif
@@ -289,6 +289,12 @@ def parse_args(args):
                         default=[],
                         help='Adds additional signature file for static code detection.')
 
+    parser.add_argument('--yara-cache',
+                        dest='yara_cache',
+                        metavar='DIR',
+                        help='Keeps compiled YARA rules in the given existing directory '
+                             'and reuses them in the following decompilations.')
+
     parser.add_argument('--static-code-archive',
                         dest='static_code_archive',
                         action='append',
@@ -397,6 +403,10 @@ class Decompiler:
                 utils.print_error('Invalid YARA file \'%s\'' % sigfile)
                 return False
 
+        if self.args.yara_cache and not os.path.isdir(self.args.yara_cache):
+            utils.print_error('Invalid YARA cache directory \'%s\'' % self.args.yara_cache)
+            return False
+
         if self.args.selected_ranges:
             self.selected_ranges = self.args.selected_ranges.strip().split(',')
             self.args.keep_unreachable_funcs = True
@@ -784,6 +794,9 @@ class Decompiler:
                 for par in config.FILEINFO_EXTERNAL_YARA_EXTRA_CRYPTO_DATABASES:
                     fileinfo_params.extend(['--crypto', par])
 
+            if self.args.yara_cache:
+                fileinfo_params.extend(['--yara-cache', self.args.yara_cache])
+
             if self.args.max_memory:
                 fileinfo_params.extend(['--max-memory', self.args.max_memory])
             elif not self.args.no_memory_limit:
@@ -856,6 +869,9 @@ class Decompiler:
                     for ed in config.FILEINFO_EXTERNAL_YARA_EXTRA_CRYPTO_DATABASES:
                         fileinfo_params.extend(['--crypto', ed])
 
+                if self.args.yara_cache:
+                    fileinfo_params.extend(['--yara-cache', self.args.yara_cache])
+
                 if self.args.max_memory:
                     fileinfo_params.extend(['--max-memory', self.args.max_memory])
                 elif not self.args.no_memory_limit:
@@ -1026,6 +1042,10 @@ class Decompiler:
             for i in self.args.static_code_sigfile:
                 CmdRunner.run_cmd([config.CONFIGTOOL, self.config_file, '--write', '--user-signature', i])
 
+            # Directory with compiled signatures shared between decompilations.
+            if self.args.yara_cache:
+                CmdRunner.run_cmd([config.CONFIGTOOL, self.config_file, '--write', '--yara-cache', self.args.yara_cache])
+
             # Store paths of type files into config.
             if os.path.isdir(config.GENERIC_TYPES_DIR):
                 CmdRunner.run_cmd([config.CONFIGTOOL, self.config_file, '--write', '--types', config.GENERIC_TYPES_DIR])
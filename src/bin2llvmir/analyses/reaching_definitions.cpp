@@ -4,6 +4,7 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <set>
@@ -11,6 +12,7 @@
 #include <string>
 #include <vector>
 
+#include <llvm/ADT/Hashing.h>
 #include <llvm/ADT/PostOrderIterator.h>
 #include <llvm/Analysis/OrderedBasicBlock.h>
 #include <llvm/IR/CFG.h>
@@ -22,6 +24,7 @@
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #define debug_enabled false
 #include "retdec/bin2llvmir/utils/llvm.h"
 
@@ -44,11 +47,19 @@ bool ReachingDefinitionsAnalysis::runOnModule(
 {
 	_trackFlagRegs = trackFlagRegs;
 	_abi = abi;
+	_module = &M;
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(&M);
 
 	clear();
-	initializeBasicBlocks(M);
-	run();
+
+	std::vector<Function*> fncs;
+	for (Function& F : M)
+	{
+		fncs.push_back(&F);
+	}
+	analyzeFunctions(fncs);
+
+	LOG << *this << "\n";
 
 	_run = true;
 	return false;
@@ -61,37 +72,166 @@ bool ReachingDefinitionsAnalysis::runOnFunction(
 {
 	_trackFlagRegs = trackFlagRegs;
 	_abi = abi;
+	_module = F.getParent();
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(F.getParent());
 
 	clear();
-	initializeBasicBlocks(F);
-	run();
+	analyzeFunctions({&F});
+
+	LOG << *this << "\n";
 
 	_run = true;
 	return false;
 }
 
-void ReachingDefinitionsAnalysis::run()
+/**
+ * Update the analysis after module @a M was changed. Only functions that
+ * were reported by invalidateFunction(), or whose instructions or control
+ * flow changed since they were analyzed, are recomputed. If the analysis was
+ * not run on @a M with the same parameters yet, the whole module is analyzed.
+ * @return @c True if at least one function was (re)analyzed.
+ */
+bool ReachingDefinitionsAnalysis::update(
+		llvm::Module& M,
+		Abi* abi,
+		bool trackFlagRegs)
 {
-	initializeBasicBlocksPrev();
-	initializeKillGenSets();
-	propagate();
-	initializeDefsAndUses();
+	if (!_run
+			|| _module != &M
+			|| _abi != abi
+			|| _trackFlagRegs != trackFlagRegs
+			|| _specialGlobal != AsmInstruction::getLlvmToAsmGlobalVariable(&M))
+	{
+		runOnModule(M, abi, trackFlagRegs);
+		return true;
+	}
 
-	LOG << *this << "\n";
+	// Entries are created beforehand, so that workers only read the map.
+	//
+	std::vector<Function*> fncs;
+	std::map<const Function*, std::size_t> hashes;
+	for (Function& F : M)
+	{
+		fncs.push_back(&F);
+		hashes[&F] = 0;
+	}
+	runOnFunctions(fncs, _jobs, [this, &hashes](Function* F)
+	{
+		hashes.find(F)->second = getFunctionHash(*F);
+	});
 
-	clearInternal();
+	std::vector<Function*> changedFncs;
+	for (auto* F : fncs)
+	{
+		auto hIt = _fncHashes.find(F);
+		if (hIt == _fncHashes.end()
+				|| hIt->second != hashes[F]
+				|| _invalidFncs.count(F))
+		{
+			changedFncs.push_back(F);
+		}
+	}
+	_invalidFncs.clear();
+
+	// Functions removed from the module.
+	//
+	for (auto it = bbMap.begin(); it != bbMap.end();)
+	{
+		it = hashes.count(it->first) ? std::next(it) : bbMap.erase(it);
+	}
+	for (auto it = _fncHashes.begin(); it != _fncHashes.end();)
+	{
+		it = hashes.count(it->first) ? std::next(it) : _fncHashes.erase(it);
+	}
+
+	analyzeFunctions(changedFncs);
+
+	return !changedFncs.empty();
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
+/**
+ * Report that function @a F was changed, so that it is recomputed by the
+ * next update().
+ */
+void ReachingDefinitionsAnalysis::invalidateFunction(const llvm::Function* F)
 {
-	for (Function& F : M)
+	_invalidFncs.insert(F);
+}
+
+/**
+ * Set the number of threads used to analyze functions (@c 1 by default).
+ * The analysis of a function only reads the module, so functions can be
+ * analyzed concurrently.
+ */
+void ReachingDefinitionsAnalysis::setJobs(std::size_t jobs)
+{
+	_jobs = jobs;
+}
+
+/**
+ * (Re)analyze functions @a fncs, possibly on several threads.
+ */
+void ReachingDefinitionsAnalysis::analyzeFunctions(
+		const std::vector<llvm::Function*>& fncs)
+{
+	// Entries are created beforehand, so that workers only read the maps.
+	//
+	for (auto* F : fncs)
 	{
-		initializeBasicBlocks(F);
+		bbMap[F].clear();
+		_fncHashes[F] = 0;
 	}
+
+	runOnFunctions(fncs, _jobs, [this](Function* F)
+	{
+		auto& bbs = bbMap.find(F)->second;
+		initializeBasicBlocks(*F, bbs);
+		run(F, bbs);
+		_fncHashes.find(F)->second = getFunctionHash(*F);
+	});
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
+void ReachingDefinitionsAnalysis::run(const llvm::Function* F, BBEntryMap& bbs)
+{
+	if (bbs.empty())
+	{
+		return;
+	}
+
+	DefIndex index;
+	initializeBasicBlocksPrev(bbs);
+	initializeKillGenSets(bbs, index);
+	propagate(F, bbs, index);
+	initializeDefsAndUses(bbs, index);
+	clearInternal(bbs);
+}
+
+/**
+ * Get a hash of everything the analysis of function @a F depends on: its
+ * basic blocks and instructions (identities, order, and operands).
+ */
+std::size_t ReachingDefinitionsAnalysis::getFunctionHash(
+		const llvm::Function& F) const
+{
+	llvm::hash_code hash = llvm::hash_value(&F);
+	for (const BasicBlock& B : F)
+	{
+		hash = llvm::hash_combine(hash, &B);
+		for (const Instruction& I : B)
+		{
+			hash = llvm::hash_combine(hash, &I, I.getOpcode());
+			for (const llvm::Use& op : I.operands())
+			{
+				hash = llvm::hash_combine(hash, op.get());
+			}
+		}
+	}
+	return hash;
+}
+
+void ReachingDefinitionsAnalysis::initializeBasicBlocks(
+		llvm::Function& F,
+		BBEntryMap& bbs)
 {
 	for (BasicBlock& B : F)
 	{
@@ -168,13 +308,15 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
 			}
 		}
 
-		bbMap[&F][&B] = bbe;
+		bbs[&B] = bbe;
 	}
 }
 
 void ReachingDefinitionsAnalysis::clear()
 {
 	bbMap.clear();
+	_fncHashes.clear();
+	_invalidFncs.clear();
 	_run = false;
 }
 
@@ -187,10 +329,9 @@ bool ReachingDefinitionsAnalysis::wasRun() const
  * Clear internal structures used to compute RDA, but not needed to use it once
  * it is computed.
  */
-void ReachingDefinitionsAnalysis::clearInternal()
+void ReachingDefinitionsAnalysis::clearInternal(BBEntryMap& bbs)
 {
-	for (auto& pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry& bb = pair.second;
 		bb.defsOut.clear();
@@ -199,10 +340,9 @@ void ReachingDefinitionsAnalysis::clearInternal()
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
+void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev(BBEntryMap& bbs)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		auto B = pair.first;
 		auto &entry = pair.second;
@@ -210,63 +350,103 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
 		for (auto PI = pred_begin(B), E = pred_end(B); PI != E; ++PI)
 		{
 			auto* pred = *PI;
-			auto p = pair1.second.find(pred);
+			auto p = bbs.find(pred);
 
-			assert(p != pair1.second.end() && "we should have all BBs stored in bbMap");
+			assert(p != bbs.end() && "we should have all BBs stored in bbMap");
 
 			entry.prevBBs.insert( &p->second );
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeKillGenSets()
+/**
+ * Number all the definitions in the function and compute the GEN and KILL
+ * sets of its basic blocks.
+ */
+void ReachingDefinitionsAnalysis::initializeKillGenSets(
+		BBEntryMap& bbs,
+		DefIndex& index)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
+	for (Definition& d : pair.second.defs)
+	{
+		d.id = index.defs.size();
+		index.defs.push_back(&d);
+	}
+
+	for (auto* d : index.defs)
+	{
+		auto& srcDefs = index.src2defs[d->getSource()];
+		if (srcDefs.size() != index.defs.size())
+		{
+			srcDefs.resize(index.defs.size());
+		}
+		srcDefs.set(d->id);
+	}
+
+	for (auto& pair : bbs)
 	{
-		pair.second.initializeKillDefSets();
+		pair.second.initializeKillDefSets(index.defs.size());
 	}
 }
 
-void ReachingDefinitionsAnalysis::propagate()
+void ReachingDefinitionsAnalysis::propagate(
+		const llvm::Function* fnc,
+		BBEntryMap& bbs,
+		const DefIndex& index)
 {
-	for (auto &pair1 : bbMap)
+	// Blocks unreachable from the entry are never processed -- nothing
+	// reaches out of them.
+	//
+	std::deque<BasicBlockEntry*> workList;
+	ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
+	for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
 	{
-		const Function* fnc = pair1.first;
+		const BasicBlock* bb = *I;
+		auto fIt = bbs.find(bb);
+		assert(fIt != bbs.end());
+		workList.push_back(&(fIt->second));
 
-		std::vector<BasicBlockEntry*> workList;
-		workList.reserve(pair1.second.size());
-		ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
-		for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
-		{
-			const BasicBlock* bb = *I;
-			auto fIt = pair1.second.find(bb);
-			assert(fIt != pair1.second.end());
-			workList.push_back(&(fIt->second));
+		fIt->second.queued = true;
+	}
 
-			fIt->second.changed = true;
-		}
+	llvm::BitVector tmp(index.defs.size());
+	while (!workList.empty())
+	{
+		auto* bbe = workList.front();
+		workList.pop_front();
+		bbe->queued = false;
 
-		bool changed = true;
-		while (changed)
+		if (!bbe->initDefsOut(index.src2defs, tmp))
 		{
-			changed = false;
+			continue;
+		}
 
-			for (auto* bbe : workList)
+		for (auto* succ : successors(bbe->bb))
+		{
+			auto fIt = bbs.find(succ);
+			assert(fIt != bbs.end());
+			if (!fIt->second.queued)
 			{
-				changed |= bbe->initDefsOut();
+				fIt->second.queued = true;
+				workList.push_back(&(fIt->second));
 			}
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeDefsAndUses()
+void ReachingDefinitionsAnalysis::initializeDefsAndUses(
+		BBEntryMap& bbs,
+		const DefIndex& index)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	llvm::BitVector defsIn;
+	llvm::BitVector reaching;
+
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry &bb = pair.second;
 		OrderedBasicBlock obb(bb.bb);
+		bool defsInComputed = false;
 
 		for (Use &u : bb.uses)
 		{
@@ -289,14 +469,26 @@ void ReachingDefinitionsAnalysis::initializeDefsAndUses()
 
 			if (u.defs.empty())
 			{
-				for (auto p : bb.prevBBs)
-				for (auto d : p->defsOut)
+				auto srcIt = index.src2defs.find(u.src);
+				if (srcIt == index.src2defs.end())
 				{
-					if (d->getSource() == u.src)
-					{
-						d->uses.insert(&u);
-						u.defs.insert(d);
-					}
+					continue;
+				}
+
+				if (!defsInComputed)
+				{
+					bb.getDefsIn(defsIn);
+					defsInComputed = true;
+				}
+
+				reaching = defsIn;
+				reaching &= srcIt->second;
+				for (int i = reaching.find_first(); i != -1;
+						i = reaching.find_next(i))
+				{
+					Definition* d = index.defs[i];
+					d->uses.insert(&u);
+					u.defs.insert(d);
 				}
 			}
 		}
@@ -353,7 +545,7 @@ std::ostream& operator<<(std::ostream& out, const ReachingDefinitionsAnalysis& r
 //=============================================================================
 //
 
-int BasicBlockEntry::newUID = 0;
+std::atomic<int> BasicBlockEntry::newUID(0);
 
 BasicBlockEntry::BasicBlockEntry(const llvm::BasicBlock* b) :
 	bb(b),
@@ -362,52 +554,72 @@ BasicBlockEntry::BasicBlockEntry(const llvm::BasicBlock* b) :
 
 }
 
-void BasicBlockEntry::initializeKillDefSets()
+/**
+ * GEN[B] = the last definition of each value defined in B
+ * KILL[B] = all the definitions of values defined in B
+ *
+ * @param defCount Number of definitions in the function.
+ */
+void BasicBlockEntry::initializeKillDefSets(std::size_t defCount)
 {
 	killDefs.clear();
 	genDefs.clear();
+	genDefs.resize(defCount);
+	defsOut.clear();
+	defsOut.resize(defCount);
 
+	llvm::SmallPtrSet<const llvm::Value*, 16> defined;
 	for (auto dIt = defs.rbegin(); dIt != defs.rend(); ++dIt)
 	{
 		Definition& d = *dIt;
 
-		bool added = (killDefs.insert(d.getSource())).second;
-		if (added)
+		if (defined.insert(d.getSource()).second)
 		{
-			genDefs.insert(&d);
+			killDefs.push_back(d.getSource());
+			genDefs.set(d.id);
 		}
 	}
 }
 
 /**
  * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
- * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
  */
-Changed BasicBlockEntry::initDefsOut()
+void BasicBlockEntry::getDefsIn(llvm::BitVector& defsIn) const
 {
-	auto oldSz = defsOut.size();
+	defsIn.clear();
+	defsIn.resize(defsOut.size());
+	for (auto* p : prevBBs)
+	{
+		defsIn |= p->defsOut;
+	}
+}
 
-	if (defsOut.empty() && !genDefs.empty())
+/**
+ * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
+ *
+ * @param src2defs Mapping of defined values to all their definitions.
+ * @param tmp Scratch vector, so that it does not need to be allocated for
+ *        each block.
+ * @return @c True if REACH_out[B] changed.
+ */
+Changed BasicBlockEntry::initDefsOut(
+		const std::unordered_map<const llvm::Value*, llvm::BitVector>& src2defs,
+		llvm::BitVector& tmp)
+{
+	getDefsIn(tmp);
+	for (auto* v : killDefs)
 	{
-		defsOut = std::move(genDefs);
+		tmp.reset(src2defs.find(v)->second);
 	}
+	tmp |= genDefs;
 
-	for (auto* p : prevBBs)
+	if (tmp == defsOut)
 	{
-		if (p->changed)
-		{
-			for (auto* d : p->defsOut)
-			{
-				if (killDefs.find(d->getSource()) == killDefs.end())
-				{
-					defsOut.insert(d);
-				}
-			}
-		}
+		return false;
 	}
 
-	changed = oldSz != defsOut.size();
-	return changed;
+	std::swap(defsOut, tmp);
+	return true;
 }
 
 std::string BasicBlockEntry::getName() const
@@ -737,5 +949,53 @@ std::set<llvm::Instruction*> ReachingDefinitionsAnalysis::usesFromDef_onDemand(
 	return ret;
 }
 
+//
+//=============================================================================
+//  ReachingDefinitionsProvider
+//=============================================================================
+//
+
+std::map<ReachingDefinitionsProvider::Key, ReachingDefinitionsAnalysis>
+		ReachingDefinitionsProvider::_module2rda;
+
+/**
+ * Get the reaching definitions analysis of module @a m that is up to date with
+ * the current state of the module.
+ * @param m Module to get the analysis for.
+ * @param abi ABI of the module.
+ * @param trackFlagRegs Track also flag registers.
+ */
+ReachingDefinitionsAnalysis* ReachingDefinitionsProvider::getRda(
+		llvm::Module* m,
+		Abi* abi,
+		bool trackFlagRegs)
+{
+	auto& rda = _module2rda[Key(m, trackFlagRegs)];
+	rda.setJobs(getFunctionJobs(m));
+	rda.update(*m, abi, trackFlagRegs);
+	return &rda;
+}
+
+/**
+ * Report that function @a f was changed, so that it is recomputed in all the
+ * shared analyses of its module.
+ */
+void ReachingDefinitionsProvider::invalidateFunction(llvm::Function* f)
+{
+	for (bool trackFlagRegs : {false, true})
+	{
+		auto fIt = _module2rda.find(Key(f->getParent(), trackFlagRegs));
+		if (fIt != _module2rda.end())
+		{
+			fIt->second.invalidateFunction(f);
+		}
+	}
+}
+
+void ReachingDefinitionsProvider::clear()
+{
+	_module2rda.clear();
+}
+
 } // namespace bin2llvmir
 } // namespace retdec
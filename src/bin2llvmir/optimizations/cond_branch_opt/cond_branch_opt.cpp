@@ -63,19 +63,27 @@ bool CondBranchOpt::run()
 
 	bool changed = false;
 
-	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi, true);
+	auto* RDA = ReachingDefinitionsProvider::getRda(_module, _abi, true);
 
 	SymbolicTree::setTrackThroughAllocaLoads(false);
 	SymbolicTree::setTrackOnlyFlagRegisters(true);
 
 	for (Function& f : *_module)
-	for (auto it = inst_begin(&f), eIt = inst_end(&f); it != eIt;)
 	{
-		Instruction& insn = *it;
-		++it;
+		bool fncChanged = false;
+		for (auto it = inst_begin(&f), eIt = inst_end(&f); it != eIt;)
+		{
+			Instruction& insn = *it;
+			++it;
+
+			fncChanged |= runOnInstruction(*RDA, insn);
+		}
 
-		changed |= runOnInstruction(RDA, insn);
+		if (fncChanged)
+		{
+			ReachingDefinitionsProvider::invalidateFunction(&f);
+			changed = true;
+		}
 	}
 
 	SymbolicTree::setToDefaultConfiguration();
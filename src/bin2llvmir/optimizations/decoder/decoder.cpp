@@ -41,10 +41,7 @@ Decoder::Decoder() :
 
 Decoder::~Decoder()
 {
-	if (_dryCsInsn)
-	{
-		cs_free(_dryCsInsn, 1);
-	}
+
 }
 
 bool Decoder::runOnModule(Module& m)
@@ -105,7 +102,6 @@ bool Decoder::run()
 	}
 
 	initTranslator();
-	initDryRunCsInstruction();
 	initEnvironment();
 	initRanges();
 	initJumpTargets();
@@ -320,7 +316,9 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 		}
 		_somethingDecoded = true;
 
-		_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
+		res.capstoneInsn = _llvm2capstone->emplace(
+				res.llvmInsn,
+				res.capstoneInsn);
 
 		bbEnd |= getJumpTargetsFromInstruction(oldAddr, res, bytes.second);
 		bbEnd |= instructionBreaksBasicBlock(oldAddr, res);
@@ -338,7 +336,16 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne
 Decoder::translate(ByteData& bytes, utils::Address& addr, llvm::IRBuilder<>& irb)
 {
-	auto res = _c2l->translateOne(bytes.first, bytes.second, addr, irb);
+	capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne res;
+	if (auto* insn = takeDryRunInsn(bytes, addr))
+	{
+		res = _c2l->translateOne(insn, irb);
+		addr += res.size;
+	}
+	else
+	{
+		res = _c2l->translateOne(bytes.first, bytes.second, addr, irb);
+	}
 
 	// MIPS 64-bit mode can decompile more instructions than the 32-bit mode.
 	// When 32-bit mode is used, some 32-bit instructions that IDA handles fail
@@ -356,9 +363,56 @@ Decoder::translate(ByteData& bytes, utils::Address& addr, llvm::IRBuilder<>& irb
 		_c2l->modifyBasicMode(CS_MODE_MIPS32);
 	}
 
+	if (res.llvmInsn)
+	{
+		AsmInstruction::addLlvmToAsmInstruction(res.llvmInsn);
+	}
+
 	return res;
 }
 
+/**
+ * Disassemble one instruction in a dry run. The instruction is kept until the
+ * next dry run, so that it can be translated without disassembling it again.
+ * @param ce    Capstone engine.
+ * @param bytes Bytes to disassemble. Updated to point to the next instruction.
+ * @param a     Address of @p bytes. Updated to the address of the next
+ *              instruction.
+ * @return Disassembled instruction, or @c nullptr if disassembly failed.
+ *         It is owned by the decoder.
+ */
+cs_insn* Decoder::disasmDryRun(csh ce, ByteData& bytes, uint64_t& a)
+{
+	Address addr = a;
+	cs_mode mode = _c2l->getBasicMode();
+	cs_insn* insn = _dryRunInsns.getScratch(ce);
+
+	bool ok = _config->getConfig().architecture.isMipsOrPic32()
+			? disasm_mips(ce, mode, bytes, a, insn)
+			: cs_disasm_iter(ce, &bytes.first, &bytes.second, &a, insn);
+	return ok ? _dryRunInsns.keepScratch(addr, mode) : nullptr;
+}
+
+/**
+ * Take the instruction disassembled by the last dry run on the given address
+ * in the current mode, if there is such an instruction.
+ * @param bytes Bytes on @p addr. Updated to point to the next instruction
+ *              if an instruction is returned.
+ * @param addr  Address of the instruction.
+ * @return Instruction, which is no longer owned by the decoder, or
+ *         @c nullptr.
+ */
+cs_insn* Decoder::takeDryRunInsn(ByteData& bytes, utils::Address addr)
+{
+	auto* insn = _dryRunInsns.take(addr, _c2l->getBasicMode(), bytes.second);
+	if (insn)
+	{
+		bytes.first += insn->size;
+		bytes.second -= insn->size;
+	}
+	return insn;
+}
+
 /**
  * Check if the given jump targets and bytes can/should be decoded.
  * \return The number of bytes to skip from decoding. If zero, then dry run was
@@ -370,6 +424,8 @@ std::size_t Decoder::decodeJumpTargetDryRun(
 		ByteData bytes,
 		bool strict)
 {
+	_dryRunInsns.clear();
+
 	// Architecture-specific dry runs.
 	//
 	if (_config->getConfig().architecture.isX86())
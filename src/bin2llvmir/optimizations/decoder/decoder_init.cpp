@@ -77,15 +77,8 @@ void Decoder::initTranslator()
 			_module,
 			basicMode,
 			extraMode);
-}
 
-/**
- * Initialize instruction used in dry run disassembly.
- */
-void Decoder::initDryRunCsInstruction()
-{
-	csh ce = _c2l->getCapstoneEngine();
-	_dryCsInsn = cs_malloc(ce);
+	_llvm2capstone->setArchitecture(arch);
 }
 
 /**
@@ -0,0 +1,122 @@
+/**
+* @file src/bin2llvmir/optimizations/decoder/dry_run_insn_cache.cpp
+* @brief Instructions disassembled by decoder's dry runs.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cassert>
+
+#include "retdec/bin2llvmir/optimizations/decoder/dry_run_insn_cache.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace bin2llvmir {
+
+DryRunInsnCache::~DryRunInsnCache()
+{
+	clear();
+	for (auto* insn : _free)
+	{
+		cs_free(insn, 1);
+	}
+	if (_scratch)
+	{
+		cs_free(_scratch, 1);
+	}
+}
+
+/**
+ * Get the instruction into which the next instruction should be
+ * disassembled. An instruction dropped by clear() is reused if there is
+ * any, otherwise a new one is allocated.
+ * @param ce Capstone engine used to allocate a new instruction.
+ * @return Instruction owned by the cache.
+ */
+cs_insn* DryRunInsnCache::getScratch(csh ce)
+{
+	if (_scratch == nullptr)
+	{
+		if (_free.empty())
+		{
+			_scratch = cs_malloc(ce);
+		}
+		else
+		{
+			_scratch = _free.back();
+			_free.pop_back();
+		}
+	}
+
+	return _scratch;
+}
+
+/**
+ * Keep the instruction disassembled into the instruction from getScratch().
+ * An instruction that was kept on the same address in the same mode before
+ * is used as the next scratch instruction.
+ * @param a Address of the instruction.
+ * @param m Basic mode in which the instruction was disassembled.
+ * @return The kept instruction, which is owned by the cache.
+ */
+cs_insn* DryRunInsnCache::keepScratch(utils::Address a, cs_mode m)
+{
+	assert(_scratch && "getScratch() must be called first");
+
+	auto& insn = _insns[std::make_pair(a, m)];
+	std::swap(insn, _scratch);
+	return insn;
+}
+
+/**
+ * Take the instruction kept on the given address in the given mode, if
+ * there is such an instruction and it is not longer than @p maxSize.
+ * @return Instruction, which is no longer owned by the cache (it must be
+ *         freed by @c cs_free()), or @c nullptr.
+ */
+cs_insn* DryRunInsnCache::take(
+		utils::Address a,
+		cs_mode m,
+		std::size_t maxSize)
+{
+	auto it = _insns.find(std::make_pair(a, m));
+	if (it == _insns.end() || it->second->size > maxSize)
+	{
+		return nullptr;
+	}
+
+	auto* insn = it->second;
+	_insns.erase(it);
+	return insn;
+}
+
+/**
+ * Drop all the kept instructions. They are reused by getScratch().
+ */
+void DryRunInsnCache::clear()
+{
+	for (auto& p : _insns)
+	{
+		_free.push_back(p.second);
+	}
+	_insns.clear();
+}
+
+/**
+ * Get the number of kept instructions.
+ */
+std::size_t DryRunInsnCache::size() const
+{
+	return _insns.size();
+}
+
+/**
+ * Get the number of dropped instructions waiting to be reused.
+ */
+std::size_t DryRunInsnCache::freeSize() const
+{
+	return _free.size();
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
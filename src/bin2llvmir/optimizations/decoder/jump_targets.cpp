@@ -187,7 +187,7 @@ const JumpTarget* JumpTargets::push(
 		retdec::utils::Address f,
 		utils::Maybe<std::size_t> sz)
 {
-	static auto& arch = config->getConfig().architecture;
+	auto& arch = config->getConfig().architecture;
 
 	if (a.isDefined())
 	{
@@ -75,22 +75,22 @@ std::size_t Decoder::decodeJumpTargetDryRun_mips(
 		return true;
 	}
 
-	static csh ce = _c2l->getCapstoneEngine();
+	csh ce = _c2l->getCapstoneEngine();
 
 	uint64_t addr = jt.getAddress();
 	std::size_t nops = 0;
 	bool first = true;
 	unsigned counter = 0;
 	unsigned cfChangePos = 0;
-	while (disasm_mips(ce, _c2l->getBasicMode(), bytes, addr, _dryCsInsn))
+	while (cs_insn* insn = disasmDryRun(ce, bytes, addr))
 	{
 		++counter;
 
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& _abi->isNopInstruction(insn))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn->size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
@@ -98,20 +98,20 @@ std::size_t Decoder::decodeJumpTargetDryRun_mips(
 			return nops;
 		}
 
-		if (_c2l->isReturnInstruction(*_dryCsInsn))
+		if (_c2l->isReturnInstruction(*insn))
 		{
 			return false;
 		}
-		if (_c2l->isBranchInstruction(*_dryCsInsn)
-				&& !isBadBranch(_image, _dryCsInsn))
+		if (_c2l->isBranchInstruction(*insn)
+				&& !isBadBranch(_image, insn))
 		{
 			return false;
 		}
 
-		if (_c2l->isReturnInstruction(*_dryCsInsn)
-				|| _c2l->isBranchInstruction(*_dryCsInsn)
-				|| _c2l->isCondBranchInstruction(*_dryCsInsn)
-				|| _c2l->isCallInstruction(*_dryCsInsn))
+		if (_c2l->isReturnInstruction(*insn)
+				|| _c2l->isBranchInstruction(*insn)
+				|| _c2l->isCondBranchInstruction(*insn)
+				|| _c2l->isCallInstruction(*insn))
 		{
 			cfChangePos = counter;
 		}
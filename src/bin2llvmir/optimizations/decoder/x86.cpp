@@ -25,7 +25,7 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 		return true;
 	}
 
-	static csh ce = _c2l->getCapstoneEngine();
+	csh ce = _c2l->getCapstoneEngine();
 
 	uint64_t addr = jt.getAddress();
 	std::size_t nops = 0;
@@ -33,16 +33,16 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 	bool storeOneToEax = false;
 	bool lastSyscall = false;
 	std::size_t decodedSz = 0;
-	while (cs_disasm_iter(ce, &bytes.first, &bytes.second, &addr, _dryCsInsn))
+	while (cs_insn* insn = disasmDryRun(ce, bytes, addr))
 	{
-		decodedSz += _dryCsInsn->size;
-		auto& detail = _dryCsInsn->detail->x86;
+		decodedSz += insn->size;
+		auto& detail = insn->detail->x86;
 
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& _abi->isNopInstruction(insn))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn->size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
@@ -50,14 +50,14 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 			return nops;
 		}
 
-		if (_c2l->isReturnInstruction(*_dryCsInsn)
-				|| _c2l->isBranchInstruction(*_dryCsInsn))
+		if (_c2l->isReturnInstruction(*insn)
+				|| _c2l->isBranchInstruction(*insn))
 		{
 			return false;
 		}
 
 		// TODO: not very strict - not checking that eax is not overwritten.
-		if (_dryCsInsn->id == X86_INS_MOV
+		if (insn->id == X86_INS_MOV
 				&& detail.op_count == 2
 				&& detail.operands[0].type == X86_OP_REG
 				&& detail.operands[0].reg == X86_REG_EAX
@@ -66,7 +66,7 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 		{
 			storeOneToEax = true;
 		}
-		if (_dryCsInsn->id == X86_INS_INT
+		if (insn->id == X86_INS_INT
 				&& detail.op_count == 1
 				&& detail.operands[0].type == X86_OP_IMM
 				&& detail.operands[0].imm == 0x80)
@@ -77,7 +77,7 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 			}
 			lastSyscall = true;
 		}
-		else if (_dryCsInsn->id == X86_INS_SYSCALL)
+		else if (insn->id == X86_INS_SYSCALL)
 		{
 			lastSyscall = true;
 		}
@@ -4,6 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
+#include <llvm/IR/ValueHandle.h>
+
 #include "retdec/bin2llvmir/optimizations/idioms/idioms_analysis.h"
 
 using namespace llvm;
@@ -12,258 +16,341 @@ namespace retdec {
 namespace bin2llvmir {
 
 /**
- * Analyse given BasicBlock and use instruction exchanger to transform
- * instruction idioms
+ * Register all instruction idiom exchangers applicable to the compiler and
+ * architecture of the analysis
  *
- * @param bb BasicBlock to analyse
- * @param exchanger instruction idiom exchanger
- * @param fname instruction idiom exchanger name (for debug purpose only)
+ * Every idiom is a tree of instructions and an exchanger inspects its root
+ * instruction first, so every exchanger is registered together with the
+ * opcodes of the roots of its idioms.
+ * Position of instruction idiom exchangers is IMPORTANT! More complicated
+ * instruction idioms have to be exchanged before simplier ones. They can
+ * consist of other instruction idioms (the simple ones), so they have to be
+ * exchanged at first place!
  */
-bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname) {
-	bool change_made = false;
+void IdiomsAnalysis::initExchangers() {
+	CC_compiler cc = getCompiler();
+	CC_arch arch = getArch();
 
-	for (BasicBlock::iterator iter = bb.begin(), end = bb.end(); iter != end; /**/) {
-		BasicBlock::iterator insn = iter;
-		++iter; // go to next instruction to use valid iterator in next loop
+	if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
+			addExchanger(Instruction::Add, &IdiomsMagicDivMod::signedMod1,
+								"IdiomsMagicDivMod::signedMod1");
 
-		// call exchanger on every instruction
-		Instruction * res = (this->*exchanger)(insn);
+			addExchanger(Instruction::Add, &IdiomsMagicDivMod::signedMod2,
+								"IdiomsMagicDivMod::signedMod2");
 
-		if (res) {
-			change_made = true;
+			addExchanger(Instruction::LShr, &IdiomsMagicDivMod::magicUnsignedDiv2,
+								"IdiomsMagicDivMod::magicUnsignedDiv2");
 
-			(*insn).replaceAllUsesWith(res);
+			addExchanger(Instruction::Trunc, &IdiomsMagicDivMod::magicUnsignedDiv1,
+								"IdiomsMagicDivMod::magicUnsignedDiv1");
 
-			// Move the name to the new instruction first.
-			res->takeName(&*insn);
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv1,
+								"IdiomsMagicDivMod::magicSignedDiv1");
 
-			// Insert the new instruction into the basic block...
-			BasicBlock * InstParent = (*insn).getParent();
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv2,
+								"IdiomsMagicDivMod::magicSignedDiv2");
 
-			// If we replace a PHI with something that isn't a PHI,
-			// fix up the insertion point.
-			if (! isa<PHINode>(res) && isa<PHINode>(insn))
-				insn = InstParent->getFirstInsertionPt();
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv3,
+								"IdiomsMagicDivMod::magicSignedDiv3");
 
-			InstParent->getInstList().insert(insn, res);
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv4,
+								"IdiomsMagicDivMod::magicSignedDiv4");
 
-			(*insn).eraseFromParent();
-		}
-	}
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv5,
+								"IdiomsMagicDivMod::magicSignedDiv5");
 
-	return change_made;
-}
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv6,
+								"IdiomsMagicDivMod::magicSignedDiv6");
 
-/**
- * Do instruction idioms analysis pass
- *
- * @param f Function to analyse for instruction idioms
- * @param p actual pass
- * @return true whenever an exchange has been made, otherwise 0
- */
-bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
-	/*
-	 * Instruction idioms are inspected in a tree of Instructions. Every
-	 * instruction idiom has to be called on a basic block. Position of
-	 * instruction idiom exchangers is IMPORTANT! More complicated instruction
-	 * idioms have to be exchanged before simplier ones. They can consist of
-	 * other instruction idioms (the simple ones), so they have to be exchanged
-	 * at first place!
-	 */
-	bool change_made = false; // was there any exchange?
+			// Found in PowerPC - div 10
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv7pos,
+								"IdiomsMagicDivMod::magicSignedDiv7pos");
 
-	CC_compiler cc = getCompiler();
-	CC_arch arch = getArch();
+			// Found in PowerPC - the same as previous, but the divisor
+			// is negative, i.e. div -10
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv7neg,
+								"IdiomsMagicDivMod::magicSignedDiv7neg");
 
-	// Inspect multi-basic block idioms
-	if (cc == CC_GCC || cc == CC_ANY) {
-		change_made |= analyse(f, p, &IdiomsGCC::exchangeCondBitShiftDivMultiBB,
-									"IdiomsGCC::exchangeCondBitShiftDivMultiBB");
+			// Found in PowerPC - div 6
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv8pos,
+								"IdiomsMagicDivMod::magicSignedDiv8pos");
+
+			// Found in PowerPC - the same as previous, but the divisor
+			// is negative, i.e. div -3
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::magicSignedDiv8neg,
+								"IdiomsMagicDivMod::magicSignedDiv8neg");
+
+			addExchanger(Instruction::Sub, &IdiomsMagicDivMod::unsignedMod,
+								"IdiomsMagicDivMod::unsignedMod");
 	}
 
-	// Inspect basic-block idioms
-	for (Function::iterator b = f.begin(); b != f.end(); ++b) {
-		BasicBlock & bb = *b;
-		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
-				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod1,
-											"IdiomsMagicDivMod::signedMod1");
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addExchanger(Instruction::Sub, &IdiomsGCC::exchangeSignedModuloByTwo,
+							"IdiomsGCC::exchangeSignedModuloByTwo");
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod2,
-											"IdiomsMagicDivMod::signedMod2");
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			addExchanger(Instruction::Or, &IdiomsGCC::exchangeCopysign,
+								"IdiomsGCC::exchangeCopysign");
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv2,
-											"IdiomsMagicDivMod::magicUnsignedDiv2");
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			addExchanger(Instruction::And, &IdiomsGCC::exchangeFloatAbs,
+								"IdiomsGCC::exchangeFloatAbs");
+
+	if (arch == ARCH_x86 || arch == ARCH_ANY)
+		if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
+			addExchanger(Instruction::Or, &IdiomsVStudio::exchangeOrMinusOneAssign,
+								"IdiomsVStudio::exchangeOrMinusOneAssign");
+
+	if (arch == ARCH_x86 || arch == ARCH_ANY)
+		if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
+			addExchanger(Instruction::And, &IdiomsVStudio::exchangeAndZeroAssign,
+								"IdiomsVStudio::exchangeAndZeroAssign");
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addExchanger(Instruction::AShr, &IdiomsGCC::exchangeCondBitShiftDiv1,
+							"IdiomsGCC::exchangeCondBitShiftDiv1");
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addExchanger(Instruction::Sub, &IdiomsGCC::exchangeCondBitShiftDiv2,
+							"IdiomsGCC::exchangeCondBitShiftDiv2");
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addExchanger(Instruction::Sub, &IdiomsGCC::exchangeCondBitShiftDiv3,
+							"IdiomsGCC::exchangeCondBitShiftDiv3");
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
+		addExchanger(Instruction::Sub, &IdiomsCommon::exchangeSignedModulo2n,
+							"IdiomsCommon::exchangeSignedModulo2n");
+
+	// all arch
+	// ((X u>> 31) ^ 1) or ((X ^ -1) u>> 31)
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY) {
+		addExchanger({Instruction::Xor, Instruction::LShr},
+							&IdiomsCommon::exchangeGreaterEqualZero,
+							"IdiomsCommon::exchangeGreaterEqualZero");
+	}
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv1,
-											"IdiomsMagicDivMod::magicUnsignedDiv1");
+	// all arch
+	if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
+		addExchanger(Instruction::Xor, &IdiomsGCC::exchangeXorMinusOne,
+							"IdiomsGCC::exchangeXorMinusOne");
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv1,
-											"IdiomsMagicDivMod::magicSignedDiv1");
+	if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			addExchanger(Instruction::Sub, &IdiomsCommon::exchangeDivByMinusTwo,
+								"IdiomsCommon::exchangeDivByMinusTwo");
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv2,
-											"IdiomsMagicDivMod::magicSignedDiv2");
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
+		addExchanger(Instruction::LShr, &IdiomsCommon::exchangeLessThanZero,
+							"IdiomsCommon::exchangeLessThanZero");
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv3,
-											"IdiomsMagicDivMod::magicSignedDiv3");
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (cc == CC_GCC || cc == CC_ANY)
+		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+			addExchanger(Instruction::Xor, &IdiomsGCC::exchangeFloatNeg,
+								"IdiomsGCC::exchangeFloatNeg");
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		addExchanger(Instruction::And, &IdiomsCommon::exchangeUnsignedModulo2n,
+							"IdiomsCommon::exchangeUnsignedModulo2n");
+
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY)
+		addExchanger(Instruction::ICmp, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
+							"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+
+	// all arch
+	// all compilers
+	addExchanger(Instruction::Or, &IdiomsCommon::exchangeBitShiftSDiv1,
+						"IdiomsCommon::exchangeBitShiftSDiv1");
+
+	// all arch
+	// all compilers
+	addExchanger(Instruction::AShr, &IdiomsCommon::exchangeBitShiftSDiv2,
+						"IdiomsCommon::exchangeBitShiftSDiv2");
+
+	// all arch
+	// all compilers
+	addExchanger(Instruction::LShr, &IdiomsCommon::exchangeBitShiftUDiv,
+						"IdiomsCommon::exchangeBitShiftUDiv");
+
+	// all arch
+	// all compilers
+	addExchanger(Instruction::Shl, &IdiomsCommon::exchangeBitShiftMul,
+						"IdiomsCommon::exchangeBitShiftMul");
+
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY) {
+		addExchanger(Instruction::ICmp, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
+							"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+	}
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv4,
-											"IdiomsMagicDivMod::magicSignedDiv4");
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY) {
+		// ~(A^B)
+		addExchanger(Instruction::Xor, &IdiomsLLVM::exchangeCompareEq,
+							"IdiomsLLVM::exchangeCompareEq");
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv5,
-											"IdiomsMagicDivMod::magicSignedDiv5");
+#if 0
+		/* We do not recognize this well */
+		addExchanger(Instruction::Xor, &IdiomsLLVM::exchangeCompareNeq,
+							"IdiomsLLVM::exchangeCompareNeq");
+#endif
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv6,
-											"IdiomsMagicDivMod::magicSignedDiv6");
+		addExchanger(Instruction::And, &IdiomsLLVM::exchangeCompareSlt,
+							"IdiomsLLVM::exchangeCompareSlt");
 
-				// Found in PowerPC - div 10
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7pos,
-											"IdiomsMagicDivMod::magicSignedDiv7pos");
+		addExchanger(Instruction::Or, &IdiomsLLVM::exchangeCompareSle,
+							"IdiomsLLVM::exchangeCompareSle");
+	}
+}
 
-				// Found in PowerPC - the same as previous, but the divisor
-				// is negative, i.e. div -10
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7neg,
-											"IdiomsMagicDivMod::magicSignedDiv7neg");
+/**
+ * Register instruction idiom exchanger
+ *
+ * @param opcode opcode of the root instruction of the idiom
+ * @param exchanger instruction idiom exchanger
+ * @param fname instruction idiom exchanger name (for debug purpose only)
+ */
+void IdiomsAnalysis::addExchanger(unsigned opcode, Exchanger exchanger, const char * fname) {
+	addExchanger({opcode}, exchanger, fname);
+}
 
-				// Found in PowerPC - div 6
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8pos,
-											"IdiomsMagicDivMod::magicSignedDiv8pos");
+/**
+ * Register instruction idiom exchanger whose idioms may have roots with
+ * different opcodes
+ *
+ * @param opcodes opcodes of the root instructions of the idioms
+ * @param exchanger instruction idiom exchanger
+ * @param fname instruction idiom exchanger name (for debug purpose only)
+ */
+void IdiomsAnalysis::addExchanger(std::initializer_list<unsigned> opcodes, Exchanger exchanger, const char * fname) {
+	m_exchangers.push_back({opcodes, exchanger, fname});
+}
 
-				// Found in PowerPC - the same as previous, but the divisor
-				// is negative, i.e. div -3
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8neg,
-											"IdiomsMagicDivMod::magicSignedDiv8neg");
+/**
+ * Replace instruction by the result of an exchanger
+ *
+ * @param insn instruction to replace
+ * @param res new instruction, not inserted in any basic block yet
+ */
+void IdiomsAnalysis::replaceInstruction(Instruction * insn, Instruction * res) const {
+	insn->replaceAllUsesWith(res);
 
-				change_made |= analyse(bb, &IdiomsMagicDivMod::unsignedMod,
-											"IdiomsMagicDivMod::unsignedMod");
-		}
+	// Move the name to the new instruction first.
+	res->takeName(insn);
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeSignedModuloByTwo,
-										"IdiomsGCC::exchangeSignedModuloByTwo");
+	// Insert the new instruction into the basic block...
+	BasicBlock * InstParent = insn->getParent();
+	BasicBlock::iterator insertPt = insn->getIterator();
 
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeCopysign,
-											"IdiomsGCC::exchangeCopysign");
+	// If we replace a PHI with something that isn't a PHI,
+	// fix up the insertion point.
+	if (! isa<PHINode>(res) && isa<PHINode>(insn))
+		insertPt = InstParent->getFirstInsertionPt();
 
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatAbs,
-											"IdiomsGCC::exchangeFloatAbs");
+	InstParent->getInstList().insert(insertPt, res);
 
-		if (arch == ARCH_x86 || arch == ARCH_ANY)
-			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsVStudio::exchangeOrMinusOneAssign,
-											"IdiomsVStudio::exchangeOrMinusOneAssign");
+	insn->eraseFromParent();
+}
 
-		if (arch == ARCH_x86 || arch == ARCH_ANY)
-			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsVStudio::exchangeAndZeroAssign,
-										"IdiomsVStudio::exchangeAndZeroAssign");
+/**
+ * Analyse given BasicBlock and use instruction exchangers to transform
+ * instruction idioms
+ *
+ * Exchangers are applied in the order in which they have been registered and
+ * every exchanger is applied to the instructions of the basic block from its
+ * beginning, as if the whole basic block was inspected by one exchanger after
+ * another. However, an exchanger is called only for instructions with the
+ * opcodes of the roots of its idioms.
+ *
+ * @param bb BasicBlock to analyse
+ */
+bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb) {
+	bool change_made = false;
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv1,
-										"IdiomsGCC::exchangeCondBitShiftDiv1");
+	// Instructions of the basic block, all of them and by their opcodes.
+	// Exchangers erase instructions of the exchanged idioms, so value handles
+	// are used to skip them. The instructions are collected again only after
+	// an exchange.
+	std::vector<WeakVH> insns;
+	std::vector<std::vector<WeakVH>> insnsByOpcode;
+	bool insnsChanged = true;
+
+	for (const IdiomExchanger & e : m_exchangers) {
+		if (insnsChanged) {
+			insns.clear();
+			insnsByOpcode.clear();
+			for (Instruction & insn : bb) {
+				insns.push_back(WeakVH(&insn));
+				if (insn.getOpcode() >= insnsByOpcode.size())
+					insnsByOpcode.resize(insn.getOpcode() + 1);
+				insnsByOpcode[insn.getOpcode()].push_back(WeakVH(&insn));
+			}
+			insnsChanged = false;
+		}
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv2,
-										"IdiomsGCC::exchangeCondBitShiftDiv2");
+		const std::vector<WeakVH> * candidates = &insns;
+		if (e.opcodes.size() == 1) {
+			unsigned opcode = e.opcodes.front();
+			if (opcode >= insnsByOpcode.size())
+				continue;
+			candidates = &insnsByOpcode[opcode];
+		}
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv3,
-										"IdiomsGCC::exchangeCondBitShiftDiv3");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeSignedModulo2n,
-										"IdiomsCommon::exchangeSignedModulo2n");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeGreaterEqualZero,
-										"IdiomsCommon::exchangeGreaterEqualZero");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeXorMinusOne,
-										"IdiomsGCC::exchangeXorMinusOne");
-
-		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsCommon::exchangeDivByMinusTwo,
-											"IdiomsCommon::exchangeDivByMinusTwo");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeLessThanZero,
-										"IdiomsCommon::exchangeLessThanZero");
-
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (cc == CC_GCC || cc == CC_ANY)
-			if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatNeg,
-											"IdiomsGCC::exchangeFloatNeg");
+		for (const WeakVH & vh : *candidates) {
+			Instruction * insn = dyn_cast_or_null<Instruction>(vh);
+			if (! insn || insn->getParent() != &bb)
+				continue;
 
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeUnsignedModulo2n,
-										"IdiomsCommon::exchangeUnsignedModulo2n");
-
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-											"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv1,
-									"IdiomsCommon::exchangeBitShiftSDiv1");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv2,
-									"IdiomsCommon::exchangeBitShiftSDiv2");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftUDiv,
-									"IdiomsCommon::exchangeBitShiftUDiv");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftMul,
-									"IdiomsCommon::exchangeBitShiftMul");
-
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY) {
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-										"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+			if (e.opcodes.size() != 1 && std::find(e.opcodes.begin(),
+					e.opcodes.end(), insn->getOpcode()) == e.opcodes.end())
+				continue;
+
+			if (Instruction * res = (this->*e.exchanger)(insn->getIterator())) {
+				change_made = true;
+				insnsChanged = true;
+				replaceInstruction(insn, res);
+			}
 		}
+	}
+
+	return change_made;
+}
 
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY) {
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareEq,
-										"IdiomsLLVM::exchangeCompareEq");
+/**
+ * Do instruction idioms analysis pass
+ *
+ * @param f Function to analyse for instruction idioms
+ * @param p actual pass
+ * @return true whenever an exchange has been made, otherwise 0
+ */
+bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
+	bool change_made = false; // was there any exchange?
 
-	#if 0
-			/* We do not recognize this well */
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareNeq,
-										"IdiomsLLVM::exchangeCompareNeq");
-	#endif
+	CC_compiler cc = getCompiler();
 
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSlt,
-										"IdiomsLLVM::exchangeCompareSlt");
+	// Inspect multi-basic block idioms
+	if (cc == CC_GCC || cc == CC_ANY) {
+		change_made |= analyse(f, p, &IdiomsGCC::exchangeCondBitShiftDivMultiBB,
+									"IdiomsGCC::exchangeCondBitShiftDivMultiBB");
+	}
 
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSle,
-									"IdiomsLLVM::exchangeCompareSle");
-		}
+	// Inspect basic-block idioms
+	for (Function::iterator b = f.begin(); b != f.end(); ++b) {
+		change_made |= analyse(*b);
 	}
 
 	return change_made;
@@ -67,8 +67,7 @@ bool LocalVars::runOnModule(Module& M)
 		return false;
 	}
 
-	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(M, abi);
+	auto& RDA = *ReachingDefinitionsProvider::getRda(&M, abi);
 
 	std::set<llvm::Instruction*> uses;
 
@@ -59,7 +59,6 @@ bool ParamReturn::runOnModule(Module& m)
 	_image = FileImageProvider::getFileImage(_module);
 	_dbgf = DebugFormatProvider::getDebugFormat(_module);
 	_lti = LtiProvider::getLti(_module);
-	_collector = CollectorProvider::createCollector(_abi, _module, &_RDA);
 
 	return run();
 }
@@ -78,7 +77,6 @@ bool ParamReturn::runOnModuleCustom(
 	_image = img;
 	_dbgf = dbgf;
 	_lti = lti;
-	_collector = CollectorProvider::createCollector(_abi, _module, &_RDA);
 
 	return run();
 }
@@ -91,7 +89,8 @@ bool ParamReturn::run()
 		return false;
 	}
 
-	_RDA.runOnModule(*_module, _abi);
+	_RDA = ReachingDefinitionsProvider::getRda(_module, _abi);
+	_collector = CollectorProvider::createCollector(_abi, _module, _RDA);
 
 	collectAllCalls();
 dumpInfo();
@@ -99,8 +98,6 @@ dumpInfo();
 dumpInfo();
 	applyToIr();
 
-	_RDA.clear();
-
 	return false;
 }
 
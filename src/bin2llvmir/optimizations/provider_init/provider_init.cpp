@@ -9,7 +9,9 @@
 #include <llvm/Support/CommandLine.h>
 
 #include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
+#include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/analyses/symbolic_tree.h"
+#include "retdec/bin2llvmir/optimizations/simple_types/simple_types.h"
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
@@ -39,8 +41,28 @@ cl::opt<std::string> ConfigPath(
 		cl::init("")
 );
 
-ProviderInitialization::ProviderInitialization() :
-		ModulePass(ID)
+cl::opt<unsigned> StaticCodeJobs(
+		"static-code-jobs",
+		cl::desc("Number of static code signature files scanned concurrently "
+				"(0 means one per hardware thread). Overrides the config."),
+		cl::init(1)
+);
+
+cl::opt<unsigned> FunctionJobs(
+		"function-jobs",
+		cl::desc("Number of functions whose reaching definitions are built "
+				"concurrently (0 means one per hardware thread). Overrides the "
+				"config."),
+		cl::init(1)
+);
+
+/**
+ * @param c Config DB to initialize the providers from. If not set, config is
+ *          read from the file given by the @c -config-path option.
+ */
+ProviderInitialization::ProviderInitialization(retdec::config::Config* c) :
+		ModulePass(ID),
+		_config(c)
 {
 
 }
@@ -50,19 +72,32 @@ ProviderInitialization::ProviderInitialization() :
  */
 bool ProviderInitialization::runOnModule(Module& m)
 {
-	static bool firstRun = true;
+	// Providers are initialized only once per module, even if the pass is
+	// run on it several times.
 	std::string confPath = ConfigPath;
-	if (!firstRun || confPath.empty())
+	if (ConfigProvider::getConfig(&m)
+			|| (_config == nullptr && confPath.empty()))
 	{
 		return false;
 	}
 
-	auto* c = ConfigProvider::addConfigFile(&m, confPath);
+	auto* c = _config
+			? ConfigProvider::addConfig(&m, *_config)
+			: ConfigProvider::addConfigFile(&m, confPath);
 	if (c == nullptr)
 	{
 		return false;
 	}
 
+	if (StaticCodeJobs.getNumOccurrences())
+	{
+		c->getConfig().parameters.setStaticCodeJobs(StaticCodeJobs);
+	}
+	if (FunctionJobs.getNumOccurrences())
+	{
+		c->getConfig().parameters.setFunctionJobs(FunctionJobs);
+	}
+
 	auto* abi = AbiProvider::addAbi(&m, c);
 	SymbolicTree::setAbi(abi);
 	SymbolicTree::setConfig(c);
@@ -95,8 +130,6 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	AsmInstruction::clear();
 
-	firstRun = false;
-
 	return false;
 }
 
@@ -106,8 +139,41 @@ bool ProviderInitialization::runOnModule(Module& m)
 bool ProviderInitialization::doFinalization(Module& m)
 {
 	ConfigProvider::doFinalization(&m);
+
+	Config* c = nullptr;
+	if (_config && ConfigProvider::getConfig(&m, c))
+	{
+		*_config = c->getConfig();
+	}
+
 	return false;
 }
 
+/**
+ * Clear all the data of the providers and other module-bound data kept by
+ * bin2llvmir passes in static members.
+ *
+ * This has to be done before the providers are initialized for another module
+ * in the same process. Otherwise, the new module would see the data of the old
+ * one (e.g. when it is allocated at the same address).
+ */
+void ProviderInitialization::clear()
+{
+	AbiProvider::clear();
+	AsmInstruction::clear();
+	ConfigProvider::clear();
+	DebugFormatProvider::clear();
+	DemanglerProvider::clear();
+	FileImageProvider::clear();
+	LtiProvider::clear();
+	NamesProvider::clear();
+	ReachingDefinitionsProvider::clear();
+	SimpleTypesAnalysis::clear();
+
+	SymbolicTree::setAbi(nullptr);
+	SymbolicTree::setConfig(nullptr);
+	SymbolicTree::setToDefaultConfiguration();
+}
+
 } // namespace bin2llvmir
 } // namespace retdec
@@ -63,11 +63,21 @@ SimpleTypesAnalysis::SimpleTypesAnalysis() :
 
 }
 
+std::set<const llvm::Module*> SimpleTypesAnalysis::_analysedModules;
+
 void SimpleTypesAnalysis::getAnalysisUsage(AnalysisUsage& AU) const
 {
 
 }
 
+/**
+ * Forget all the modules on which the analysis has been run.
+ */
+void SimpleTypesAnalysis::clear()
+{
+	_analysedModules.clear();
+}
+
 bool SimpleTypesAnalysis::runOnModule(Module& M)
 {
 	if (!ConfigProvider::getConfig(&M, config))
@@ -83,19 +93,18 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	module = &M;
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(module);
 
-	static bool first = true;
-
-	if (first)
+	// The full analysis is done only when the pass is run on the module for
+	// the first time.
+	if (_analysedModules.insert(&M).second)
 	{
-		RDA.runOnModule(M, AbiProvider::getAbi(&M));
+		RDA = ReachingDefinitionsProvider::getRda(&M, AbiProvider::getAbi(&M));
 		buildEqSets(M);
 		buildEquations();
 		eqSets.propagate(module);
 		eqSets.apply(module, config, objf, instToErase);
 		eraseObsoleteInstructions();
 		setGlobalConstants();
-		first = false;
-		RDA.clear();
+		RDA = nullptr;
 	}
 	else
 	{
@@ -401,7 +410,7 @@ void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<
 					}
 					else
 					{
-						auto uses = RDA.usesFromDef(store);
+						auto uses = RDA->usesFromDef(store);
 						for (auto* u : uses)
 						{
 							toProcess.push(u->use);
@@ -527,7 +536,7 @@ void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<
 			}
 			else
 			{
-				auto uses = RDA.usesFromDef(user);
+				auto uses = RDA->usesFromDef(user);
 				for (auto* u : uses)
 				{
 					toProcess.push(u->use);
@@ -1228,7 +1237,7 @@ void EqSet::apply(
 
 	LOG << "\napply BEGIN " << id << " =============================\n";
 
-	static auto &conf = config->getConfig();
+	auto& conf = config->getConfig();
 
 	IrModifier irModif(module, config);
 	for (auto& vs : valSet)
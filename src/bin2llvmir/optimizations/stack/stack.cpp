@@ -69,8 +69,7 @@ bool StackAnalysis::run()
 		return false;
 	}
 
-	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi);
+	auto& RDA = *ReachingDefinitionsProvider::getRda(_module, _abi);
 
 	for (auto& f : *_module)
 	{
@@ -4,6 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/InstIterator.h>
 
@@ -19,8 +23,135 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+//
+//==============================================================================
+// Llvm2CapstoneInsnMap
+//==============================================================================
+//
+
+/**
+ * Set architecture of the instructions that will be stored in this map.
+ * Instructions of this architecture are stored with only the part of
+ * @c cs_detail that belongs to it. If no architecture is set, the whole
+ * @c cs_detail is stored.
+ */
+void Llvm2CapstoneInsnMap::setArchitecture(cs_arch arch)
+{
+	switch (arch)
+	{
+		case CS_ARCH_X86:
+			_detailSize = offsetof(cs_detail, x86) + sizeof(cs_x86);
+			break;
+		case CS_ARCH_ARM:
+			_detailSize = offsetof(cs_detail, arm) + sizeof(cs_arm);
+			break;
+		case CS_ARCH_MIPS:
+			_detailSize = offsetof(cs_detail, mips) + sizeof(cs_mips);
+			break;
+		case CS_ARCH_PPC:
+			_detailSize = offsetof(cs_detail, ppc) + sizeof(cs_ppc);
+			break;
+		default:
+			_detailSize = sizeof(cs_detail);
+			break;
+	}
+}
+
+/**
+ * Map the given LLVM IR special instruction to a copy of the given Capstone
+ * instruction. The given Capstone instruction must have been allocated by
+ * @c cs_malloc(). It is freed by this method and must not be used afterwards.
+ * @return Stored copy of @a insn, which should be used instead of it.
+ */
+cs_insn* Llvm2CapstoneInsnMap::emplace(
+		llvm::StoreInst* llvmInsn,
+		cs_insn* insn)
+{
+	auto it = _index.find(llvmInsn);
+	if (it != _index.end())
+	{
+		cs_free(insn, 1);
+		return it->second;
+	}
+
+	auto* copy = copyInsn(insn);
+	cs_free(insn, 1);
+	_index.insert({llvmInsn, copy});
+	return copy;
+}
+
+/**
+ * @return Capstone instruction mapped to the given LLVM IR special
+ *         instruction, or @c nullptr if there is no such instruction.
+ */
+cs_insn* Llvm2CapstoneInsnMap::find(const llvm::StoreInst* llvmInsn) const
+{
+	auto it = _index.find(llvmInsn);
+	return it != _index.end() ? it->second : nullptr;
+}
+
+std::size_t Llvm2CapstoneInsnMap::size() const
+{
+	return _index.size();
+}
+
+bool Llvm2CapstoneInsnMap::empty() const
+{
+	return _index.empty();
+}
+
+/**
+ * Remove all the mappings and release the memory of all the stored
+ * instructions.
+ */
+void Llvm2CapstoneInsnMap::clear()
+{
+	_index.clear();
+	_blocks.clear();
+	_blockUsed = 0;
+	_blockCapacity = 0;
+}
+
+cs_insn* Llvm2CapstoneInsnMap::copyInsn(const cs_insn* insn)
+{
+	auto* copy = static_cast<cs_insn*>(allocate(sizeof(cs_insn)));
+	std::memcpy(copy, insn, sizeof(cs_insn));
+
+	if (insn->detail)
+	{
+		copy->detail = static_cast<cs_detail*>(allocate(_detailSize));
+		std::memcpy(copy->detail, insn->detail, _detailSize);
+	}
+
+	return copy;
+}
+
+void* Llvm2CapstoneInsnMap::allocate(std::size_t size)
+{
+	const std::size_t align = alignof(std::max_align_t);
+	size = (size + align - 1) / align * align;
+
+	if (_blockUsed + size > _blockCapacity)
+	{
+		_blockCapacity = std::max(size, BLOCK_SIZE);
+		_blocks.emplace_back(new std::uint8_t[_blockCapacity]);
+		_blockUsed = 0;
+	}
+
+	void* ret = _blocks.back().get() + _blockUsed;
+	_blockUsed += size;
+	return ret;
+}
+
+//
+//==============================================================================
+// AsmInstruction
+//==============================================================================
+//
+
 std::vector<AsmInstruction::ModuleGlobalPair> AsmInstruction::_module2global;
 std::vector<AsmInstruction::ModuleInstructionMap> AsmInstruction::_module2instMap;
+std::vector<AsmInstruction::ModuleAddressIndex> AsmInstruction::_module2addrIndex;
 
 AsmInstruction::AsmInstruction()
 {
@@ -35,7 +166,20 @@ AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 	}
 
 	auto* bb = inst->getParent();
-	while (inst && !isLlvmToAsmInstructionPrivate(inst))
+	if (bb == nullptr || bb->getParent() == nullptr)
+	{
+		return;
+	}
+
+	// The special global is the same for all the visited instructions
+	// -> get it only once.
+	auto* gv = getLlvmToAsmGlobalVariable(bb->getModule());
+	if (gv == nullptr)
+	{
+		return;
+	}
+
+	while (!isLlvmToAsmInstruction(inst, gv))
 	{
 		if (&bb->front() == inst)
 		{
@@ -55,8 +199,7 @@ AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 		}
 	}
 
-	auto* s = dyn_cast_or_null<StoreInst>(inst);
-	_llvmToAsmInstr = isLlvmToAsmInstructionPrivate(s) ? s : nullptr;
+	_llvmToAsmInstr = cast<StoreInst>(inst);
 }
 
 AsmInstruction::AsmInstruction(llvm::BasicBlock* bb)
@@ -76,12 +219,18 @@ AsmInstruction::AsmInstruction(llvm::Function* f)
 		return;
 	}
 
+	auto* gv = getLlvmToAsmGlobalVariable(f->getParent());
+	if (gv == nullptr)
+	{
+		return;
+	}
+
 	for (auto it = inst_begin(f), e = inst_end(f); it != e; ++it)
 	{
 		Instruction* i = &(*it);
-		if (isLlvmToAsmInstructionPrivate(i))
+		if (isLlvmToAsmInstruction(i, gv))
 		{
-			_llvmToAsmInstr = dyn_cast_or_null<StoreInst>(i);
+			_llvmToAsmInstr = cast<StoreInst>(i);
 			return;
 		}
 	}
@@ -89,28 +238,26 @@ AsmInstruction::AsmInstruction(llvm::Function* f)
 
 AsmInstruction::AsmInstruction(llvm::Module* m, retdec::utils::Address addr)
 {
-	if (m == nullptr)
+	if (m == nullptr || !isIndexableAddress(addr))
 	{
 		return;
 	}
 
-	ConstantInt* ci = ConstantInt::get(
-			Type::getInt64Ty(m->getContext()),
-			addr,
-			false);
-	if (ci == nullptr)
+	auto& index = getAddressIndex(m);
+	auto it = index.find(addr);
+	if (it == index.end())
 	{
 		return;
 	}
 
-	for (auto* u : ci->users())
+	// Special instruction was erased.
+	if (it->second == nullptr)
 	{
-		if (isLlvmToAsmInstructionPrivate(u))
-		{
-			_llvmToAsmInstr = dyn_cast_or_null<StoreInst>(u);
-			return;
-		}
+		index.erase(it);
+		return;
 	}
+
+	_llvmToAsmInstr = cast<StoreInst>(it->second);
 }
 
 bool AsmInstruction::operator<(const AsmInstruction& o) const
@@ -193,10 +340,8 @@ Llvm2CapstoneInsnMap& AsmInstruction::getLlvmToCapstoneInsnMap(
 		}
 	}
 
-	auto it = _module2instMap.emplace(_module2instMap.end(), std::make_pair(
-			m,
-			std::map<llvm::StoreInst*, cs_insn*>()));
-	return it->second;
+	_module2instMap.emplace_back(m, Llvm2CapstoneInsnMap());
+	return _module2instMap.back().second;
 }
 
 llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariable(
@@ -216,9 +361,104 @@ void AsmInstruction::setLlvmToAsmGlobalVariable(
 		const llvm::Module* m,
 		llvm::GlobalVariable* gv)
 {
+	// Special instructions are identified by the global -> index them again.
+	for (auto& p : _module2addrIndex)
+	{
+		if (p.first == m)
+		{
+			p.second.reset();
+		}
+	}
+
+	for (auto& p : _module2global)
+	{
+		if (p.first == m)
+		{
+			p.second = gv;
+			return;
+		}
+	}
 	_module2global.emplace_back(m, gv);
 }
 
+/**
+ * Add the given special LLVM IR instruction to the index of instructions
+ * by their addresses. Each newly created special instruction must be added,
+ * otherwise it might not be found by @c AsmInstruction(llvm::Module*, Address).
+ * Erased instructions are removed from the index automatically.
+ */
+void AsmInstruction::addLlvmToAsmInstruction(llvm::StoreInst* s)
+{
+	auto* ci = dyn_cast_or_null<ConstantInt>(
+			s ? s->getValueOperand() : nullptr);
+	if (ci == nullptr || !isIndexableAddress(ci->getZExtValue()))
+	{
+		return;
+	}
+
+	for (auto& p : _module2addrIndex)
+	{
+		// Index that was not created yet will find the instruction itself.
+		if (p.first == s->getModule() && p.second)
+		{
+			(*p.second)[ci->getZExtValue()] = s;
+			return;
+		}
+	}
+}
+
+/**
+ * Get the index of special instructions of the given module by their
+ * addresses. If the index does not exist, it is created from all the
+ * existing special instructions.
+ */
+AsmInstruction::AddressToAsmInstructionMap& AsmInstruction::getAddressIndex(
+		const llvm::Module* m)
+{
+	auto it = std::find_if(
+			_module2addrIndex.begin(),
+			_module2addrIndex.end(),
+			[m](const ModuleAddressIndex& p) { return p.first == m; });
+	if (it == _module2addrIndex.end())
+	{
+		it = _module2addrIndex.emplace(_module2addrIndex.end(), m, nullptr);
+	}
+	if (it->second)
+	{
+		return *it->second;
+	}
+
+	it->second = std::make_unique<AddressToAsmInstructionMap>();
+	auto& index = *it->second;
+
+	if (auto* gv = getLlvmToAsmGlobalVariable(m))
+	{
+		for (auto* u : gv->users())
+		{
+			auto* s = dyn_cast<StoreInst>(u);
+			auto* ci = s && s->getPointerOperand() == gv
+					? dyn_cast<ConstantInt>(s->getValueOperand())
+					: nullptr;
+			if (ci && isIndexableAddress(ci->getZExtValue()))
+			{
+				index.insert({ci->getZExtValue(), s});
+			}
+		}
+	}
+
+	return index;
+}
+
+/**
+ * DenseMap reserves the two highest keys. There can not be any instruction on
+ * such addresses anyway.
+ */
+bool AsmInstruction::isIndexableAddress(std::uint64_t addr)
+{
+	return addr != DenseMapInfo<std::uint64_t>::getEmptyKey()
+			&& addr != DenseMapInfo<std::uint64_t>::getTombstoneKey();
+}
+
 retdec::utils::Address AsmInstruction::getInstructionAddress(
 		llvm::Instruction* inst)
 {
@@ -258,6 +498,14 @@ bool AsmInstruction::isLlvmToAsmInstructionPrivate(llvm::Value* inst) const
 	return s->getPointerOperand() == getLlvmToAsmGlobalVariablePrivate(m);
 }
 
+bool AsmInstruction::isLlvmToAsmInstruction(
+		const llvm::Value* inst,
+		const llvm::GlobalVariable* gv)
+{
+	auto* s = dyn_cast_or_null<StoreInst>(inst);
+	return s && s->getPointerOperand() == gv;
+}
+
 bool AsmInstruction::isLlvmToAsmInstruction(const llvm::Value* inst)
 {
 	auto* s = dyn_cast_or_null<StoreInst>(inst);
@@ -273,6 +521,7 @@ void AsmInstruction::clear()
 {
 	_module2global.clear();
 	_module2instMap.clear();
+	_module2addrIndex.clear();
 }
 
 bool AsmInstruction::isValid() const
@@ -291,8 +540,7 @@ cs_insn* AsmInstruction::getCapstoneInsn() const
 	{
 		if (p.first == _llvmToAsmInstr->getModule())
 		{
-			auto it =  p.second.find(_llvmToAsmInstr);
-			return it != p.second.end() ? it->second : nullptr;
+			return p.second.find(_llvmToAsmInstr);
 		}
 	}
 
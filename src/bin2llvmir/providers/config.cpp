@@ -45,17 +45,7 @@ Config Config::fromFile(llvm::Module* m, const std::string& path)
 		config._configDB.readJsonFile(config._configPath);
 	}
 
-	for (auto& s : config.getConfig().structures)
-	{
-		llvm_utils::stringToLlvmType(m->getContext(), s.getLlvmIr());
-	}
-
-	// TODO: needed?
-	if (config.getConfig().tools.isPic32())
-	{
-		config.getConfig().architecture.setIsPic32();
-	}
-
+	config.initialize();
 	return config;
 }
 
@@ -64,19 +54,41 @@ Config Config::fromJsonString(llvm::Module* m, const std::string& json)
 	Config config;
 	config._module = m;
 	config._configDB.readJsonString(json);
+	config.initialize();
+	return config;
+}
 
-	for (auto& s : config.getConfig().structures)
+/**
+ * Create config from an already existing config DB object. This is used when
+ * bin2llvmir runs in the same process as the other decompilation phases and
+ * the config does not have to go through a file.
+ */
+Config Config::fromConfig(
+		llvm::Module* m,
+		const retdec::config::Config& config)
+{
+	Config c;
+	c._module = m;
+	c._configDB = config;
+	c.initialize();
+	return c;
+}
+
+/**
+ * Common initialization of a config whose DB has just been filled.
+ */
+void Config::initialize()
+{
+	for (auto& s : getConfig().structures)
 	{
-		llvm_utils::stringToLlvmType(m->getContext(), s.getLlvmIr());
+		llvm_utils::stringToLlvmType(_module->getContext(), s.getLlvmIr());
 	}
 
 	// TODO: needed?
-	if (config.getConfig().tools.isPic32())
+	if (getConfig().tools.isPic32())
 	{
-		config.getConfig().architecture.setIsPic32();
+		getConfig().architecture.setIsPic32();
 	}
-
-	return config;
 }
 
 /**
@@ -759,6 +771,14 @@ Config* ConfigProvider::addConfigJsonString(
 	return &p.first->second;
 }
 
+Config* ConfigProvider::addConfig(
+		llvm::Module* m,
+		const retdec::config::Config& config)
+{
+	auto p = _module2config.emplace(m, Config::fromConfig(m, config));
+	return &p.first->second;
+}
+
 Config* ConfigProvider::getConfig(llvm::Module* m)
 {
 	auto f = _module2config.find(m);
@@ -224,6 +224,11 @@ Type* ToLlvmTypeVisitor::getLlvmType() const
 //=============================================================================
 //
 
+std::map<
+		std::string,
+		std::shared_ptr<const ctypesparser::JSONCTypesParser::IndexedJson>>
+		Lti::_preloadedFiles;
+
 Lti::Lti(
 		llvm::Module* m,
 		Config* c,
@@ -236,9 +241,6 @@ Lti::Lti(
 	_ltiModule = std::make_unique<retdec::ctypes::Module>(
 			std::make_shared<retdec::ctypes::Context>());
 
-	_ltiParser = ctypesparser::JSONCTypesParser(
-			static_cast<unsigned>(c->getConfig().architecture.getBitSize()));
-
 	for (auto& l : _config->getConfig().parameters.libraryTypeInfoPaths)
 	{
 		if (retdec::utils::startsWith(retdec::utils::stripDirs(l), "cstdlib"))
@@ -284,6 +286,10 @@ Lti::Lti(
 	}
 }
 
+/**
+ * Index functions in the given LTI file. Their declarations are created only
+ * when they are asked for, see getLtiFunction().
+ */
 void Lti::loadLtiFile(const std::string& filePath)
 {
 	// This could/should be derived from architecture or LLVM module.
@@ -307,27 +313,102 @@ void Lti::loadLtiFile(const std::string& filePath)
 		{"unsigned __int3264", 32} // this has the same size as arch size
 	};
 
+	std::string cc = "cdecl";
+	if (retdec::utils::containsCaseInsensitive(filePath, "win"))
+	{
+		cc = "stdcall";
+	}
+
+	ctypesparser::JSONCTypesParser parser(
+			static_cast<unsigned>(_config->getConfig().architecture.getBitSize()));
+
+	auto preloaded = _preloadedFiles.find(filePath);
+	if (preloaded != _preloadedFiles.end())
+	{
+		parser.indexFunctions(
+				preloaded->second,
+				_ltiModule->getContext(),
+				typeWidths,
+				cc);
+		_ltiParsers.push_back(std::move(parser));
+		return;
+	}
+
 	std::ifstream file(filePath);
 	if (file)
 	{
-		std::string cc = "cdecl";
-		if (retdec::utils::containsCaseInsensitive(filePath, "win"))
-		{
-			cc = "stdcall";
-		}
-		_ltiParser.parseInto(file, _ltiModule, typeWidths, cc);
+		parser.indexFunctions(file, _ltiModule->getContext(), typeWidths, cc);
+		_ltiParsers.push_back(std::move(parser));
 	}
 }
 
-bool Lti::hasLtiFunction(const std::string& name)
+/**
+ * Parse and index the given LTI files once, so that instances created later
+ * (e.g. for other inputs decompiled by the same process or by processes
+ * forked from it) do not have to read and parse them again. The instances
+ * only read the indexed files, so they share them.
+ *
+ * Files that cannot be parsed are not preloaded, so they are handled by the
+ * instances as if this was not called.
+ *
+ * The preloaded files are not synchronized, so this has to be called before
+ * any decompilation starts.
+ */
+void Lti::preloadLtiFiles(const std::set<std::string>& filePaths)
 {
-	return getLtiFunction(name) != nullptr;
+	for (auto& filePath : filePaths)
+	{
+		std::ifstream file(filePath, std::ios::binary);
+		if (!file)
+		{
+			continue;
+		}
+
+		try
+		{
+			_preloadedFiles[filePath] =
+					ctypesparser::JSONCTypesParser::indexJson(file);
+		}
+		catch (const ctypesparser::CTypesParseError&)
+		{
+			// Left to loadLtiFile().
+		}
+	}
 }
 
+/**
+ * Find LTI function with @c name. Its declaration is created from the first
+ * loaded LTI file that contains it when it is asked for the first time.
+ * @param[in]  name   Function name to find.
+ * @return LTI function for @c name, or @c nullptr if not found or if it is
+ *         not represented correctly in the LTI file.
+ */
 std::shared_ptr<retdec::ctypes::Function> Lti::getLtiFunction(
 		const std::string& name)
 {
-	return _ltiModule->getFunctionWithName(name);
+	if (auto ltiFnc = _ltiModule->getFunctionWithName(name))
+	{
+		return ltiFnc;
+	}
+
+	try
+	{
+		for (auto& parser : _ltiParsers)
+		{
+			if (auto ltiFnc = parser.parseIndexedFunction(name))
+			{
+				_ltiModule->addFunction(ltiFnc);
+				return ltiFnc;
+			}
+		}
+	}
+	catch (const ctypesparser::CTypesParseError&)
+	{
+		// The function is in the first file that contains it, but it is
+		// malformed there.
+	}
+
+	return nullptr;
 }
 
 /**
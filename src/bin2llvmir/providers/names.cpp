@@ -4,7 +4,15 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <llvm/Support/Endian.h>
+
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/utils/filesystem_path.h"
 #include "retdec/utils/string.h"
 
 using namespace retdec::utils;
@@ -12,6 +20,66 @@ using namespace retdec::utils;
 namespace retdec {
 namespace bin2llvmir {
 
+namespace {
+
+/**
+ * Read <ordinal number, function name> pairs from @a filePath into @a ordMap.
+ */
+bool readImportOrds(
+		const std::string& filePath,
+		std::map<int, std::string>& ordMap)
+{
+	std::ifstream inputFile;
+	inputFile.open(filePath);
+	if (!inputFile)
+	{
+		return false;
+	}
+
+	std::string line;
+	while (!getline(inputFile, line).eof())
+	{
+		std::stringstream ordDecl(line);
+
+		int ord = -1;
+		std::string funcName;
+		ordDecl >> ord >> funcName;
+		if (ord >= 0)
+		{
+			ordMap[ord] = funcName;
+		}
+	}
+
+	return true;
+}
+
+// Layout of the ordinal database, see support/install-ordinals.py.
+const char ordDatabaseMagic[] = "RDORDDB1";
+const std::size_t ordDatabaseMagicSize = sizeof(ordDatabaseMagic) - 1;
+const std::size_t ordDatabaseHeaderSize = ordDatabaseMagicSize + 8;
+const std::size_t ordDatabaseSlotSize = 20;
+
+uint32_t read32(const char* p)
+{
+	return llvm::support::endian::read32le(p);
+}
+
+/**
+ * FNV-1a hash of library name @a name used to find its slot in the ordinal
+ * database.
+ */
+uint32_t hashLibraryName(const std::string& name)
+{
+	uint32_t hash = 2166136261u;
+	for (unsigned char c : name)
+	{
+		hash = (hash ^ c) * 16777619u;
+	}
+	return hash;
+}
+
+} // anonymous namespace
+
 //
 //==============================================================================
 // names::
@@ -76,6 +144,7 @@ Name::Name(Config* c, const std::string& name, eType type, Lti* lti) :
 
 	fixPostfix();
 
+	// A function that is malformed in the LTI files is not there.
 	_inLti = lti->getLtiFunction(_name) != nullptr;
 }
 
@@ -255,12 +324,164 @@ bool Names::empty() const
 	return _names.empty();
 }
 
+//
+//==============================================================================
+// ImportOrdDatabase
+//==============================================================================
+//
+
+const std::string ImportOrdDatabase::fileName = "ordinals.db";
+
+ImportOrdDatabase::ImportOrdDatabase(
+		std::unique_ptr<llvm::MemoryBuffer> buffer,
+		uint32_t slotCount)
+		:
+		_buffer(std::move(buffer)),
+		_slotCount(slotCount)
+{
+
+}
+
+/**
+ * Open the ordinal database in file @a filePath.
+ * @return Database, or @c nullptr if the file does not exist or it is not
+ *         a valid database.
+ */
+std::unique_ptr<ImportOrdDatabase> ImportOrdDatabase::fromFile(
+		const std::string& filePath)
+{
+	auto buffer = llvm::MemoryBuffer::getFile(llvm::Twine(filePath));
+	if (!buffer)
+	{
+		return nullptr;
+	}
+
+	return fromBuffer(std::move(buffer.get()));
+}
+
+/**
+ * Create the ordinal database from the contents of a database file.
+ * @return Database, or @c nullptr if @a buffer is not a valid database.
+ */
+std::unique_ptr<ImportOrdDatabase> ImportOrdDatabase::fromBuffer(
+		std::unique_ptr<llvm::MemoryBuffer> buffer)
+{
+	if (buffer == nullptr
+			|| buffer->getBufferSize() < ordDatabaseHeaderSize
+			|| std::memcmp(
+					buffer->getBufferStart(),
+					ordDatabaseMagic,
+					ordDatabaseMagicSize) != 0)
+	{
+		return nullptr;
+	}
+
+	uint32_t slotCount = read32(buffer->getBufferStart() + ordDatabaseMagicSize);
+	if (slotCount == 0
+			|| (slotCount & (slotCount - 1)) != 0
+			|| buffer->getBufferSize() < ordDatabaseHeaderSize
+					+ uint64_t(slotCount) * ordDatabaseSlotSize)
+	{
+		return nullptr;
+	}
+
+	return std::unique_ptr<ImportOrdDatabase>(
+			new ImportOrdDatabase(std::move(buffer), slotCount));
+}
+
+/**
+ * Find the slot of library @a libName.
+ * @return Pointer to the slot in the database, or @c nullptr if the library is
+ *         not in the database.
+ */
+const char* ImportOrdDatabase::findLibrarySlot(const std::string& libName) const
+{
+	const char* data = _buffer->getBufferStart();
+	uint64_t size = _buffer->getBufferSize();
+
+	uint32_t mask = _slotCount - 1;
+	uint32_t i = hashLibraryName(libName) & mask;
+	for (uint32_t probes = 0; probes < _slotCount; ++probes, i = (i + 1) & mask)
+	{
+		const char* slot = data + ordDatabaseHeaderSize + i * ordDatabaseSlotSize;
+		uint32_t nameOffset = read32(slot);
+		if (nameOffset == 0)
+		{
+			return nullptr;
+		}
+
+		uint32_t nameSize = read32(slot + 4);
+		if (nameSize == libName.size()
+				&& uint64_t(nameOffset) + nameSize <= size
+				&& std::memcmp(data + nameOffset, libName.data(), nameSize) == 0)
+		{
+			return slot;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Check if there are ordinals of library @a libName (without suffix ".dll")
+ * in the database.
+ */
+bool ImportOrdDatabase::hasLibrary(const std::string& libName) const
+{
+	return findLibrarySlot(libName) != nullptr;
+}
+
+/**
+ * Get the name of the function imported by ordinal number @a ord from
+ * library @a libName (without suffix ".dll").
+ * @return Function name, or an empty string if it is not known.
+ */
+std::string ImportOrdDatabase::getFunctionName(
+		const std::string& libName,
+		int ord) const
+{
+	const char* slot = findLibrarySlot(libName);
+	if (slot == nullptr || ord < 0)
+	{
+		return std::string();
+	}
+
+	uint32_t firstOrd = read32(slot + 8);
+	uint32_t ordCount = read32(slot + 12);
+	uint32_t tableOffset = read32(slot + 16);
+	if (uint32_t(ord) < firstOrd || uint32_t(ord) - firstOrd >= ordCount)
+	{
+		return std::string();
+	}
+
+	const char* data = _buffer->getBufferStart();
+	uint64_t size = _buffer->getBufferSize();
+	uint64_t entryOffset = tableOffset + uint64_t(uint32_t(ord) - firstOrd) * 4;
+	if (entryOffset + 4 > size)
+	{
+		return std::string();
+	}
+
+	uint32_t nameOffset = read32(data + entryOffset);
+	if (nameOffset == 0 || nameOffset >= size)
+	{
+		return std::string();
+	}
+
+	const char* name = data + nameOffset;
+	return std::string(name, std::find(name, data + size, '\0'));
+}
+
 //
 //==============================================================================
 // NameContainer
 //==============================================================================
 //
 
+std::map<std::string, NameContainer::ImportOrdMap> NameContainer::_preloadedOrds;
+std::map<std::string, std::shared_ptr<const ImportOrdDatabase>>
+		NameContainer::_preloadedOrdDatabases;
+
 NameContainer::NameContainer(
 		llvm::Module*,
 		Config* c,
@@ -486,6 +707,14 @@ std::string NameContainer::getNameFromImportLibAndOrd(
 		const std::string& libName,
 		int ord)
 {
+	// Ordinal files that are not in the database (e.g. added after it was
+	// generated) are still read as text.
+	auto* db = getImportOrdDatabase();
+	if (db && db->hasLibrary(libName))
+	{
+		return db->getFunctionName(libName, ord);
+	}
+
 	auto it = _dllOrds.find(libName);
 	if (it == _dllOrds.end())
 	{
@@ -514,31 +743,90 @@ bool NameContainer::loadImportOrds(const std::string& libName)
 	auto dir = _config->getConfig().parameters.getOrdinalNumbersDirectory();
 	auto filePath = dir + "/" + libName + ".ord";
 
-	std::ifstream inputFile;
-	inputFile.open(filePath);
-	if (!inputFile)
+	auto preloaded = _preloadedOrds.find(filePath);
+	if (preloaded != _preloadedOrds.end())
 	{
-		return false;
+		_dllOrds.emplace(libName, preloaded->second);
+		return true;
 	}
 
-	std::string line;
 	ImportOrdMap ordMap;
-	while (!getline(inputFile, line).eof())
+	if (!readImportOrds(filePath, ordMap))
 	{
-		std::stringstream ordDecl(line);
+		return false;
+	}
+	_dllOrds.emplace(libName, ordMap);
 
-		int ord = -1;
-		std::string funcName;
-		ordDecl >> ord >> funcName;
-		if (ord >= 0)
+	return true;
+}
+
+/**
+ * Get the database of ordinals in the ordinal numbers directory. It is opened
+ * when it is needed for the first time.
+ * @return Database, or @c nullptr if there is no database in the directory.
+ */
+const ImportOrdDatabase* NameContainer::getImportOrdDatabase()
+{
+	if (!_ordDatabaseOpened)
+	{
+		_ordDatabaseOpened = true;
+
+		auto dir = _config->getConfig().parameters.getOrdinalNumbersDirectory();
+		auto preloaded = _preloadedOrdDatabases.find(dir);
+		if (preloaded != _preloadedOrdDatabases.end())
 		{
-			ordMap[ord] = funcName;
+			_ordDatabase = preloaded->second;
+		}
+		else
+		{
+			_ordDatabase = ImportOrdDatabase::fromFile(
+					dir + "/" + ImportOrdDatabase::fileName);
 		}
 	}
-	inputFile.close();
-	_dllOrds.emplace(libName, ordMap);
 
-	return true;
+	return _ordDatabase.get();
+}
+
+/**
+ * Open the ordinal database in directory @a dir, or if there is none, parse
+ * all the ordinal files (@c *.ord) in it, once, so that containers created
+ * later (e.g. for other inputs decompiled by the same process) do not have
+ * to do it again.
+ *
+ * The preloaded ordinals are not synchronized, so this has to be called
+ * before any decompilation starts.
+ */
+void NameContainer::preloadImportOrds(const std::string& dir)
+{
+	FilesystemPath dirPath(dir);
+	if (!dirPath.isDirectory())
+	{
+		return;
+	}
+
+	if (auto db = ImportOrdDatabase::fromFile(
+			dir + "/" + ImportOrdDatabase::fileName))
+	{
+		_preloadedOrdDatabases[dir] = std::move(db);
+		return;
+	}
+
+	for (auto* f : dirPath)
+	{
+		if (!f->isFile() || !endsWith(f->getPath(), ".ord"))
+		{
+			continue;
+		}
+
+		// Use the same path as loadImportOrds() does.
+		auto filePath = dir + "/" + stripDirs(f->getPath());
+
+		ImportOrdMap ordMap;
+		if (readImportOrds(f->getPath(), ordMap))
+		{
+			_preloadedOrds[filePath] = std::move(ordMap);
+		}
+	}
 }
 
 //
@@ -176,7 +176,7 @@ void dumpControFlowToJsonBasicBlock(
 		llvm::BasicBlock& bbEnd,
 		std::ostream &out)
 {
-	static auto* config = ConfigProvider::getConfig(bb.getModule());
+	auto* config = ConfigProvider::getConfig(bb.getModule());
 
 	auto start = getBasicBlockAddress(&bb);
 	auto end = getBasicBlockEndAddress(&bbEnd);
@@ -291,7 +291,7 @@ void dumpControFlowToJsonFunction(
 		llvm::Function& f,
 		std::ostream &out)
 {
-	static auto* config = ConfigProvider::getConfig(f.getParent());
+	auto* config = ConfigProvider::getConfig(f.getParent());
 
 	auto start = getFunctionAddress(&f);
 	auto end = getFunctionEndAddress(&f);
@@ -0,0 +1,62 @@
+/**
+ * @file src/bin2llvmir/utils/parallel.cpp
+ * @brief Running function-local work on several threads.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
+#include "retdec/utils/parallel.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Get the number of threads that function-local work in module @a m may use.
+ * It is taken from the module's config, @c 0 there means one thread per
+ * hardware thread.
+ */
+std::size_t getFunctionJobs(llvm::Module* m)
+{
+	auto* c = ConfigProvider::getConfig(m);
+	std::size_t jobs = c ? c->getConfig().parameters.getFunctionJobs() : 1;
+	if (jobs == 0)
+	{
+		jobs = retdec::utils::getHardwareJobs();
+	}
+	return jobs;
+}
+
+/**
+ * Call @a work for every function in @a fncs using up to @a jobs threads
+ * (the calling thread is one of them).
+ *
+ * LLVM allows concurrent reads of a module, but not concurrent
+ * modifications: even creating a constant or an instruction that uses
+ * a global variable changes data shared by all functions. Therefore,
+ * @a work may only read the IR and write into data owned by the processed
+ * function. Modifications of the module have to be made afterwards on the
+ * calling thread.
+ *
+ * If @a work throws, the exception is rethrown on the calling thread after
+ * all the threads have finished.
+ *
+ * This is why only the construction of reaching definitions and function
+ * hashing use it. Passes like StackAnalysis, LocalVars, IdiomsAnalysis,
+ * InstructionOptimizer and SimpleTypes create and replace instructions and
+ * constants while they analyze functions, and they use the provider
+ * registries and the SymbolicTree configuration, which are not
+ * synchronized, so they run serially.
+ */
+void runOnFunctions(
+		const std::vector<llvm::Function*>& fncs,
+		std::size_t jobs,
+		const std::function<void(llvm::Function*)>& work)
+{
+	retdec::utils::runInParallel(fncs.size(), jobs, [&](std::size_t i) {
+		work(fncs[i]);
+	});
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -13,6 +13,9 @@ const std::string JSON_keepAllFuncs             = "keepAllFuncs";
 const std::string JSON_selectedDecodeOnly       = "selectedDecodeOnly";
 const std::string JSON_outputFile               = "outputFile";
 const std::string JSON_ordinalNumDir            = "ordinalNumDirectory";
+const std::string JSON_yaraCacheDir             = "yaraCacheDirectory";
+const std::string JSON_staticCodeJobs           = "staticCodeJobs";
+const std::string JSON_functionJobs             = "functionJobs";
 const std::string JSON_userStaticSigPaths       = "userStaticSignPaths";
 const std::string JSON_staticSigPaths           = "staticSignPaths";
 const std::string JSON_libraryTypeInfoPaths     = "libraryTypeInfoPaths";
@@ -102,6 +105,21 @@ void Parameters::setOrdinalNumbersDirectory(const std::string& n)
 	_ordinalNumbersDirectory = n;
 }
 
+void Parameters::setYaraCacheDirectory(const std::string& n)
+{
+	_yaraCacheDirectory = n;
+}
+
+void Parameters::setStaticCodeJobs(std::size_t n)
+{
+	_staticCodeJobs = n;
+}
+
+void Parameters::setFunctionJobs(std::size_t n)
+{
+	_functionJobs = n;
+}
+
 std::string Parameters::getOutputFile() const
 {
 	return _outputFile;
@@ -112,6 +130,21 @@ std::string Parameters::getOrdinalNumbersDirectory() const
 	return _ordinalNumbersDirectory;
 }
 
+std::string Parameters::getYaraCacheDirectory() const
+{
+	return _yaraCacheDirectory;
+}
+
+std::size_t Parameters::getStaticCodeJobs() const
+{
+	return _staticCodeJobs;
+}
+
+std::size_t Parameters::getFunctionJobs() const
+{
+	return _functionJobs;
+}
+
 /**
  * Returns JSON object (associative array) holding parameters information.
  * @return JSON object.
@@ -126,6 +159,9 @@ Json::Value Parameters::getJsonValue() const
 	params[JSON_outputFile]         = getOutputFile();
 
 	if (!getOrdinalNumbersDirectory().empty()) params[JSON_ordinalNumDir] = getOrdinalNumbersDirectory();
+	if (!getYaraCacheDirectory().empty()) params[JSON_yaraCacheDir] = getYaraCacheDirectory();
+	if (getStaticCodeJobs() != 1) params[JSON_staticCodeJobs] = Json::UInt(getStaticCodeJobs());
+	if (getFunctionJobs() != 1) params[JSON_functionJobs] = Json::UInt(getFunctionJobs());
 
 	params[JSON_selectedRanges]       = selectedRanges.getJsonValue();
 
@@ -155,6 +191,9 @@ void Parameters::readJsonValue(const Json::Value& val)
 	setIsKeepAllFunctions( safeGetBool(val, JSON_keepAllFuncs) );
 	setIsSelectedDecodeOnly( safeGetBool(val, JSON_selectedDecodeOnly) );
 	setOrdinalNumbersDirectory( safeGetString(val, JSON_ordinalNumDir) );
+	setYaraCacheDirectory( safeGetString(val, JSON_yaraCacheDir) );
+	setStaticCodeJobs( safeGetUint(val, JSON_staticCodeJobs, 1) );
+	setFunctionJobs( safeGetUint(val, JSON_functionJobs, 1) );
 	setOutputFile( safeGetString(val, JSON_outputFile) );
 
 	selectedRanges.readJsonValue( val[JSON_selectedRanges] );
@@ -65,6 +65,7 @@ void printHelp()
 	std::cout << "\t--types path" << std::endl;
 	std::cout << "\t--abis path" << std::endl;
 	std::cout << "\t--ords path" << std::endl;
+	std::cout << "\t--yara-cache path" << std::endl;
 	std::cout << "\t--pdb-file path" << std::endl;
 	std::cout << "\t--input-file path" << std::endl;
 	std::cout << "\t--unpacked-in-file path" << std::endl;
@@ -321,6 +322,10 @@ int handleArguments(std::vector<std::string> &args)
 			{
 				config.parameters.setOrdinalNumbersDirectory(val);
 			}
+			else if (opt == "--yara-cache")
+			{
+				config.parameters.setYaraCacheDirectory(val);
+			}
 			else if (opt == "--pdb-file")
 			{
 				config.setPdbInputFile(val);
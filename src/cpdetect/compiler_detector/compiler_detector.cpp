@@ -12,6 +12,7 @@
 #include "retdec/cpdetect/compiler_detector/compiler_detector.h"
 #include "retdec/cpdetect/settings.h"
 #include "retdec/cpdetect/utils/version_solver.h"
+#include "retdec/yara-cache/yara_rule_cache.h"
 #include "yaracpp/yara_detector/yara_detector.h"
 
 using namespace retdec::fileformat;
@@ -340,13 +341,14 @@ void CompilerDetector::getAllHeuristics()
 ReturnCode CompilerDetector::getAllSignatures()
 {
 	YaraDetector yara;
+	yara_cache::YaraRuleCache cache(cpParams.yaraCacheDirectory);
 
 	// Add internal paths.
 	unsigned iCntr = 0;
 	for (const auto &ruleFile : internalPaths)
 	{
 		std::string nameSpace = "internal_" + std::to_string(iCntr++);
-		yara.addRuleFile(ruleFile, nameSpace);
+		yara.addRuleFile(cache.getRuleFile(ruleFile), nameSpace);
 	}
 
 	unsigned eCntr = 0;
@@ -355,7 +357,7 @@ ReturnCode CompilerDetector::getAllSignatures()
 		for (const auto &item : externalDatabase)
 		{
 			std::string nameSpace = "external_" + std::to_string(eCntr++);
-			yara.addRuleFile(item, nameSpace);
+			yara.addRuleFile(cache.getRuleFile(item), nameSpace);
 		}
 	}
 
@@ -7,6 +7,11 @@
 #include <algorithm>
 #include <map>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RETDEC_CPDETECT_SEARCH_SSE2
+#endif
+
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/equality.h"
@@ -31,19 +36,132 @@ const std::map<Architecture, std::vector<Search::RelativeJump>> jumpMap =
 	{Architecture::X86_64, {Search::RelativeJump("EB", 1), Search::RelativeJump("E9", 4)}}
 };
 
+const char hexDigits[] = "0123456789ABCDEF";
+
+/**
+ * Get value of hexadecimal digit in signature
+ * @param c Character of signature
+ * @return Value of digit or -1 if @a c is not an upper-case hexadecimal digit
+ */
+int hexDigitValue(char c)
+{
+	if(c >= '0' && c <= '9')
+	{
+		return c - '0';
+	}
+	else if(c >= 'A' && c <= 'F')
+	{
+		return c - 'A' + 10;
+	}
+
+	return -1;
+}
+
+/**
+ * Check if @a pattern matches @a content on byte offset @a offset
+ */
+bool matchesOnOffset(const unsigned char *content, std::size_t offset, const std::vector<unsigned char> &values, const std::vector<unsigned char> &masks)
+{
+	for(std::size_t i = 0, e = values.size(); i < e; ++i)
+	{
+		if((content[offset + i] & masks[i]) != values[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Find byte pattern in content
+ * @param content Searched content
+ * @param contentSize Size of @a content in bytes
+ * @param first First byte offset on which the pattern may start
+ * @param last Last byte offset on which the pattern may start
+ * @param values Values of significant bits of pattern bytes
+ * @param masks Significant bits of pattern bytes
+ * @return @c true if pattern was found, @c false otherwise
+ *
+ * Pattern must fit into the content on all offsets from @a first to @a last.
+ */
+bool findBytePattern(const unsigned char *content, std::size_t contentSize, std::size_t first, std::size_t last,
+	const std::vector<unsigned char> &values, const std::vector<unsigned char> &masks)
+{
+	auto offset = first;
+
+#ifdef RETDEC_CPDETECT_SEARCH_SSE2
+	// Filter 16 offsets at once by the first two bytes of the pattern
+	if(values.size() >= 2)
+	{
+		const auto value0 = _mm_set1_epi8(static_cast<char>(values[0]));
+		const auto mask0 = _mm_set1_epi8(static_cast<char>(masks[0]));
+		const auto value1 = _mm_set1_epi8(static_cast<char>(values[1]));
+		const auto mask1 = _mm_set1_epi8(static_cast<char>(masks[1]));
+
+		for(; offset + 15 <= last && offset + 17 <= contentSize; offset += 16)
+		{
+			const auto block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(content + offset));
+			const auto block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(content + offset + 1));
+			const auto candidates = _mm_and_si128(
+				_mm_cmpeq_epi8(_mm_and_si128(block0, mask0), value0),
+				_mm_cmpeq_epi8(_mm_and_si128(block1, mask1), value1));
+
+			for(unsigned bits = _mm_movemask_epi8(candidates), i = 0; bits; bits >>= 1, ++i)
+			{
+				if((bits & 1) && matchesOnOffset(content, offset + i, values, masks))
+				{
+					return true;
+				}
+			}
+		}
+	}
+#endif
+
+	for(; offset <= last; ++offset)
+	{
+		if(matchesOnOffset(content, offset, values, masks))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 } // anonymous namespace
 
 /**
  * Constructor
  * @param fileParser Parser of input file
  */
-Search::Search(retdec::fileformat::FileFormat &fileParser) : parser(fileParser), averageSlashLen(0)
+Search::Search(retdec::fileformat::FileFormat &fileParser) : parser(fileParser), content(nullptr), nibbleCount(0), averageSlashLen(0)
 {
 	const auto &bytes = parser.getLoadedBytes();
-	bytesToHexString(bytes, nibbles);
 	bytesToString(bytes, plain);
 	fileLoaded = !bytes.empty();
-	fileSupported = parser.hexToLittle(nibbles) && parser.getNumberOfNibblesInByte();
+
+	if(parser.isLittleEndian())
+	{
+		content = bytes.data();
+		nibbleCount = bytes.size() * 2;
+		fileSupported = parser.getNumberOfNibblesInByte();
+	}
+	else
+	{
+		// Reorder bytes exactly as the hexadecimal representation is reordered
+		std::string nibbles;
+		bytesToHexString(bytes, nibbles);
+		fileSupported = parser.hexToLittle(nibbles) && parser.getNumberOfNibblesInByte();
+		nibbleCount = nibbles.length();
+		swappedContent.resize((nibbleCount + 1) / 2);
+		for(std::size_t i = 0; i < nibbleCount; ++i)
+		{
+			swappedContent[i / 2] |= hexDigitValue(nibbles[i]) << (i % 2 ? 0 : 4);
+		}
+		content = swappedContent.data();
+	}
+
 	jumps = mapGetValueOrDefault(jumpMap, parser.getTargetArchitecture(), std::vector<RelativeJump>());
 
 	for(std::size_t i = 0, e = jumps.size(); i < e; ++i)
@@ -124,6 +242,86 @@ bool Search::haveSlashes() const
 	return !jumps.empty();
 }
 
+/**
+ * Get nibble of content in hexadecimal representation
+ * @param nibbleIndex Index of nibble (must be lower than number of nibbles)
+ * @return Upper-case hexadecimal digit
+ */
+char Search::getNibble(std::size_t nibbleIndex) const
+{
+	const auto byte = content[nibbleIndex / 2];
+	return hexDigits[nibbleIndex % 2 ? byte & 0x0F : byte >> 4];
+}
+
+/**
+ * Check if content has hexadecimal string @a hexString on specified position
+ * @param hexString Hexadecimal string
+ * @param nibbleIndex Index of first nibble
+ * @return @c true if content has @a hexString on position @a nibbleIndex, @c false otherwise
+ */
+bool Search::hasNibblesOnPosition(const std::string &hexString, std::size_t nibbleIndex) const
+{
+	if(nibbleIndex >= nibbleCount || hexString.length() > nibbleCount - nibbleIndex)
+	{
+		return false;
+	}
+
+	for(std::size_t i = 0, e = hexString.length(); i < e; ++i)
+	{
+		if(getNibble(nibbleIndex + i) != hexString[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Get signature without slashes compiled into byte patterns
+ * @param signPattern Signature pattern
+ * @return Compiled signature (compilation is done only once for each signature)
+ */
+const Search::CompiledSignature& Search::getCompiledSignature(const std::string &signPattern) const
+{
+	auto it = compiledSignatures.find(signPattern);
+	if(it != compiledSignatures.end())
+	{
+		return it->second;
+	}
+
+	auto &compiled = compiledSignatures[signPattern];
+	for(std::size_t shift = 0; shift < 2; ++shift)
+	{
+		auto &pattern = compiled.patterns[shift];
+		pattern.values.assign((shift + signPattern.length() + 1) / 2, 0);
+		pattern.masks.assign(pattern.values.size(), 0);
+
+		for(std::size_t i = 0, e = signPattern.length(); i < e; ++i)
+		{
+			const auto c = signPattern[i];
+			if(c == '-' || c == '?' || c == ';')
+			{
+				continue;
+			}
+
+			const auto value = hexDigitValue(c);
+			if(value < 0)
+			{
+				return compiled;
+			}
+
+			const auto nibbleIndex = shift + i;
+			const auto bitShift = nibbleIndex % 2 ? 0 : 4;
+			pattern.values[nibbleIndex / 2] |= value << bitShift;
+			pattern.masks[nibbleIndex / 2] |= 0x0F << bitShift;
+		}
+	}
+
+	compiled.valid = true;
+	return compiled;
+}
+
 /**
  * Count number of nibbles from number of bytes
  * @param nBytes Number of bytes
@@ -162,15 +360,6 @@ bool Search::isFileSupported() const
 	return fileSupported;
 }
 
-/**
- * Get content of file in hexadecimal string representation
- * @return Content of file in hexadecimal string representation
- */
-const std::string& Search::getNibbles() const
-{
-	return nibbles;
-}
-
 /**
  * Get content of file as plain string
  * @return Content of file as plain string
@@ -196,8 +385,8 @@ const Search::RelativeJump* Search::getRelativeJump(std::size_t fileOffset, std:
 	for(const auto &jump : jumps)
 	{
 		const auto nibblesAfter = nibblesFromBytes(jump.getBytesAfter());
-		if(!hasSubstringOnPosition(nibbles, jump.getSlash(), nibbleOffset) ||
-			(nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1 >= nibbles.length()))
+		if(!hasNibblesOnPosition(jump.getSlash(), nibbleOffset) ||
+			(nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1 >= nibbleCount))
 		{
 			continue;
 		}
@@ -272,17 +461,39 @@ unsigned long long Search::findUnslashedSignature(const std::string &signPattern
 		return 0;
 	}
 
-	const auto startIterator = nibbles.begin() + nibblesFromBytes(startOffset);
-	const auto stopIndex = nibblesFromBytes(stopOffset) + 1;
-	const auto stopIterator = stopIndex < nibbles.size() ? nibbles.begin() + stopIndex : nibbles.end();
-	const auto it = std::search(startIterator, stopIterator, signPattern.begin(), signPattern.end(),
-		[] (const char fileNibble, const char signatureNibble)
+	// Pattern has to lie in nibbles <startIndex, stopIndex)
+	const auto startIndex = nibblesFromBytes(startOffset);
+	const auto stopIndex = std::min(nibblesFromBytes(stopOffset) + 1, nibbleCount);
+	const auto signLen = signPattern.length();
+	if(signPattern.empty() || startIndex >= stopIndex || stopIndex - startIndex < signLen)
+	{
+		return 0;
+	}
+
+	const auto &compiled = getCompiledSignature(signPattern);
+	if(!compiled.valid)
+	{
+		return 0;
+	}
+
+	// Signature may start in both nibbles of a byte
+	const auto lastIndex = stopIndex - signLen;
+	for(std::size_t shift = 0; shift < 2; ++shift)
+	{
+		const auto firstByte = (startIndex + 1 - shift) / 2;
+		if(lastIndex < shift || firstByte > (lastIndex - shift) / 2)
+		{
+			continue;
+		}
+
+		const auto &pattern = compiled.patterns[shift];
+		if(findBytePattern(content, (nibbleCount + 1) / 2, firstByte, (lastIndex - shift) / 2, pattern.values, pattern.masks))
 		{
-			return fileNibble == signatureNibble || signatureNibble == '-' || signatureNibble == '?' || signatureNibble == ';';
+			return countImpNibbles(signPattern);
 		}
-	);
+	}
 
-	return (it != stopIterator) ? countImpNibbles(signPattern) : 0;
+	return 0;
 }
 
 /**
@@ -328,7 +539,7 @@ unsigned long long Search::findSlashedSignature(const std::string &signPattern,
  */
 unsigned long long Search::exactComparison(const std::string &signPattern, std::size_t fileOffset, std::size_t shift) const
 {
-	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbles.length();
+	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbleCount;
 		fileIndex < fileLen; ++sigIndex, ++fileIndex)
 	{
 		if(sigIndex == signPattern.length() || signPattern[sigIndex] == ';')
@@ -354,7 +565,7 @@ unsigned long long Search::exactComparison(const std::string &signPattern, std::
 			// move after one nibble is in header of cycle
 			fileIndex += jump->getSlashNibbleSize() + nibblesFromBytes(jump->getBytesAfter()) + moveSize - 1;
 		}
-		else if(signPattern[sigIndex] != nibbles[fileIndex] && signPattern[sigIndex] != '-' && signPattern[sigIndex] != '?')
+		else if(signPattern[sigIndex] != getNibble(fileIndex) && signPattern[sigIndex] != '-' && signPattern[sigIndex] != '?')
 		{
 			return 0;
 		}
@@ -377,7 +588,7 @@ bool Search::countSimilarity(const std::string &signPattern, Similarity &sim, st
 {
 	Similarity result;
 
-	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbles.length(); fileIndex < fileLen; ++sigIndex, ++fileIndex)
+	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbleCount; fileIndex < fileLen; ++sigIndex, ++fileIndex)
 	{
 		if(sigIndex == signPattern.length() || signPattern[sigIndex] == ';')
 		{
@@ -413,7 +624,7 @@ bool Search::countSimilarity(const std::string &signPattern, Similarity &sim, st
 			}
 			continue;
 		}
-		else if(signPattern[sigIndex] == nibbles[fileIndex])
+		else if(signPattern[sigIndex] == getNibble(fileIndex))
 		{
 			++result.same;
 		}
@@ -551,7 +762,7 @@ bool Search::createSignature(std::string &pattern, std::size_t fileOffset, std::
 {
 	pattern.clear();
 
-	for(std::size_t i = 0, fileIndex = nibblesFromBytes(fileOffset), fileLen = nibbles.length(), nibbleSize = nibblesFromBytes(size);
+	for(std::size_t i = 0, fileIndex = nibblesFromBytes(fileOffset), fileLen = nibbleCount, nibbleSize = nibblesFromBytes(size);
 		fileIndex < fileLen && i < nibbleSize; ++i, ++fileIndex)
 	{
 		std::int64_t moveSize = 0;
@@ -564,7 +775,7 @@ bool Search::createSignature(std::string &pattern, std::size_t fileOffset, std::
 		}
 		else
 		{
-			pattern += nibbles[fileIndex];
+			pattern += getNibble(fileIndex);
 		}
 	}
 
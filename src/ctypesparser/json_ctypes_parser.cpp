@@ -186,7 +186,7 @@ JSONCTypesParser::JSONCTypesParser(unsigned defaultBitWidth):
 *
 * @throw CTypesParseError
 */
-void JSONCTypesParser::handleParsingFailure(const rapidjson::ParseResult &err) const
+void JSONCTypesParser::handleParsingFailure(const rapidjson::ParseResult &err)
 {
 	std::ostringstream errMsg;
 	errMsg << "Failed to parse JSON.\n";
@@ -251,10 +251,136 @@ void JSONCTypesParser::parseInto(
 	parseJsonIntoModule(root, module);
 }
 
+/**
+* @brief Parses JSON representation of C-types and indexes its functions and
+*        types by their names.
+*
+* @param[in] stream Input stream containing C-types in JSON.
+*
+* @throw CTypesParseError when the input JSON is invalid.
+*
+* The returned JSON can be shared by several parsers, see indexFunctions(). No
+* C-types are created here.
+*/
+std::shared_ptr<const JSONCTypesParser::IndexedJson> JSONCTypesParser::indexJson(
+	std::istream &stream)
+{
+	auto json = std::make_shared<IndexedJson>();
+
+	std::string text = loadJson(stream);
+	// The rapidjson library requires a null-terminated string.
+	json->text.assign(text.begin(), text.end());
+	json->text.push_back('\0');
+	json->root = parseJson(json->text.data());
+
+	const rapidjson::Value &types = safeGetObject(*json->root, JSON_types);
+	for (auto i = types.MemberBegin(), e = types.MemberEnd(); i != e; ++i)
+	{
+		json->types.emplace(i->name.GetString(), i);
+	}
+	const rapidjson::Value &functions = safeGetObject(*json->root, JSON_functions);
+	for (auto i = functions.MemberBegin(), e = functions.MemberEnd(); i != e; ++i)
+	{
+		json->functions.emplace(i->name.GetString(), i);
+	}
+
+	return json;
+}
+
+/**
+* @brief Indexes functions from JSON that has already been indexed by
+*        indexJson() so that they can be parsed later, one by one.
+*
+* @param[in] json Indexed JSON. It is only read, so it may be shared with
+*                 other parsers.
+* @param[in] context Container where parsed functions and types are stored.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* C-types of a function (and of the types it uses) are created by
+* parseIndexedFunction() when the function is asked for, so loading a large
+* JSON from which only a few functions are needed is cheap. The index is
+* discarded when another JSON is parsed by this parser.
+*
+* Call convention is used when function itself does not specify its call
+* convention.
+*/
+void JSONCTypesParser::indexFunctions(
+	const std::shared_ptr<const IndexedJson> &json,
+	const std::shared_ptr<retdec::ctypes::Context> &context,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(json && "violated precondition - json cannot be null");
+	assert(context && "violated precondition - context cannot be null");
+
+	this->context = context;
+	defaultCallConv = callConvention;
+	this->typeWidths = typeWidths;
+
+	parserContext.clear();
+	typesMap.clear();
+	indexedJson = json;
+}
+
+/**
+* @brief Indexes functions from JSON representation so that they can be parsed
+*        later, one by one.
+*
+* @param[in] stream Input stream containing C-types in JSON.
+* @param[in] context Container where parsed functions and types are stored.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @throw CTypesParseError when the input JSON is invalid.
+*
+* The same as indexFunctions() with the JSON from indexJson(), which is not
+* shared with other parsers.
+*/
+void JSONCTypesParser::indexFunctions(
+	std::istream &stream,
+	const std::shared_ptr<retdec::ctypes::Context> &context,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	indexFunctions(indexJson(stream), context, typeWidths, callConvention);
+}
+
+/**
+* @brief Returns @c true if the function is indexed by indexFunctions(), @c
+*        false otherwise.
+*/
+bool JSONCTypesParser::hasIndexedFunction(const std::string &name) const
+{
+	return indexedJson && retdec::utils::mapHasKey(indexedJson->functions, name);
+}
+
+/**
+* @brief Returns function indexed by indexFunctions(), parsing it if needed.
+*
+* @param name Name of the function.
+*
+* @return Requested function. If it is not indexed, returns @c nullptr.
+*
+* @throw CTypesParseError when the function is not represented correctly.
+*/
+std::shared_ptr<retdec::ctypes::Function> JSONCTypesParser::parseIndexedFunction(
+	const std::string &name)
+{
+	if (!indexedJson)
+	{
+		return nullptr;
+	}
+
+	auto it = indexedJson->functions.find(name);
+	return it != indexedJson->functions.end() ?
+		getOrParseFunction(name, it->second->value) : nullptr;
+}
+
 /**
 * @brief Loads JSON from the input stream to a string.
 */
-std::string JSONCTypesParser::loadJson(std::istream &stream) const
+std::string JSONCTypesParser::loadJson(std::istream &stream)
 {
 	std::ostringstream sstr;
 	sstr << stream.rdbuf();
@@ -270,7 +396,7 @@ std::string JSONCTypesParser::loadJson(std::istream &stream) const
 *
 * @throw CTypesParseError when the input JSON is invalid.
 */
-std::unique_ptr<rapidjson::Document> JSONCTypesParser::parseJson(char *buffer) const
+std::unique_ptr<rapidjson::Document> JSONCTypesParser::parseJson(char *buffer)
 {
 	auto root = std::make_unique<rapidjson::Document>();
 	rapidjson::ParseResult res = root->ParseInsitu(buffer);
@@ -295,6 +421,7 @@ void JSONCTypesParser::parseJsonIntoModule(
 {
 	// We need a clean context for each JSON because types may have different keys.
 	parserContext.clear();
+	indexedJson.reset();
 	const rapidjson::Value &functions = safeGetObject(*root, JSON_functions);
 
 	addTypesToMap(safeGetObject(*root, JSON_types));
@@ -523,7 +650,9 @@ std::shared_ptr<retdec::ctypes::Type> JSONCTypesParser::getOrParseType(
 std::shared_ptr<retdec::ctypes::Type> JSONCTypesParser::parseType(
 	const std::string &typeKey)
 {
-	const rapidjson::Value &jsonType = retdec::utils::mapGetValueOrDefault(typesMap, typeKey)->value;
+	// Types of indexed JSON are indexed together with its functions.
+	const TypesMap &types = indexedJson ? indexedJson->types : typesMap;
+	const rapidjson::Value &jsonType = retdec::utils::mapGetValueOrDefault(types, typeKey)->value;
 	std::string typeOfType = safeGetString(jsonType, JSON_type);
 	std::shared_ptr<retdec::ctypes::Type> parsedType;
 
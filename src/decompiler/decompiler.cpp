@@ -0,0 +1,629 @@
+/**
+ * @file src/decompiler/decompiler.cpp
+ * @brief Single-process decompilation of a binary file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ *
+ * The decompilation is done in the same way as in the retdec-decompiler.py
+ * script, but all the phases (file detection, bin2llvmir, llvmir2hll) share
+ * one LLVM module and one config DB instead of passing intermediate files
+ * between separate processes.
+ */
+
+#include <algorithm>
+#include <memory>
+
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Analysis/ScalarEvolution.h>
+#include <llvm/Analysis/TargetLibraryInfo.h>
+#include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/IR/IRPrintingPasses.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/InitializePasses.h>
+#include <llvm/PassRegistry.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/ToolOutputFile.h>
+
+#include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
+#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/cpdetect/errors.h"
+#include "retdec/cpdetect/settings.h"
+#include "retdec/decompiler/decompiler.h"
+#include "retdec/fileformat/utils/format_detection.h"
+#include "retdec/llvm-support/diagnostics.h"
+#include "retdec/llvmir2hll/config/configs/json_config.h"
+#include "retdec/utils/binary_path.h"
+#include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/memory.h"
+#include "retdec/utils/string.h"
+#include "retdec/yara-cache/yara_rule_cache.h"
+#include "fileinfo/file_detector/detector_factory.h"
+#include "fileinfo/file_presentation/config_presentation.h"
+#include "fileinfo/pattern_detector/pattern_detector.h"
+
+using namespace retdec::utils;
+using retdec::llvm_support::printErrorMessage;
+using retdec::llvm_support::printPhase;
+
+namespace retdec {
+namespace decompiler {
+
+namespace {
+
+const std::string TYPES_SUFFIX = ".json";
+const std::set<std::string> SIGNATURE_SUFFIXES = {".yar", ".yara", ".yarac"};
+
+/**
+ * Pseudo-pass name which is replaced by the provider initialization that
+ * uses the in-memory config.
+ */
+const std::string PROVIDER_INIT_PASS = "provider-init";
+
+/**
+ * bin2llvmir passes in the order in which they are run. The list is generated
+ * from BIN2LLVMIR_PARAMS in retdec-config.py.
+ */
+const std::vector<std::string> BIN2LLVMIR_PASSES =
+#include "bin2llvmir_passes.inc"
+;
+
+bool hasEnding(const std::string& str, const std::set<std::string>& suffixes)
+{
+	return std::any_of(suffixes.begin(), suffixes.end(),
+		[&] (const auto& suffix) { return endsWith(str, suffix); });
+}
+
+/**
+ * Recursively find all the files with the given suffixes in the directory.
+ */
+void getDirFiles(
+		const std::string& dirPath,
+		std::set<std::string>& ret,
+		const std::set<std::string>& suffixes)
+{
+	FilesystemPath fsp(dirPath);
+	if (!fsp.isDirectory())
+	{
+		return;
+	}
+
+	for (auto f : fsp)
+	{
+		if (f->isDirectory())
+		{
+			getDirFiles(f->getPath(), ret, suffixes);
+		}
+		else if (f->isFile() && hasEnding(f->getPath(), suffixes))
+		{
+			auto p = fsp.separator() == '\\'
+					? replaceAll(f->getPath(), "\\", "/")
+					: f->getPath();
+			ret.insert(p);
+		}
+	}
+}
+
+std::string joinPath(const std::string& base, const std::string& path)
+{
+	FilesystemPath p(base);
+	p.append(path);
+	return p.getPath();
+}
+
+std::string getSupportDirectory(const DecompilationParams& params)
+{
+	if (!params.supportDirectory.empty())
+	{
+		return params.supportDirectory;
+	}
+
+	return joinPath(
+			getThisBinaryDirectoryPath().getPath(),
+			"../share/retdec/support");
+}
+
+/**
+ * Get the directory with ordinal numbers for the architecture directory
+ * @a archDir (e.g. @c x86) in the support directory.
+ */
+std::string getOrdinalNumbersDirectory(
+		const std::string& supportDir,
+		const std::string& archDir)
+{
+	return joinPath(supportDir, archDir + "/ords") + "/";
+}
+
+/**
+ * Limit the maximal memory of the whole decompilation.
+ */
+bool limitMaximalMemoryIfRequested(const DecompilationParams& params)
+{
+	if (params.maxMemoryHalfRAM)
+	{
+		if (!limitSystemMemoryToHalfOfTotalSystemMemory())
+		{
+			printErrorMessage("Failed to limit maximal memory to half of system RAM.");
+			return false;
+		}
+	}
+	else if (params.maxMemory > 0)
+	{
+		if (!limitSystemMemory(params.maxMemory))
+		{
+			printErrorMessage("Failed to limit maximal memory to "
+					+ std::to_string(params.maxMemory) + ".");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Gather information about the input file into the config.
+ * This is what retdec-fileinfo does when it is run with the -c option.
+ */
+bool detectFile(
+		const DecompilationParams& params,
+		const std::string& supportDir,
+		retdec::config::Config& config)
+{
+	using namespace retdec::cpdetect;
+	using namespace retdec::fileformat;
+
+	DetectParams searchPar(SearchType::MOST_SIMILAR, true, false, EP_BYTES_SIZE);
+	searchPar.yaraCacheDirectory = params.yaraCacheDirectory;
+	auto loadFlags = static_cast<LoadFlags>(LoadFlags::NO_FILE_HASHES
+			| LoadFlags::NO_VERBOSE_HASHES);
+
+	auto fileFormat = detectFileFormat(params.inputFile, config.fileFormat.isRaw());
+	if (fileFormat == Format::UNDETECTABLE)
+	{
+		printErrorMessage("Cannot open the input file ", params.inputFile, ".");
+		return false;
+	}
+
+	fileinfo::FileInformation fileInfo;
+	fileInfo.setPathToFile(params.inputFile);
+	fileInfo.setFileFormatEnum(fileFormat);
+
+	std::unique_ptr<fileinfo::FileDetector> fileDetector(
+			fileinfo::createFileDetector(
+					params.inputFile,
+					fileFormat,
+					fileInfo,
+					searchPar,
+					loadFlags));
+	if (!fileDetector)
+	{
+		printErrorMessage("Unsupported format of the input file ", params.inputFile, ".");
+		return false;
+	}
+	if (!fileDetector->getFileParser()->isInValidState())
+	{
+		printErrorMessage("Failed to parse the input file ", params.inputFile, ".");
+		return false;
+	}
+
+	fileDetector->setConfigFile(config);
+	fileDetector->getAllInformation();
+
+	auto signsrchDir = joinPath(supportDir, "generic/yara_patterns/signsrch");
+	std::set<std::string> cryptoPaths = {
+		joinPath(signsrchDir, "signsrch.yara"),
+		joinPath(signsrchDir, "signsrch.yarac")
+	};
+	if (params.useAllExternalPatterns)
+	{
+		cryptoPaths.insert(joinPath(signsrchDir, "signsrch_regex.yara"));
+		cryptoPaths.insert(joinPath(signsrchDir, "signsrch_regex.yarac"));
+	}
+	fileinfo::PatternDetector patternDetector(fileDetector->getFileParser(), fileInfo);
+	patternDetector.addFilePaths("crypto", cryptoPaths);
+	patternDetector.analyze();
+
+	if (isFatalError(fileInfo.getStatus()))
+	{
+		printErrorMessage("Failed to gather information about ", params.inputFile, ".");
+		return false;
+	}
+
+	fileinfo::ConfigPresentation presentation(fileInfo, config);
+	if (!presentation.present())
+	{
+		printErrorMessage("Loading of config failed: ",
+				presentation.getErrorMessage(), ".");
+		return false;
+	}
+	config = presentation.getConfig();
+
+	return true;
+}
+
+/**
+ * Fill the config with the decompilation parameters that the script writes
+ * into it by the retdec-config tool.
+ */
+bool fillConfig(
+		const DecompilationParams& params,
+		const std::string& supportDir,
+		retdec::config::Config& config)
+{
+	if (!params.arch.empty())
+	{
+		config.architecture.setName(params.arch);
+	}
+
+	// Full name of the architecture may contain comments in parentheses.
+	auto archName = toLower(config.architecture.getName());
+	archName = archName.substr(0, archName.find(' '));
+
+	std::string ordsDir;
+	if (archName == "arm" || archName == "thumb")
+	{
+		ordsDir = getOrdinalNumbersDirectory(supportDir, "arm");
+	}
+	else if (archName == "x86" || archName == "x86-64")
+	{
+		ordsDir = getOrdinalNumbersDirectory(supportDir, "x86");
+	}
+	else if (archName != "powerpc" && archName != "mips" && archName != "pic32")
+	{
+		printErrorMessage("Unsupported target architecture '", archName,
+				"'. Supported architectures: Intel x86, Intel x86-64, ARM,"
+				" ARM + Thumb, MIPS, PIC32, PowerPC.");
+		return false;
+	}
+
+	auto format = config.fileFormat.getName();
+	auto fileClass = std::to_string(config.fileFormat.getFileClassBits());
+	if (fileClass != "16" && fileClass != "32" && fileClass != "64")
+	{
+		printErrorMessage("Unsupported target format '", toUpper(format),
+				fileClass, "'. Supported formats: ELF32, ELF64, PE32,"
+				" Intel HEX 32, Mach-O 32.");
+		return false;
+	}
+	if (fileClass == "64" && archName != "x86-64")
+	{
+		printErrorMessage("Unsupported target format and architecture"
+				" combination: '", toUpper(format), fileClass, "' + '",
+				archName, "'.");
+		return false;
+	}
+
+	if (!config.architecture.isEndianKnown())
+	{
+		printErrorMessage("Cannot determine endiannesss.");
+		return false;
+	}
+
+	// Statically linked code signatures.
+	auto sigFormat = (format == "ihex" || format == "raw") ? "elf" : format;
+	auto sigEndian = config.architecture.isEndianLittle() ? "le" : "be";
+	auto sigArch = archName == "pic32" ? "mips"
+			: archName == "x86-64" ? "x86"
+			: archName;
+	if (!params.noDefaultStaticSignatures)
+	{
+		auto sigDir = joinPath(supportDir, "generic/yara_patterns/static-code/"
+				+ sigFormat + "/" + fileClass + "/" + sigEndian + "/" + sigArch);
+		getDirFiles(sigDir, config.parameters.staticSignaturePaths, SIGNATURE_SUFFIXES);
+	}
+	for (auto& s : params.userStaticSignatures)
+	{
+		config.parameters.userStaticSignaturePaths.insert(s);
+	}
+	config.parameters.setYaraCacheDirectory(params.yaraCacheDirectory);
+	config.parameters.setStaticCodeJobs(params.staticCodeJobs);
+	config.parameters.setFunctionJobs(params.functionJobs);
+
+	getDirFiles(
+			joinPath(supportDir, "generic/types"),
+			config.parameters.libraryTypeInfoPaths,
+			{TYPES_SUFFIX});
+
+	if (!ordsDir.empty() && FilesystemPath(ordsDir).isDirectory())
+	{
+		config.parameters.setOrdinalNumbersDirectory(ordsDir);
+	}
+
+	if (!params.pdbFile.empty())
+	{
+		config.setPdbInputFile(params.pdbFile);
+	}
+
+	config.setInputFile(params.inputFile);
+	config.parameters.setOutputFile(params.outputFile);
+
+	if (params.keepUnreachableFuncs)
+	{
+		config.parameters.setIsKeepAllFunctions(true);
+	}
+
+	config.parameters.setIsSelectedDecodeOnly(params.selectedDecodeOnly);
+	for (auto& f : params.selectedFunctions)
+	{
+		config.parameters.selectedFunctions.insert(f);
+	}
+	for (auto& r : params.selectedRanges)
+	{
+		config.parameters.selectedRanges.insert(retdec::config::AddressRangeJson(r));
+	}
+
+	return true;
+}
+
+/**
+ * Call a bunch of LLVM initialization functions, same as bin2llvmir does.
+ * This is done only once per process.
+ */
+void initializeLlvmPasses()
+{
+	static bool initialized = false;
+	if (initialized)
+	{
+		return;
+	}
+
+	llvm::PassRegistry& registry = *llvm::PassRegistry::getPassRegistry();
+	llvm::initializeCore(registry);
+	llvm::initializeScalarOpts(registry);
+	llvm::initializeIPO(registry);
+	llvm::initializeAnalysis(registry);
+	llvm::initializeTransformUtils(registry);
+	llvm::initializeInstCombine(registry);
+	llvm::initializeTarget(registry);
+
+	initialized = true;
+}
+
+/**
+ * Create an empty input module.
+ */
+std::unique_ptr<llvm::Module> createLlvmModule(llvm::LLVMContext& context)
+{
+	llvm::SMDiagnostic err;
+
+	std::string c = "; ModuleID = 'test'\nsource_filename = \"test\"\n";
+	auto mb = llvm::MemoryBuffer::getMemBuffer(c);
+	return llvm::parseIR(mb->getMemBufferRef(), err, context);
+}
+
+/**
+ * Create all bin2llvmir passes and add them to the pass manager.
+ */
+bool addBin2llvmirPasses(
+		const DecompilationParams& params,
+		retdec::config::Config& config,
+		llvm::legacy::PassManager& pm)
+{
+	llvm::PassRegistry& registry = *llvm::PassRegistry::getPassRegistry();
+
+	for (auto& name : getDefaultBin2llvmirPasses())
+	{
+		if (name == "unreachable-funcs" && params.keepUnreachableFuncs)
+		{
+			continue;
+		}
+
+		if (name == PROVIDER_INIT_PASS)
+		{
+			pm.add(new bin2llvmir::ProviderInitialization(&config));
+			continue;
+		}
+
+		auto* passInfo = registry.getPassInfo(name);
+		if (passInfo == nullptr || !passInfo->getNormalCtor())
+		{
+			printErrorMessage("Cannot create pass: ", name, ".");
+			return false;
+		}
+
+		pm.add(passInfo->getNormalCtor()());
+	}
+
+	pm.add(llvm::createVerifierPass());
+	return true;
+}
+
+/**
+ * Write the final LLVM IR next to the output file.
+ */
+void emitLlvmIr(const DecompilationParams& params, llvm::Module& module)
+{
+	auto out = params.outputFile;
+	auto lastDot = out.find_last_of('.');
+	auto llOut = lastDot != std::string::npos
+			? out.substr(0, lastDot) + ".ll"
+			: out + ".ll";
+
+	std::error_code ec;
+	llvm::ToolOutputFile llFile(llOut, ec, llvm::sys::fs::F_None);
+	if (ec)
+	{
+		printErrorMessage("Failed to create ", llOut, ": ", ec.message());
+		return;
+	}
+	module.print(llFile.os(), nullptr);
+	llFile.keep();
+}
+
+} // anonymous namespace
+
+/**
+ * Get names of the bin2llvmir passes that are run during the decompilation.
+ */
+const std::vector<std::string>& getDefaultBin2llvmirPasses()
+{
+	return BIN2LLVMIR_PASSES;
+}
+
+/**
+ * Initialize read-only resources that are shared by all the decompilations
+ * run by this process and by processes forked from it afterwards: LLVM
+ * passes, library type information, ordinal numbers, and compiled YARA
+ * signatures of statically linked code (if @a params has a YARA cache
+ * directory).
+ *
+ * Calling this is optional because decompile() loads everything it needs on
+ * its own. It pays off in long-lived workers that decompile many files. It
+ * has to be called before the first decompilation starts.
+ */
+void initializeSharedResources(const DecompilationParams& params)
+{
+	initializeLlvmPasses();
+
+	auto supportDir = getSupportDirectory(params);
+
+	std::set<std::string> ltiFiles;
+	getDirFiles(joinPath(supportDir, "generic/types"), ltiFiles, {TYPES_SUFFIX});
+	bin2llvmir::Lti::preloadLtiFiles(ltiFiles);
+
+	for (auto& archDir : {"arm", "x86"})
+	{
+		bin2llvmir::NameContainer::preloadImportOrds(
+				getOrdinalNumbersDirectory(supportDir, archDir));
+	}
+
+	if (!params.yaraCacheDirectory.empty())
+	{
+		std::set<std::string> signatures = params.userStaticSignatures;
+		if (!params.noDefaultStaticSignatures)
+		{
+			getDirFiles(
+					joinPath(supportDir, "generic/yara_patterns/static-code"),
+					signatures,
+					SIGNATURE_SUFFIXES);
+		}
+
+		yara_cache::YaraRuleCache cache(params.yaraCacheDirectory);
+		for (auto& s : signatures)
+		{
+			cache.getRuleFile(s);
+		}
+	}
+}
+
+/**
+ * Decompile the input file into the target high-level language.
+ *
+ * Everything is done in the calling process: the input is parsed by the file
+ * detector, the config is kept in memory, bin2llvmir passes are run on an
+ * in-memory LLVM module, and the module is handed to llvmir2hll directly.
+ */
+ReturnCode decompile(const DecompilationParams& params)
+{
+	if (!limitMaximalMemoryIfRequested(params))
+	{
+		return ReturnCode::FAILED;
+	}
+
+	auto supportDir = getSupportDirectory(params);
+
+	retdec::config::Config config;
+	if (!params.inputConfigFile.empty())
+	{
+		try
+		{
+			config.readJsonFile(params.inputConfigFile);
+		}
+		catch (const retdec::config::Exception& e)
+		{
+			printErrorMessage("Loading of config failed: ", e.what(), ".");
+			return ReturnCode::FAILED;
+		}
+	}
+
+	printPhase("Gathering file information");
+	if (!detectFile(params, supportDir, config)
+			|| !fillConfig(params, supportDir, config))
+	{
+		return ReturnCode::FAILED;
+	}
+
+	printPhase("Decompiling " + params.inputFile + " into LLVM IR");
+	initializeLlvmPasses();
+
+	llvm::LLVMContext context;
+	auto module = createLlvmModule(context);
+	if (module == nullptr)
+	{
+		printErrorMessage("Failed to create LLVM module.");
+		return ReturnCode::FAILED;
+	}
+
+	// Data of a previous decompilation must not be seen by this one.
+	bin2llvmir::ProviderInitialization::clear();
+
+	{
+		llvm::Triple triple(module->getTargetTriple());
+		llvm::TargetLibraryInfoImpl tlii(triple);
+		// bin2llvmir is always run with -disable-simplify-libcalls.
+		tlii.disableAllFunctions();
+
+		llvm::legacy::PassManager pm;
+		pm.add(new llvm::TargetLibraryInfoWrapperPass(tlii));
+		pm.add(llvm::createTargetTransformInfoWrapperPass(llvm::TargetIRAnalysis()));
+		if (!addBin2llvmirPasses(params, config, pm))
+		{
+			return ReturnCode::FAILED;
+		}
+		pm.run(*module);
+	}
+
+	// The providers are not needed by the back-end, and they keep the whole
+	// input file in memory.
+	bin2llvmir::ProviderInitialization::clear();
+
+	if (params.emitLlvmIr)
+	{
+		emitLlvmIr(params, *module);
+	}
+
+	printPhase("Decompiling LLVM IR into " + params.outputFile);
+
+	std::error_code ec;
+	llvm::ToolOutputFile out(params.outputFile, ec, llvm::sys::fs::F_None);
+	if (ec)
+	{
+		printErrorMessage("Failed to create ", params.outputFile, ": ", ec.message());
+		return ReturnCode::FAILED;
+	}
+
+	{
+		auto backendParams = params.backend;
+		backendParams.configPath = params.outputConfigFile;
+		backendParams.outputFilename = params.outputFile;
+		backendParams.functionJobs = params.functionJobs;
+		// Memory has already been limited for the whole process.
+		backendParams.maxMemoryLimit = 0;
+		backendParams.maxMemoryLimitHalfRAM = false;
+
+		llvm::Triple triple(module->getTargetTriple());
+		llvm::TargetLibraryInfoImpl tlii(triple);
+
+		llvm::legacy::PassManager pm;
+		pm.add(new llvm::TargetLibraryInfoWrapperPass(tlii));
+		pm.add(new llvm::LoopInfoWrapperPass());
+		pm.add(new llvm::ScalarEvolutionWrapperPass());
+		pm.add(new retdec::llvmir2hll::Decompiler(
+				out.os(),
+				backendParams,
+				retdec::llvmir2hll::JSONConfig::fromConfig(config)));
+		pm.run(*module);
+	}
+
+	out.keep();
+	printPhase("Done");
+
+	return ReturnCode::OK;
+}
+
+} // namespace decompiler
+} // namespace retdec
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+"""Generate the list of bin2llvmir passes used by the decompiler library.
+Usage: generate-bin2llvmir-passes.py retdec-config-path output-path
+    retdec-config-path Path to retdec-config.py.
+    output-path        Path to the generated C++ file.
+
+The passes are taken from BIN2LLVMIR_PARAMS in retdec-config.py, which is the
+only place where they are listed. Parameters that are not passes (-disable-*)
+are skipped and the leading dash is removed from the pass names. The generated
+file contains an initializer list of the pass names in the order in which the
+passes are run.
+"""
+
+import runpy
+import sys
+
+
+def main(config_path, output_path):
+    # retdec-config.py is not importable as a module (its name contains a
+    # dash), so run it and take the variables it defines.
+    config = runpy.run_path(config_path)
+    passes = [p[1:] for p in config['BIN2LLVMIR_PARAMS']
+              if p not in config['BIN2LLVMIR_PARAMS_DISABLES']]
+
+    lines = ['// Generated by generate-bin2llvmir-passes.py from retdec-config.py.',
+             '// Do not edit.',
+             '{']
+    lines += ['\t"{}",'.format(p) for p in passes]
+    lines.append('}')
+
+    content = '\n'.join(lines) + '\n'
+    try:
+        with open(output_path, 'r') as f:
+            if f.read() == content:
+                return 0
+    except OSError:
+        pass
+
+    with open(output_path, 'w') as f:
+        f.write(content)
+    return 0
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print(__doc__, file=sys.stderr)
+        sys.exit(1)
+    sys.exit(main(sys.argv[1], sys.argv[2]))
@@ -0,0 +1,211 @@
+/**
+ * @file src/decompilertool/batch.cpp
+ * @brief Jobs of the batch mode of the single-process decompiler.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "decompilertool/batch.h"
+
+#ifdef OS_POSIX
+	#include <cerrno>
+	#include <csignal>
+	#include <sys/types.h>
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
+using namespace retdec::decompiler;
+
+namespace decompilertool {
+
+/**
+ * Parse one line of the standard input of the batch mode into @a job.
+ *
+ * @param line Job description (one JSON object).
+ * @param defaults Options given on the command line of the worker.
+ * @param job Parsed job. Its @c id is set even if the rest of the job is
+ *        invalid, so that the caller can pair the error with the job.
+ * @param error Set to the reason when the job is invalid.
+ *
+ * @return @c true if the job is valid, @c false otherwise.
+ */
+bool parseJob(
+		const std::string& line,
+		const Options& defaults,
+		Job& job,
+		std::string& error)
+{
+	job = Job();
+
+	Json::Value root;
+	std::string errs;
+	std::istringstream input(line);
+	Json::CharReaderBuilder builder;
+	if (!Json::parseFromStream(builder, input, &root, &errs) || !root.isObject())
+	{
+		error = "invalid JSON";
+		return false;
+	}
+
+	job.id = root.get("id", Json::Value());
+	const auto& jsonArgs = root["args"];
+	if (!jsonArgs.isArray())
+	{
+		error = "missing \"args\"";
+		return false;
+	}
+
+	std::vector<std::string> args;
+	for (const auto& a : jsonArgs)
+	{
+		if (!a.isString())
+		{
+			error = "non-string argument";
+			return false;
+		}
+		args.push_back(a.asString());
+	}
+
+	job.options = defaults;
+	if (!parseArgs(args, job.options, error)
+			|| !finishOptions(job.options, error))
+	{
+		return false;
+	}
+
+	job.timeout = job.options.jobTimeout;
+	if (root.isMember("timeout"))
+	{
+		if (!root["timeout"].isUInt())
+		{
+			error = "invalid \"timeout\"";
+			return false;
+		}
+		job.timeout = root["timeout"].asUInt();
+	}
+
+	return true;
+}
+
+std::string jobStatusToString(JobStatus status)
+{
+	switch (status)
+	{
+		case JobStatus::OK: return "ok";
+		case JobStatus::FAILED: return "failed";
+		case JobStatus::TIMEOUT: return "timeout";
+		case JobStatus::CRASHED: return "crashed";
+		case JobStatus::INVALID: return "invalid";
+	}
+	return "invalid";
+}
+
+/**
+ * Format the result of one job as one JSON line (without the newline).
+ */
+std::string formatJobResult(
+		const Json::Value& id,
+		JobStatus status,
+		const std::string& message)
+{
+	Json::Value result(Json::objectValue);
+	result["id"] = id;
+	result["status"] = jobStatusToString(status);
+	if (!message.empty())
+	{
+		result["message"] = message;
+	}
+
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "";
+	return Json::writeString(builder, result);
+}
+
+#ifdef OS_POSIX
+
+/**
+ * Run @a work in a child process, so that a failure, crash, or exhausted
+ * memory of one job does not affect the others.
+ *
+ * @param work Work to run. Its return value is the exit code of the child.
+ * @param timeout Time limit in seconds (0 means no limit). The child is
+ *        killed and reaped when it is exceeded.
+ */
+JobStatus runInChildProcess(
+		const std::function<int ()>& work,
+		unsigned timeout)
+{
+	std::cout.flush();
+	std::cerr.flush();
+
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		return JobStatus::FAILED;
+	}
+	else if (pid == 0)
+	{
+		// The standard output of the worker is reserved for job results.
+		dup2(STDERR_FILENO, STDOUT_FILENO);
+		int rc = work();
+		std::cout.flush();
+		std::cerr.flush();
+		_exit(rc);
+	}
+
+	auto deadline = std::chrono::steady_clock::now()
+			+ std::chrono::seconds(timeout);
+	int status = 0;
+	while (true)
+	{
+		auto rc = waitpid(pid, &status, timeout > 0 ? WNOHANG : 0);
+		if (rc == pid)
+		{
+			break;
+		}
+		else if (rc < 0 && errno != EINTR)
+		{
+			return JobStatus::FAILED;
+		}
+		else if (timeout > 0 && std::chrono::steady_clock::now() >= deadline)
+		{
+			kill(pid, SIGKILL);
+			waitpid(pid, &status, 0);
+			return JobStatus::TIMEOUT;
+		}
+		else if (rc == 0)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+	}
+
+	if (WIFEXITED(status))
+	{
+		return WEXITSTATUS(status) == 0 ? JobStatus::OK : JobStatus::FAILED;
+	}
+	return JobStatus::CRASHED;
+}
+
+/**
+ * Decompile according to @a params in a child process, see
+ * runInChildProcess(). The memory limit from @a params is applied only to
+ * the child.
+ */
+JobStatus decompileInChildProcess(
+		const DecompilationParams& params,
+		unsigned timeout)
+{
+	return runInChildProcess(
+			[&params]() { return decompile(params) == ReturnCode::OK ? 0 : 1; },
+			timeout);
+}
+
+#endif
+
+} // namespace decompilertool
@@ -0,0 +1,67 @@
+/**
+ * @file src/decompilertool/batch.h
+ * @brief Jobs of the batch mode of the single-process decompiler.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef DECOMPILERTOOL_BATCH_H
+#define DECOMPILERTOOL_BATCH_H
+
+#include <functional>
+#include <string>
+
+#include <json/json.h>
+
+#include "retdec/utils/os.h"
+#include "decompilertool/options.h"
+
+namespace decompilertool {
+
+/**
+ * Final state of one job in batch mode.
+ */
+enum class JobStatus
+{
+	OK,
+	FAILED,
+	TIMEOUT,
+	CRASHED,
+	INVALID
+};
+
+/**
+ * One job in batch mode.
+ */
+struct Job
+{
+	/// Identifier of the job given by the caller (null if there is none).
+	Json::Value id;
+	/// Options of the decompilation.
+	Options options;
+	/// Time limit in seconds (0 means no limit).
+	unsigned timeout = 0;
+};
+
+bool parseJob(
+		const std::string& line,
+		const Options& defaults,
+		Job& job,
+		std::string& error);
+std::string jobStatusToString(JobStatus status);
+std::string formatJobResult(
+		const Json::Value& id,
+		JobStatus status,
+		const std::string& message = std::string());
+
+#ifdef OS_POSIX
+JobStatus runInChildProcess(
+		const std::function<int ()>& work,
+		unsigned timeout);
+JobStatus decompileInChildProcess(
+		const retdec::decompiler::DecompilationParams& params,
+		unsigned timeout);
+#endif
+
+} // namespace decompilertool
+
+#endif
@@ -0,0 +1,184 @@
+/**
+ * @file src/decompilertool/decompiler.cpp
+ * @brief Single-process decompiler of binary files.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "retdec/decompiler/decompiler.h"
+#include "retdec/utils/os.h"
+#include "decompilertool/batch.h"
+#include "decompilertool/options.h"
+
+using namespace retdec::decompiler;
+using namespace decompilertool;
+
+namespace {
+
+/**
+ * Print usage.
+ */
+void printUsage()
+{
+	std::cout << "\nDecompiles the given (non-packed) binary file in a single process.\n"
+		<< "Usage: retdec-decompiler [options] FILE\n"
+		<< "       retdec-decompiler --batch [options]\n\n"
+		<< "Options:\n"
+		<< "  -h, --help                      Print this help message.\n"
+		<< "  -o, --output FILE               Output file (default: FILE.c).\n"
+		<< "  -l, --target-language LANGUAGE  Target high-level language [c|py].\n"
+		<< "  -a, --arch ARCH                 Force the architecture.\n"
+		<< "  -p, --pdb FILE                  File with PDB debug information.\n"
+		<< "  -k, --keep-unreachable-funcs    Keep functions that are unreachable from the main function.\n"
+		<< "  --config FILE                   Use the given input config.\n"
+		<< "  --cleanup                       Do not emit the output config and LLVM IR.\n"
+		<< "  --static-code-sigfile FILE      Add a signature file with static code.\n"
+		<< "  --no-default-static-signatures  Do not use the default static-code signatures.\n"
+		<< "  --yara-cache DIR                Cache compiled YARA rules in the existing directory.\n"
+		<< "  --static-code-jobs N            Scan up to N static-code signature files concurrently.\n"
+		<< "  --function-jobs N               Process up to N functions concurrently (reaching definitions, back-end optimizations).\n"
+		<< "  --select-functions LIST         Decompile only the given comma-separated functions.\n"
+		<< "  --select-ranges LIST            Decompile only the given comma-separated address ranges.\n"
+		<< "  --select-decode-only            Decode only the selected parts.\n"
+		<< "  --max-memory BYTES              Limit the maximal memory to the given number of bytes.\n"
+		<< "  --no-memory-limit               Do not limit the maximal memory.\n"
+		<< "  --backend-*                     The same back-end options as retdec-decompiler.py.\n"
+		<< "  --batch                         Decompile jobs read from the standard input (see below).\n"
+		<< "  --job-timeout SECONDS           Time limit of one job in batch mode.\n\n"
+		<< "Batch mode:\n"
+		<< "  Every line of the standard input is one job in the JSON format\n"
+		<< "    {\"id\": \"ID\", \"args\": [\"-o\", \"out.c\", \"FILE\"], \"timeout\": SECONDS}\n"
+		<< "  where \"args\" are the options above (the options given on the command\n"
+		<< "  line are used as defaults) and \"id\" and \"timeout\" are optional.\n"
+		<< "  Shared resources are initialized only once and every job runs in its\n"
+		<< "  own process with its own memory and time limits. The result of every\n"
+		<< "  job is printed to the standard output as one line in the JSON format\n"
+		<< "    {\"id\": \"ID\", \"status\": \"ok|failed|timeout|crashed|invalid\"}\n"
+		<< "  while the messages of the decompilation go to the standard error.\n\n";
+}
+
+/**
+ * Print error message and return non-zero value.
+ *
+ * @param errorMessage message to print
+ * @return non-zero value
+ */
+int printError(const std::string& errorMessage)
+{
+	std::cerr << "Error: " << errorMessage << "\n";
+	return 1;
+}
+
+#ifdef OS_POSIX
+
+/**
+ * Run one job from the batch mode.
+ *
+ * @param line Job description (one JSON object).
+ * @param defaults Options given on the command line of the worker.
+ */
+void runJob(const std::string& line, const Options& defaults)
+{
+	Job job;
+	std::string error;
+	if (!parseJob(line, defaults, job, error))
+	{
+		std::cout << formatJobResult(job.id, JobStatus::INVALID, error)
+			<< std::endl;
+		return;
+	}
+
+	auto status = decompileInChildProcess(job.options.params, job.timeout);
+	std::cout << formatJobResult(job.id, status) << std::endl;
+}
+
+/**
+ * Decompile jobs read from the standard input until its end.
+ *
+ * @param defaults Options given on the command line of the worker.
+ */
+int runBatch(const Options& defaults)
+{
+	if (!defaults.params.inputFile.empty())
+	{
+		return printError("no input file can be given in the batch mode");
+	}
+
+	initializeSharedResources(defaults.params);
+
+	std::string line;
+	while (std::getline(std::cin, line))
+	{
+		if (line.find_first_not_of(" \t\r") == std::string::npos)
+		{
+			continue;
+		}
+		runJob(line, defaults);
+	}
+
+	return 0;
+}
+
+#else
+
+int runBatch(const Options&)
+{
+	return printError("the batch mode is not supported on this system");
+}
+
+#endif
+
+/**
+ * Do actions according to command line arguments.
+ *
+ * @param args command line arguments
+ */
+int doActions(const std::vector<std::string>& args)
+{
+	Options options;
+	auto& params = options.params;
+	params.maxMemoryHalfRAM = true;
+	// The same back-end defaults as used by retdec-decompiler.py.
+	params.backend.targetHll = "c";
+	params.backend.debug = true;
+	params.backend.emitDebugComments = true;
+	params.backend.validateModule = true;
+
+	std::string error;
+	if (!parseArgs(args, options, error))
+	{
+		return printError(error);
+	}
+
+	if (options.help)
+	{
+		printUsage();
+		return 0;
+	}
+
+	if (options.batch)
+	{
+		return runBatch(options);
+	}
+
+	if (!finishOptions(options, error))
+	{
+		if (params.inputFile.empty())
+		{
+			printUsage();
+		}
+		return printError(error);
+	}
+
+	return decompile(params) == ReturnCode::OK ? 0 : 1;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+	return doActions(std::vector<std::string>(argv + 1, argv + argc));
+}
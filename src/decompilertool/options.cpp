@@ -0,0 +1,256 @@
+/**
+ * @file src/decompilertool/options.cpp
+ * @brief Command-line options of the single-process decompiler.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <set>
+
+#include "retdec/utils/conversion.h"
+#include "retdec/utils/filesystem_path.h"
+#include "decompilertool/options.h"
+
+using namespace retdec::utils;
+
+namespace decompilertool {
+
+namespace {
+
+/**
+ * Insert comma-separated items from @a list into @a items.
+ */
+void splitList(const std::string& list, std::set<std::string>& items)
+{
+	std::string::size_type start = 0;
+	while (start <= list.size())
+	{
+		auto end = list.find(',', start);
+		if (end == std::string::npos)
+		{
+			end = list.size();
+		}
+		auto item = list.substr(start, end - start);
+		if (!item.empty())
+		{
+			items.insert(item);
+		}
+		start = end + 1;
+	}
+}
+
+/**
+ * Parse the given back-end option.
+ *
+ * @return @c true if @a args[i] is a back-end option, @c false otherwise.
+ */
+bool parseBackendOption(
+		const std::vector<std::string>& args,
+		std::size_t& i,
+		retdec::llvmir2hll::DecompilerParams& backend)
+{
+	const auto& a = args[i];
+	bool hasValue = i + 1 < args.size();
+
+	if (a == "--backend-aggressive-opts") backend.aggressiveOpts = true;
+	else if (a == "--backend-keep-all-brackets") backend.keepAllBrackets = true;
+	else if (a == "--backend-keep-library-funcs") backend.keepLibraryFunctions = true;
+	else if (a == "--backend-no-compound-operators") backend.noCompoundOperators = true;
+	else if (a == "--backend-no-debug") backend.debug = false;
+	else if (a == "--backend-no-debug-comments") backend.emitDebugComments = false;
+	else if (a == "--backend-no-opts") backend.noOpts = true;
+	else if (a == "--backend-no-symbolic-names") backend.noSymbolicNames = true;
+	else if (a == "--backend-no-time-varying-info") backend.noTimeVaryingInfo = true;
+	else if (a == "--backend-no-var-renaming") backend.noVarRenaming = true;
+	else if (a == "--backend-emit-cfg") backend.emitCFGs = true;
+	else if (a == "--backend-emit-cg") backend.emitCG = true;
+	else if (a == "--backend-strict-fpu-semantics") backend.strictFPUSemantics = true;
+	else if (!hasValue) return false;
+	else if (a == "--backend-arithm-expr-evaluator") backend.arithmExprEvaluator = args[++i];
+	else if (a == "--backend-call-info-obtainer") backend.callInfoObtainer = args[++i];
+	else if (a == "--backend-disabled-opts") backend.disabledOpts = args[++i];
+	else if (a == "--backend-enabled-opts") backend.enabledOpts = args[++i];
+	else if (a == "--backend-find-patterns") backend.findPatterns = args[++i];
+	else if (a == "--backend-force-module-name") backend.forcedModuleName = args[++i];
+	else if (a == "--backend-semantics") backend.semantics = args[++i];
+	else if (a == "--backend-var-renamer") backend.varRenamer = args[++i];
+	else return false;
+
+	return true;
+}
+
+} // anonymous namespace
+
+/**
+ * Parse @a args into @a options.
+ *
+ * @return @c true if the arguments are valid, @c false otherwise (@a error
+ *         is set in that case).
+ */
+bool parseArgs(
+		const std::vector<std::string>& args,
+		Options& options,
+		std::string& error)
+{
+	auto& params = options.params;
+
+	for (std::size_t i = 0; i < args.size(); ++i)
+	{
+		const auto& a = args[i];
+		bool hasValue = i + 1 < args.size();
+
+		if (a == "-h" || a == "--help")
+		{
+			options.help = true;
+		}
+		else if ((a == "-o" || a == "--output") && hasValue)
+		{
+			params.outputFile = args[++i];
+		}
+		else if ((a == "-l" || a == "--target-language") && hasValue)
+		{
+			params.backend.targetHll = args[++i];
+		}
+		else if ((a == "-a" || a == "--arch") && hasValue)
+		{
+			params.arch = args[++i];
+		}
+		else if ((a == "-p" || a == "--pdb") && hasValue)
+		{
+			params.pdbFile = args[++i];
+		}
+		else if (a == "-k" || a == "--keep-unreachable-funcs")
+		{
+			params.keepUnreachableFuncs = true;
+		}
+		else if (a == "--config" && hasValue)
+		{
+			params.inputConfigFile = args[++i];
+		}
+		else if (a == "--cleanup")
+		{
+			options.cleanup = true;
+		}
+		else if (a == "--static-code-sigfile" && hasValue)
+		{
+			params.userStaticSignatures.insert(args[++i]);
+		}
+		else if (a == "--no-default-static-signatures")
+		{
+			params.noDefaultStaticSignatures = true;
+		}
+		else if (a == "--yara-cache" && hasValue)
+		{
+			params.yaraCacheDirectory = args[++i];
+		}
+		else if (a == "--static-code-jobs" && hasValue)
+		{
+			if (!strToNum(args[++i], params.staticCodeJobs))
+			{
+				error = "invalid value of --static-code-jobs: " + args[i];
+				return false;
+			}
+		}
+		else if (a == "--function-jobs" && hasValue)
+		{
+			if (!strToNum(args[++i], params.functionJobs))
+			{
+				error = "invalid value of --function-jobs: " + args[i];
+				return false;
+			}
+		}
+		else if (a == "--select-functions" && hasValue)
+		{
+			splitList(args[++i], params.selectedFunctions);
+		}
+		else if (a == "--select-ranges" && hasValue)
+		{
+			splitList(args[++i], params.selectedRanges);
+		}
+		else if (a == "--select-decode-only")
+		{
+			params.selectedDecodeOnly = true;
+		}
+		else if (a == "--max-memory" && hasValue)
+		{
+			if (!strToNum(args[++i], params.maxMemory) || params.maxMemory == 0)
+			{
+				error = "invalid value of --max-memory: " + args[i];
+				return false;
+			}
+			params.maxMemoryHalfRAM = false;
+		}
+		else if (a == "--no-memory-limit")
+		{
+			params.maxMemory = 0;
+			params.maxMemoryHalfRAM = false;
+		}
+		else if (a == "--batch")
+		{
+			options.batch = true;
+		}
+		else if (a == "--job-timeout" && hasValue)
+		{
+			if (!strToNum(args[++i], options.jobTimeout))
+			{
+				error = "invalid value of --job-timeout: " + args[i];
+				return false;
+			}
+		}
+		else if (parseBackendOption(args, i, params.backend))
+		{
+			// Already handled.
+		}
+		else if (!a.empty() && a[0] == '-')
+		{
+			error = "invalid option '" + a + "'";
+			return false;
+		}
+		else if (params.inputFile.empty())
+		{
+			params.inputFile = a;
+		}
+		else
+		{
+			error = "only one input file is supported";
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Check the input file and derive the names of the output files.
+ *
+ * @return @c true if the options are valid, @c false otherwise (@a error
+ *         is set in that case).
+ */
+bool finishOptions(Options& options, std::string& error)
+{
+	auto& params = options.params;
+
+	if (params.inputFile.empty())
+	{
+		error = "no input file";
+		return false;
+	}
+	if (!FilesystemPath(params.inputFile).isFile())
+	{
+		error = "invalid input file '" + params.inputFile + "'";
+		return false;
+	}
+
+	if (params.outputFile.empty())
+	{
+		params.outputFile = params.inputFile + "." + params.backend.targetHll;
+	}
+	if (!options.cleanup)
+	{
+		params.outputConfigFile = params.outputFile + ".json";
+		params.emitLlvmIr = true;
+	}
+
+	return true;
+}
+
+} // namespace decompilertool
@@ -0,0 +1,41 @@
+/**
+ * @file src/decompilertool/options.h
+ * @brief Command-line options of the single-process decompiler.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef DECOMPILERTOOL_OPTIONS_H
+#define DECOMPILERTOOL_OPTIONS_H
+
+#include <string>
+#include <vector>
+
+#include "retdec/decompiler/decompiler.h"
+
+namespace decompilertool {
+
+/**
+ * Options of one decompilation.
+ */
+struct Options
+{
+	retdec::decompiler::DecompilationParams params;
+	/// Do not emit the output config and LLVM IR.
+	bool cleanup = false;
+	/// Only print the usage.
+	bool help = false;
+	/// Read jobs from the standard input instead of decompiling one file.
+	bool batch = false;
+	/// Time limit of one job in batch mode in seconds (0 means no limit).
+	unsigned jobTimeout = 0;
+};
+
+bool parseArgs(
+		const std::vector<std::string>& args,
+		Options& options,
+		std::string& error);
+bool finishOptions(Options& options, std::string& error);
+
+} // namespace decompilertool
+
+#endif
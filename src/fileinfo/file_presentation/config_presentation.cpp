@@ -39,12 +39,29 @@ ConfigPresentation::ConfigPresentation(FileInformation &fileinfo_, std::string f
 	}
 }
 
+/**
+ * Constructor
+ * @param fileinfo_ Information about file
+ * @param config_ Initial content of the config
+ *
+ * Config created by this constructor is not written into any file. Use
+ * getConfig() to obtain the presented information.
+ */
+ConfigPresentation::ConfigPresentation(FileInformation &fileinfo_, const retdec::config::Config &config_) :
+	FilePresentation(fileinfo_), outDoc(config_), stateIsValid(true)
+{
+
+}
+
 /**
  * Destructor
  */
 ConfigPresentation::~ConfigPresentation()
 {
-	outDoc.generateJsonFile(configFile);
+	if(!configFile.empty())
+	{
+		outDoc.generateJsonFile(configFile);
+	}
 }
 
 /**
@@ -253,4 +270,13 @@ std::string ConfigPresentation::getErrorMessage() const
 	return errorMessage;
 }
 
+/**
+ * Get presented config
+ * @return Config with all the information presented so far
+ */
+const retdec::config::Config& ConfigPresentation::getConfig() const
+{
+	return outDoc;
+}
+
 } // namespace fileinfo
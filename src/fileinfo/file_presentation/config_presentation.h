@@ -15,7 +15,7 @@ namespace fileinfo {
 class ConfigPresentation : public FilePresentation
 {
 	private:
-		std::string configFile;         ///< name of output file
+		std::string configFile;         ///< name of output file (empty if in-memory only)
 		retdec::config::Config outDoc; ///< representation of output file
 		bool stateIsValid;              ///< internal state of instance
 		std::string errorMessage;       ///< error message
@@ -28,10 +28,12 @@ class ConfigPresentation : public FilePresentation
 		/// @}
 	public:
 		ConfigPresentation(FileInformation &fileinfo_, std::string file_);
+		ConfigPresentation(FileInformation &fileinfo_, const retdec::config::Config &config_);
 		virtual ~ConfigPresentation() override;
 
 		virtual bool present() override;
 		std::string getErrorMessage() const;
+		const retdec::config::Config& getConfig() const;
 };
 
 } // namespace fileinfo
@@ -54,6 +54,7 @@ struct ProgParams
 	bool maxMemoryHalfRAM;                  ///< limit maximal memory to half of system RAM
 	std::size_t epBytesCount;               ///< number of bytes to load from entry point
 	LoadFlags loadFlags;                    ///< load flags for `fileformat`
+	std::string yaraCacheDirectory;         ///< directory with compiled YARA rules
 
 	ProgParams() : searchMode(SearchType::EXACT_MATCH),
 					internalDatabase(true),
@@ -143,6 +144,8 @@ void printHelp()
 				<< "                          and functions.\n"
 				<< "    --other=fileOrDir, -o=fileOrDir\n"
 				<< "                          Path to other YARA rules.\n"
+				<< "    --yara-cache=dir      Keep compiled signatures in the existing directory\n"
+				<< "                          and reuse them in the following runs.\n"
 				<< "\n"
 				<< "Options for specifying output format:\n"
 				<< "  From this group, only one option can be used. If no option is used, program\n"
@@ -211,7 +214,7 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 	std::vector<std::string> argv;
 
 	std::set<std::string> withArgs = {"malware", "m", "crypto", "C", "other",
-			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes"};
+			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes", "yara-cache"};
 	for (int i = 1; i < argc; ++i)
 	{
 		std::string a = _argv[i];
@@ -303,6 +306,10 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 		{
 			params.yaraOtherPaths.insert(getParamOrDie(argv, i));
 		}
+		else if (c == "--yara-cache")
+		{
+			params.yaraCacheDirectory = getParamOrDie(argv, i);
+		}
 		else if (c == "--max-memory")
 		{
 			auto maxMemoryString = getParamOrDie(argv, i);
@@ -428,6 +435,7 @@ int main(int argc, char* argv[])
 	}
 
 	DetectParams searchPar(params.searchMode, params.internalDatabase, params.externalDatabase, params.epBytesCount);
+	searchPar.yaraCacheDirectory = params.yaraCacheDirectory;
 	const auto fileFormat = detectFileFormat(params.filePath, useConfig && config.fileFormat.isRaw());
 	FileInformation fileinfo;
 	FileDetector *fileDetector = nullptr;
@@ -8,6 +8,7 @@
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/analysis/var_uses_visitor.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/ir/statement.h"
@@ -87,7 +88,7 @@ void DefUseChains::debugPrint() {
 DefUseAnalysis::DefUseAnalysis(ShPtr<Module> module,
 		ShPtr<ValueAnalysis> va, ShPtr<VarUsesVisitor> vuv):
 		module(module), va(va), vuv(vuv),
-		cfgBuilder(RecursiveCFGBuilder::create()) {
+		cfgCache(CFGCache::create(RecursiveCFGBuilder::create())) {
 	// If we don't have a visitor for obtaining uses of variables, create one.
 	if (!this->vuv) {
 		this->vuv = VarUsesVisitor::create(this->va);
@@ -117,10 +118,11 @@ ShPtr<DefUseChains> DefUseAnalysis::getDefUseChains(
 	ducs->func = func;
 	ducs->shouldBeIncluded = shouldBeIncluded;
 
-	// If we don't have a CFG, generate it.
+	// If we don't have a CFG, get it from the cache (it is built only if the
+	// function has changed since the last time).
 	ducs->cfg = cfg;
 	if (!ducs->cfg) {
-		ducs->cfg = cfgBuilder->getCFG(func);
+		ducs->cfg = cfgCache->getCFG(func);
 	}
 
 	computeGenAndKill(ducs);
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
@@ -91,7 +93,8 @@ ValueData::ValueData(): dirReadVars(), dirWrittenVars(), dirAllVars(),
 	dirNumOfVarUses(), mayBeReadVars(), mayBeWrittenVars(),
 	mayBeAccessedVars(), mustBeReadVars(), mustBeWrittenVars(),
 	mustBeAccessedVars(), calls(), addressTakenVars(), containsDerefs(false),
-	containsArrayAccesses(false), containsStructAccesses(false) {}
+	containsArrayAccesses(false), containsStructAccesses(false),
+	valueVersion(0) {}
 
 /**
 * @brief Constructs a new ValueData object from @a other.
@@ -591,14 +594,17 @@ ValueAnalysis::~ValueAnalysis() {}
 ShPtr<ValueData> ValueAnalysis::getValueData(ShPtr<Value> value) {
 	PRECONDITION_NON_NULL(value);
 
-	// Caching.
-	if (isCachingEnabled() && getCachedResult(value, valueData)) {
+	// Caching. A cached result is valid only if the value has not been
+	// changed since the result was computed.
+	if (isCachingEnabled() && getCachedResult(value, valueData) &&
+			valueData->valueVersion == value->getVersion()) {
 		return valueData;
 	}
 
 	// Initialization.
 	restart(false, false);
 	valueData = ShPtr<ValueData>(new ValueData());
+	valueData->valueVersion = value->getVersion();
 	writing = false;
 
 	// Obtain read and written-into variables.
@@ -608,8 +614,12 @@ ShPtr<ValueData> ValueAnalysis::getValueData(ShPtr<Value> value) {
 	addToSet(valueData->dirReadVars, valueData->dirAllVars);
 	addToSet(valueData->dirWrittenVars, valueData->dirAllVars);
 
-	// Caching.
-	addToCache(value, valueData);
+	// Caching. Results for functions are not cached because they depend on
+	// the bodies of the functions, whose changes do not change the versions
+	// of the functions.
+	if (!isa<Function>(value)) {
+		addToCache(value, valueData);
+	}
 
 	return valueData;
 }
@@ -650,14 +660,57 @@ void ValueAnalysis::removeFromCache(ShPtr<Value> value, bool recursive) {
 	}
 }
 
+/**
+* @brief Removes the results of values that are no longer used from the cache.
+*
+* Since the cache keeps its results until the values are changed, it may
+* contain results of values that have already been removed from the module.
+* The cache is the only owner of such values, so they can be safely removed.
+*
+* OptimizerManager calls this function after every optimization.
+*/
+void ValueAnalysis::removeUnusedValuesFromCache() {
+	// The visitor itself may still refer to the last analyzed statements and
+	// to the last computed result.
+	restart(false, false);
+	lastStmt.reset();
+	valueData.reset();
+
+	// A removed result may hold the last references to other cached values
+	// (e.g. to calls in a removed statement), so repeat until nothing is
+	// removed.
+	std::size_t numOfRemovedValues;
+	do {
+		numOfRemovedValues = removeFromCacheIf(
+			[](const ShPtr<Value> &value, const ShPtr<ValueData> &data) {
+				// The result for a call refers to the call itself.
+				auto numOfRefsFromData = std::count_if(data->call_begin(),
+					data->call_end(), [&value](const ShPtr<CallExpr> &call) {
+						return call == value;
+					});
+				return value.use_count() == 1 + numOfRefsFromData;
+			}
+		);
+	} while (numOfRemovedValues > 0);
+}
+
 /**
 * @brief Re-initializes the underlying alias analysis.
 *
 * This function is a delegation to AliasAnalysis::init(). See it for more
 * information.
+*
+* Cached results of values containing dereferences are removed from the cache
+* because they may have been computed by using the old alias information.
 */
 void ValueAnalysis::initAliasAnalysis(ShPtr<Module> module) {
 	aliasAnalysis->init(module);
+
+	// Only the results of values containing dereferences depend on the alias
+	// analysis, so the other cached results can be kept.
+	removeFromCacheIf([](const ShPtr<Value> &, const ShPtr<ValueData> &data) {
+		return data->hasDerefs();
+	});
 }
 
 /**
@@ -691,6 +744,19 @@ bool ValueAnalysis::mayBePointed(ShPtr<Variable> var) const {
 	return aliasAnalysis->mayBePointed(var);
 }
 
+/**
+* @brief Creates a new analysis with the same alias analysis and the same
+*        caching setting as this analysis.
+*
+* The cached results are not copied, so the new analysis starts with an empty
+* cache in a valid state. A single analysis cannot be used from several threads
+* at once, so this is a way of getting an analysis for every thread.
+*/
+ShPtr<ValueAnalysis> ValueAnalysis::clone() const {
+	return ShPtr<ValueAnalysis>(new ValueAnalysis(aliasAnalysis,
+		isCachingEnabled()));
+}
+
 /**
 * @brief Creates a new analysis.
 *
@@ -152,6 +152,20 @@ UPtr<JSONConfig> JSONConfig::fromString(const std::string &str) {
 	return config;
 }
 
+/**
+* @brief Returns a config that wraps a copy of the given, already parsed
+*        config.
+*
+* This allows the back-end to be run in the same process as the front-end
+* without serializing the config into JSON and parsing it back again.
+*/
+UPtr<JSONConfig> JSONConfig::fromConfig(const retdec::config::Config &config) {
+	// We cannot use std::make_unique() because JSONConfig() is private.
+	auto jsonConfig = UPtr<JSONConfig>(new JSONConfig());
+	jsonConfig->impl->config = config;
+	return jsonConfig;
+}
+
 /**
 * @brief Returns an empty config.
 */
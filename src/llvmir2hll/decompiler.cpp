@@ -0,0 +1,750 @@
+/**
+* @file src/llvmir2hll/decompiler.cpp
+* @brief Conversion of LLVM IR into the specified target high-level language.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <fstream>
+
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Analysis/ScalarEvolution.h>
+
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis.h"
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis_factory.h"
+#include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/config/configs/json_config.h"
+#include "retdec/llvmir2hll/decompiler.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator_factory.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writer.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writer_factory.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_writer.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_writer_factory.h"
+#include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/hll/hll_writer_factory.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/llvm/llvm_debug_info_obtainer.h"
+#include "retdec/llvmir2hll/llvm/llvm_intrinsic_converter.h"
+#include "retdec/llvmir2hll/llvm/llvmir2bir_converter.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainer.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainer_factory.h"
+#include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
+#include "retdec/llvmir2hll/pattern/pattern_finder_factory.h"
+#include "retdec/llvmir2hll/pattern/pattern_finder_runner.h"
+#include "retdec/llvmir2hll/pattern/pattern_finder_runners/cli_pattern_finder_runner.h"
+#include "retdec/llvmir2hll/pattern/pattern_finder_runners/no_action_pattern_finder_runner.h"
+#include "retdec/llvmir2hll/semantics/semantics/compound_semantics_builder.h"
+#include "retdec/llvmir2hll/semantics/semantics/default_semantics.h"
+#include "retdec/llvmir2hll/semantics/semantics_factory.h"
+#include "retdec/llvmir2hll/support/const_symbol_converter.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/expr_types_fixer.h"
+#include "retdec/llvmir2hll/support/funcs_with_prefix_remover.h"
+#include "retdec/llvmir2hll/support/library_funcs_remover.h"
+#include "retdec/llvmir2hll/support/unreachable_code_in_cfg_remover.h"
+#include "retdec/llvmir2hll/utils/ir.h"
+#include "retdec/llvmir2hll/utils/string.h"
+#include "retdec/llvmir2hll/validator/validator.h"
+#include "retdec/llvmir2hll/validator/validator_factory.h"
+#include "retdec/llvmir2hll/var_name_gen/var_name_gen_factory.h"
+#include "retdec/llvmir2hll/var_name_gen/var_name_gens/num_var_name_gen.h"
+#include "retdec/llvmir2hll/var_renamer/var_renamer.h"
+#include "retdec/llvmir2hll/var_renamer/var_renamer_factory.h"
+#include "retdec/llvm-support/diagnostics.h"
+#include "retdec/utils/container.h"
+#include "retdec/utils/conversion.h"
+#include "retdec/utils/memory.h"
+#include "retdec/utils/string.h"
+
+using retdec::utils::hasItem;
+using retdec::utils::joinStrings;
+using retdec::utils::limitSystemMemory;
+using retdec::utils::limitSystemMemoryToHalfOfTotalSystemMemory;
+using retdec::utils::split;
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+* @brief Returns a list of all supported objects by the given factory.
+*
+* @tparam FactoryType Type of the factory in whose objects we are interested in.
+*
+* The list is comma separated and has no beginning or trailing whitespace.
+*/
+template<typename FactoryType>
+std::string getListOfSupportedObjects() {
+	return joinStrings(FactoryType::getInstance().getRegisteredObjects());
+}
+
+/**
+* @brief Prints an error message concerning the situation when an unsupported
+*        object has been selected from the given factory.
+*
+* @param[in] typeOfObjectsSingular A human-readable description of the type of
+*                                  objects the factory provides. In the
+*                                  singular form, e.g. "HLL writer".
+* @param[in] typeOfObjectsPlural A human-readable description of the type of
+*                                objects the factory provides. In the plural
+*                                form, e.g. "HLL writers".
+*
+* @tparam FactoryType Type of the factory in whose objects we are interested in.
+*/
+template<typename FactoryType>
+void printErrorUnsupportedObject(const std::string &typeOfObjectsSingular,
+		const std::string &typeOfObjectsPlural) {
+	std::string supportedObjects(getListOfSupportedObjects<FactoryType>());
+	if (!supportedObjects.empty()) {
+		llvm_support::printErrorMessage("Invalid name of the ",
+			typeOfObjectsSingular, " (supported names are: ", supportedObjects,
+			").");
+	} else {
+		llvm_support::printErrorMessage("There are no available ",
+			typeOfObjectsPlural, ". Please, recompile the backend and try it"
+			" again.");
+	}
+}
+
+} // anonymous namespace
+
+// Static variables and constants initialization.
+char Decompiler::ID = 0;
+
+/**
+* @brief Constructs a new decompiler.
+*
+* @param[in] out Output stream into which the generated HLL code will be
+*                emitted.
+* @param[in] params Parameters of the decompilation.
+* @param[in] config If non-null, this config is used instead of the one given
+*                   in @a params.
+*/
+Decompiler::Decompiler(llvm::raw_pwrite_stream &out,
+		const DecompilerParams &params, ShPtr<Config> config):
+	ModulePass(ID), out(out), params(params), llvmModule(nullptr),
+	resModule(), semantics(), config(config), hllWriter(), aliasAnalysis(),
+	cio(), arithmExprEvaluator(), varNameGen(), varRenamer() {}
+
+void Decompiler::getAnalysisUsage(llvm::AnalysisUsage &au) const {
+	au.addRequired<llvm::LoopInfoWrapperPass>();
+	au.addRequired<llvm::ScalarEvolutionWrapperPass>();
+	au.setPreservesAll();
+}
+
+bool Decompiler::runOnModule(llvm::Module &m) {
+	if (params.debug) llvm_support::printPhase("initialization");
+
+	bool decompilationShouldContinue = initialize(m);
+	if (!decompilationShouldContinue) {
+		return false;
+	}
+
+	if (params.debug) llvm_support::printPhase("conversion of LLVM IR into BIR");
+	decompilationShouldContinue = convertLLVMIRToBIR();
+	if (!decompilationShouldContinue) {
+		return false;
+	}
+
+	StringSet funcPrefixes(getPrefixesOfFuncsToBeRemoved());
+	if (params.debug) llvm_support::printPhase("removing functions prefixed with [" + joinStrings(funcPrefixes) + "]");
+	removeFuncsPrefixedWith(funcPrefixes);
+
+	if (!params.keepLibraryFunctions) {
+		if (params.debug) llvm_support::printPhase("removing functions from standard libraries");
+		removeLibraryFuncs();
+	}
+
+	// The following phase needs to be done right after the conversion because
+	// there may be code that is not reachable in a CFG. This happens because
+	// the conversion of LLVM IR to BIR is not perfect, so it may introduce
+	// unreachable code. This causes problems later during optimizations
+	// because the code exists in BIR, but not in a CFG.
+	if (params.debug) llvm_support::printPhase("removing code that is not reachable in a CFG");
+	removeCodeUnreachableInCFG();
+
+	if (params.debug) llvm_support::printPhase("signed/unsigned types fixing");
+	fixSignedUnsignedTypes();
+
+	if (params.debug) llvm_support::printPhase("converting LLVM intrinsic functions to standard functions");
+	convertLLVMIntrinsicFunctions();
+
+	if (resModule->isDebugInfoAvailable()) {
+		if (params.debug) llvm_support::printPhase("obtaining debug information");
+		obtainDebugInfo();
+	}
+
+	if (!params.noOpts) {
+		if (params.debug) llvm_support::printPhase("alias analysis [" + aliasAnalysis->getId() + "]");
+		initAliasAnalysis();
+
+		if (params.debug) llvm_support::printPhase("optimizations [" + getTypeOfRunOptimizations() + "]");
+		runOptimizations();
+	}
+
+	if (!params.noVarRenaming) {
+		if (params.debug) llvm_support::printPhase("variable renaming [" + varRenamer->getId() + "]");
+		renameVariables();
+	}
+
+	if (!params.noSymbolicNames) {
+		if (params.debug) llvm_support::printPhase("converting constants to symbolic names");
+		convertConstantsToSymbolicNames();
+	}
+
+	if (params.validateModule) {
+		if (params.debug) llvm_support::printPhase("module validation");
+		validateResultingModule();
+	}
+
+	if (!params.findPatterns.empty()) {
+		if (params.debug) llvm_support::printPhase("finding patterns");
+		findPatterns();
+	}
+
+	if (params.emitCFGs) {
+		if (params.debug) llvm_support::printPhase("emission of control-flow graphs");
+		emitCFGs();
+	}
+
+	if (params.emitCG) {
+		if (params.debug) llvm_support::printPhase("emission of a call graph");
+		emitCG();
+	}
+
+	if (params.debug) llvm_support::printPhase("emission of the target code [" + hllWriter->getId() + "]");
+	emitTargetHLLCode();
+
+	if (params.debug) llvm_support::printPhase("finalization");
+	finalize();
+
+	if (params.debug) llvm_support::printPhase("cleanup");
+	cleanup();
+
+	return false;
+}
+
+/**
+* @brief Initializes all the needed private variables.
+*
+* @return @c true if the decompilation should continue (the initialization went
+*         OK), @c false otherwise.
+*/
+bool Decompiler::initialize(llvm::Module &m) {
+	llvmModule = &m;
+
+	// Maximal memory limitation.
+	bool memoryLimitationSucceeded = limitMaximalMemoryIfRequested();
+	if (!memoryLimitationSucceeded) {
+		return false;
+	}
+
+	// Instantiate the requested HLL writer and make sure it exists. We need to
+	// explicitly specify template parameters because raw_pwrite_stream has
+	// a private copy constructor, so it needs to be passed by reference.
+	if (params.debug) llvm_support::printSubPhase("creating the used HLL writer [" + params.targetHll + "]");
+	hllWriter = HLLWriterFactory::getInstance().createObject<
+		llvm::raw_pwrite_stream &>(params.targetHll, out);
+	if (!hllWriter) {
+		printErrorUnsupportedObject<HLLWriterFactory>(
+			"target HLL", "target HLLs");
+		return false;
+	}
+
+	// Instantiate the requested alias analysis and make sure it exists.
+	if (params.debug) llvm_support::printSubPhase("creating the used alias analysis [" + params.aliasAnalysis + "]");
+	aliasAnalysis = AliasAnalysisFactory::getInstance().createObject(
+		params.aliasAnalysis);
+	if (!aliasAnalysis) {
+		printErrorUnsupportedObject<AliasAnalysisFactory>(
+			"alias analysis", "alias analyses");
+		return false;
+	}
+
+	// Instantiate the requested obtainer of information about function
+	// calls and make sure it exists.
+	if (params.debug) llvm_support::printSubPhase("creating the used call info obtainer [" + params.callInfoObtainer + "]");
+	cio = CallInfoObtainerFactory::getInstance().createObject(
+		params.callInfoObtainer);
+	if (!cio) {
+		printErrorUnsupportedObject<CallInfoObtainerFactory>(
+			"call info obtainer", "call info obtainers");
+		return false;
+	}
+
+	// Instantiate the requested evaluator of arithmetical expressions and make
+	// sure it exists.
+	if (params.debug) llvm_support::printSubPhase("creating the used evaluator of arithmetical expressions [" +
+		params.arithmExprEvaluator + "]");
+	arithmExprEvaluator = ArithmExprEvaluatorFactory::getInstance().createObject(
+		params.arithmExprEvaluator);
+	if (!arithmExprEvaluator) {
+		printErrorUnsupportedObject<ArithmExprEvaluatorFactory>(
+			"evaluator of arithmetical expressions", "evaluators of arithmetical expressions");
+		return false;
+	}
+
+	// Instantiate the requested variable names generator and make sure it
+	// exists.
+	if (params.debug) llvm_support::printSubPhase("creating the used variable names generator [" + params.varNameGen + "]");
+	varNameGen = VarNameGenFactory::getInstance().createObject(
+		params.varNameGen, params.varNameGenPrefix);
+	if (!varNameGen) {
+		printErrorUnsupportedObject<VarNameGenFactory>(
+			"variable names generator", "variable names generators");
+		return false;
+	}
+
+	// Instantiate the requested variable renamer and make sure it exists.
+	if (params.debug) llvm_support::printSubPhase("creating the used variable renamer [" + params.varRenamer + "]");
+	varRenamer = VarRenamerFactory::getInstance().createObject(
+		params.varRenamer, varNameGen, true);
+	if (!varRenamer) {
+		printErrorUnsupportedObject<VarRenamerFactory>(
+			"renamer of variables", "renamers of variables");
+		return false;
+	}
+
+	createSemantics();
+
+	bool configLoaded = loadConfig();
+	if (!configLoaded) {
+		return false;
+	}
+
+	// Everything went OK.
+	return true;
+}
+
+/**
+* @brief Limits the maximal memory of the tool based on the decompilation
+*        parameters.
+*/
+bool Decompiler::limitMaximalMemoryIfRequested() {
+	if (params.maxMemoryLimitHalfRAM) {
+		auto limitationSucceeded = limitSystemMemoryToHalfOfTotalSystemMemory();
+		if (!limitationSucceeded) {
+			llvm_support::printErrorMessage(
+				"Failed to limit maximal memory to half of system RAM."
+			);
+			return false;
+		}
+	} else if (params.maxMemoryLimit > 0) {
+		auto limitationSucceeded = limitSystemMemory(params.maxMemoryLimit);
+		if (!limitationSucceeded) {
+			llvm_support::printErrorMessage(
+				"Failed to limit maximal memory to " + std::to_string(params.maxMemoryLimit) + "."
+			);
+		}
+	}
+
+	return true;
+}
+
+/**
+* @brief Creates the used semantics.
+*/
+void Decompiler::createSemantics() {
+	if (!params.semantics.empty()) {
+		// The user has requested some concrete semantics, so use it.
+		createSemanticsFromParameter();
+	} else {
+		// The user didn't request any semantics, so create it based on the
+		// data in the input LLVM IR.
+		createSemanticsFromLLVMIR();
+	}
+}
+
+/**
+* @brief Creates the used semantics as requested by the user.
+*/
+void Decompiler::createSemanticsFromParameter() {
+	if (params.semantics.empty() || params.semantics == "-") {
+		// Do no use any semantics.
+		if (params.debug) llvm_support::printSubPhase("creating the used semantics [none]");
+		semantics = DefaultSemantics::create();
+	} else {
+		// Use the given semantics.
+		if (params.debug) llvm_support::printSubPhase("creating the used semantics [" + params.semantics + "]");
+		semantics = CompoundSemanticsBuilder::build(split(params.semantics, ','));
+	}
+}
+
+/**
+* @brief Creates the used semantics based on the data in the input LLVM IR.
+*/
+void Decompiler::createSemanticsFromLLVMIR() {
+	// Create a list of the semantics to be used.
+	// TODO Use some data from the input LLVM IR, like the used compiler.
+	std::string usedSemantics("libc,gcc-general,win-api");
+
+	// Use the list to create the semantics.
+	if (params.debug) llvm_support::printSubPhase("creating the used semantics [" + usedSemantics + "]");
+	semantics = CompoundSemanticsBuilder::build(split(usedSemantics, ','));
+}
+
+/**
+* @brief Loads a config for the module.
+*
+* @return @a true if the config was loaded successfully, @c false otherwise.
+*/
+bool Decompiler::loadConfig() {
+	if (config) {
+		// The config has already been provided by the caller.
+		if (params.debug) llvm_support::printSubPhase("using the given config");
+		return true;
+	}
+
+	// Currently, we always use the JSON config.
+	if (params.configPath.empty()) {
+		if (params.debug) llvm_support::printSubPhase("creating a new config");
+		config = JSONConfig::empty();
+		return true;
+	}
+
+	if (params.debug) llvm_support::printSubPhase("loading the input config");
+	try {
+		config = JSONConfig::fromFile(params.configPath);
+		return true;
+	} catch (const ConfigError &ex) {
+		llvm_support::printErrorMessage(
+			"Loading of the config failed: " + ex.getMessage() + "."
+		);
+		return false;
+	}
+}
+
+/**
+* @brief Saves the config file.
+*/
+void Decompiler::saveConfig() {
+	if (!params.configPath.empty()) {
+		config->saveTo(params.configPath);
+	}
+}
+
+/**
+* @brief Convert the LLVM IR module into a BIR module using the instantiated
+*        converter.
+* @return @c True if decompilation should continue, @c False if something went
+*         wrong and decompilation should abort.
+*/
+bool Decompiler::convertLLVMIRToBIR() {
+	auto llvm2BIRConverter = LLVMIR2BIRConverter::create(this);
+	// Options
+	llvm2BIRConverter->setOptionStrictFPUSemantics(params.strictFPUSemantics);
+
+	std::string moduleName = params.forcedModuleName.empty() ?
+		llvmModule->getModuleIdentifier() : params.forcedModuleName;
+	resModule = llvm2BIRConverter->convert(llvmModule, moduleName,
+		semantics, config, params.debug);
+
+	return true;
+}
+
+/**
+* @brief Removes defined functions which are from some standard library whose
+*        header file has to be included because of some function declarations.
+*/
+void Decompiler::removeLibraryFuncs() {
+	FuncVector removedFuncs(LibraryFuncsRemover::removeFuncs(
+		resModule));
+
+	if (params.debug) {
+		// Emit the functions that were turned into declarations. Before that,
+		// however, sort them by name to provide a more deterministic output.
+		sortByName(removedFuncs);
+		for (const auto &func : removedFuncs) {
+			llvm_support::printSubPhase("removing " + func->getName() + "()");
+		}
+	}
+}
+
+/**
+* @brief Removes code from all the functions in the module that is unreachable
+*        in the CFG.
+*/
+void Decompiler::removeCodeUnreachableInCFG() {
+	// The CFGs of the functions from which nothing is removed are later reused
+	// by cio.
+	UnreachableCodeInCFGRemover::removeCode(resModule, cio->getCFGCache());
+}
+
+/**
+* @brief Removes functions with the given prefix.
+*/
+void Decompiler::removeFuncsPrefixedWith(const StringSet &prefixes) {
+	FuncsWithPrefixRemover::removeFuncs(resModule, prefixes);
+}
+
+/**
+* @brief Fixes signed and unsigned types in the resulting module.
+*/
+void Decompiler::fixSignedUnsignedTypes() {
+	ExprTypesFixer::fixTypes(resModule);
+}
+
+/**
+* @brief Converts LLVM intrinsic functions to functions from the standard
+*        library.
+*/
+void Decompiler::convertLLVMIntrinsicFunctions() {
+	LLVMIntrinsicConverter::convert(resModule);
+}
+
+/**
+* @brief When available, obtains debugging information.
+*/
+void Decompiler::obtainDebugInfo() {
+	LLVMDebugInfoObtainer::obtainVarNames(resModule);
+}
+
+/**
+* @brief Initializes the alias analysis.
+*/
+void Decompiler::initAliasAnalysis() {
+	aliasAnalysis->init(resModule);
+}
+
+/**
+* @brief Runs the optimizations over the resulting module.
+*/
+void Decompiler::runOptimizations() {
+	ShPtr<OptimizerManager> optManager(new OptimizerManager(
+		parseListOfOpts(params.enabledOpts), parseListOfOpts(params.disabledOpts),
+		hllWriter, ValueAnalysis::create(aliasAnalysis, true), cio,
+		arithmExprEvaluator, params.aggressiveOpts, params.debug,
+		params.functionJobs));
+	optManager->optimize(resModule);
+}
+
+/**
+* @brief Renames variables in the resulting module by using the selected
+*        variable renamer.
+*/
+void Decompiler::renameVariables() {
+	varRenamer->renameVars(resModule);
+}
+
+/**
+* @brief Converts constants in function calls to symbolic names.
+*/
+void Decompiler::convertConstantsToSymbolicNames() {
+	ConstSymbolConverter::convert(resModule);
+}
+
+/**
+* @brief Validates the resulting module.
+*/
+void Decompiler::validateResultingModule() {
+	// Run all the registered validators over the resulting module, sorted by
+	// name.
+	StringVector regValidatorIDs(
+		ValidatorFactory::getInstance().getRegisteredObjects());
+	std::sort(regValidatorIDs.begin(), regValidatorIDs.end());
+	for (const auto &id : regValidatorIDs) {
+		if (params.debug) llvm_support::printSubPhase("running " + id + "Validator");
+		ShPtr<Validator> validator(
+			ValidatorFactory::getInstance().createObject(id));
+		validator->validate(resModule, true);
+	}
+}
+
+/**
+* @brief Finds patterns in the resulting module.
+*/
+void Decompiler::findPatterns() {
+	StringVector pfsIds(getIdsOfPatternFindersToBeRun());
+	PatternFinderRunner::PatternFinders pfs(instantiatePatternFinders(pfsIds));
+	ShPtr<PatternFinderRunner> pfr(instantiatePatternFinderRunner());
+	pfr->run(pfs, resModule);
+}
+
+/**
+* @brief Emits the target HLL code.
+*/
+void Decompiler::emitTargetHLLCode() {
+	hllWriter->setOptionEmitDebugComments(params.emitDebugComments);
+	hllWriter->setOptionKeepAllBrackets(params.keepAllBrackets);
+	hllWriter->setOptionEmitTimeVaryingInfo(!params.noTimeVaryingInfo);
+	hllWriter->setOptionUseCompoundOperators(!params.noCompoundOperators);
+	hllWriter->emitTargetCode(resModule);
+}
+
+/**
+* @brief Finalizes the run of the back-end part.
+*/
+void Decompiler::finalize() {
+	saveConfig();
+}
+
+/**
+* @brief Cleanup.
+*/
+void Decompiler::cleanup() {
+	// Nothing to do.
+
+	// Note: Do not remove this phase, even if there is nothing to do. The
+	// presence of this phase is needed for the analyzing scripts in
+	// scripts/decompiler_tests (it marks the very last phase of a successful
+	// decompilation).
+}
+
+/**
+* @brief Emits a control-flow graph (CFG) for each function in the resulting
+*        module.
+*/
+void Decompiler::emitCFGs() {
+	// Make sure that the requested CFG writer exists.
+	StringVector availCFGWriters(
+		CFGWriterFactory::getInstance().getRegisteredObjects());
+	if (!hasItem(availCFGWriters, std::string(params.cfgWriter))) {
+		printErrorUnsupportedObject<CFGWriterFactory>(
+			"CFG writer", "CFG writers");
+		return;
+	}
+
+	// The CFGs of the functions that have not changed since the last
+	// initialization of cio are already in its cache.
+	ShPtr<CFGCache> cfgCache(cio->getCFGCache());
+
+	// Get the extension of the files that will be written (we use the CFG
+	// writer's name for this purpose).
+	std::string fileExt(params.cfgWriter);
+
+	// For each function in the resulting module...
+	for (auto i = resModule->func_definition_begin(),
+			e = resModule->func_definition_end(); i != e; ++i) {
+		// Open the output file.
+		std::string fileName(params.outputFilename + ".cfg." + (*i)->getName() + "." + fileExt);
+		std::ofstream out(fileName.c_str());
+		if (!out) {
+			llvm_support::printErrorMessage("Cannot open " + fileName + " for writing.");
+			return;
+		}
+		// Create a CFG for the current function and emit it into the opened
+		// file.
+		ShPtr<CFGWriter> writer(CFGWriterFactory::getInstance(
+			).createObject<ShPtr<CFG>, std::ostream &>(
+				params.cfgWriter, cfgCache->getCFG(*i), out));
+		ASSERT_MSG(writer, "instantiation of the requested CFG writer `"
+			<< params.cfgWriter << "` failed");
+		writer->emitCFG();
+	}
+}
+
+/**
+* @brief Emits a call graph (CG) for the resulting module.
+*/
+void Decompiler::emitCG() {
+	// Make sure that the requested CG writer exists.
+	StringVector availCGWriters(
+		CGWriterFactory::getInstance().getRegisteredObjects());
+	if (!hasItem(availCGWriters, std::string(params.cgWriter))) {
+		printErrorUnsupportedObject<CGWriterFactory>(
+			"CG writer", "CG writers");
+		return;
+	}
+
+	// Get the extension of the file that will be written (we use the CG
+	// writer's name for this purpose).
+	std::string fileExt(params.cgWriter);
+
+	// Open the output file.
+	std::string fileName(params.outputFilename + ".cg." + fileExt);
+	std::ofstream out(fileName.c_str());
+	if (!out) {
+		llvm_support::printErrorMessage("Cannot open " + fileName + " for writing.");
+		return;
+	}
+
+	// Create a CG for the current module and emit it into the opened file.
+	ShPtr<CGWriter> writer(CGWriterFactory::getInstance(
+		).createObject<ShPtr<CG>, std::ostream &>(
+			params.cgWriter, CGBuilder::getCG(resModule), out));
+	ASSERT_MSG(writer,
+		"instantiation of the requested CG writer `" << params.cgWriter << "` failed");
+	writer->emitCG();
+}
+
+/**
+* @brief Parses the given list of optimizations.
+*
+* @a opts should be a list of strings separated by a comma.
+*/
+StringSet Decompiler::parseListOfOpts(const std::string &opts) const {
+	StringVector parsedOpts(split(opts, ','));
+	return StringSet(parsedOpts.begin(), parsedOpts.end());
+}
+
+/**
+* @brief Returns the type of optimizations that should be run (as a string).
+*/
+std::string Decompiler::getTypeOfRunOptimizations() const {
+	return params.aggressiveOpts ? "aggressive" : "normal";
+}
+
+/**
+* @brief Returns the IDs of pattern finders to be run.
+*/
+StringVector Decompiler::getIdsOfPatternFindersToBeRun() const {
+	if (params.findPatterns == "all") {
+		// Get all of them.
+		return PatternFinderFactory::getInstance().getRegisteredObjects();
+	} else {
+		// Get only the selected IDs.
+		return split(params.findPatterns, ',');
+	}
+}
+
+/**
+* @brief Instantiates and returns the pattern finders described by their ID.
+*
+* If a pattern finder cannot be instantiated, a warning message is emitted.
+*/
+PatternFinderRunner::PatternFinders Decompiler::instantiatePatternFinders(
+		const StringVector &pfsIds) {
+	// Pattern finders need a value analysis, so create it.
+	initAliasAnalysis();
+	ShPtr<ValueAnalysis> va(ValueAnalysis::create(aliasAnalysis, true));
+
+	// Re-initialize cio to be sure its up-to-date.
+	cio->init(CGBuilder::getCG(resModule), va);
+
+	PatternFinderRunner::PatternFinders pfs;
+	for (const auto pfId : pfsIds) {
+		ShPtr<PatternFinder> pf(
+			PatternFinderFactory::getInstance().createObject(pfId, va, cio));
+		if (!pf && params.debug) {
+			llvm_support::printWarningMessage("the requested pattern finder '" + pfId + "' does not exist");
+		} else {
+			pfs.push_back(pf);
+		}
+	}
+	return pfs;
+}
+
+/**
+* @brief Instantiates and returns a proper PatternFinderRunner.
+*/
+ShPtr<PatternFinderRunner> Decompiler::instantiatePatternFinderRunner() const {
+	if (params.debug) {
+		return ShPtr<PatternFinderRunner>(new CLIPatternFinderRunner(llvm::errs()));
+	}
+	return ShPtr<PatternFinderRunner>(new NoActionPatternFinderRunner());
+}
+
+/**
+* @brief Returns the prefixes of functions to be removed.
+*/
+StringSet Decompiler::getPrefixesOfFuncsToBeRemoved() const {
+	return config->getPrefixesOfFuncsToBeRemoved();
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
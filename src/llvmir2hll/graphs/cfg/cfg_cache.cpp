@@ -0,0 +1,231 @@
+/**
+* @file src/llvmir2hll/graphs/cfg/cfg_cache.cpp
+* @brief Implementation of CFGCache.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/graphs/cfg/cfg.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
+#include "retdec/llvmir2hll/ir/for_loop_stmt.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/goto_stmt.h"
+#include "retdec/llvmir2hll/ir/if_stmt.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/statement.h"
+#include "retdec/llvmir2hll/ir/switch_stmt.h"
+#include "retdec/llvmir2hll/ir/ufor_loop_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/ir/while_loop_stmt.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+* @brief Calls @a visit for every statement in the list starting with @a stmts,
+*        including nested statements.
+*
+* @a visit is called with a value and its version. Ends of lists of statements
+* are passed as the null pointer. Targets of goto statements are passed with
+* version @c 0. Visiting stops when @a visit returns @c false.
+*
+* @return @c false if visiting has been stopped, @c true otherwise.
+*/
+template<typename Visit>
+bool visitStmts(ShPtr<Statement> stmts, Visit &visit) {
+	for (auto stmt = stmts; stmt; stmt = stmt->getSuccessor()) {
+		if (!visit(stmt, stmt->getVersion())) {
+			return false;
+		}
+
+		if (auto ifStmt = cast<IfStmt>(stmt)) {
+			for (auto i = ifStmt->clause_begin(), e = ifStmt->clause_end();
+					i != e; ++i) {
+				if (!visitStmts(i->second, visit)) {
+					return false;
+				}
+			}
+			// There is always an end of the else clause, even if it is
+			// missing, so a removal of the else clause changes the layout.
+			if (!visitStmts(ifStmt->getElseClause(), visit)) {
+				return false;
+			}
+		} else if (auto switchStmt = cast<SwitchStmt>(stmt)) {
+			for (auto i = switchStmt->clause_begin(),
+					e = switchStmt->clause_end(); i != e; ++i) {
+				if (!visitStmts(i->second, visit)) {
+					return false;
+				}
+			}
+		} else if (auto whileLoopStmt = cast<WhileLoopStmt>(stmt)) {
+			if (!visitStmts(whileLoopStmt->getBody(), visit)) {
+				return false;
+			}
+		} else if (auto forLoopStmt = cast<ForLoopStmt>(stmt)) {
+			if (!visitStmts(forLoopStmt->getBody(), visit)) {
+				return false;
+			}
+		} else if (auto uforLoopStmt = cast<UForLoopStmt>(stmt)) {
+			if (!visitStmts(uforLoopStmt->getBody(), visit)) {
+				return false;
+			}
+		} else if (auto gotoStmt = cast<GotoStmt>(stmt)) {
+			if (!visit(gotoStmt->getTarget(), 0)) {
+				return false;
+			}
+		}
+	}
+	return visit(ShPtr<Value>(), 0);
+}
+
+/**
+* @brief Calls @a visit for every parameter of @a func and every statement in
+*        its body.
+*
+* See visitStmts() for more details.
+*/
+template<typename Visit>
+bool visitFuncLayout(ShPtr<Function> func, Visit &visit) {
+	for (const auto &param : func->getParams()) {
+		if (!visit(param, 0)) {
+			return false;
+		}
+	}
+	if (!visit(ShPtr<Value>(), 0)) {
+		return false;
+	}
+	return visitStmts(func->getBody(), visit);
+}
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a new cache.
+*
+* See create() for more details.
+*/
+CFGCache::CFGCache(ShPtr<CFGBuilder> cfgBuilder):
+	cfgBuilder(cfgBuilder), cachedCFGs() {}
+
+/**
+* @brief Creates a new cache.
+*
+* @param[in] cfgBuilder Builder of CFGs that are not in the cache.
+*
+* @par Preconditions
+*  - @a cfgBuilder is non-null
+*/
+ShPtr<CFGCache> CFGCache::create(ShPtr<CFGBuilder> cfgBuilder) {
+	PRECONDITION_NON_NULL(cfgBuilder);
+
+	return ShPtr<CFGCache>(new CFGCache(cfgBuilder));
+}
+
+/**
+* @brief Returns a CFG of the given function @a func.
+*
+* If the cache contains a CFG of @a func and the function has not been changed
+* since the CFG was built, the cached CFG is returned. Otherwise, a new CFG is
+* built and stored into the cache.
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+ShPtr<CFG> CFGCache::getCFG(ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(func);
+
+	CachedCFG &cachedCFG(cachedCFGs[func]);
+	if (cachedCFG.cfg && hasFuncLayout(func, cachedCFG.layout)) {
+		return cachedCFG.cfg;
+	}
+
+	cachedCFG.cfg = cfgBuilder->getCFG(func);
+	cachedCFG.layout = getFuncLayout(func);
+	return cachedCFG.cfg;
+}
+
+/**
+* @brief Returns @c true if the cache contains a CFG of @a func, @c false
+*        otherwise.
+*
+* The CFG may be out of date. It is checked only in getCFG().
+*/
+bool CFGCache::hasCFG(ShPtr<Function> func) const {
+	return cachedCFGs.find(func) != cachedCFGs.end();
+}
+
+/**
+* @brief Returns the number of CFGs in the cache.
+*/
+std::size_t CFGCache::getNumOfCFGs() const {
+	return cachedCFGs.size();
+}
+
+/**
+* @brief Removes the CFG of @a func from the cache (if any).
+*/
+void CFGCache::removeCFG(ShPtr<Function> func) {
+	cachedCFGs.erase(func);
+}
+
+/**
+* @brief Removes CFGs of functions that are not in @a module from the cache.
+*
+* @par Preconditions
+*  - @a module is non-null
+*/
+void CFGCache::removeCFGsOfFuncsNotInModule(ShPtr<Module> module) {
+	PRECONDITION_NON_NULL(module);
+
+	FuncSet funcs(module->func_begin(), module->func_end());
+	for (auto i = cachedCFGs.begin(); i != cachedCFGs.end();) {
+		if (funcs.find(i->first) == funcs.end()) {
+			i = cachedCFGs.erase(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+/**
+* @brief Removes all CFGs from the cache.
+*/
+void CFGCache::clear() {
+	cachedCFGs.clear();
+}
+
+/**
+* @brief Returns the current layout of @a func.
+*/
+CFGCache::FuncLayout CFGCache::getFuncLayout(ShPtr<Function> func) {
+	FuncLayout layout;
+	auto store = [&layout](ShPtr<Value> value, unsigned version) {
+		layout.emplace_back(value, version);
+		return true;
+	};
+	visitFuncLayout(func, store);
+	return layout;
+}
+
+/**
+* @brief Returns @c true if the current layout of @a func is @a layout, @c
+*        false otherwise.
+*/
+bool CFGCache::hasFuncLayout(ShPtr<Function> func, const FuncLayout &layout) {
+	auto i = layout.begin();
+	auto compare = [&i, &layout](ShPtr<Value> value, unsigned version) {
+		if (i == layout.end() || i->first != value || i->second != version) {
+			return false;
+		}
+		++i;
+		return true;
+	};
+	return visitFuncLayout(func, compare) && i == layout.end();
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
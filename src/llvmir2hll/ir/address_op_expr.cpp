@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 AddressOpExpr::AddressOpExpr(ShPtr<Expression> op):
-	UnaryOpExpr(op) {}
+	UnaryOpExpr(ValueKind::AddressOpExpr, op) {}
 
 /**
 * @brief Destructs the operator.
@@ -18,7 +18,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 AndOpExpr::AndOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2):
-	BinaryOpExpr(op1, op2) {}
+	BinaryOpExpr(ValueKind::AndOpExpr, op1, op2) {}
 
 /**
 * @brief Destructs the operator.
@@ -20,7 +20,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 ArrayIndexOpExpr::ArrayIndexOpExpr(ShPtr<Expression> base, ShPtr<Expression> index):
-	BinaryOpExpr(base, index) {}
+	BinaryOpExpr(ValueKind::ArrayIndexOpExpr, base, index) {}
 
 /**
 * @brief Destructs the operator.
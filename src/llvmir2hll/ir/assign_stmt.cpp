@@ -20,7 +20,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 AssignStmt::AssignStmt(ShPtr<Expression> lhs, ShPtr<Expression> rhs):
-	lhs(lhs), rhs(rhs) {}
+	Statement(ValueKind::AssignStmt), lhs(lhs), rhs(rhs) {}
 
 /**
 * @brief Destructs the statement.
@@ -87,6 +87,7 @@ void AssignStmt::setLhs(ShPtr<Expression> left) {
 	lhs->removeObserver(shared_from_this());
 	left->addObserver(shared_from_this());
 	lhs = left;
+	updateVersion();
 }
 
 /**
@@ -101,6 +102,7 @@ void AssignStmt::setRhs(ShPtr<Expression> right) {
 	rhs->removeObserver(shared_from_this());
 	right->addObserver(shared_from_this());
 	rhs = right;
+	updateVersion();
 }
 
 /**
@@ -22,8 +22,9 @@ namespace llvmir2hll {
 * @par Preconditions
 *  - both operands are non-null
 */
-BinaryOpExpr::BinaryOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2):
-		op1(op1), op2(op2) {
+BinaryOpExpr::BinaryOpExpr(ValueKind kind, ShPtr<Expression> op1,
+		ShPtr<Expression> op2):
+			Expression(kind), op1(op1), op2(op2) {
 	PRECONDITION_NON_NULL(op1);
 	PRECONDITION_NON_NULL(op2);
 }
@@ -107,6 +108,7 @@ void BinaryOpExpr::setFirstOperand(ShPtr<Expression> first) {
 	op1->removeObserver(shared_from_this());
 	first->addObserver(shared_from_this());
 	op1 = first;
+	updateVersion();
 }
 
 /**
@@ -121,6 +123,7 @@ void BinaryOpExpr::setSecondOperand(ShPtr<Expression> second) {
 	op2->removeObserver(shared_from_this());
 	second->addObserver(shared_from_this());
 	op2 = second;
+	updateVersion();
 }
 
 /**
@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 BitCastExpr::BitCastExpr(ShPtr<Expression> op, ShPtr<Type> dstType):
-	CastExpr(op, dstType) {}
+	CastExpr(ValueKind::BitCastExpr, op, dstType) {}
 
 /**
 * @brief Destructs the operator.
@@ -14,7 +14,7 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a new break statement.
 */
-BreakStmt::BreakStmt() {}
+BreakStmt::BreakStmt(): Statement(ValueKind::BreakStmt) {}
 
 /**
 * @brief Destructs the statement.
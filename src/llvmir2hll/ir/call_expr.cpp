@@ -21,7 +21,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 CallExpr::CallExpr(ShPtr<Expression> calledExpr, ExprVector args):
-	calledExpr(calledExpr), args(args) {}
+	Expression(ValueKind::CallExpr), calledExpr(calledExpr), args(args) {}
 
 /**
 * @brief Destructs the call expression.
@@ -93,6 +93,7 @@ void CallExpr::replace(ShPtr<Expression> oldExpr, ShPtr<Expression> newExpr) {
 			arg->removeObserver(shared_from_this());
 			newExpr->addObserver(shared_from_this());
 			arg = newExpr;
+			updateVersion();
 		} else {
 			arg->replace(oldExpr, newExpr);
 		}
@@ -164,6 +165,7 @@ void CallExpr::setCalledExpr(ShPtr<Expression> newCalledExpr) {
 	calledExpr->removeObserver(shared_from_this());
 	newCalledExpr->addObserver(shared_from_this());
 	calledExpr = newCalledExpr;
+	updateVersion();
 }
 
 /**
@@ -177,6 +179,7 @@ void CallExpr::setArgs(ExprVector newArgs) {
 		arg->addObserver(shared_from_this());
 	}
 	args = newArgs;
+	updateVersion();
 }
 
 /**
@@ -204,6 +207,7 @@ void CallExpr::setArg(std::size_t position, ShPtr<Expression> newArg) {
 	(*iter)->removeObserver(shared_from_this());
 	newArg->addObserver(shared_from_this());
 	*iter = newArg;
+	updateVersion();
 }
 
 /**
@@ -222,6 +226,7 @@ void CallExpr::replaceArg(ShPtr<Expression> oldArg, ShPtr<Expression> newArg) {
 		oldArg->removeObserver(shared_from_this());
 		newArg->addObserver(shared_from_this());
 		*oldArgIter = newArg;
+		updateVersion();
 	}
 }
 
@@ -17,7 +17,8 @@ namespace llvmir2hll {
 *
 * See create() for more information.
 */
-CallStmt::CallStmt(ShPtr<CallExpr> call): call(call) {}
+CallStmt::CallStmt(ShPtr<CallExpr> call):
+	Statement(ValueKind::CallStmt), call(call) {}
 
 /**
 * @brief Destructs the statement.
@@ -69,6 +70,7 @@ void CallStmt::setCall(ShPtr<CallExpr> newCall) {
 	call->removeObserver(shared_from_this());
 	newCall->addObserver(shared_from_this());
 	call = newCall;
+	updateVersion();
 }
 
 /**
@@ -13,8 +13,9 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a cast operator.
 */
-CastExpr::CastExpr(ShPtr<Expression> op, ShPtr<Type> dstType):
-	op(op), dstType(dstType) {
+CastExpr::CastExpr(ValueKind kind, ShPtr<Expression> op,
+		ShPtr<Type> dstType):
+	Expression(kind), op(op), dstType(dstType) {
 		PRECONDITION_NON_NULL(op);
 		PRECONDITION_NON_NULL(dstType);
 }
@@ -50,6 +51,7 @@ void CastExpr::setOperand(ShPtr<Expression> newOp) {
 	op->removeObserver(shared_from_this());
 	newOp->addObserver(shared_from_this());
 	op = newOp;
+	updateVersion();
 }
 
 /**
@@ -19,7 +19,8 @@ namespace llvmir2hll {
 * See create() or createUninitialized() for more information.
 */
 ConstArray::ConstArray(ArrayValue value, ShPtr<ArrayType> type):
-	Constant(), value(value), initialized(!value.empty()), type(type) {}
+	Constant(ValueKind::ConstArray),
+	value(value), initialized(!value.empty()), type(type) {}
 
 /**
 * @brief Destructs the constant.
@@ -91,6 +92,7 @@ void ConstArray::replace(ShPtr<Expression> oldExpr, ShPtr<Expression> newExpr) {
 	for (auto &item : value) {
 		if (item == oldExpr) {
 			item = newExpr;
+			updateVersion();
 		} else {
 			item->replace(oldExpr, newExpr);
 		}
@@ -245,6 +247,7 @@ void ConstArray::update(ShPtr<Value> subject, ShPtr<Value> arg) {
 	for (auto &item : value) {
 		if (item == subject) {
 			item = newExpr;
+			updateVersion();
 		}
 	}
 }
@@ -18,7 +18,8 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 ConstBool::ConstBool(Type value):
-	Constant(), value(value), type(IntType::create(1, false)) {}
+	Constant(ValueKind::ConstBool),
+	value(value), type(IntType::create(1, false)) {}
 
 /**
 * @brief Destructs the constant.
@@ -58,7 +58,8 @@ ShPtr<FloatType> getTypeOfValue(const ConstFloat::Type &value) {
 * See create() for more information.
 */
 ConstFloat::ConstFloat(Type value):
-	Constant(), value(value), type(getTypeOfValue(value)) {}
+	Constant(ValueKind::ConstFloat),
+	value(value), type(getTypeOfValue(value)) {}
 
 /**
 * @brief Destructs the constant.
@@ -18,7 +18,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 ConstNullPointer::ConstNullPointer(ShPtr<PointerType> type):
-	Constant(), type(type) {}
+	Constant(ValueKind::ConstNullPointer), type(type) {}
 
 /**
 * @brief Destructs the constant.
@@ -19,7 +19,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 ConstStruct::ConstStruct(Type value, ShPtr<StructType> type):
-	Constant(), value(value), type(type) {}
+	Constant(ValueKind::ConstStruct), value(value), type(type) {}
 
 /**
 * @brief Destructs the constant.
@@ -62,12 +62,14 @@ void ConstStruct::replace(ShPtr<Expression> oldExpr, ShPtr<Expression> newExpr)
 	for (auto &member : value) {
 		if (member.first == oldExpr && isa<ConstInt>(newExpr)) {
 			member.first = cast<ConstInt>(newExpr);
+			updateVersion();
 		} else {
 			member.first->replace(oldExpr, newExpr);
 		}
 
 		if (member.second == oldExpr) {
 			member.second = newExpr;
+			updateVersion();
 		} else {
 			member.second->replace(oldExpr, newExpr);
 		}
@@ -135,6 +137,7 @@ void ConstStruct::update(ShPtr<Value> subject, ShPtr<Value> arg) {
 	for (auto &member : value) {
 		if (member.second == subject) {
 			member.second = newExpr;
+			updateVersion();
 		}
 	}
 }
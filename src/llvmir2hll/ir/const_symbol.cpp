@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 ConstSymbol::ConstSymbol(const std::string &name, ShPtr<Constant> value):
-	Constant(), name(name), value(value) {}
+	Constant(ValueKind::ConstSymbol), name(name), value(value) {}
 
 /**
 * @brief Destructs the constant.
@@ -107,6 +107,7 @@ void ConstSymbol::setValue(ShPtr<Constant> newValue) {
 	value->removeObserver(shared_from_this());
 	value = newValue;
 	value->addObserver(shared_from_this());
+	updateVersion();
 }
 
 void ConstSymbol::accept(Visitor *v) {
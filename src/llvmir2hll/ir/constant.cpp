@@ -13,7 +13,7 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a constant.
 */
-Constant::Constant() {}
+Constant::Constant(ValueKind kind): Expression(kind) {}
 
 /**
 * @brief Destructs the operator.
@@ -14,7 +14,7 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a new continue statement.
 */
-ContinueStmt::ContinueStmt(): Statement() {}
+ContinueStmt::ContinueStmt(): Statement(ValueKind::ContinueStmt) {}
 
 /**
 * @brief Destructs the statement.
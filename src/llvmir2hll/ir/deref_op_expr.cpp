@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 DerefOpExpr::DerefOpExpr(ShPtr<Expression> op):
-	UnaryOpExpr(op) {}
+	UnaryOpExpr(ValueKind::DerefOpExpr, op) {}
 
 /**
 * @brief Destructs the operator.
@@ -16,7 +16,7 @@ namespace llvmir2hll {
 *
 * See create() for more information.
 */
-EmptyStmt::EmptyStmt() {}
+EmptyStmt::EmptyStmt(): Statement(ValueKind::EmptyStmt) {}
 
 /**
 * @brief Destructs the statement.
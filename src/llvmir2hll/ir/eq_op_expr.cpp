@@ -18,7 +18,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 EqOpExpr::EqOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2):
-	BinaryOpExpr(op1, op2) {}
+	BinaryOpExpr(ValueKind::EqOpExpr, op1, op2) {}
 
 /**
 * @brief Destructs the operator.
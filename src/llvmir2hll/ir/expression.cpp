@@ -13,7 +13,7 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a new expression.
 */
-Expression::Expression() {}
+Expression::Expression(ValueKind kind): Value(kind) {}
 
 /**
 * @brief Destructs the expression.
@@ -19,7 +19,7 @@ namespace llvmir2hll {
 */
 ExtCastExpr::ExtCastExpr(ShPtr<Expression> op, ShPtr<Type> dstType,
 		Variant variant):
-	CastExpr(op, dstType), variant(variant) {}
+	CastExpr(ValueKind::ExtCastExpr, op, dstType), variant(variant) {}
 
 /**
 * @brief Destructs the operator.
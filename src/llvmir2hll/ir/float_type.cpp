@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <mutex>
+
 #include "retdec/llvmir2hll/ir/float_type.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/llvmir2hll/support/visitor.h"
@@ -11,13 +13,20 @@
 namespace retdec {
 namespace llvmir2hll {
 
+namespace {
+
+/// Guards the set of already created types.
+std::mutex createdTypesMutex;
+
+} // anonymous namespace
+
 /**
 * @brief Constructs a new float type.
 *
 * See create() for more information.
 */
 FloatType::FloatType(unsigned size):
-	Type(), size(size) {}
+	Type(ValueKind::FloatType), size(size) {}
 
 /**
 * @brief Destructs the type.
@@ -51,6 +60,7 @@ unsigned FloatType::getSize() const {
 * @return Returns true if exists type, else false.
 */
 bool FloatType::existsFloatTypeWith(unsigned size) const {
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
 	return createdTypes.find(size) != createdTypes.end();
 }
 
@@ -60,10 +70,8 @@ bool FloatType::existsFloatTypeWith(unsigned size) const {
 * @return Returns true if exists float type, else false.
 */
 bool FloatType::existsFloatType() const {
-	if (createdTypes.empty()) {
-		return false;
-	}
-	return true;
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
+	return !createdTypes.empty();
 }
 
 /**
@@ -74,6 +82,8 @@ bool FloatType::existsFloatType() const {
 ShPtr<FloatType> FloatType::create(unsigned size) {
 	PRECONDITION(size > 0, "invalid size " << size);
 
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
+
 	// To reduce the amount of created types, we use a set of already created
 	// float types of the given size. If the wanted type has already been
 	// created, reuse it.
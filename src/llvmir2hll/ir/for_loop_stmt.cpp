@@ -20,6 +20,7 @@ namespace llvmir2hll {
 */
 ForLoopStmt::ForLoopStmt(ShPtr<Variable> indVar, ShPtr<Expression> startValue,
 	ShPtr<Expression> endCond, ShPtr<Expression> step, ShPtr<Statement> body):
+		Statement(ValueKind::ForLoopStmt),
 		indVar(indVar), startValue(startValue), endCond(endCond), step(step),
 		body(body) {}
 
@@ -133,6 +134,7 @@ void ForLoopStmt::setIndVar(ShPtr<Variable> newIndVar) {
 	indVar->removeObserver(shared_from_this());
 	newIndVar->addObserver(shared_from_this());
 	indVar = newIndVar;
+	updateVersion();
 }
 
 /**
@@ -147,6 +149,7 @@ void ForLoopStmt::setStartValue(ShPtr<Expression> newStartValue) {
 	startValue->removeObserver(shared_from_this());
 	newStartValue->addObserver(shared_from_this());
 	startValue = newStartValue;
+	updateVersion();
 }
 
 /**
@@ -161,6 +164,7 @@ void ForLoopStmt::setEndCond(ShPtr<Expression> newEndCond) {
 	endCond->removeObserver(shared_from_this());
 	newEndCond->addObserver(shared_from_this());
 	endCond = newEndCond;
+	updateVersion();
 }
 
 /**
@@ -175,6 +179,7 @@ void ForLoopStmt::setStep(ShPtr<Expression> newStep) {
 	step->removeObserver(shared_from_this());
 	newStep->addObserver(shared_from_this());
 	step = newStep;
+	updateVersion();
 }
 
 /**
@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 FPToIntCastExpr::FPToIntCastExpr(ShPtr<Expression> op, ShPtr<Type> dstType):
-	CastExpr(op, dstType) {}
+	CastExpr(ValueKind::FPToIntCastExpr, op, dstType) {}
 
 /**
 * @brief Destructs the operator.
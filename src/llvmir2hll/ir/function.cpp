@@ -29,6 +29,7 @@ namespace llvmir2hll {
 */
 Function::Function(ShPtr<Type> retType, std::string name, VarVector params,
 		VarSet localVars, ShPtr<Statement> body, bool isVarArg):
+			Value(ValueKind::Function),
 			retType(retType), params(params), localVars(localVars),
 			body(body), funcVar(), varArg(isVarArg) {
 	includeParamsIntoLocalVars();
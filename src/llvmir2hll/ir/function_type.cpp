@@ -21,7 +21,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 FunctionType::FunctionType(ShPtr<Type> retType):
-	Type(), retType(retType), varArg(false) {}
+	Type(ValueKind::FunctionType), retType(retType), varArg(false) {}
 
 /**
 * @brief Destructs the type.
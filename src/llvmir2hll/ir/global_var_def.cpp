@@ -19,7 +19,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 GlobalVarDef::GlobalVarDef(ShPtr<Variable> var, ShPtr<Expression> init):
-	var(var), init(init) {}
+	Value(ValueKind::GlobalVarDef), var(var), init(init) {}
 
 /**
 * @brief Destructs the definition.
@@ -105,6 +105,7 @@ void GlobalVarDef::setVar(ShPtr<Variable> newVar) {
 	var->removeObserver(shared_from_this());
 	newVar->addObserver(shared_from_this());
 	var = newVar;
+	updateVersion();
 }
 
 /**
@@ -118,6 +119,7 @@ void GlobalVarDef::setInitializer(ShPtr<Expression> newInit) {
 		newInit->addObserver(shared_from_this());
 	}
 	init = newInit;
+	updateVersion();
 }
 
 /**
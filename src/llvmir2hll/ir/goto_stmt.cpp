@@ -16,7 +16,8 @@ namespace llvmir2hll {
 *
 * See create() for more information.
 */
-GotoStmt::GotoStmt(ShPtr<Statement> target): target(target) {}
+GotoStmt::GotoStmt(ShPtr<Statement> target):
+	Statement(ValueKind::GotoStmt), target(target) {}
 
 /**
 * @brief Destructs the statement.
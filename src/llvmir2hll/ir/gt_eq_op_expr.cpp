@@ -19,7 +19,7 @@ namespace llvmir2hll {
 */
 GtEqOpExpr::GtEqOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2,
 		Variant variant):
-	BinaryOpExpr(op1, op2), variant(variant) {}
+	BinaryOpExpr(ValueKind::GtEqOpExpr, op1, op2), variant(variant) {}
 
 /**
 * @brief Destructs the operator.
@@ -19,6 +19,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 IfStmt::IfStmt(ShPtr<Expression> cond, ShPtr<Statement> body):
+		Statement(ValueKind::IfStmt),
 		ifClauseList{IfClause(cond, body)}, elseClause() {}
 
 /**
@@ -88,6 +89,7 @@ void IfStmt::replace(ShPtr<Expression> oldExpr, ShPtr<Expression> newExpr) {
 			clause.first->removeObserver(shared_from_this());
 			newExpr->addObserver(shared_from_this());
 			clause.first = newExpr;
+			updateVersion();
 		} else {
 			clause.first->replace(oldExpr, newExpr);
 		}
@@ -121,6 +123,7 @@ void IfStmt::addClause(ShPtr<Expression> cond, ShPtr<Statement> body) {
 	cond->addObserver(shared_from_this());
 	body->addObserver(shared_from_this());
 	ifClauseList.push_back(IfClause(cond, body));
+	updateVersion();
 }
 
 /**
@@ -167,6 +170,7 @@ IfStmt::clause_iterator IfStmt::removeClause(clause_iterator clauseIterator) {
 	// We assume that the used container is std::list.
 	clauseIterator->first->removeObserver(shared_from_this());
 	clauseIterator->second->removeObserver(shared_from_this());
+	updateVersion();
 	return ifClauseList.erase(clauseIterator);
 }
 
@@ -313,6 +317,7 @@ void IfStmt::update(ShPtr<Value> subject, ShPtr<Value> arg) {
 			clause.first->removeObserver(shared_from_this());
 			newCond->addObserver(shared_from_this());
 			clause.first = newCond;
+			updateVersion();
 		} else if (subject == clause.second && newBody) {
 			clause.second->removeObserver(shared_from_this());
 			newBody->addObserver(shared_from_this());
@@ -367,6 +372,7 @@ void IfStmt::setFirstIfCond(ShPtr<Expression> newCond) {
 	ifClauseList.begin()->first->removeObserver(shared_from_this());
 	newCond->addObserver(shared_from_this());
 	*ifClauseList.begin() = IfClause(newCond, ifClauseList.begin()->second);
+	updateVersion();
 }
 
 /**
@@ -18,7 +18,7 @@ namespace llvmir2hll {
 */
 IntToFPCastExpr::IntToFPCastExpr(ShPtr<Expression> op, ShPtr<Type> dstType,
 		Variant variant):
-	CastExpr(op, dstType), variant(variant) {}
+	CastExpr(ValueKind::IntToFPCastExpr, op, dstType), variant(variant) {}
 
 /**
 * @brief Destructs the operator.
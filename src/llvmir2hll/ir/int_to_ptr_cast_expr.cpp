@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 IntToPtrCastExpr::IntToPtrCastExpr(ShPtr<Expression> op, ShPtr<Type> dstType):
-	CastExpr(op, dstType) {}
+	CastExpr(ValueKind::IntToPtrCastExpr, op, dstType) {}
 
 /**
 * @brief Destructs the operator.
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <mutex>
+
 #include "retdec/llvmir2hll/ir/int_type.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/llvmir2hll/support/visitor.h"
@@ -11,13 +13,21 @@
 namespace retdec {
 namespace llvmir2hll {
 
+namespace {
+
+/// Guards the sets of already created types. Types are created also by
+/// optimizers that run in several threads (see OptimizerManager).
+std::mutex createdTypesMutex;
+
+} // anonymous namespace
+
 /**
 * @brief Constructs a new integer type.
 *
 * See create() for more information.
 */
 IntType::IntType(unsigned size, bool isSigned):
-	Type(), size(size), signedInt(isSigned) {}
+	Type(ValueKind::IntType), size(size), signedInt(isSigned) {}
 
 /**
 * @brief Destructs the type.
@@ -83,6 +93,8 @@ bool IntType::isBool() const {
 ShPtr<IntType> IntType::create(unsigned size, bool isSigned) {
 	PRECONDITION(size > 0, "invalid size " << size);
 
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
+
 	// There are two maps, one for signed integers and one for unsigned integers.
 	if (isSigned) {
 		// To reduce the amount of created types, we use a set of already created
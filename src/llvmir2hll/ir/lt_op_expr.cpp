@@ -19,7 +19,7 @@ namespace llvmir2hll {
 */
 LtOpExpr::LtOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2,
 		Variant variant):
-	BinaryOpExpr(op1, op2), variant(variant) {}
+	BinaryOpExpr(ValueKind::LtOpExpr, op1, op2), variant(variant) {}
 
 /**
 * @brief Destructs the operator.
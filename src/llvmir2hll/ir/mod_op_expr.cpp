@@ -18,7 +18,7 @@ namespace llvmir2hll {
 */
 ModOpExpr::ModOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2,
 		Variant variant):
-	BinaryOpExpr(op1, op2), variant(variant) {}
+	BinaryOpExpr(ValueKind::ModOpExpr, op1, op2), variant(variant) {}
 
 /**
 * @brief Destructs the operator.
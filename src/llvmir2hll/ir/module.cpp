@@ -17,6 +17,7 @@
 #include "retdec/llvmir2hll/semantics/semantics.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/llvmir2hll/support/maybe.h"
+#include "retdec/llvmir2hll/support/value_allocator.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/string.h"
 
@@ -50,8 +51,18 @@ Module::Module(const llvm::Module *llvmModule, const std::string &identifier,
 
 /**
 * @brief Destructs the module.
+*
+* Memory of values that are freed together with the module is returned to the
+* system (see ValueAllocator::releaseUnusedMemory()).
 */
-Module::~Module() {}
+Module::~Module() {
+	// The values have to be freed before the memory is released, so they
+	// cannot be left to the destructors of the members.
+	globalVars.clear();
+	funcs.clear();
+	debugVarNameMap.clear();
+	ValueAllocator::releaseUnusedMemory();
+}
 
 /**
 * @brief Adds a new global variable to the module.
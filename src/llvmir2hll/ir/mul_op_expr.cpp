@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 MulOpExpr::MulOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2):
-	BinaryOpExpr(op1, op2) {}
+	BinaryOpExpr(ValueKind::MulOpExpr, op1, op2) {}
 
 /**
 * @brief Destructs the operator.
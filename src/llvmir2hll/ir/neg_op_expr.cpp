@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 NegOpExpr::NegOpExpr(ShPtr<Expression> op):
-	UnaryOpExpr(op) {}
+	UnaryOpExpr(ValueKind::NegOpExpr, op) {}
 
 /**
 * @brief Destructs the operator.
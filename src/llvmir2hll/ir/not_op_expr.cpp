@@ -18,7 +18,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 NotOpExpr::NotOpExpr(ShPtr<Expression> op):
-	UnaryOpExpr(op) {}
+	UnaryOpExpr(ValueKind::NotOpExpr, op) {}
 
 /**
 * @brief Destructs the operator.
@@ -18,7 +18,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 OrOpExpr::OrOpExpr(ShPtr<Expression> op1, ShPtr<Expression> op2):
-	BinaryOpExpr(op1, op2) {}
+	BinaryOpExpr(ValueKind::OrOpExpr, op1, op2) {}
 
 /**
 * @brief Destructs the operator.
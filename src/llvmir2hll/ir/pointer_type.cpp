@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 PointerType::PointerType(ShPtr<Type> containedType):
-	Type(), containedType(containedType) {}
+	Type(ValueKind::PointerType), containedType(containedType) {}
 
 /**
 * @brief Destructs the type.
@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 PtrToIntCastExpr::PtrToIntCastExpr(ShPtr<Expression> op, ShPtr<Type> dstType):
-	CastExpr(op, dstType) {}
+	CastExpr(ValueKind::PtrToIntCastExpr, op, dstType) {}
 
 /**
 * @brief Destructs the operator.
@@ -18,7 +18,8 @@ namespace llvmir2hll {
 *
 * See create() for more information.
 */
-ReturnStmt::ReturnStmt(ShPtr<Expression> retVal): retVal(retVal) {}
+ReturnStmt::ReturnStmt(ShPtr<Expression> retVal):
+	Statement(ValueKind::ReturnStmt), retVal(retVal) {}
 
 /**
 * @brief Destructs the statement.
@@ -83,6 +84,7 @@ void ReturnStmt::setRetVal(ShPtr<Expression> newRetVal) {
 	if (retVal) {
 		retVal->addObserver(shared_from_this());
 	}
+	updateVersion();
 }
 
 /**
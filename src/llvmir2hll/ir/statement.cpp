@@ -32,8 +32,8 @@ void preserveLabel(ShPtr<Statement> origStmt, ShPtr<Statement> newStmt) {
 /**
 * @brief Constructs a new statement.
 */
-Statement::Statement():
-	succ(), preds(), label() {
+Statement::Statement(ValueKind kind):
+	Value(kind), succ(), preds(), label() {
 }
 
 /**
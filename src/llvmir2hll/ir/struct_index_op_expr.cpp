@@ -22,7 +22,7 @@ namespace llvmir2hll {
 */
 StructIndexOpExpr::StructIndexOpExpr(ShPtr<Expression> base,
 	ShPtr<ConstInt> fieldNumber):
-		BinaryOpExpr(base, fieldNumber) {}
+		BinaryOpExpr(ValueKind::StructIndexOpExpr, base, fieldNumber) {}
 
 /**
 * @brief Destructs the operator.
@@ -19,6 +19,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 SwitchStmt::SwitchStmt(ShPtr<Expression> controlExpr):
+	Statement(ValueKind::SwitchStmt),
 	switchClauseList(), controlExpr(controlExpr) {}
 
 /**
@@ -106,6 +107,7 @@ void SwitchStmt::replace(ShPtr<Expression> oldExpr, ShPtr<Expression> newExpr) {
 			i->first->removeObserver(shared_from_this());
 			newExpr->addObserver(shared_from_this());
 			i->first = newExpr;
+			updateVersion();
 		}
 	}
 }
@@ -140,6 +142,7 @@ void SwitchStmt::addClause(ShPtr<Expression> expr, ShPtr<Statement> body) {
 	}
 	body->addObserver(shared_from_this());
 	switchClauseList.push_back(SwitchClause(expr, body));
+	updateVersion();
 }
 
 /**
@@ -172,6 +175,7 @@ SwitchStmt::clause_iterator SwitchStmt::removeClause(
 		clauseIterator->first->removeObserver(shared_from_this());
 	}
 	clauseIterator->second->removeObserver(shared_from_this());
+	updateVersion();
 	return switchClauseList.erase(clauseIterator);
 }
 
@@ -189,6 +193,7 @@ void SwitchStmt::setControlExpr(ShPtr<Expression> newExpr) {
 	controlExpr->removeObserver(shared_from_this());
 	newExpr->addObserver(shared_from_this());
 	controlExpr = newExpr;
+	updateVersion();
 }
 
 /**
@@ -350,6 +355,7 @@ void SwitchStmt::update(ShPtr<Value> subject, ShPtr<Value> arg) {
 		controlExpr->removeObserver(shared_from_this());
 		newExpr->addObserver(shared_from_this());
 		controlExpr = newExpr;
+		updateVersion();
 	}
 
 	// Check all clauses.
@@ -361,6 +367,7 @@ void SwitchStmt::update(ShPtr<Value> subject, ShPtr<Value> arg) {
 				newExpr->addObserver(shared_from_this());
 			}
 			i->first = newExpr;
+			updateVersion();
 		} else if (subject == i->second && newBody) {
 			i->second->removeObserver(shared_from_this());
 			newBody->addObserver(shared_from_this());
@@ -19,7 +19,8 @@ namespace llvmir2hll {
 */
 TernaryOpExpr::TernaryOpExpr(ShPtr<Expression> cond, ShPtr<Expression> trueValue,
 	ShPtr<Expression> falseValue):
-		Expression(), cond(cond), trueValue(trueValue), falseValue(falseValue) {}
+		Expression(ValueKind::TernaryOpExpr),
+		cond(cond), trueValue(trueValue), falseValue(falseValue) {}
 
 /**
 * @brief Destructs the operator.
@@ -108,6 +109,7 @@ void TernaryOpExpr::setCondition(ShPtr<Expression> newCond) {
 	cond->removeObserver(shared_from_this());
 	newCond->addObserver(shared_from_this());
 	cond = newCond;
+	updateVersion();
 }
 
 /**
@@ -122,6 +124,7 @@ void TernaryOpExpr::setTrueValue(ShPtr<Expression> newTrueValue) {
 	trueValue->removeObserver(shared_from_this());
 	newTrueValue->addObserver(shared_from_this());
 	trueValue = newTrueValue;
+	updateVersion();
 }
 
 /**
@@ -136,6 +139,7 @@ void TernaryOpExpr::setFalseValue(ShPtr<Expression> newFalseValue) {
 	falseValue->removeObserver(shared_from_this());
 	newFalseValue->addObserver(shared_from_this());
 	falseValue = newFalseValue;
+	updateVersion();
 }
 
 /**
@@ -17,7 +17,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 TruncCastExpr::TruncCastExpr(ShPtr<Expression> op, ShPtr<Type> dstType):
-	CastExpr(op, dstType) {}
+	CastExpr(ValueKind::TruncCastExpr, op, dstType) {}
 
 /**
 * @brief Destructs the operator.
@@ -13,7 +13,7 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a new type.
 */
-Type::Type() {}
+Type::Type(ValueKind kind): Value(kind) {}
 
 /**
 * @brief Destructs the types.
@@ -22,6 +22,7 @@ UForLoopStmt::UForLoopStmt(
 		ShPtr<Expression> cond,
 		ShPtr<Expression> step,
 		ShPtr<Statement> body):
+	Statement(ValueKind::UForLoopStmt),
 	init(init), initIsDefinition(false), cond(cond), step(step),
 	body(body) {}
 
@@ -117,6 +118,7 @@ void UForLoopStmt::setInit(ShPtr<Expression> newInit) {
 	init->removeObserver(shared_from_this());
 	newInit->addObserver(shared_from_this());
 	init = newInit;
+	updateVersion();
 }
 
 /**
@@ -131,6 +133,7 @@ void UForLoopStmt::setCond(ShPtr<Expression> newCond) {
 	cond->removeObserver(shared_from_this());
 	newCond->addObserver(shared_from_this());
 	cond = newCond;
+	updateVersion();
 }
 
 /**
@@ -145,6 +148,7 @@ void UForLoopStmt::setStep(ShPtr<Expression> newStep) {
 	step->removeObserver(shared_from_this());
 	newStep->addObserver(shared_from_this());
 	step = newStep;
+	updateVersion();
 }
 
 /**
@@ -18,8 +18,8 @@ namespace llvmir2hll {
 * @par Preconditions
 *  - @a op is non-null
 */
-UnaryOpExpr::UnaryOpExpr(ShPtr<Expression> op):
-		op(op) {
+UnaryOpExpr::UnaryOpExpr(ValueKind kind, ShPtr<Expression> op):
+		Expression(kind), op(op) {
 	PRECONDITION_NON_NULL(op);
 }
 
@@ -61,6 +61,7 @@ void UnaryOpExpr::setOperand(ShPtr<Expression> newOp) {
 	op->removeObserver(shared_from_this());
 	newOp->addObserver(shared_from_this());
 	op = newOp;
+	updateVersion();
 }
 
 /**
@@ -14,7 +14,7 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a new unreachable statement.
 */
-UnreachableStmt::UnreachableStmt() {}
+UnreachableStmt::UnreachableStmt(): Statement(ValueKind::UnreachableStmt) {}
 
 /**
 * @brief Destructs the statement.
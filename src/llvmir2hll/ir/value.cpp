@@ -4,9 +4,11 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/ir/expression.h"
 #include "retdec/llvmir2hll/ir/statement.h"
 #include "retdec/llvmir2hll/ir/value.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/value_allocator.h"
 #include "retdec/llvmir2hll/support/value_text_repr_visitor.h"
 
 namespace retdec {
@@ -29,9 +31,9 @@ std::string getTextRepr(ValuePtr value) {
 } // anonymous namespace
 
 /**
-* @brief Constructs a new value.
+* @brief Constructs a new value of the given kind.
 */
-Value::Value() {}
+Value::Value(ValueKind kind): kind(kind), version(0) {}
 
 /**
 * @brief Destructs the value.
@@ -52,6 +54,48 @@ std::string Value::getTextRepr() {
 	return ValueTextReprVisitor::getTextRepr(shared_from_this());
 }
 
+/**
+* @brief Changes the version of the value.
+*
+* This member function has to be called whenever a part of the value which
+* the results of analyses depend on is changed (e.g. an operand of an
+* expression). If the value is an expression, the versions of all the values
+* containing it (i.e. its observers) are changed as well. Statements do not
+* propagate the change any further because analyses of statements consider
+* just the statements themselves, not the statements nested in them.
+*/
+void Value::updateVersion() {
+	++version;
+
+	if (!isa<Expression>(this)) {
+		return;
+	}
+
+	for (const auto &observer : getObservers()) {
+		ShPtr<Observer<Value>> existingObserver(observer.lock());
+		if (auto observerValue = cast<Value>(existingObserver.get())) {
+			observerValue->updateVersion();
+		}
+	}
+}
+
+/**
+* @brief Allocates memory for a value of the given size.
+*/
+void *Value::operator new(std::size_t size) {
+	return ValueAllocator::allocate(size);
+}
+
+/**
+* @brief Frees memory of a value of the given size.
+*
+* Since the destructor is virtual, @a size is the size of the most derived
+* class of the destroyed value.
+*/
+void Value::operator delete(void *ptr, std::size_t size) noexcept {
+	ValueAllocator::deallocate(ptr, size);
+}
+
 /**
 * @brief Emits @a value into @a os.
 */
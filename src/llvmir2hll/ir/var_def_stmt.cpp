@@ -19,7 +19,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 VarDefStmt::VarDefStmt(ShPtr<Variable> var, ShPtr<Expression> init):
-	var(var), init(init) {}
+	Statement(ValueKind::VarDefStmt), var(var), init(init) {}
 
 /**
 * @brief Destructs the statement.
@@ -100,6 +100,7 @@ void VarDefStmt::setVar(ShPtr<Variable> newVar) {
 	var->removeObserver(shared_from_this());
 	newVar->addObserver(shared_from_this());
 	var = newVar;
+	updateVersion();
 }
 
 /**
@@ -113,6 +114,7 @@ void VarDefStmt::setInitializer(ShPtr<Expression> newInit) {
 		newInit->addObserver(shared_from_this());
 	}
 	init = newInit;
+	updateVersion();
 }
 
 /**
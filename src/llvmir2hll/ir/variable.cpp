@@ -18,6 +18,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 Variable::Variable(const std::string &name, ShPtr<Type> type):
+	Expression(ValueKind::Variable),
 	initialName(name), name(name), type(type), internal(true) {}
 
 /**
@@ -19,7 +19,7 @@ namespace llvmir2hll {
 * See create() for more information.
 */
 WhileLoopStmt::WhileLoopStmt(ShPtr<Expression> cond, ShPtr<Statement> body):
-	cond(cond), body(body) {}
+	Statement(ValueKind::WhileLoopStmt), cond(cond), body(body) {}
 
 /**
 * @brief Destructs the statement.
@@ -82,6 +82,7 @@ void WhileLoopStmt::setCondition(ShPtr<Expression> newCond) {
 	cond->removeObserver(shared_from_this());
 	newCond->addObserver(shared_from_this());
 	cond = newCond;
+	updateVersion();
 }
 
 /**
@@ -8,6 +8,7 @@
 
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
 #include "retdec/llvmir2hll/ir/call_expr.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
@@ -73,7 +74,7 @@ ShPtr<Function> FuncInfo::getFunc() const {
 */
 CallInfoObtainer::CallInfoObtainer():
 	module(), cg(), va(), funcCFGMap(),
-	cfgBuilder(NonRecursiveCFGBuilder::create()) {}
+	cfgCache(CFGCache::create(NonRecursiveCFGBuilder::create())) {}
 
 /**
 * @brief Destructs the obtainer.
@@ -101,6 +102,17 @@ ShPtr<CFG> CallInfoObtainer::getCFGForFunc(ShPtr<Function> func) const {
 	return i != funcCFGMap.end() ? i->second : ShPtr<CFG>();
 }
 
+/**
+* @brief Returns the cache from which the obtainer gets CFGs of functions.
+*
+* Other users of CFGs may get their CFGs from this cache, too. Then, the CFGs of
+* unchanged functions are built only once. The cache cannot be used from
+* several threads at once.
+*/
+ShPtr<CFGCache> CallInfoObtainer::getCFGCache() const {
+	return cfgCache;
+}
+
 /**
 * @brief Initializes the obtainer.
 *
@@ -127,10 +139,12 @@ void CallInfoObtainer::init(ShPtr<CG> cg, ShPtr<ValueAnalysis> va) {
 	module = cg->getCorrespondingModule();
 	funcCFGMap.clear();
 
-	// To speedup the initialization, compute and store the CFG for each
-	// function.
+	// To speedup the initialization, obtain and store the CFG for each
+	// function. Only CFGs of functions that have changed since the last
+	// initialization are re-built.
+	cfgCache->removeCFGsOfFuncsNotInModule(module);
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
-		funcCFGMap[*i] = cfgBuilder->getCFG(*i);
+		funcCFGMap[*i] = cfgCache->getCFG(*i);
 	}
 }
 
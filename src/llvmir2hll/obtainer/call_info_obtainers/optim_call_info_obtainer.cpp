@@ -326,7 +326,7 @@ ShPtr<OptimCallInfo> OptimCallInfoObtainer::computeCallInfo(ShPtr<CallExpr> call
 	//
 	// Then, if we included local variables, we would have that the variable a
 	// is modified in the call func(i - 1), which is not true.
-	ShPtr<OptimFuncInfo> calledFuncInfo(funcInfoMap[calledFunc]);
+	ShPtr<OptimFuncInfo> calledFuncInfo(funcInfoMap.at(calledFunc));
 	callInfo->neverReadVars = skipLocalVars(calledFuncInfo->neverReadVars);
 	callInfo->mayBeReadVars = skipLocalVars(calledFuncInfo->mayBeReadVars);
 	callInfo->alwaysReadVars = skipLocalVars(calledFuncInfo->alwaysReadVars);
@@ -396,15 +396,20 @@ ShPtr<CallInfo> OptimCallInfoObtainer::getCallInfo(ShPtr<CallExpr> call,
 		"function `" << caller->getName() << "` does not exist");
 
 	// Have we already computed the info?
-	auto callInfoIter = callInfoMap.find(call);
-	if (callInfoIter != callInfoMap.end()) {
-		return callInfoIter->second;
+	{
+		std::lock_guard<std::mutex> lock(callInfoMapMutex);
+		auto callInfoIter = callInfoMap.find(call);
+		if (callInfoIter != callInfoMap.end()) {
+			return callInfoIter->second;
+		}
 	}
 
-	// We haven't, so compute it.
+	// We haven't, so compute it. The computation only reads the module and
+	// infos about functions, so it does not need to be guarded. If another
+	// thread has computed the info in the meantime, use its result.
 	ShPtr<OptimCallInfo> callInfo(computeCallInfo(call, caller));
-	callInfoMap[call] = callInfo;
-	return callInfo;
+	std::lock_guard<std::mutex> lock(callInfoMapMutex);
+	return callInfoMap.emplace(call, callInfo).first->second;
 }
 
 ShPtr<FuncInfo> OptimCallInfoObtainer::getFuncInfo(ShPtr<Function> func) {
@@ -412,7 +417,11 @@ ShPtr<FuncInfo> OptimCallInfoObtainer::getFuncInfo(ShPtr<Function> func) {
 	PRECONDITION(module->funcExists(func),
 		"function `" << func->getName() << "` does not exist");
 
-	return funcInfoMap[func];
+	// Do not use operator[] because it may insert into the map, which cannot
+	// be done from several threads at once.
+	auto funcInfoIter = funcInfoMap.find(func);
+	return funcInfoIter != funcInfoMap.end() ?
+		funcInfoIter->second : ShPtr<OptimFuncInfo>();
 }
 
 /**
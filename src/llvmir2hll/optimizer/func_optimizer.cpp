@@ -4,10 +4,15 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <mutex>
+#include <vector>
+
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/optimizer/func_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/utils/parallel.h"
 
 namespace retdec {
 namespace llvmir2hll {
@@ -30,6 +35,23 @@ FuncOptimizer::FuncOptimizer(ShPtr<Module> module):
 */
 FuncOptimizer::~FuncOptimizer() {}
 
+/**
+* @brief Adds a worker optimizing functions in parallel with this optimizer.
+*
+* @param[in] worker Another instance of the same optimizer for the same module.
+*
+* Every worker optimizes functions on its own thread. See the class description
+* for the optimizers to which workers can be added.
+*
+* @par Preconditions
+*  - @a worker is non-null
+*/
+void FuncOptimizer::addWorker(ShPtr<FuncOptimizer> worker) {
+	PRECONDITION_NON_NULL(worker);
+
+	workers.push_back(worker);
+}
+
 /**
 * @brief Performs the optimization on all functions in the module.
 *
@@ -39,6 +61,11 @@ FuncOptimizer::~FuncOptimizer() {}
 * optimized; otherwise, just override runOnFunction().
 */
 void FuncOptimizer::doOptimization() {
+	if (!workers.empty()) {
+		runOnFunctionsInParallel();
+		return;
+	}
+
 	// For each function in the module...
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
 		runOnFunction(*i);
@@ -58,5 +85,49 @@ void FuncOptimizer::runOnFunction(ShPtr<Function> func) {
 	func->accept(this);
 }
 
+/**
+* @brief Calls runOnFunction() for each function in the module in this
+*        optimizer and in its workers, each of them on its own thread.
+*
+* The calling thread is one of the threads (see utils::runInParallel()). Every
+* function is optimized by an optimizer that is not used by any other thread
+* at that time. If any runOnFunction() throws an exception, the remaining
+* functions are not optimized and the first exception is rethrown after all
+* threads have finished.
+*/
+void FuncOptimizer::runOnFunctionsInParallel() {
+	FuncVector funcs(module->func_begin(), module->func_end());
+	std::vector<FuncOptimizer *> idleOptimizers{this};
+	for (const auto &worker : workers) {
+		idleOptimizers.push_back(worker.get());
+	}
+	std::mutex idleOptimizersMutex;
+	auto takeIdleOptimizer = [&]() {
+		std::lock_guard<std::mutex> lock(idleOptimizersMutex);
+		FuncOptimizer *optimizer = idleOptimizers.back();
+		idleOptimizers.pop_back();
+		return optimizer;
+	};
+	auto returnIdleOptimizer = [&](FuncOptimizer *optimizer) {
+		std::lock_guard<std::mutex> lock(idleOptimizersMutex);
+		idleOptimizers.push_back(optimizer);
+	};
+
+	// There are never more threads than optimizers, so there is always an
+	// idle optimizer.
+	utils::runInParallel(funcs.size(), idleOptimizers.size(),
+		[&](std::size_t i) {
+			FuncOptimizer *optimizer = takeIdleOptimizer();
+			try {
+				optimizer->runOnFunction(funcs[i]);
+			} catch (...) {
+				returnIdleOptimizer(optimizer);
+				throw;
+			}
+			returnIdleOptimizer(optimizer);
+		}
+	);
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
@@ -5,6 +5,7 @@
 */
 
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator_factory.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/hll/bir_writer.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
@@ -47,6 +48,7 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_while_cond_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/utils/container.h"
+#include "retdec/utils/parallel.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
 
@@ -87,6 +89,35 @@ StringSet trimOptimizerSuffix(const StringSet &opts) {
 	return result;
 }
 
+/**
+* @brief Returns the argument for a worker of a parallel optimization that
+*        corresponds to @a arg.
+*
+* By default, workers share the arguments.
+*/
+template<typename T>
+T getWorkerArg(const T &arg) {
+	return arg;
+}
+
+/**
+* @brief Returns a separate analysis of values for a worker because an analysis
+*        cannot be used from several threads at once.
+*/
+ShPtr<ValueAnalysis> getWorkerArg(const ShPtr<ValueAnalysis> &va) {
+	return va->clone();
+}
+
+/**
+* @brief Returns a separate evaluator for a worker because an evaluator cannot
+*        be used from several threads at once.
+*/
+ShPtr<ArithmExprEvaluator> getWorkerArg(
+		const ShPtr<ArithmExprEvaluator> &arithmExprEvaluator) {
+	return ArithmExprEvaluatorFactory::getInstance().createObject(
+		arithmExprEvaluator->getId());
+}
+
 } // anonymous namespace
 
 /**
@@ -102,6 +133,9 @@ StringSet trimOptimizerSuffix(const StringSet &opts) {
 * @param[in] arithmExprEvaluator Used evaluator of arithmetical expressions.
 * @param[in] enableAggressiveOpts Enables aggressive optimizations.
 * @param[in] enableDebug Enables emission of debug messages.
+* @param[in] funcJobs Number of functions optimized in parallel by optimizations
+*                     that optimize every function separately (0 means one
+*                     per hardware thread).
 *
 * To perform the actual optimizations, call optimize(). To get a list of
 * available optimizations and their names, see our wiki.
@@ -125,12 +159,13 @@ OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 	const StringSet &disabledOpts, ShPtr<HLLWriter> hllWriter,
 	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
-	bool enableAggressiveOpts, bool enableDebug):
+	bool enableAggressiveOpts, bool enableDebug, std::size_t funcJobs):
 		enabledOpts(trimOptimizerSuffix(enabledOpts)),
 		disabledOpts(trimOptimizerSuffix(disabledOpts)),
 		hllWriter(hllWriter), va(va), cio(cio),
 		arithmExprEvaluator(arithmExprEvaluator),
 		enableAggressiveOpts(enableAggressiveOpts), enableDebug(enableDebug),
+		funcJobs(funcJobs != 0 ? funcJobs : utils::getHardwareJobs()),
 		recoverFromOutOfMemory(true), backendRunOpts() {
 			PRECONDITION_NON_NULL(hllWriter);
 			PRECONDITION_NON_NULL(va);
@@ -153,13 +188,18 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	//
 	// Of course, if some optimization depend on another one, the order is
 	// clear.
+	//
+	// Optimizations run by runInParallel() optimize functions in parallel. The
+	// other ones work with the whole module (e.g. they remove global
+	// variables or use information about variables gathered from all
+	// functions), so they always run on a single thread.
 
 	//
 	// Perform initial, HLL-dependent optimizations.
 	//
 	if (hllWriter->getId() == "py") {
 		// Optimizations for Python'.
-		run<RemoveAllCastsOptimizer>(m);
+		runInParallel<RemoveAllCastsOptimizer>(m);
 	}
 
 	//
@@ -168,16 +208,16 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	if (!enableDebug) {
 		// Since we will not emit debug comments, empty statements are useless,
 		// so we can remove them.
-		run<EmptyStmtOptimizer>(m);
+		runInParallel<EmptyStmtOptimizer>(m);
 	}
 
-	run<GotoStmtOptimizer>(m);
-	run<RemoveUselessCastsOptimizer>(m);
+	runInParallel<GotoStmtOptimizer>(m);
+	runInParallel<RemoveUselessCastsOptimizer>(m);
 
 	// The first part of removal of non-compound statements. The other part
 	// should be run after structure optimizations because they may introduce
 	// constructs that can be optimized.
-	run<AggressiveDerefOptimizer>(m);
+	runInParallel<AggressiveDerefOptimizer>(m);
 	run<AggressiveGlobalToLocalOptimizer>(m);
 
 	// Data-flow optimizations.
@@ -188,7 +228,7 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	run<SimpleCopyPropagationOptimizer>(m, va, cio);
 	run<CopyPropagationOptimizer>(m, va, cio);
 	// AuxiliaryVariablesOptimizer should be run after CopyPropagationOptimizer.
-	run<AuxiliaryVariablesOptimizer>(m, va, cio);
+	runInParallel<AuxiliaryVariablesOptimizer>(m, va, cio);
 
 	// SimplifyArithmExprOptimizer should be run before loop optimizations.
 	run<SimplifyArithmExprOptimizer>(m, arithmExprEvaluator);
@@ -196,17 +236,17 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// Structure optimizations.
 	// IfStructureOptimizer should be run before loop optimizations because
 	// it may make induction variables easier to find.
-	run<IfStructureOptimizer>(m);
+	runInParallel<IfStructureOptimizer>(m);
 	// LoopLastContinueOptimizer should be run after IfStructureOptimizer
 	// because IfBeforeLoopOptimizer may introduce continue statements to the
 	// end of loops.
-	run<LoopLastContinueOptimizer>(m);
+	runInParallel<LoopLastContinueOptimizer>(m);
 	// PreWhileTrueLoopConvOptimizer should be run before other `while True`
 	// loop optimizers.
 	run<PreWhileTrueLoopConvOptimizer>(m, va);
 	// WhileTrueToForLoopOptimizer should be run before
 	// WhileTrueToWhileCondOptimizer.
-	run<WhileTrueToForLoopOptimizer>(m, va, arithmExprEvaluator);
+	runInParallel<WhileTrueToForLoopOptimizer>(m, va, arithmExprEvaluator);
 	// TODO The WhileTrueToUForLoopOptimizer does nothing at the moment, so it
 	//      makes no sense to run it.
 	#if 0
@@ -215,22 +255,22 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// better results). Also, run it only for C because the Python HLL writer
 	// does not support emission of universal for loops.
 	if (hllWriter->getId() == "c") {
-		run<WhileTrueToUForLoopOptimizer>(m, va);
+		runInParallel<WhileTrueToUForLoopOptimizer>(m, va);
 	}
 	#endif
-	run<WhileTrueToWhileCondOptimizer>(m);
-	run<IfBeforeLoopOptimizer>(m, va);
+	runInParallel<WhileTrueToWhileCondOptimizer>(m);
+	runInParallel<IfBeforeLoopOptimizer>(m, va);
 
 	// The second part of removal of non-compound statements.
 	run<LLVMIntrinsicsOptimizer>(m);
-	run<VoidReturnOptimizer>(m);
-	run<BreakContinueReturnOptimizer>(m);
+	runInParallel<VoidReturnOptimizer>(m);
+	runInParallel<BreakContinueReturnOptimizer>(m);
 
 	// Expression optimizations.
 	run<BitShiftOptimizer>(m);
-	run<DerefAddressOptimizer>(m);
+	runInParallel<DerefAddressOptimizer>(m);
 	run<EmptyArrayToStringOptimizer>(m);
-	run<BitOpToLogOpOptimizer>(m, va);
+	runInParallel<BitOpToLogOpOptimizer>(m, va);
 	run<SimplifyArithmExprOptimizer>(m, arithmExprEvaluator);
 
 	// Data-flow optimizations.
@@ -247,7 +287,7 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// This is best to be run after DeadLocalAssignOptimizer and
 	// CopyPropagationOptimizer because it can get rid of statements like `v =
 	// v`, where v is a variable.
-	run<SelfAssignOptimizer>(m);
+	runInParallel<SelfAssignOptimizer>(m);
 
 	// VarDefForLoopOptimizer and VarDefStmtOptimizer are utilized also if the
 	// output is Python because in this way, we may emit addresses of
@@ -255,11 +295,11 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// Indeed, recall that in Python, we do not emit definitions without an
 	// initializer, so if we didn't move the definitions to the usages, there
 	// wouldn't be initializers.
-	run<VarDefForLoopOptimizer>(m);
-	run<VarDefStmtOptimizer>(m, va);
+	runInParallel<VarDefForLoopOptimizer>(m);
+	runInParallel<VarDefStmtOptimizer>(m, va);
 
-	run<EmptyStmtOptimizer>(m);
-	run<GotoStmtOptimizer>(m);
+	runInParallel<EmptyStmtOptimizer>(m);
+	runInParallel<GotoStmtOptimizer>(m);
 
 	// SimplifyArithmExprOptimizer should be run at the end to produce the most
 	// readable output.
@@ -269,9 +309,9 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// SimplifyArithmExprOptimizer optimizes expressions in conditions and then
 	// DeadCodeOptimizer is called. The same holds for
 	// DerefToArrayIndexOptimizer and IfToSwitchOptimizer.
-	run<DeadCodeOptimizer>(m, arithmExprEvaluator);
+	runInParallel<DeadCodeOptimizer>(m, arithmExprEvaluator);
 	run<DerefToArrayIndexOptimizer>(m);
-	run<IfToSwitchOptimizer>(m, va);
+	runInParallel<IfToSwitchOptimizer>(m, va);
 
 	//
 	// Perform final, HLL-dependent optimizations.
@@ -282,7 +322,7 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 		run<CArrayArgOptimizer>(m);
 	} else if (hllWriter->getId() == "py") {
 		// Optimizations for Python'.
-		run<NoInitVarDefOptimizer>(m);
+		runInParallel<NoInitVarDefOptimizer>(m);
 	}
 }
 
@@ -338,6 +378,10 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 		optimizer->optimize();
 	}
 
+	// The optimization may have removed values whose results are cached in
+	// the analysis. Nobody can ask for them anymore, so free them.
+	va->removeUnusedValuesFromCache();
+
 	backendRunOpts.insert(OPT_ID);
 }
 
@@ -397,5 +441,35 @@ void OptimizerManager::run(ShPtr<Module> m, Args &&... args) {
 	runOptimizerProvidedItShouldBeRun(optimizer);
 }
 
+/**
+* @brief Runs the given function optimization (specified in the template
+*        parameter) over @a m with the given arguments, optimizing up to @c
+*        funcJobs functions in parallel.
+*
+* @tparam Optimization Optimization to be performed. Its runOnFunction() may
+*                      modify only the optimized function (see FuncOptimizer).
+*
+* @param[in] m Module to be optimized.
+* @param[in] args Arguments to be passed to the optimization.
+*
+* Workers of the optimization get their own analysis of values and evaluator of
+* arithmetical expressions; other arguments are shared. Otherwise, it behaves
+* like run().
+*/
+template<typename Optimization, typename... Args>
+void OptimizerManager::runInParallel(ShPtr<Module> m, Args &&... args) {
+	auto optimizer = std::make_shared<Optimization>(m, args...);
+	bool parallel = funcJobs > 1 && m->getNumOfFuncDefinitions() > 1 &&
+		optShouldBeRun(optimizer->getId());
+	if (parallel) {
+		for (std::size_t i = 1; i < funcJobs; ++i) {
+			optimizer->addWorker(std::make_shared<Optimization>(m,
+				getWorkerArg(args)...));
+		}
+	}
+
+	runOptimizerProvidedItShouldBeRun(optimizer);
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
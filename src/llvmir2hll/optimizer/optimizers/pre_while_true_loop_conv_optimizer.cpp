@@ -55,13 +55,6 @@ void PreWhileTrueLoopConvOptimizer::doOptimization() {
 	// the following create() call.
 	vuv = VarUsesVisitor::create(va, true);
 	FuncOptimizer::doOptimization();
-
-	// Currently, we do not update the used analysis of values (va) during this
-	// optimization, so here, at the end of the optimization, we have to put it
-	// into an invalid state.
-	// TODO Regularly update the cache of va so we do not have to invalidate it.
-	//      However, is (or will be) this feasible?
-	va->invalidateState();
 }
 
 void PreWhileTrueLoopConvOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
@@ -61,9 +61,14 @@ SimpleCopyPropagationOptimizer::~SimpleCopyPropagationOptimizer() {}
 
 void SimpleCopyPropagationOptimizer::doOptimization() {
 	// Initialization.
-	// We clear the cache of va even if it is in a valid state (this
-	// surprisingly speeds up the optimization).
-	va->clearCache();
+	// The cache of va is kept between optimizations (changed values are
+	// recomputed by va itself), so just get rid of the values that have been
+	// removed from the module (this speeds up the optimization).
+	if (!va->isInValidState()) {
+		va->clearCache();
+	} else {
+		va->removeUnusedValuesFromCache();
+	}
 	va->initAliasAnalysis(module);
 	cio->init(CGBuilder::getCG(module), va);
 	vuv = VarUsesVisitor::create(va, true, module);
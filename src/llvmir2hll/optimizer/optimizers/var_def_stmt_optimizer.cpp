@@ -54,9 +54,9 @@ VarDefStmtOptimizer::VarDefStmtOptimizer(ShPtr<Module> module,
 VarDefStmtOptimizer::~VarDefStmtOptimizer() {}
 
 void VarDefStmtOptimizer::doOptimization() {
-	// Clear the cache of va because other optimizations may have left it in an
-	// invalid state.
-	va->clearCache();
+	if (!va->isInValidState()) {
+		va->clearCache();
+	}
 
 	FuncOptimizer::doOptimization();
 }
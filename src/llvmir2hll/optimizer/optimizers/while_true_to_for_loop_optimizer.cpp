@@ -60,13 +60,6 @@ void WhileTrueToForLoopOptimizer::doOptimization() {
 		va->clearCache();
 	}
 	FuncOptimizer::doOptimization();
-
-	// Currently, we do not update the used analysis of values (va) during this
-	// optimization, so here, at the end of the optimization, we have to put it
-	// into an invalid state.
-	// TODO Regularly update the cache of va so we do not have to invalidate it.
-	//      However, is (or will be) this feasible?
-	va->invalidateState();
 }
 
 void WhileTrueToForLoopOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
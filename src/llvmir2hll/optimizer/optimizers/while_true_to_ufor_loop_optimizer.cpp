@@ -42,11 +42,6 @@ void WhileTrueToUForLoopOptimizer::doOptimization() {
 		va->clearCache();
 	}
 	FuncOptimizer::doOptimization();
-
-	// Currently, we do not update the used analysis of values (va) during this
-	// optimization, so here, at the end of the optimization, we have to put it
-	// into an invalid state.
-	va->invalidateState();
 }
 
 /**
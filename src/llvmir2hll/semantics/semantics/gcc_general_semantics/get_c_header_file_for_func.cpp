@@ -7,6 +7,9 @@
 
 #include "retdec/llvmir2hll/semantics/semantics/gcc_general_semantics/get_c_header_file_for_func.h"
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_c_header_file_for_func.h"
+#include "retdec/utils/array.h"
+
+using retdec::utils::arraySize;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -15,13 +18,8 @@ namespace gcc_general {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_C_HEADER_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncCHeaderMap() {
-	static StringStringUMap m;
-
+/// Function names and their corresponding header files.
+constexpr StringStringEntry FUNC_C_HEADERS[] = {
 	//
 	// The following list was automatically generated by
 	// scripts/gen_getCHeaderFileForFunc.py on 2013-05-09.
@@ -36,1931 +34,1699 @@ const StringStringUMap &initFuncCHeaderMap() {
 	//
 
 	// aio.h
-	static const char *AIO_H_FUNCS[] = {
-		"aio_cancel",
-		"aio_error",
-		"aio_fsync",
-		"aio_read",
-		"aio_return",
-		"aio_suspend",
-		"aio_write",
-		"lio_listio",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(AIO_H_FUNCS, "aio.h", m);
+	{"aio_cancel", "aio.h"},
+	{"aio_error", "aio.h"},
+	{"aio_fsync", "aio.h"},
+	{"aio_read", "aio.h"},
+	{"aio_return", "aio.h"},
+	{"aio_suspend", "aio.h"},
+	{"aio_write", "aio.h"},
+	{"lio_listio", "aio.h"},
 
 	// alloca.h
-	static const char *ALLOCA_H_FUNCS[] = {
-		"alloca",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ALLOCA_H_FUNCS, "alloca.h", m);
+	{"alloca", "alloca.h"},
 
 	// arpa/inet.h
-	static const char *ARPA_INET_H_FUNCS[] = {
-		"inet_addr",
-		"inet_aton",
-		"inet_lnaof",
-		"inet_makeaddr",
-		"inet_net_ntop",
-		"inet_net_pton",
-		"inet_neta",
-		"inet_netof",
-		"inet_network",
-		"inet_nsap_addr",
-		"inet_nsap_ntoa",
-		"inet_ntoa",
-		"inet_ntop",
-		"inet_pton",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ARPA_INET_H_FUNCS, "arpa/inet.h", m);
+	{"inet_addr", "arpa/inet.h"},
+	{"inet_aton", "arpa/inet.h"},
+	{"inet_lnaof", "arpa/inet.h"},
+	{"inet_makeaddr", "arpa/inet.h"},
+	{"inet_net_ntop", "arpa/inet.h"},
+	{"inet_net_pton", "arpa/inet.h"},
+	{"inet_neta", "arpa/inet.h"},
+	{"inet_netof", "arpa/inet.h"},
+	{"inet_network", "arpa/inet.h"},
+	{"inet_nsap_addr", "arpa/inet.h"},
+	{"inet_nsap_ntoa", "arpa/inet.h"},
+	{"inet_ntoa", "arpa/inet.h"},
+	{"inet_ntop", "arpa/inet.h"},
+	{"inet_pton", "arpa/inet.h"},
 
 	// assert.h
-	static const char *ASSERT_H_FUNCS[] = {
-		"__assert",
-		"__assert_fail",
-		"__assert_perror_fail",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ASSERT_H_FUNCS, "assert.h", m);
+	{"__assert", "assert.h"},
+	{"__assert_fail", "assert.h"},
+	{"__assert_perror_fail", "assert.h"},
 
 	// ctype.h
-	static const char *CTYPE_H_FUNCS[] = {
-		"__ctype_b_loc",
-		"__ctype_tolower_loc",
-		"__ctype_toupper_loc",
-		"__tolower_l",
-		"__toupper_l",
-		"_tolower",
-		"_toupper",
-		"isalnum",
-		"isalnum_l",
-		"isalpha",
-		"isalpha_l",
-		"isascii",
-		"isblank",
-		"isblank_l",
-		"iscntrl",
-		"iscntrl_l",
-		"isdigit",
-		"isdigit_l",
-		"isgraph",
-		"isgraph_l",
-		"islower",
-		"islower_l",
-		"isprint",
-		"isprint_l",
-		"ispunct",
-		"ispunct_l",
-		"isspace",
-		"isspace_l",
-		"isupper",
-		"isupper_l",
-		"isxdigit",
-		"isxdigit_l",
-		"toascii",
-		"tolower",
-		"tolower_l",
-		"toupper",
-		"toupper_l",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(CTYPE_H_FUNCS, "ctype.h", m);
+	{"__ctype_b_loc", "ctype.h"},
+	{"__ctype_tolower_loc", "ctype.h"},
+	{"__ctype_toupper_loc", "ctype.h"},
+	{"__tolower_l", "ctype.h"},
+	{"__toupper_l", "ctype.h"},
+	{"_tolower", "ctype.h"},
+	{"_toupper", "ctype.h"},
+	{"isalnum", "ctype.h"},
+	{"isalnum_l", "ctype.h"},
+	{"isalpha", "ctype.h"},
+	{"isalpha_l", "ctype.h"},
+	{"isascii", "ctype.h"},
+	{"isblank", "ctype.h"},
+	{"isblank_l", "ctype.h"},
+	{"iscntrl", "ctype.h"},
+	{"iscntrl_l", "ctype.h"},
+	{"isdigit", "ctype.h"},
+	{"isdigit_l", "ctype.h"},
+	{"isgraph", "ctype.h"},
+	{"isgraph_l", "ctype.h"},
+	{"islower", "ctype.h"},
+	{"islower_l", "ctype.h"},
+	{"isprint", "ctype.h"},
+	{"isprint_l", "ctype.h"},
+	{"ispunct", "ctype.h"},
+	{"ispunct_l", "ctype.h"},
+	{"isspace", "ctype.h"},
+	{"isspace_l", "ctype.h"},
+	{"isupper", "ctype.h"},
+	{"isupper_l", "ctype.h"},
+	{"isxdigit", "ctype.h"},
+	{"isxdigit_l", "ctype.h"},
+	{"toascii", "ctype.h"},
+	{"tolower", "ctype.h"},
+	{"tolower_l", "ctype.h"},
+	{"toupper", "ctype.h"},
+	{"toupper_l", "ctype.h"},
 
 	// dirent.h
-	static const char *DIRENT_H_FUNCS[] = {
-		"alphasort",
-		"closedir",
-		"dirfd",
-		"fdopendir",
-		"getdirentries",
-		"opendir",
-		"readdir",
-		"readdir_r",
-		"rewinddir",
-		"seekdir",
-		"telldir",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(DIRENT_H_FUNCS, "dirent.h", m);
+	{"alphasort", "dirent.h"},
+	{"closedir", "dirent.h"},
+	{"dirfd", "dirent.h"},
+	{"fdopendir", "dirent.h"},
+	{"getdirentries", "dirent.h"},
+	{"opendir", "dirent.h"},
+	{"readdir", "dirent.h"},
+	{"readdir_r", "dirent.h"},
+	{"rewinddir", "dirent.h"},
+	{"seekdir", "dirent.h"},
+	{"telldir", "dirent.h"},
 
 	// dlfcn.h
-	static const char *DLFCN_H_FUNCS[] = {
-		"dlclose",
-		"dlerror",
-		"dlopen",
-		"dlsym",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(DLFCN_H_FUNCS, "dlfcn.h", m);
+	{"dlclose", "dlfcn.h"},
+	{"dlerror", "dlfcn.h"},
+	{"dlopen", "dlfcn.h"},
+	{"dlsym", "dlfcn.h"},
 
 	// errno.h
-	static const char *ERRNO_H_FUNCS[] = {
-		"__errno_location",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ERRNO_H_FUNCS, "errno.h", m);
+	{"__errno_location", "errno.h"},
 
 	// error.h
-	static const char *ERROR_H_FUNCS[] = {
-		"__error_alias",
-		"__error_at_line_alias",
-		"__error_at_line_noreturn",
-		"__error_noreturn",
-		"error",
-		"error_at_line",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ERROR_H_FUNCS, "error.h", m);
+	{"__error_alias", "error.h"},
+	{"__error_at_line_alias", "error.h"},
+	{"__error_at_line_noreturn", "error.h"},
+	{"__error_noreturn", "error.h"},
+	{"error", "error.h"},
+	{"error_at_line", "error.h"},
 
 	// fcntl.h
-	static const char *FCNTL_H_FUNCS[] = {
-		"creat",
-		"fcntl",
-		"lockf",
-		"open",
-		"openat",
-		"posix_fadvise",
-		"posix_fallocate",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(FCNTL_H_FUNCS, "fcntl.h", m);
+	{"creat", "fcntl.h"},
+	{"fcntl", "fcntl.h"},
+	{"lockf", "fcntl.h"},
+	{"open", "fcntl.h"},
+	{"openat", "fcntl.h"},
+	{"posix_fadvise", "fcntl.h"},
+	{"posix_fallocate", "fcntl.h"},
 
 	// fenv.h
-	static const char *FENV_H_FUNCS[] = {
-		"feclearexcept",
-		"fegetenv",
-		"fegetexceptflag",
-		"fegetround",
-		"feholdexcept",
-		"feraiseexcept",
-		"fesetenv",
-		"fesetexceptflag",
-		"fesetround",
-		"fetestexcept",
-		"feupdateenv",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(FENV_H_FUNCS, "fenv.h", m);
+	{"feclearexcept", "fenv.h"},
+	{"fegetenv", "fenv.h"},
+	{"fegetexceptflag", "fenv.h"},
+	{"fegetround", "fenv.h"},
+	{"feholdexcept", "fenv.h"},
+	{"feraiseexcept", "fenv.h"},
+	{"fesetenv", "fenv.h"},
+	{"fesetexceptflag", "fenv.h"},
+	{"fesetround", "fenv.h"},
+	{"fetestexcept", "fenv.h"},
+	{"feupdateenv", "fenv.h"},
 
 	// fmtmsg.h
-	static const char *FMTMSG_H_FUNCS[] = {
-		"addseverity",
-		"fmtmsg",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(FMTMSG_H_FUNCS, "fmtmsg.h", m);
+	{"addseverity", "fmtmsg.h"},
+	{"fmtmsg", "fmtmsg.h"},
 
 	// fnmatch.h
-	static const char *FNMATCH_H_FUNCS[] = {
-		"fnmatch",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(FNMATCH_H_FUNCS, "fnmatch.h", m);
+	{"fnmatch", "fnmatch.h"},
 
 	// ftw.h
-	static const char *FTW_H_FUNCS[] = {
-		"ftw",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(FTW_H_FUNCS, "ftw.h", m);
+	{"ftw", "ftw.h"},
 
 	// gdbm.h
-	static const char *GDBM_H_FUNCS[] = {
-		"gdbm_close",
-		"gdbm_delete",
-		"gdbm_exists",
-		"gdbm_export",
-		"gdbm_fdesc",
-		"gdbm_fetch",
-		"gdbm_firstkey",
-		"gdbm_import",
-		"gdbm_nextkey",
-		"gdbm_reorganize",
-		"gdbm_setopt",
-		"gdbm_store",
-		"gdbm_strerror",
-		"gdbm_sync",
-		"gdbm_version_cmp",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(GDBM_H_FUNCS, "gdbm.h", m);
+	{"gdbm_close", "gdbm.h"},
+	{"gdbm_delete", "gdbm.h"},
+	{"gdbm_exists", "gdbm.h"},
+	{"gdbm_export", "gdbm.h"},
+	{"gdbm_fdesc", "gdbm.h"},
+	{"gdbm_fetch", "gdbm.h"},
+	{"gdbm_firstkey", "gdbm.h"},
+	{"gdbm_import", "gdbm.h"},
+	{"gdbm_nextkey", "gdbm.h"},
+	{"gdbm_reorganize", "gdbm.h"},
+	{"gdbm_setopt", "gdbm.h"},
+	{"gdbm_store", "gdbm.h"},
+	{"gdbm_strerror", "gdbm.h"},
+	{"gdbm_sync", "gdbm.h"},
+	{"gdbm_version_cmp", "gdbm.h"},
 
 	// getopt.h
-	static const char *GETOPT_H_FUNCS[] = {
-		"getopt",
-		"getopt_long",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(GETOPT_H_FUNCS, "getopt.h", m);
+	{"getopt", "getopt.h"},
+	{"getopt_long", "getopt.h"},
 
 	// glob.h
-	static const char *GLOB_H_FUNCS[] = {
-		"globfree",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(GLOB_H_FUNCS, "glob.h", m);
+	{"globfree", "glob.h"},
 
 	// grp.h
-	static const char *GRP_H_FUNCS[] = {
-		"endgrent",
-		"fgetgrent",
-		"fgetgrent_r",
-		"getgrent",
-		"getgrgid",
-		"getgrgid_r",
-		"getgrnam",
-		"getgrnam_r",
-		"getgrouplist",
-		"initgroups",
-		"setgrent",
-		"setgroups",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(GRP_H_FUNCS, "grp.h", m);
+	{"endgrent", "grp.h"},
+	{"fgetgrent", "grp.h"},
+	{"fgetgrent_r", "grp.h"},
+	{"getgrent", "grp.h"},
+	{"getgrgid", "grp.h"},
+	{"getgrgid_r", "grp.h"},
+	{"getgrnam", "grp.h"},
+	{"getgrnam_r", "grp.h"},
+	{"getgrouplist", "grp.h"},
+	{"initgroups", "grp.h"},
+	{"setgrent", "grp.h"},
+	{"setgroups", "grp.h"},
 
 	// iconv.h
-	static const char *ICONV_H_FUNCS[] = {
-		"iconv",
-		"iconv_close",
-		"iconv_open",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ICONV_H_FUNCS, "iconv.h", m);
+	{"iconv", "iconv.h"},
+	{"iconv_close", "iconv.h"},
+	{"iconv_open", "iconv.h"},
 
 	// inttypes.h
-	static const char *INTTYPES_H_FUNCS[] = {
-		"imaxabs",
-		"imaxdiv",
-		"strtoimax",
-		"strtoumax",
-		"wcstoimax",
-		"wcstoumax",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(INTTYPES_H_FUNCS, "inttypes.h", m);
+	{"imaxabs", "inttypes.h"},
+	{"imaxdiv", "inttypes.h"},
+	{"strtoimax", "inttypes.h"},
+	{"strtoumax", "inttypes.h"},
+	{"wcstoimax", "inttypes.h"},
+	{"wcstoumax", "inttypes.h"},
 
 	// langinfo.h
-	static const char *LANGINFO_H_FUNCS[] = {
-		"nl_langinfo",
-		"nl_langinfo_l",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(LANGINFO_H_FUNCS, "langinfo.h", m);
+	{"nl_langinfo", "langinfo.h"},
+	{"nl_langinfo_l", "langinfo.h"},
 
 	// libgen.h
-	static const char *LIBGEN_H_FUNCS[] = {
-		"__xpg_basename",
-		"dirname",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(LIBGEN_H_FUNCS, "libgen.h", m);
+	{"__xpg_basename", "libgen.h"},
+	{"dirname", "libgen.h"},
 
 	// libintl.h
-	static const char *LIBINTL_H_FUNCS[] = {
-		"bindtextdomain",
-		"dcgettext",
-		"dgettext",
-		"gettext",
-		"textdomain",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(LIBINTL_H_FUNCS, "libintl.h", m);
+	{"bindtextdomain", "libintl.h"},
+	{"dcgettext", "libintl.h"},
+	{"dgettext", "libintl.h"},
+	{"gettext", "libintl.h"},
+	{"textdomain", "libintl.h"},
 
 	// libio.h
-	static const char *LIBIO_H_FUNCS[] = {
-		"__overflow",
-		"__uflow",
-		"__underflow",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(LIBIO_H_FUNCS, "libio.h", m);
+	{"__overflow", "libio.h"},
+	{"__uflow", "libio.h"},
+	{"__underflow", "libio.h"},
 
 	// locale.h
-	static const char *LOCALE_H_FUNCS[] = {
-		"duplocale",
-		"freelocale",
-		"localeconv",
-		"newlocale",
-		"setlocale",
-		"uselocale",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(LOCALE_H_FUNCS, "locale.h", m);
+	{"duplocale", "locale.h"},
+	{"freelocale", "locale.h"},
+	{"localeconv", "locale.h"},
+	{"newlocale", "locale.h"},
+	{"setlocale", "locale.h"},
+	{"uselocale", "locale.h"},
 
 	// math.h
-	static const char *MATH_H_FUNCS[] = {
-		"__acos",
-		"__acosf",
-		"__acosh",
-		"__acoshf",
-		"__acoshl",
-		"__acosl",
-		"__asin",
-		"__asinf",
-		"__asinh",
-		"__asinhf",
-		"__asinhl",
-		"__asinl",
-		"__atan",
-		"__atan2",
-		"__atan2f",
-		"__atan2l",
-		"__atanf",
-		"__atanh",
-		"__atanhf",
-		"__atanhl",
-		"__atanl",
-		"__cbrt",
-		"__cbrtf",
-		"__cbrtl",
-		"__ceil",
-		"__ceilf",
-		"__ceill",
-		"__copysign",
-		"__copysignf",
-		"__copysignl",
-		"__cos",
-		"__cosf",
-		"__cosh",
-		"__coshf",
-		"__coshl",
-		"__cosl",
-		"__drem",
-		"__dremf",
-		"__dreml",
-		"__erf",
-		"__erfc",
-		"__erfcf",
-		"__erfcl",
-		"__erff",
-		"__erfl",
-		"__exp",
-		"__exp2",
-		"__exp2f",
-		"__exp2l",
-		"__expf",
-		"__expl",
-		"__expm1",
-		"__expm1f",
-		"__expm1l",
-		"__fabs",
-		"__fabsf",
-		"__fabsl",
-		"__fdim",
-		"__fdimf",
-		"__fdiml",
-		"__finite",
-		"__finitef",
-		"__finitel",
-		"__floor",
-		"__floorf",
-		"__floorl",
-		"__fma",
-		"__fmaf",
-		"__fmal",
-		"__fmax",
-		"__fmaxf",
-		"__fmaxl",
-		"__fmin",
-		"__fminf",
-		"__fminl",
-		"__fmod",
-		"__fmodf",
-		"__fmodl",
-		"__fpclassify",
-		"__fpclassifyf",
-		"__fpclassifyl",
-		"__frexp",
-		"__frexpf",
-		"__frexpl",
-		"__gamma",
-		"__gammaf",
-		"__gammal",
-		"__hypot",
-		"__hypotf",
-		"__hypotl",
-		"__ilogb",
-		"__ilogbf",
-		"__ilogbl",
-		"__isinf",
-		"__isinff",
-		"__isinfl",
-		"__isnan",
-		"__isnanf",
-		"__isnanl",
-		"__j0",
-		"__j0f",
-		"__j0l",
-		"__j1",
-		"__j1f",
-		"__j1l",
-		"__jn",
-		"__jnf",
-		"__jnl",
-		"__ldexp",
-		"__ldexpf",
-		"__ldexpl",
-		"__lgamma",
-		"__lgamma_r",
-		"__lgammaf",
-		"__lgammaf_r",
-		"__lgammal",
-		"__lgammal_r",
-		"__llrint",
-		"__llrintf",
-		"__llrintl",
-		"__llround",
-		"__llroundf",
-		"__llroundl",
-		"__log",
-		"__log10",
-		"__log10f",
-		"__log10l",
-		"__log1p",
-		"__log1pf",
-		"__log1pl",
-		"__log2",
-		"__log2f",
-		"__log2l",
-		"__logb",
-		"__logbf",
-		"__logbl",
-		"__logf",
-		"__logl",
-		"__lrint",
-		"__lrintf",
-		"__lrintl",
-		"__lround",
-		"__lroundf",
-		"__lroundl",
-		"__modf",
-		"__modff",
-		"__modfl",
-		"__nan",
-		"__nanf",
-		"__nanl",
-		"__nearbyint",
-		"__nearbyintf",
-		"__nearbyintl",
-		"__nextafter",
-		"__nextafterf",
-		"__nextafterl",
-		"__nexttoward",
-		"__nexttowardf",
-		"__nexttowardl",
-		"__pow",
-		"__powf",
-		"__powl",
-		"__remainder",
-		"__remainderf",
-		"__remainderl",
-		"__remquo",
-		"__remquof",
-		"__remquol",
-		"__rint",
-		"__rintf",
-		"__rintl",
-		"__round",
-		"__roundf",
-		"__roundl",
-		"__scalb",
-		"__scalbf",
-		"__scalbl",
-		"__scalbln",
-		"__scalblnf",
-		"__scalblnl",
-		"__scalbn",
-		"__scalbnf",
-		"__scalbnl",
-		"__signbit",
-		"__signbitf",
-		"__signbitl",
-		"__significand",
-		"__significandf",
-		"__significandl",
-		"__sin",
-		"__sinf",
-		"__sinh",
-		"__sinhf",
-		"__sinhl",
-		"__sinl",
-		"__sqrt",
-		"__sqrtf",
-		"__sqrtl",
-		"__tan",
-		"__tanf",
-		"__tanh",
-		"__tanhf",
-		"__tanhl",
-		"__tanl",
-		"__tgamma",
-		"__tgammaf",
-		"__tgammal",
-		"__trunc",
-		"__truncf",
-		"__truncl",
-		"__y0",
-		"__y0f",
-		"__y0l",
-		"__y1",
-		"__y1f",
-		"__y1l",
-		"__yn",
-		"__ynf",
-		"__ynl",
-		"acos",
-		"acosf",
-		"acosh",
-		"acoshf",
-		"acoshl",
-		"acosl",
-		"asin",
-		"asinf",
-		"asinh",
-		"asinhf",
-		"asinhl",
-		"asinl",
-		"atan",
-		"atan2",
-		"atan2f",
-		"atan2l",
-		"atanf",
-		"atanh",
-		"atanhf",
-		"atanhl",
-		"atanl",
-		"cbrt",
-		"cbrtf",
-		"cbrtl",
-		"ceil",
-		"ceilf",
-		"ceill",
-		"copysign",
-		"copysignf",
-		"copysignl",
-		"cos",
-		"cosf",
-		"cosh",
-		"coshf",
-		"coshl",
-		"cosl",
-		"drem",
-		"dremf",
-		"dreml",
-		"erf",
-		"erfc",
-		"erfcf",
-		"erfcl",
-		"erff",
-		"erfl",
-		"exp",
-		"exp2",
-		"exp2f",
-		"exp2l",
-		"expf",
-		"expl",
-		"expm1",
-		"expm1f",
-		"expm1l",
-		"fabs",
-		"fabsf",
-		"fabsl",
-		"fdim",
-		"fdimf",
-		"fdiml",
-		"finite",
-		"finitef",
-		"finitel",
-		"floor",
-		"floorf",
-		"floorl",
-		"fma",
-		"fmaf",
-		"fmal",
-		"fmax",
-		"fmaxf",
-		"fmaxl",
-		"fmin",
-		"fminf",
-		"fminl",
-		"fmod",
-		"fmodf",
-		"fmodl",
-		"frexp",
-		"frexpf",
-		"frexpl",
-		"gamma",
-		"gammaf",
-		"gammal",
-		"hypot",
-		"hypotf",
-		"hypotl",
-		"ilogb",
-		"ilogbf",
-		"ilogbl",
-		"isinf",
-		"isinff",
-		"isinfl",
-		"isnan",
-		"isnanf",
-		"isnanl",
-		"j0",
-		"j0f",
-		"j0l",
-		"j1",
-		"j1f",
-		"j1l",
-		"jn",
-		"jnf",
-		"jnl",
-		"ldexp",
-		"ldexpf",
-		"ldexpl",
-		"lgamma",
-		"lgamma_r",
-		"lgammaf",
-		"lgammaf_r",
-		"lgammal",
-		"lgammal_r",
-		"llrint",
-		"llrintf",
-		"llrintl",
-		"llround",
-		"llroundf",
-		"llroundl",
-		"log",
-		"log10",
-		"log10f",
-		"log10l",
-		"log1p",
-		"log1pf",
-		"log1pl",
-		"log2",
-		"log2f",
-		"log2l",
-		"logb",
-		"logbf",
-		"logbl",
-		"logf",
-		"logl",
-		"lrint",
-		"lrintf",
-		"lrintl",
-		"lround",
-		"lroundf",
-		"lroundl",
-		"matherr",
-		"modf",
-		"modff",
-		"modfl",
-		"nan",
-		"nanf",
-		"nanl",
-		"nearbyint",
-		"nearbyintf",
-		"nearbyintl",
-		"nextafter",
-		"nextafterf",
-		"nextafterl",
-		"nexttoward",
-		"nexttowardf",
-		"nexttowardl",
-		"pow",
-		"powf",
-		"powl",
-		"remainder",
-		"remainderf",
-		"remainderl",
-		"remquo",
-		"remquof",
-		"remquol",
-		"rint",
-		"rintf",
-		"rintl",
-		"round",
-		"roundf",
-		"roundl",
-		"scalb",
-		"scalbf",
-		"scalbl",
-		"scalbln",
-		"scalblnf",
-		"scalblnl",
-		"scalbn",
-		"scalbnf",
-		"scalbnl",
-		"significand",
-		"significandf",
-		"significandl",
-		"sin",
-		"sinf",
-		"sinh",
-		"sinhf",
-		"sinhl",
-		"sinl",
-		"sqrt",
-		"sqrtf",
-		"sqrtl",
-		"tan",
-		"tanf",
-		"tanh",
-		"tanhf",
-		"tanhl",
-		"tanl",
-		"tgamma",
-		"tgammaf",
-		"tgammal",
-		"trunc",
-		"truncf",
-		"truncl",
-		"y0",
-		"y0f",
-		"y0l",
-		"y1",
-		"y1f",
-		"y1l",
-		"yn",
-		"ynf",
-		"ynl",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(MATH_H_FUNCS, "math.h", m);
+	{"__acos", "math.h"},
+	{"__acosf", "math.h"},
+	{"__acosh", "math.h"},
+	{"__acoshf", "math.h"},
+	{"__acoshl", "math.h"},
+	{"__acosl", "math.h"},
+	{"__asin", "math.h"},
+	{"__asinf", "math.h"},
+	{"__asinh", "math.h"},
+	{"__asinhf", "math.h"},
+	{"__asinhl", "math.h"},
+	{"__asinl", "math.h"},
+	{"__atan", "math.h"},
+	{"__atan2", "math.h"},
+	{"__atan2f", "math.h"},
+	{"__atan2l", "math.h"},
+	{"__atanf", "math.h"},
+	{"__atanh", "math.h"},
+	{"__atanhf", "math.h"},
+	{"__atanhl", "math.h"},
+	{"__atanl", "math.h"},
+	{"__cbrt", "math.h"},
+	{"__cbrtf", "math.h"},
+	{"__cbrtl", "math.h"},
+	{"__ceil", "math.h"},
+	{"__ceilf", "math.h"},
+	{"__ceill", "math.h"},
+	{"__copysign", "math.h"},
+	{"__copysignf", "math.h"},
+	{"__copysignl", "math.h"},
+	{"__cos", "math.h"},
+	{"__cosf", "math.h"},
+	{"__cosh", "math.h"},
+	{"__coshf", "math.h"},
+	{"__coshl", "math.h"},
+	{"__cosl", "math.h"},
+	{"__drem", "math.h"},
+	{"__dremf", "math.h"},
+	{"__dreml", "math.h"},
+	{"__erf", "math.h"},
+	{"__erfc", "math.h"},
+	{"__erfcf", "math.h"},
+	{"__erfcl", "math.h"},
+	{"__erff", "math.h"},
+	{"__erfl", "math.h"},
+	{"__exp", "math.h"},
+	{"__exp2", "math.h"},
+	{"__exp2f", "math.h"},
+	{"__exp2l", "math.h"},
+	{"__expf", "math.h"},
+	{"__expl", "math.h"},
+	{"__expm1", "math.h"},
+	{"__expm1f", "math.h"},
+	{"__expm1l", "math.h"},
+	{"__fabs", "math.h"},
+	{"__fabsf", "math.h"},
+	{"__fabsl", "math.h"},
+	{"__fdim", "math.h"},
+	{"__fdimf", "math.h"},
+	{"__fdiml", "math.h"},
+	{"__finite", "math.h"},
+	{"__finitef", "math.h"},
+	{"__finitel", "math.h"},
+	{"__floor", "math.h"},
+	{"__floorf", "math.h"},
+	{"__floorl", "math.h"},
+	{"__fma", "math.h"},
+	{"__fmaf", "math.h"},
+	{"__fmal", "math.h"},
+	{"__fmax", "math.h"},
+	{"__fmaxf", "math.h"},
+	{"__fmaxl", "math.h"},
+	{"__fmin", "math.h"},
+	{"__fminf", "math.h"},
+	{"__fminl", "math.h"},
+	{"__fmod", "math.h"},
+	{"__fmodf", "math.h"},
+	{"__fmodl", "math.h"},
+	{"__fpclassify", "math.h"},
+	{"__fpclassifyf", "math.h"},
+	{"__fpclassifyl", "math.h"},
+	{"__frexp", "math.h"},
+	{"__frexpf", "math.h"},
+	{"__frexpl", "math.h"},
+	{"__gamma", "math.h"},
+	{"__gammaf", "math.h"},
+	{"__gammal", "math.h"},
+	{"__hypot", "math.h"},
+	{"__hypotf", "math.h"},
+	{"__hypotl", "math.h"},
+	{"__ilogb", "math.h"},
+	{"__ilogbf", "math.h"},
+	{"__ilogbl", "math.h"},
+	{"__isinf", "math.h"},
+	{"__isinff", "math.h"},
+	{"__isinfl", "math.h"},
+	{"__isnan", "math.h"},
+	{"__isnanf", "math.h"},
+	{"__isnanl", "math.h"},
+	{"__j0", "math.h"},
+	{"__j0f", "math.h"},
+	{"__j0l", "math.h"},
+	{"__j1", "math.h"},
+	{"__j1f", "math.h"},
+	{"__j1l", "math.h"},
+	{"__jn", "math.h"},
+	{"__jnf", "math.h"},
+	{"__jnl", "math.h"},
+	{"__ldexp", "math.h"},
+	{"__ldexpf", "math.h"},
+	{"__ldexpl", "math.h"},
+	{"__lgamma", "math.h"},
+	{"__lgamma_r", "math.h"},
+	{"__lgammaf", "math.h"},
+	{"__lgammaf_r", "math.h"},
+	{"__lgammal", "math.h"},
+	{"__lgammal_r", "math.h"},
+	{"__llrint", "math.h"},
+	{"__llrintf", "math.h"},
+	{"__llrintl", "math.h"},
+	{"__llround", "math.h"},
+	{"__llroundf", "math.h"},
+	{"__llroundl", "math.h"},
+	{"__log", "math.h"},
+	{"__log10", "math.h"},
+	{"__log10f", "math.h"},
+	{"__log10l", "math.h"},
+	{"__log1p", "math.h"},
+	{"__log1pf", "math.h"},
+	{"__log1pl", "math.h"},
+	{"__log2", "math.h"},
+	{"__log2f", "math.h"},
+	{"__log2l", "math.h"},
+	{"__logb", "math.h"},
+	{"__logbf", "math.h"},
+	{"__logbl", "math.h"},
+	{"__logf", "math.h"},
+	{"__logl", "math.h"},
+	{"__lrint", "math.h"},
+	{"__lrintf", "math.h"},
+	{"__lrintl", "math.h"},
+	{"__lround", "math.h"},
+	{"__lroundf", "math.h"},
+	{"__lroundl", "math.h"},
+	{"__modf", "math.h"},
+	{"__modff", "math.h"},
+	{"__modfl", "math.h"},
+	{"__nan", "math.h"},
+	{"__nanf", "math.h"},
+	{"__nanl", "math.h"},
+	{"__nearbyint", "math.h"},
+	{"__nearbyintf", "math.h"},
+	{"__nearbyintl", "math.h"},
+	{"__nextafter", "math.h"},
+	{"__nextafterf", "math.h"},
+	{"__nextafterl", "math.h"},
+	{"__nexttoward", "math.h"},
+	{"__nexttowardf", "math.h"},
+	{"__nexttowardl", "math.h"},
+	{"__pow", "math.h"},
+	{"__powf", "math.h"},
+	{"__powl", "math.h"},
+	{"__remainder", "math.h"},
+	{"__remainderf", "math.h"},
+	{"__remainderl", "math.h"},
+	{"__remquo", "math.h"},
+	{"__remquof", "math.h"},
+	{"__remquol", "math.h"},
+	{"__rint", "math.h"},
+	{"__rintf", "math.h"},
+	{"__rintl", "math.h"},
+	{"__round", "math.h"},
+	{"__roundf", "math.h"},
+	{"__roundl", "math.h"},
+	{"__scalb", "math.h"},
+	{"__scalbf", "math.h"},
+	{"__scalbl", "math.h"},
+	{"__scalbln", "math.h"},
+	{"__scalblnf", "math.h"},
+	{"__scalblnl", "math.h"},
+	{"__scalbn", "math.h"},
+	{"__scalbnf", "math.h"},
+	{"__scalbnl", "math.h"},
+	{"__signbit", "math.h"},
+	{"__signbitf", "math.h"},
+	{"__signbitl", "math.h"},
+	{"__significand", "math.h"},
+	{"__significandf", "math.h"},
+	{"__significandl", "math.h"},
+	{"__sin", "math.h"},
+	{"__sinf", "math.h"},
+	{"__sinh", "math.h"},
+	{"__sinhf", "math.h"},
+	{"__sinhl", "math.h"},
+	{"__sinl", "math.h"},
+	{"__sqrt", "math.h"},
+	{"__sqrtf", "math.h"},
+	{"__sqrtl", "math.h"},
+	{"__tan", "math.h"},
+	{"__tanf", "math.h"},
+	{"__tanh", "math.h"},
+	{"__tanhf", "math.h"},
+	{"__tanhl", "math.h"},
+	{"__tanl", "math.h"},
+	{"__tgamma", "math.h"},
+	{"__tgammaf", "math.h"},
+	{"__tgammal", "math.h"},
+	{"__trunc", "math.h"},
+	{"__truncf", "math.h"},
+	{"__truncl", "math.h"},
+	{"__y0", "math.h"},
+	{"__y0f", "math.h"},
+	{"__y0l", "math.h"},
+	{"__y1", "math.h"},
+	{"__y1f", "math.h"},
+	{"__y1l", "math.h"},
+	{"__yn", "math.h"},
+	{"__ynf", "math.h"},
+	{"__ynl", "math.h"},
+	{"acos", "math.h"},
+	{"acosf", "math.h"},
+	{"acosh", "math.h"},
+	{"acoshf", "math.h"},
+	{"acoshl", "math.h"},
+	{"acosl", "math.h"},
+	{"asin", "math.h"},
+	{"asinf", "math.h"},
+	{"asinh", "math.h"},
+	{"asinhf", "math.h"},
+	{"asinhl", "math.h"},
+	{"asinl", "math.h"},
+	{"atan", "math.h"},
+	{"atan2", "math.h"},
+	{"atan2f", "math.h"},
+	{"atan2l", "math.h"},
+	{"atanf", "math.h"},
+	{"atanh", "math.h"},
+	{"atanhf", "math.h"},
+	{"atanhl", "math.h"},
+	{"atanl", "math.h"},
+	{"cbrt", "math.h"},
+	{"cbrtf", "math.h"},
+	{"cbrtl", "math.h"},
+	{"ceil", "math.h"},
+	{"ceilf", "math.h"},
+	{"ceill", "math.h"},
+	{"copysign", "math.h"},
+	{"copysignf", "math.h"},
+	{"copysignl", "math.h"},
+	{"cos", "math.h"},
+	{"cosf", "math.h"},
+	{"cosh", "math.h"},
+	{"coshf", "math.h"},
+	{"coshl", "math.h"},
+	{"cosl", "math.h"},
+	{"drem", "math.h"},
+	{"dremf", "math.h"},
+	{"dreml", "math.h"},
+	{"erf", "math.h"},
+	{"erfc", "math.h"},
+	{"erfcf", "math.h"},
+	{"erfcl", "math.h"},
+	{"erff", "math.h"},
+	{"erfl", "math.h"},
+	{"exp", "math.h"},
+	{"exp2", "math.h"},
+	{"exp2f", "math.h"},
+	{"exp2l", "math.h"},
+	{"expf", "math.h"},
+	{"expl", "math.h"},
+	{"expm1", "math.h"},
+	{"expm1f", "math.h"},
+	{"expm1l", "math.h"},
+	{"fabs", "math.h"},
+	{"fabsf", "math.h"},
+	{"fabsl", "math.h"},
+	{"fdim", "math.h"},
+	{"fdimf", "math.h"},
+	{"fdiml", "math.h"},
+	{"finite", "math.h"},
+	{"finitef", "math.h"},
+	{"finitel", "math.h"},
+	{"floor", "math.h"},
+	{"floorf", "math.h"},
+	{"floorl", "math.h"},
+	{"fma", "math.h"},
+	{"fmaf", "math.h"},
+	{"fmal", "math.h"},
+	{"fmax", "math.h"},
+	{"fmaxf", "math.h"},
+	{"fmaxl", "math.h"},
+	{"fmin", "math.h"},
+	{"fminf", "math.h"},
+	{"fminl", "math.h"},
+	{"fmod", "math.h"},
+	{"fmodf", "math.h"},
+	{"fmodl", "math.h"},
+	{"frexp", "math.h"},
+	{"frexpf", "math.h"},
+	{"frexpl", "math.h"},
+	{"gamma", "math.h"},
+	{"gammaf", "math.h"},
+	{"gammal", "math.h"},
+	{"hypot", "math.h"},
+	{"hypotf", "math.h"},
+	{"hypotl", "math.h"},
+	{"ilogb", "math.h"},
+	{"ilogbf", "math.h"},
+	{"ilogbl", "math.h"},
+	{"isinf", "math.h"},
+	{"isinff", "math.h"},
+	{"isinfl", "math.h"},
+	{"isnan", "math.h"},
+	{"isnanf", "math.h"},
+	{"isnanl", "math.h"},
+	{"j0", "math.h"},
+	{"j0f", "math.h"},
+	{"j0l", "math.h"},
+	{"j1", "math.h"},
+	{"j1f", "math.h"},
+	{"j1l", "math.h"},
+	{"jn", "math.h"},
+	{"jnf", "math.h"},
+	{"jnl", "math.h"},
+	{"ldexp", "math.h"},
+	{"ldexpf", "math.h"},
+	{"ldexpl", "math.h"},
+	{"lgamma", "math.h"},
+	{"lgamma_r", "math.h"},
+	{"lgammaf", "math.h"},
+	{"lgammaf_r", "math.h"},
+	{"lgammal", "math.h"},
+	{"lgammal_r", "math.h"},
+	{"llrint", "math.h"},
+	{"llrintf", "math.h"},
+	{"llrintl", "math.h"},
+	{"llround", "math.h"},
+	{"llroundf", "math.h"},
+	{"llroundl", "math.h"},
+	{"log", "math.h"},
+	{"log10", "math.h"},
+	{"log10f", "math.h"},
+	{"log10l", "math.h"},
+	{"log1p", "math.h"},
+	{"log1pf", "math.h"},
+	{"log1pl", "math.h"},
+	{"log2", "math.h"},
+	{"log2f", "math.h"},
+	{"log2l", "math.h"},
+	{"logb", "math.h"},
+	{"logbf", "math.h"},
+	{"logbl", "math.h"},
+	{"logf", "math.h"},
+	{"logl", "math.h"},
+	{"lrint", "math.h"},
+	{"lrintf", "math.h"},
+	{"lrintl", "math.h"},
+	{"lround", "math.h"},
+	{"lroundf", "math.h"},
+	{"lroundl", "math.h"},
+	{"matherr", "math.h"},
+	{"modf", "math.h"},
+	{"modff", "math.h"},
+	{"modfl", "math.h"},
+	{"nan", "math.h"},
+	{"nanf", "math.h"},
+	{"nanl", "math.h"},
+	{"nearbyint", "math.h"},
+	{"nearbyintf", "math.h"},
+	{"nearbyintl", "math.h"},
+	{"nextafter", "math.h"},
+	{"nextafterf", "math.h"},
+	{"nextafterl", "math.h"},
+	{"nexttoward", "math.h"},
+	{"nexttowardf", "math.h"},
+	{"nexttowardl", "math.h"},
+	{"pow", "math.h"},
+	{"powf", "math.h"},
+	{"powl", "math.h"},
+	{"remainder", "math.h"},
+	{"remainderf", "math.h"},
+	{"remainderl", "math.h"},
+	{"remquo", "math.h"},
+	{"remquof", "math.h"},
+	{"remquol", "math.h"},
+	{"rint", "math.h"},
+	{"rintf", "math.h"},
+	{"rintl", "math.h"},
+	{"round", "math.h"},
+	{"roundf", "math.h"},
+	{"roundl", "math.h"},
+	{"scalb", "math.h"},
+	{"scalbf", "math.h"},
+	{"scalbl", "math.h"},
+	{"scalbln", "math.h"},
+	{"scalblnf", "math.h"},
+	{"scalblnl", "math.h"},
+	{"scalbn", "math.h"},
+	{"scalbnf", "math.h"},
+	{"scalbnl", "math.h"},
+	{"significand", "math.h"},
+	{"significandf", "math.h"},
+	{"significandl", "math.h"},
+	{"sin", "math.h"},
+	{"sinf", "math.h"},
+	{"sinh", "math.h"},
+	{"sinhf", "math.h"},
+	{"sinhl", "math.h"},
+	{"sinl", "math.h"},
+	{"sqrt", "math.h"},
+	{"sqrtf", "math.h"},
+	{"sqrtl", "math.h"},
+	{"tan", "math.h"},
+	{"tanf", "math.h"},
+	{"tanh", "math.h"},
+	{"tanhf", "math.h"},
+	{"tanhl", "math.h"},
+	{"tanl", "math.h"},
+	{"tgamma", "math.h"},
+	{"tgammaf", "math.h"},
+	{"tgammal", "math.h"},
+	{"trunc", "math.h"},
+	{"truncf", "math.h"},
+	{"truncl", "math.h"},
+	{"y0", "math.h"},
+	{"y0f", "math.h"},
+	{"y0l", "math.h"},
+	{"y1", "math.h"},
+	{"y1f", "math.h"},
+	{"y1l", "math.h"},
+	{"yn", "math.h"},
+	{"ynf", "math.h"},
+	{"ynl", "math.h"},
 
 	// monetary.h
-	static const char *MONETARY_H_FUNCS[] = {
-		"strfmon",
-		"strfmon_l",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(MONETARY_H_FUNCS, "monetary.h", m);
+	{"strfmon", "monetary.h"},
+	{"strfmon_l", "monetary.h"},
 
 	// mqueue.h
-	static const char *MQUEUE_H_FUNCS[] = {
-		"mq_close",
-		"mq_getattr",
-		"mq_notify",
-		"mq_open",
-		"mq_receive",
-		"mq_send",
-		"mq_setattr",
-		"mq_timedreceive",
-		"mq_timedsend",
-		"mq_unlink",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(MQUEUE_H_FUNCS, "mqueue.h", m);
+	{"mq_close", "mqueue.h"},
+	{"mq_getattr", "mqueue.h"},
+	{"mq_notify", "mqueue.h"},
+	{"mq_open", "mqueue.h"},
+	{"mq_receive", "mqueue.h"},
+	{"mq_send", "mqueue.h"},
+	{"mq_setattr", "mqueue.h"},
+	{"mq_timedreceive", "mqueue.h"},
+	{"mq_timedsend", "mqueue.h"},
+	{"mq_unlink", "mqueue.h"},
 
 	// ndbm.h
-	static const char *NDBM_H_FUNCS[] = {
-		"dbm_clearerr",
-		"dbm_close",
-		"dbm_delete",
-		"dbm_dirfno",
-		"dbm_error",
-		"dbm_fetch",
-		"dbm_firstkey",
-		"dbm_nextkey",
-		"dbm_open",
-		"dbm_pagfno",
-		"dbm_rdonly",
-		"dbm_store",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(NDBM_H_FUNCS, "ndbm.h", m);
+	{"dbm_clearerr", "ndbm.h"},
+	{"dbm_close", "ndbm.h"},
+	{"dbm_delete", "ndbm.h"},
+	{"dbm_dirfno", "ndbm.h"},
+	{"dbm_error", "ndbm.h"},
+	{"dbm_fetch", "ndbm.h"},
+	{"dbm_firstkey", "ndbm.h"},
+	{"dbm_nextkey", "ndbm.h"},
+	{"dbm_open", "ndbm.h"},
+	{"dbm_pagfno", "ndbm.h"},
+	{"dbm_rdonly", "ndbm.h"},
+	{"dbm_store", "ndbm.h"},
 
 	// net/if.h
-	static const char *NET_IF_H_FUNCS[] = {
-		"if_freenameindex",
-		"if_indextoname",
-		"if_nameindex",
-		"if_nametoindex",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(NET_IF_H_FUNCS, "net/if.h", m);
+	{"if_freenameindex", "net/if.h"},
+	{"if_indextoname", "net/if.h"},
+	{"if_nameindex", "net/if.h"},
+	{"if_nametoindex", "net/if.h"},
 
 	// netdb.h
-	static const char *NETDB_H_FUNCS[] = {
-		"__h_errno_location",
-		"endhostent",
-		"endnetent",
-		"endnetgrent",
-		"endprotoent",
-		"endservent",
-		"freeaddrinfo",
-		"gai_strerror",
-		"getaddrinfo",
-		"gethostbyaddr",
-		"gethostbyaddr_r",
-		"gethostbyname",
-		"gethostbyname2",
-		"gethostbyname2_r",
-		"gethostbyname_r",
-		"gethostent",
-		"gethostent_r",
-		"getnameinfo",
-		"getnetbyaddr",
-		"getnetbyaddr_r",
-		"getnetbyname",
-		"getnetbyname_r",
-		"getnetent",
-		"getnetent_r",
-		"getnetgrent",
-		"getnetgrent_r",
-		"getprotobyname",
-		"getprotobyname_r",
-		"getprotobynumber",
-		"getprotobynumber_r",
-		"getprotoent",
-		"getprotoent_r",
-		"getservbyname",
-		"getservbyname_r",
-		"getservbyport",
-		"getservbyport_r",
-		"getservent",
-		"getservent_r",
-		"herror",
-		"hstrerror",
-		"innetgr",
-		"iruserok",
-		"iruserok_af",
-		"rcmd",
-		"rcmd_af",
-		"rexec",
-		"rexec_af",
-		"rresvport",
-		"rresvport_af",
-		"ruserok",
-		"ruserok_af",
-		"sethostent",
-		"setnetent",
-		"setnetgrent",
-		"setprotoent",
-		"setservent",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(NETDB_H_FUNCS, "netdb.h", m);
+	{"__h_errno_location", "netdb.h"},
+	{"endhostent", "netdb.h"},
+	{"endnetent", "netdb.h"},
+	{"endnetgrent", "netdb.h"},
+	{"endprotoent", "netdb.h"},
+	{"endservent", "netdb.h"},
+	{"freeaddrinfo", "netdb.h"},
+	{"gai_strerror", "netdb.h"},
+	{"getaddrinfo", "netdb.h"},
+	{"gethostbyaddr", "netdb.h"},
+	{"gethostbyaddr_r", "netdb.h"},
+	{"gethostbyname", "netdb.h"},
+	{"gethostbyname2", "netdb.h"},
+	{"gethostbyname2_r", "netdb.h"},
+	{"gethostbyname_r", "netdb.h"},
+	{"gethostent", "netdb.h"},
+	{"gethostent_r", "netdb.h"},
+	{"getnameinfo", "netdb.h"},
+	{"getnetbyaddr", "netdb.h"},
+	{"getnetbyaddr_r", "netdb.h"},
+	{"getnetbyname", "netdb.h"},
+	{"getnetbyname_r", "netdb.h"},
+	{"getnetent", "netdb.h"},
+	{"getnetent_r", "netdb.h"},
+	{"getnetgrent", "netdb.h"},
+	{"getnetgrent_r", "netdb.h"},
+	{"getprotobyname", "netdb.h"},
+	{"getprotobyname_r", "netdb.h"},
+	{"getprotobynumber", "netdb.h"},
+	{"getprotobynumber_r", "netdb.h"},
+	{"getprotoent", "netdb.h"},
+	{"getprotoent_r", "netdb.h"},
+	{"getservbyname", "netdb.h"},
+	{"getservbyname_r", "netdb.h"},
+	{"getservbyport", "netdb.h"},
+	{"getservbyport_r", "netdb.h"},
+	{"getservent", "netdb.h"},
+	{"getservent_r", "netdb.h"},
+	{"herror", "netdb.h"},
+	{"hstrerror", "netdb.h"},
+	{"innetgr", "netdb.h"},
+	{"iruserok", "netdb.h"},
+	{"iruserok_af", "netdb.h"},
+	{"rcmd", "netdb.h"},
+	{"rcmd_af", "netdb.h"},
+	{"rexec", "netdb.h"},
+	{"rexec_af", "netdb.h"},
+	{"rresvport", "netdb.h"},
+	{"rresvport_af", "netdb.h"},
+	{"ruserok", "netdb.h"},
+	{"ruserok_af", "netdb.h"},
+	{"sethostent", "netdb.h"},
+	{"setnetent", "netdb.h"},
+	{"setnetgrent", "netdb.h"},
+	{"setprotoent", "netdb.h"},
+	{"setservent", "netdb.h"},
 
 	// netinet/in.h
-	static const char *NETINET_IN_H_FUNCS[] = {
-		"bindresvport",
-		"bindresvport6",
-		"htonl",
-		"htons",
-		"ntohl",
-		"ntohs",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(NETINET_IN_H_FUNCS, "netinet/in.h", m);
+	{"bindresvport", "netinet/in.h"},
+	{"bindresvport6", "netinet/in.h"},
+	{"htonl", "netinet/in.h"},
+	{"htons", "netinet/in.h"},
+	{"ntohl", "netinet/in.h"},
+	{"ntohs", "netinet/in.h"},
 
 	// nl_types.h
-	static const char *NL_TYPES_H_FUNCS[] = {
-		"catclose",
-		"catgets",
-		"catopen",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(NL_TYPES_H_FUNCS, "nl_types.h", m);
+	{"catclose", "nl_types.h"},
+	{"catgets", "nl_types.h"},
+	{"catopen", "nl_types.h"},
 
 	// pthread.h
-	static const char *PTHREAD_H_FUNCS[] = {
-		"__pthread_register_cancel",
-		"__pthread_unregister_cancel",
-		"__pthread_unwind_next",
-		"__sigsetjmp",
-		"pthread_attr_destroy",
-		"pthread_attr_getdetachstate",
-		"pthread_attr_getguardsize",
-		"pthread_attr_getinheritsched",
-		"pthread_attr_getschedparam",
-		"pthread_attr_getschedpolicy",
-		"pthread_attr_getscope",
-		"pthread_attr_getstack",
-		"pthread_attr_getstackaddr",
-		"pthread_attr_getstacksize",
-		"pthread_attr_init",
-		"pthread_attr_setdetachstate",
-		"pthread_attr_setguardsize",
-		"pthread_attr_setinheritsched",
-		"pthread_attr_setschedparam",
-		"pthread_attr_setschedpolicy",
-		"pthread_attr_setscope",
-		"pthread_attr_setstack",
-		"pthread_attr_setstackaddr",
-		"pthread_attr_setstacksize",
-		"pthread_barrier_destroy",
-		"pthread_barrier_init",
-		"pthread_barrier_wait",
-		"pthread_barrierattr_destroy",
-		"pthread_barrierattr_getpshared",
-		"pthread_barrierattr_init",
-		"pthread_barrierattr_setpshared",
-		"pthread_cancel",
-		"pthread_cond_broadcast",
-		"pthread_cond_destroy",
-		"pthread_cond_init",
-		"pthread_cond_signal",
-		"pthread_cond_timedwait",
-		"pthread_cond_wait",
-		"pthread_condattr_destroy",
-		"pthread_condattr_getclock",
-		"pthread_condattr_getpshared",
-		"pthread_condattr_init",
-		"pthread_condattr_setclock",
-		"pthread_condattr_setpshared",
-		"pthread_create",
-		"pthread_detach",
-		"pthread_equal",
-		"pthread_exit",
-		"pthread_getcpuclockid",
-		"pthread_getschedparam",
-		"pthread_getspecific",
-		"pthread_join",
-		"pthread_key_delete",
-		"pthread_kill",
-		"pthread_mutex_consistent",
-		"pthread_mutex_destroy",
-		"pthread_mutex_getprioceiling",
-		"pthread_mutex_init",
-		"pthread_mutex_lock",
-		"pthread_mutex_setprioceiling",
-		"pthread_mutex_timedlock",
-		"pthread_mutex_trylock",
-		"pthread_mutex_unlock",
-		"pthread_mutexattr_destroy",
-		"pthread_mutexattr_getprioceiling",
-		"pthread_mutexattr_getprotocol",
-		"pthread_mutexattr_getpshared",
-		"pthread_mutexattr_getrobust",
-		"pthread_mutexattr_gettype",
-		"pthread_mutexattr_init",
-		"pthread_mutexattr_setprioceiling",
-		"pthread_mutexattr_setprotocol",
-		"pthread_mutexattr_setpshared",
-		"pthread_mutexattr_setrobust",
-		"pthread_mutexattr_settype",
-		"pthread_rwlock_destroy",
-		"pthread_rwlock_init",
-		"pthread_rwlock_rdlock",
-		"pthread_rwlock_timedrdlock",
-		"pthread_rwlock_timedwrlock",
-		"pthread_rwlock_tryrdlock",
-		"pthread_rwlock_trywrlock",
-		"pthread_rwlock_unlock",
-		"pthread_rwlock_wrlock",
-		"pthread_rwlockattr_destroy",
-		"pthread_rwlockattr_getkind_np",
-		"pthread_rwlockattr_getpshared",
-		"pthread_rwlockattr_init",
-		"pthread_rwlockattr_setkind_np",
-		"pthread_rwlockattr_setpshared",
-		"pthread_self",
-		"pthread_setcancelstate",
-		"pthread_setcanceltype",
-		"pthread_setschedparam",
-		"pthread_setschedprio",
-		"pthread_setspecific",
-		"pthread_sigmask",
-		"pthread_spin_destroy",
-		"pthread_spin_init",
-		"pthread_spin_lock",
-		"pthread_spin_trylock",
-		"pthread_spin_unlock",
-		"pthread_testcancel",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(PTHREAD_H_FUNCS, "pthread.h", m);
+	{"__pthread_register_cancel", "pthread.h"},
+	{"__pthread_unregister_cancel", "pthread.h"},
+	{"__pthread_unwind_next", "pthread.h"},
+	{"__sigsetjmp", "pthread.h"},
+	{"pthread_attr_destroy", "pthread.h"},
+	{"pthread_attr_getdetachstate", "pthread.h"},
+	{"pthread_attr_getguardsize", "pthread.h"},
+	{"pthread_attr_getinheritsched", "pthread.h"},
+	{"pthread_attr_getschedparam", "pthread.h"},
+	{"pthread_attr_getschedpolicy", "pthread.h"},
+	{"pthread_attr_getscope", "pthread.h"},
+	{"pthread_attr_getstack", "pthread.h"},
+	{"pthread_attr_getstackaddr", "pthread.h"},
+	{"pthread_attr_getstacksize", "pthread.h"},
+	{"pthread_attr_init", "pthread.h"},
+	{"pthread_attr_setdetachstate", "pthread.h"},
+	{"pthread_attr_setguardsize", "pthread.h"},
+	{"pthread_attr_setinheritsched", "pthread.h"},
+	{"pthread_attr_setschedparam", "pthread.h"},
+	{"pthread_attr_setschedpolicy", "pthread.h"},
+	{"pthread_attr_setscope", "pthread.h"},
+	{"pthread_attr_setstack", "pthread.h"},
+	{"pthread_attr_setstackaddr", "pthread.h"},
+	{"pthread_attr_setstacksize", "pthread.h"},
+	{"pthread_barrier_destroy", "pthread.h"},
+	{"pthread_barrier_init", "pthread.h"},
+	{"pthread_barrier_wait", "pthread.h"},
+	{"pthread_barrierattr_destroy", "pthread.h"},
+	{"pthread_barrierattr_getpshared", "pthread.h"},
+	{"pthread_barrierattr_init", "pthread.h"},
+	{"pthread_barrierattr_setpshared", "pthread.h"},
+	{"pthread_cancel", "pthread.h"},
+	{"pthread_cond_broadcast", "pthread.h"},
+	{"pthread_cond_destroy", "pthread.h"},
+	{"pthread_cond_init", "pthread.h"},
+	{"pthread_cond_signal", "pthread.h"},
+	{"pthread_cond_timedwait", "pthread.h"},
+	{"pthread_cond_wait", "pthread.h"},
+	{"pthread_condattr_destroy", "pthread.h"},
+	{"pthread_condattr_getclock", "pthread.h"},
+	{"pthread_condattr_getpshared", "pthread.h"},
+	{"pthread_condattr_init", "pthread.h"},
+	{"pthread_condattr_setclock", "pthread.h"},
+	{"pthread_condattr_setpshared", "pthread.h"},
+	{"pthread_create", "pthread.h"},
+	{"pthread_detach", "pthread.h"},
+	{"pthread_equal", "pthread.h"},
+	{"pthread_exit", "pthread.h"},
+	{"pthread_getcpuclockid", "pthread.h"},
+	{"pthread_getschedparam", "pthread.h"},
+	{"pthread_getspecific", "pthread.h"},
+	{"pthread_join", "pthread.h"},
+	{"pthread_key_delete", "pthread.h"},
+	{"pthread_kill", "pthread.h"},
+	{"pthread_mutex_consistent", "pthread.h"},
+	{"pthread_mutex_destroy", "pthread.h"},
+	{"pthread_mutex_getprioceiling", "pthread.h"},
+	{"pthread_mutex_init", "pthread.h"},
+	{"pthread_mutex_lock", "pthread.h"},
+	{"pthread_mutex_setprioceiling", "pthread.h"},
+	{"pthread_mutex_timedlock", "pthread.h"},
+	{"pthread_mutex_trylock", "pthread.h"},
+	{"pthread_mutex_unlock", "pthread.h"},
+	{"pthread_mutexattr_destroy", "pthread.h"},
+	{"pthread_mutexattr_getprioceiling", "pthread.h"},
+	{"pthread_mutexattr_getprotocol", "pthread.h"},
+	{"pthread_mutexattr_getpshared", "pthread.h"},
+	{"pthread_mutexattr_getrobust", "pthread.h"},
+	{"pthread_mutexattr_gettype", "pthread.h"},
+	{"pthread_mutexattr_init", "pthread.h"},
+	{"pthread_mutexattr_setprioceiling", "pthread.h"},
+	{"pthread_mutexattr_setprotocol", "pthread.h"},
+	{"pthread_mutexattr_setpshared", "pthread.h"},
+	{"pthread_mutexattr_setrobust", "pthread.h"},
+	{"pthread_mutexattr_settype", "pthread.h"},
+	{"pthread_rwlock_destroy", "pthread.h"},
+	{"pthread_rwlock_init", "pthread.h"},
+	{"pthread_rwlock_rdlock", "pthread.h"},
+	{"pthread_rwlock_timedrdlock", "pthread.h"},
+	{"pthread_rwlock_timedwrlock", "pthread.h"},
+	{"pthread_rwlock_tryrdlock", "pthread.h"},
+	{"pthread_rwlock_trywrlock", "pthread.h"},
+	{"pthread_rwlock_unlock", "pthread.h"},
+	{"pthread_rwlock_wrlock", "pthread.h"},
+	{"pthread_rwlockattr_destroy", "pthread.h"},
+	{"pthread_rwlockattr_getkind_np", "pthread.h"},
+	{"pthread_rwlockattr_getpshared", "pthread.h"},
+	{"pthread_rwlockattr_init", "pthread.h"},
+	{"pthread_rwlockattr_setkind_np", "pthread.h"},
+	{"pthread_rwlockattr_setpshared", "pthread.h"},
+	{"pthread_self", "pthread.h"},
+	{"pthread_setcancelstate", "pthread.h"},
+	{"pthread_setcanceltype", "pthread.h"},
+	{"pthread_setschedparam", "pthread.h"},
+	{"pthread_setschedprio", "pthread.h"},
+	{"pthread_setspecific", "pthread.h"},
+	{"pthread_sigmask", "pthread.h"},
+	{"pthread_spin_destroy", "pthread.h"},
+	{"pthread_spin_init", "pthread.h"},
+	{"pthread_spin_lock", "pthread.h"},
+	{"pthread_spin_trylock", "pthread.h"},
+	{"pthread_spin_unlock", "pthread.h"},
+	{"pthread_testcancel", "pthread.h"},
 
 	// pwd.h
-	static const char *PWD_H_FUNCS[] = {
-		"endpwent",
-		"fgetpwent",
-		"fgetpwent_r",
-		"getpwent",
-		"getpwent_r",
-		"getpwnam",
-		"getpwnam_r",
-		"getpwuid",
-		"getpwuid_r",
-		"putpwent",
-		"setpwent",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(PWD_H_FUNCS, "pwd.h", m);
+	{"endpwent", "pwd.h"},
+	{"fgetpwent", "pwd.h"},
+	{"fgetpwent_r", "pwd.h"},
+	{"getpwent", "pwd.h"},
+	{"getpwent_r", "pwd.h"},
+	{"getpwnam", "pwd.h"},
+	{"getpwnam_r", "pwd.h"},
+	{"getpwuid", "pwd.h"},
+	{"getpwuid_r", "pwd.h"},
+	{"putpwent", "pwd.h"},
+	{"setpwent", "pwd.h"},
 
 	// regex.h
-	static const char *REGEX_H_FUNCS[] = {
-		"regcomp",
-		"regerror",
-		"regexec",
-		"regfree",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(REGEX_H_FUNCS, "regex.h", m);
+	{"regcomp", "regex.h"},
+	{"regerror", "regex.h"},
+	{"regexec", "regex.h"},
+	{"regfree", "regex.h"},
 
 	// rpc/netdb.h
-	static const char *RPC_NETDB_H_FUNCS[] = {
-		"endrpcent",
-		"getrpcbyname",
-		"getrpcbyname_r",
-		"getrpcbynumber",
-		"getrpcbynumber_r",
-		"getrpcent",
-		"getrpcent_r",
-		"setrpcent",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(RPC_NETDB_H_FUNCS, "rpc/netdb.h", m);
+	{"endrpcent", "rpc/netdb.h"},
+	{"getrpcbyname", "rpc/netdb.h"},
+	{"getrpcbyname_r", "rpc/netdb.h"},
+	{"getrpcbynumber", "rpc/netdb.h"},
+	{"getrpcbynumber_r", "rpc/netdb.h"},
+	{"getrpcent", "rpc/netdb.h"},
+	{"getrpcent_r", "rpc/netdb.h"},
+	{"setrpcent", "rpc/netdb.h"},
 
 	// sched.h
-	static const char *SCHED_H_FUNCS[] = {
-		"__sched_cpualloc",
-		"__sched_cpucount",
-		"__sched_cpufree",
-		"sched_get_priority_max",
-		"sched_get_priority_min",
-		"sched_getparam",
-		"sched_getscheduler",
-		"sched_rr_get_interval",
-		"sched_setparam",
-		"sched_setscheduler",
-		"sched_yield",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SCHED_H_FUNCS, "sched.h", m);
+	{"__sched_cpualloc", "sched.h"},
+	{"__sched_cpucount", "sched.h"},
+	{"__sched_cpufree", "sched.h"},
+	{"sched_get_priority_max", "sched.h"},
+	{"sched_get_priority_min", "sched.h"},
+	{"sched_getparam", "sched.h"},
+	{"sched_getscheduler", "sched.h"},
+	{"sched_rr_get_interval", "sched.h"},
+	{"sched_setparam", "sched.h"},
+	{"sched_setscheduler", "sched.h"},
+	{"sched_yield", "sched.h"},
 
 	// search.h
-	static const char *SEARCH_H_FUNCS[] = {
-		"hcreate",
-		"hdestroy",
-		"hsearch",
-		"insque",
-		"lfind",
-		"lsearch",
-		"remque",
-		"tdelete",
-		"tfind",
-		"tsearch",
-		"twalk",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SEARCH_H_FUNCS, "search.h", m);
+	{"hcreate", "search.h"},
+	{"hdestroy", "search.h"},
+	{"hsearch", "search.h"},
+	{"insque", "search.h"},
+	{"lfind", "search.h"},
+	{"lsearch", "search.h"},
+	{"remque", "search.h"},
+	{"tdelete", "search.h"},
+	{"tfind", "search.h"},
+	{"tsearch", "search.h"},
+	{"twalk", "search.h"},
 
 	// semaphore.h
-	static const char *SEMAPHORE_H_FUNCS[] = {
-		"sem_close",
-		"sem_destroy",
-		"sem_getvalue",
-		"sem_init",
-		"sem_open",
-		"sem_post",
-		"sem_timedwait",
-		"sem_trywait",
-		"sem_unlink",
-		"sem_wait",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SEMAPHORE_H_FUNCS, "semaphore.h", m);
+	{"sem_close", "semaphore.h"},
+	{"sem_destroy", "semaphore.h"},
+	{"sem_getvalue", "semaphore.h"},
+	{"sem_init", "semaphore.h"},
+	{"sem_open", "semaphore.h"},
+	{"sem_post", "semaphore.h"},
+	{"sem_timedwait", "semaphore.h"},
+	{"sem_trywait", "semaphore.h"},
+	{"sem_unlink", "semaphore.h"},
+	{"sem_wait", "semaphore.h"},
 
 	// setjmp.h
-	static const char *SETJMP_H_FUNCS[] = {
-		"__sigsetjmp",
-		"_longjmp",
-		"_setjmp",
-		"longjmp",
-		"setjmp",
-		"siglongjmp",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SETJMP_H_FUNCS, "setjmp.h", m);
+	{"__sigsetjmp", "setjmp.h"},
+	{"_longjmp", "setjmp.h"},
+	{"_setjmp", "setjmp.h"},
+	{"longjmp", "setjmp.h"},
+	{"setjmp", "setjmp.h"},
+	{"siglongjmp", "setjmp.h"},
 
 	// signal.h
-	static const char *SIGNAL_H_FUNCS[] = {
-		"__libc_current_sigrtmax",
-		"__libc_current_sigrtmin",
-		"__sigaddset",
-		"__sigdelset",
-		"__sigismember",
-		"__sigpause",
-		"__sysv_signal",
-		"gsignal",
-		"kill",
-		"killpg",
-		"psiginfo",
-		"psignal",
-		"raise",
-		"sigaction",
-		"sigaddset",
-		"sigaltstack",
-		"sigblock",
-		"sigdelset",
-		"sigemptyset",
-		"sigfillset",
-		"siggetmask",
-		"siginterrupt",
-		"sigismember",
-		"signal",
-		"sigpending",
-		"sigprocmask",
-		"sigqueue",
-		"sigreturn",
-		"sigsetmask",
-		"sigstack",
-		"sigsuspend",
-		"sigtimedwait",
-		"sigvec",
-		"sigwait",
-		"sigwaitinfo",
-		"ssignal",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SIGNAL_H_FUNCS, "signal.h", m);
+	{"__libc_current_sigrtmax", "signal.h"},
+	{"__libc_current_sigrtmin", "signal.h"},
+	{"__sigaddset", "signal.h"},
+	{"__sigdelset", "signal.h"},
+	{"__sigismember", "signal.h"},
+	{"__sigpause", "signal.h"},
+	{"__sysv_signal", "signal.h"},
+	{"gsignal", "signal.h"},
+	{"kill", "signal.h"},
+	{"killpg", "signal.h"},
+	{"psiginfo", "signal.h"},
+	{"psignal", "signal.h"},
+	{"raise", "signal.h"},
+	{"sigaction", "signal.h"},
+	{"sigaddset", "signal.h"},
+	{"sigaltstack", "signal.h"},
+	{"sigblock", "signal.h"},
+	{"sigdelset", "signal.h"},
+	{"sigemptyset", "signal.h"},
+	{"sigfillset", "signal.h"},
+	{"siggetmask", "signal.h"},
+	{"siginterrupt", "signal.h"},
+	{"sigismember", "signal.h"},
+	{"signal", "signal.h"},
+	{"sigpending", "signal.h"},
+	{"sigprocmask", "signal.h"},
+	{"sigqueue", "signal.h"},
+	{"sigreturn", "signal.h"},
+	{"sigsetmask", "signal.h"},
+	{"sigstack", "signal.h"},
+	{"sigsuspend", "signal.h"},
+	{"sigtimedwait", "signal.h"},
+	{"sigvec", "signal.h"},
+	{"sigwait", "signal.h"},
+	{"sigwaitinfo", "signal.h"},
+	{"ssignal", "signal.h"},
 
 	// spawn.h
-	static const char *SPAWN_H_FUNCS[] = {
-		"posix_spawn",
-		"posix_spawn_file_actions_addclose",
-		"posix_spawn_file_actions_adddup2",
-		"posix_spawn_file_actions_addopen",
-		"posix_spawn_file_actions_destroy",
-		"posix_spawn_file_actions_init",
-		"posix_spawnattr_destroy",
-		"posix_spawnattr_getflags",
-		"posix_spawnattr_getpgroup",
-		"posix_spawnattr_getschedparam",
-		"posix_spawnattr_getschedpolicy",
-		"posix_spawnattr_getsigdefault",
-		"posix_spawnattr_getsigmask",
-		"posix_spawnattr_init",
-		"posix_spawnattr_setflags",
-		"posix_spawnattr_setpgroup",
-		"posix_spawnattr_setschedparam",
-		"posix_spawnattr_setschedpolicy",
-		"posix_spawnattr_setsigdefault",
-		"posix_spawnattr_setsigmask",
-		"posix_spawnp",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SPAWN_H_FUNCS, "spawn.h", m);
+	{"posix_spawn", "spawn.h"},
+	{"posix_spawn_file_actions_addclose", "spawn.h"},
+	{"posix_spawn_file_actions_adddup2", "spawn.h"},
+	{"posix_spawn_file_actions_addopen", "spawn.h"},
+	{"posix_spawn_file_actions_destroy", "spawn.h"},
+	{"posix_spawn_file_actions_init", "spawn.h"},
+	{"posix_spawnattr_destroy", "spawn.h"},
+	{"posix_spawnattr_getflags", "spawn.h"},
+	{"posix_spawnattr_getpgroup", "spawn.h"},
+	{"posix_spawnattr_getschedparam", "spawn.h"},
+	{"posix_spawnattr_getschedpolicy", "spawn.h"},
+	{"posix_spawnattr_getsigdefault", "spawn.h"},
+	{"posix_spawnattr_getsigmask", "spawn.h"},
+	{"posix_spawnattr_init", "spawn.h"},
+	{"posix_spawnattr_setflags", "spawn.h"},
+	{"posix_spawnattr_setpgroup", "spawn.h"},
+	{"posix_spawnattr_setschedparam", "spawn.h"},
+	{"posix_spawnattr_setschedpolicy", "spawn.h"},
+	{"posix_spawnattr_setsigdefault", "spawn.h"},
+	{"posix_spawnattr_setsigmask", "spawn.h"},
+	{"posix_spawnp", "spawn.h"},
 
 	// stdio.h
-	static const char *STDIO_H_FUNCS[] = {
-		"_IO_feof",
-		"_IO_ferror",
-		"_IO_flockfile",
-		"_IO_free_backup_area",
-		"_IO_ftrylockfile",
-		"_IO_funlockfile",
-		"_IO_getc",
-		"_IO_padn",
-		"_IO_peekc_locked",
-		"_IO_putc",
-		"_IO_seekoff",
-		"_IO_seekpos",
-		"_IO_sgetn",
-		"_IO_vfprintf",
-		"_IO_vfscanf",
-		"__getdelim",
-		"clearerr",
-		"clearerr_unlocked",
-		"ctermid",
-		"dprintf",
-		"fclose",
-		"fcloseall",
-		"fdopen",
-		"feof",
-		"feof_unlocked",
-		"ferror",
-		"ferror_unlocked",
-		"fflush",
-		"fflush_unlocked",
-		"fgetc",
-		"fgetc_unlocked",
-		"fgetpos",
-		"fgets",
-		"fileno",
-		"fileno_unlocked",
-		"flockfile",
-		"fmemopen",
-		"fopen",
-		"fprintf",
-		"fputc",
-		"fputc_unlocked",
-		"fputs",
-		"fputs_unlocked",
-		"fread",
-		"fread_unlocked",
-		"freopen",
-		"fscanf",
-		"fseek",
-		"fseeko",
-		"fsetpos",
-		"ftell",
-		"ftello",
-		"ftrylockfile",
-		"funlockfile",
-		"fwrite",
-		"fwrite_unlocked",
-		"getc",
-		"getc_unlocked",
-		"getchar",
-		"getchar_unlocked",
-		"getdelim",
-		"getline",
-		"gets",
-		"getw",
-		"open_memstream",
-		"pclose",
-		"perror",
-		"popen",
-		"printf",
-		"putc",
-		"putc_unlocked",
-		"putchar",
-		"putchar_unlocked",
-		"puts",
-		"putw",
-		"remove",
-		"rename",
-		"renameat",
-		"rewind",
-		"scanf",
-		"setbuf",
-		"setbuffer",
-		"setlinebuf",
-		"setvbuf",
-		"snprintf",
-		"sprintf",
-		"sscanf",
-		"tempnam",
-		"tmpfile",
-		"tmpnam",
-		"tmpnam_r",
-		"ungetc",
-		"vasprintf",
-		"vdprintf",
-		"vfprintf",
-		"vfscanf",
-		"vprintf",
-		"vscanf",
-		"vsnprintf",
-		"vsprintf",
-		"vsscanf",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDIO_H_FUNCS, "stdio.h", m);
+	{"_IO_feof", "stdio.h"},
+	{"_IO_ferror", "stdio.h"},
+	{"_IO_flockfile", "stdio.h"},
+	{"_IO_free_backup_area", "stdio.h"},
+	{"_IO_ftrylockfile", "stdio.h"},
+	{"_IO_funlockfile", "stdio.h"},
+	{"_IO_getc", "stdio.h"},
+	{"_IO_padn", "stdio.h"},
+	{"_IO_peekc_locked", "stdio.h"},
+	{"_IO_putc", "stdio.h"},
+	{"_IO_seekoff", "stdio.h"},
+	{"_IO_seekpos", "stdio.h"},
+	{"_IO_sgetn", "stdio.h"},
+	{"_IO_vfprintf", "stdio.h"},
+	{"_IO_vfscanf", "stdio.h"},
+	{"__getdelim", "stdio.h"},
+	{"clearerr", "stdio.h"},
+	{"clearerr_unlocked", "stdio.h"},
+	{"ctermid", "stdio.h"},
+	{"dprintf", "stdio.h"},
+	{"fclose", "stdio.h"},
+	{"fcloseall", "stdio.h"},
+	{"fdopen", "stdio.h"},
+	{"feof", "stdio.h"},
+	{"feof_unlocked", "stdio.h"},
+	{"ferror", "stdio.h"},
+	{"ferror_unlocked", "stdio.h"},
+	{"fflush", "stdio.h"},
+	{"fflush_unlocked", "stdio.h"},
+	{"fgetc", "stdio.h"},
+	{"fgetc_unlocked", "stdio.h"},
+	{"fgetpos", "stdio.h"},
+	{"fgets", "stdio.h"},
+	{"fileno", "stdio.h"},
+	{"fileno_unlocked", "stdio.h"},
+	{"flockfile", "stdio.h"},
+	{"fmemopen", "stdio.h"},
+	{"fopen", "stdio.h"},
+	{"fprintf", "stdio.h"},
+	{"fputc", "stdio.h"},
+	{"fputc_unlocked", "stdio.h"},
+	{"fputs", "stdio.h"},
+	{"fputs_unlocked", "stdio.h"},
+	{"fread", "stdio.h"},
+	{"fread_unlocked", "stdio.h"},
+	{"freopen", "stdio.h"},
+	{"fscanf", "stdio.h"},
+	{"fseek", "stdio.h"},
+	{"fseeko", "stdio.h"},
+	{"fsetpos", "stdio.h"},
+	{"ftell", "stdio.h"},
+	{"ftello", "stdio.h"},
+	{"ftrylockfile", "stdio.h"},
+	{"funlockfile", "stdio.h"},
+	{"fwrite", "stdio.h"},
+	{"fwrite_unlocked", "stdio.h"},
+	{"getc", "stdio.h"},
+	{"getc_unlocked", "stdio.h"},
+	{"getchar", "stdio.h"},
+	{"getchar_unlocked", "stdio.h"},
+	{"getdelim", "stdio.h"},
+	{"getline", "stdio.h"},
+	{"gets", "stdio.h"},
+	{"getw", "stdio.h"},
+	{"open_memstream", "stdio.h"},
+	{"pclose", "stdio.h"},
+	{"perror", "stdio.h"},
+	{"popen", "stdio.h"},
+	{"printf", "stdio.h"},
+	{"putc", "stdio.h"},
+	{"putc_unlocked", "stdio.h"},
+	{"putchar", "stdio.h"},
+	{"putchar_unlocked", "stdio.h"},
+	{"puts", "stdio.h"},
+	{"putw", "stdio.h"},
+	{"remove", "stdio.h"},
+	{"rename", "stdio.h"},
+	{"renameat", "stdio.h"},
+	{"rewind", "stdio.h"},
+	{"scanf", "stdio.h"},
+	{"setbuf", "stdio.h"},
+	{"setbuffer", "stdio.h"},
+	{"setlinebuf", "stdio.h"},
+	{"setvbuf", "stdio.h"},
+	{"snprintf", "stdio.h"},
+	{"sprintf", "stdio.h"},
+	{"sscanf", "stdio.h"},
+	{"tempnam", "stdio.h"},
+	{"tmpfile", "stdio.h"},
+	{"tmpnam", "stdio.h"},
+	{"tmpnam_r", "stdio.h"},
+	{"ungetc", "stdio.h"},
+	{"vasprintf", "stdio.h"},
+	{"vdprintf", "stdio.h"},
+	{"vfprintf", "stdio.h"},
+	{"vfscanf", "stdio.h"},
+	{"vprintf", "stdio.h"},
+	{"vscanf", "stdio.h"},
+	{"vsnprintf", "stdio.h"},
+	{"vsprintf", "stdio.h"},
+	{"vsscanf", "stdio.h"},
 
 	// stdlib.h
-	static const char *STDLIB_H_FUNCS[] = {
-		"_Exit",
-		"__ctype_get_mb_cur_max",
-		"a64l",
-		"abort",
-		"abs",
-		"atof",
-		"atoi",
-		"atol",
-		"atoll",
-		"bsearch",
-		"calloc",
-		"cfree",
-		"clearenv",
-		"div",
-		"drand48",
-		"drand48_r",
-		"ecvt",
-		"ecvt_r",
-		"erand48",
-		"erand48_r",
-		"exit",
-		"fcvt",
-		"fcvt_r",
-		"free",
-		"gcvt",
-		"getenv",
-		"getloadavg",
-		"getsubopt",
-		"initstate",
-		"initstate_r",
-		"jrand48",
-		"jrand48_r",
-		"l64a",
-		"labs",
-		"lcong48",
-		"lcong48_r",
-		"ldiv",
-		"llabs",
-		"lldiv",
-		"lrand48",
-		"lrand48_r",
-		"malloc",
-		"mblen",
-		"mbstowcs",
-		"mbtowc",
-		"mkdtemp",
-		"mkstemp",
-		"mkstemps",
-		"mktemp",
-		"mrand48",
-		"mrand48_r",
-		"nrand48",
-		"nrand48_r",
-		"posix_memalign",
-		"putenv",
-		"qecvt",
-		"qecvt_r",
-		"qfcvt",
-		"qfcvt_r",
-		"qgcvt",
-		"qsort",
-		"rand",
-		"rand_r",
-		"random",
-		"random_r",
-		"realloc",
-		"realpath",
-		"rpmatch",
-		"seed48",
-		"seed48_r",
-		"setenv",
-		"setstate",
-		"setstate_r",
-		"srand",
-		"srand48",
-		"srand48_r",
-		"srandom",
-		"srandom_r",
-		"strtod",
-		"strtof",
-		"strtol",
-		"strtold",
-		"strtoll",
-		"strtoq",
-		"strtoul",
-		"strtoull",
-		"strtouq",
-		"system",
-		"unsetenv",
-		"valloc",
-		"wcstombs",
-		"wctomb",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDLIB_H_FUNCS, "stdlib.h", m);
+	{"_Exit", "stdlib.h"},
+	{"__ctype_get_mb_cur_max", "stdlib.h"},
+	{"a64l", "stdlib.h"},
+	{"abort", "stdlib.h"},
+	{"abs", "stdlib.h"},
+	{"atof", "stdlib.h"},
+	{"atoi", "stdlib.h"},
+	{"atol", "stdlib.h"},
+	{"atoll", "stdlib.h"},
+	{"bsearch", "stdlib.h"},
+	{"calloc", "stdlib.h"},
+	{"cfree", "stdlib.h"},
+	{"clearenv", "stdlib.h"},
+	{"div", "stdlib.h"},
+	{"drand48", "stdlib.h"},
+	{"drand48_r", "stdlib.h"},
+	{"ecvt", "stdlib.h"},
+	{"ecvt_r", "stdlib.h"},
+	{"erand48", "stdlib.h"},
+	{"erand48_r", "stdlib.h"},
+	{"exit", "stdlib.h"},
+	{"fcvt", "stdlib.h"},
+	{"fcvt_r", "stdlib.h"},
+	{"free", "stdlib.h"},
+	{"gcvt", "stdlib.h"},
+	{"getenv", "stdlib.h"},
+	{"getloadavg", "stdlib.h"},
+	{"getsubopt", "stdlib.h"},
+	{"initstate", "stdlib.h"},
+	{"initstate_r", "stdlib.h"},
+	{"jrand48", "stdlib.h"},
+	{"jrand48_r", "stdlib.h"},
+	{"l64a", "stdlib.h"},
+	{"labs", "stdlib.h"},
+	{"lcong48", "stdlib.h"},
+	{"lcong48_r", "stdlib.h"},
+	{"ldiv", "stdlib.h"},
+	{"llabs", "stdlib.h"},
+	{"lldiv", "stdlib.h"},
+	{"lrand48", "stdlib.h"},
+	{"lrand48_r", "stdlib.h"},
+	{"malloc", "stdlib.h"},
+	{"mblen", "stdlib.h"},
+	{"mbstowcs", "stdlib.h"},
+	{"mbtowc", "stdlib.h"},
+	{"mkdtemp", "stdlib.h"},
+	{"mkstemp", "stdlib.h"},
+	{"mkstemps", "stdlib.h"},
+	{"mktemp", "stdlib.h"},
+	{"mrand48", "stdlib.h"},
+	{"mrand48_r", "stdlib.h"},
+	{"nrand48", "stdlib.h"},
+	{"nrand48_r", "stdlib.h"},
+	{"posix_memalign", "stdlib.h"},
+	{"putenv", "stdlib.h"},
+	{"qecvt", "stdlib.h"},
+	{"qecvt_r", "stdlib.h"},
+	{"qfcvt", "stdlib.h"},
+	{"qfcvt_r", "stdlib.h"},
+	{"qgcvt", "stdlib.h"},
+	{"qsort", "stdlib.h"},
+	{"rand", "stdlib.h"},
+	{"rand_r", "stdlib.h"},
+	{"random", "stdlib.h"},
+	{"random_r", "stdlib.h"},
+	{"realloc", "stdlib.h"},
+	{"realpath", "stdlib.h"},
+	{"rpmatch", "stdlib.h"},
+	{"seed48", "stdlib.h"},
+	{"seed48_r", "stdlib.h"},
+	{"setenv", "stdlib.h"},
+	{"setstate", "stdlib.h"},
+	{"setstate_r", "stdlib.h"},
+	{"srand", "stdlib.h"},
+	{"srand48", "stdlib.h"},
+	{"srand48_r", "stdlib.h"},
+	{"srandom", "stdlib.h"},
+	{"srandom_r", "stdlib.h"},
+	{"strtod", "stdlib.h"},
+	{"strtof", "stdlib.h"},
+	{"strtol", "stdlib.h"},
+	{"strtold", "stdlib.h"},
+	{"strtoll", "stdlib.h"},
+	{"strtoq", "stdlib.h"},
+	{"strtoul", "stdlib.h"},
+	{"strtoull", "stdlib.h"},
+	{"strtouq", "stdlib.h"},
+	{"system", "stdlib.h"},
+	{"unsetenv", "stdlib.h"},
+	{"valloc", "stdlib.h"},
+	{"wcstombs", "stdlib.h"},
+	{"wctomb", "stdlib.h"},
 
 	// string.h
-	static const char *STRING_H_FUNCS[] = {
-		"__bzero",
-		"__stpcpy",
-		"__stpncpy",
-		"__strtok_r",
-		"bcmp",
-		"bcopy",
-		"bzero",
-		"ffs",
-		"index",
-		"memccpy",
-		"memchr",
-		"memcmp",
-		"memcpy",
-		"memmove",
-		"memset",
-		"rindex",
-		"stpcpy",
-		"stpncpy",
-		"strcasecmp",
-		"strcat",
-		"strchr",
-		"strcmp",
-		"strcoll",
-		"strcoll_l",
-		"strcpy",
-		"strcspn",
-		"strdup",
-		"strerror",
-		"strerror_l",
-		"strerror_r",
-		"strlen",
-		"strncasecmp",
-		"strncat",
-		"strncmp",
-		"strncpy",
-		"strndup",
-		"strnlen",
-		"strpbrk",
-		"strrchr",
-		"strsep",
-		"strsignal",
-		"strspn",
-		"strstr",
-		"strtok",
-		"strtok_r",
-		"strxfrm",
-		"strxfrm_l",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STRING_H_FUNCS, "string.h", m);
+	{"__bzero", "string.h"},
+	{"__stpcpy", "string.h"},
+	{"__stpncpy", "string.h"},
+	{"__strtok_r", "string.h"},
+	{"bcmp", "string.h"},
+	{"bcopy", "string.h"},
+	{"bzero", "string.h"},
+	{"ffs", "string.h"},
+	{"index", "string.h"},
+	{"memccpy", "string.h"},
+	{"memchr", "string.h"},
+	{"memcmp", "string.h"},
+	{"memcpy", "string.h"},
+	{"memmove", "string.h"},
+	{"memset", "string.h"},
+	{"rindex", "string.h"},
+	{"stpcpy", "string.h"},
+	{"stpncpy", "string.h"},
+	{"strcasecmp", "string.h"},
+	{"strcat", "string.h"},
+	{"strchr", "string.h"},
+	{"strcmp", "string.h"},
+	{"strcoll", "string.h"},
+	{"strcoll_l", "string.h"},
+	{"strcpy", "string.h"},
+	{"strcspn", "string.h"},
+	{"strdup", "string.h"},
+	{"strerror", "string.h"},
+	{"strerror_l", "string.h"},
+	{"strerror_r", "string.h"},
+	{"strlen", "string.h"},
+	{"strncasecmp", "string.h"},
+	{"strncat", "string.h"},
+	{"strncmp", "string.h"},
+	{"strncpy", "string.h"},
+	{"strndup", "string.h"},
+	{"strnlen", "string.h"},
+	{"strpbrk", "string.h"},
+	{"strrchr", "string.h"},
+	{"strsep", "string.h"},
+	{"strsignal", "string.h"},
+	{"strspn", "string.h"},
+	{"strstr", "string.h"},
+	{"strtok", "string.h"},
+	{"strtok_r", "string.h"},
+	{"strxfrm", "string.h"},
+	{"strxfrm_l", "string.h"},
 
 	// stropts.h
-	static const char *STROPTS_H_FUNCS[] = {
-		"fattach",
-		"fdetach",
-		"getmsg",
-		"getpmsg",
-		"ioctl",
-		"isastream",
-		"putmsg",
-		"putpmsg",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STROPTS_H_FUNCS, "stropts.h", m);
+	{"fattach", "stropts.h"},
+	{"fdetach", "stropts.h"},
+	{"getmsg", "stropts.h"},
+	{"getpmsg", "stropts.h"},
+	{"ioctl", "stropts.h"},
+	{"isastream", "stropts.h"},
+	{"putmsg", "stropts.h"},
+	{"putpmsg", "stropts.h"},
 
 	// sys/file.h
-	static const char *SYS_FILE_H_FUNCS[] = {
-		"flock",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_FILE_H_FUNCS, "sys/file.h", m);
+	{"flock", "sys/file.h"},
 
 	// sys/ipc.h
-	static const char *SYS_IPC_H_FUNCS[] = {
-		"ftok",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_IPC_H_FUNCS, "sys/ipc.h", m);
+	{"ftok", "sys/ipc.h"},
 
 	// sys/mman.h
-	static const char *SYS_MMAN_H_FUNCS[] = {
-		"madvise",
-		"mincore",
-		"mlock",
-		"mlockall",
-		"mmap",
-		"mprotect",
-		"msync",
-		"munlock",
-		"munlockall",
-		"munmap",
-		"posix_madvise",
-		"shm_open",
-		"shm_unlink",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_MMAN_H_FUNCS, "sys/mman.h", m);
+	{"madvise", "sys/mman.h"},
+	{"mincore", "sys/mman.h"},
+	{"mlock", "sys/mman.h"},
+	{"mlockall", "sys/mman.h"},
+	{"mmap", "sys/mman.h"},
+	{"mprotect", "sys/mman.h"},
+	{"msync", "sys/mman.h"},
+	{"munlock", "sys/mman.h"},
+	{"munlockall", "sys/mman.h"},
+	{"munmap", "sys/mman.h"},
+	{"posix_madvise", "sys/mman.h"},
+	{"shm_open", "sys/mman.h"},
+	{"shm_unlink", "sys/mman.h"},
 
 	// sys/msg.h
-	static const char *SYS_MSG_H_FUNCS[] = {
-		"msgctl",
-		"msgget",
-		"msgrcv",
-		"msgsnd",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_MSG_H_FUNCS, "sys/msg.h", m);
+	{"msgctl", "sys/msg.h"},
+	{"msgget", "sys/msg.h"},
+	{"msgrcv", "sys/msg.h"},
+	{"msgsnd", "sys/msg.h"},
 
 	// sys/poll.h
-	static const char *SYS_POLL_H_FUNCS[] = {
-		"poll",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_POLL_H_FUNCS, "sys/poll.h", m);
+	{"poll", "sys/poll.h"},
 
 	// sys/prctl.h
-	static const char *SYS_PRCTL_H_FUNCS[] = {
-		"prctl",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_PRCTL_H_FUNCS, "sys/prctl.h", m);
+	{"prctl", "sys/prctl.h"},
 
 	// sys/resource.h
-	static const char *SYS_RESOURCE_H_FUNCS[] = {
-		"getpriority",
-		"getrlimit",
-		"getrusage",
-		"setpriority",
-		"setrlimit",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_RESOURCE_H_FUNCS, "sys/resource.h", m);
+	{"getpriority", "sys/resource.h"},
+	{"getrlimit", "sys/resource.h"},
+	{"getrusage", "sys/resource.h"},
+	{"setpriority", "sys/resource.h"},
+	{"setrlimit", "sys/resource.h"},
 
 	// sys/select.h
-	static const char *SYS_SELECT_H_FUNCS[] = {
-		"pselect",
-		"select",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_SELECT_H_FUNCS, "sys/select.h", m);
+	{"pselect", "sys/select.h"},
+	{"select", "sys/select.h"},
 
 	// sys/sem.h
-	static const char *SYS_SEM_H_FUNCS[] = {
-		"semctl",
-		"semget",
-		"semop",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_SEM_H_FUNCS, "sys/sem.h", m);
+	{"semctl", "sys/sem.h"},
+	{"semget", "sys/sem.h"},
+	{"semop", "sys/sem.h"},
 
 	// sys/shm.h
-	static const char *SYS_SHM_H_FUNCS[] = {
-		"__getpagesize",
-		"shmat",
-		"shmctl",
-		"shmdt",
-		"shmget",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_SHM_H_FUNCS, "sys/shm.h", m);
+	{"__getpagesize", "sys/shm.h"},
+	{"shmat", "sys/shm.h"},
+	{"shmctl", "sys/shm.h"},
+	{"shmdt", "sys/shm.h"},
+	{"shmget", "sys/shm.h"},
 
 	// sys/socket.h
-	static const char *SYS_SOCKET_H_FUNCS[] = {
-		"__cmsg_nxthdr",
-		"accept",
-		"bind",
-		"connect",
-		"getpeername",
-		"getsockname",
-		"getsockopt",
-		"isfdtype",
-		"listen",
-		"recv",
-		"recvfrom",
-		"recvmsg",
-		"send",
-		"sendmsg",
-		"sendto",
-		"setsockopt",
-		"shutdown",
-		"sockatmark",
-		"socket",
-		"socketpair",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_SOCKET_H_FUNCS, "sys/socket.h", m);
+	{"__cmsg_nxthdr", "sys/socket.h"},
+	{"accept", "sys/socket.h"},
+	{"bind", "sys/socket.h"},
+	{"connect", "sys/socket.h"},
+	{"getpeername", "sys/socket.h"},
+	{"getsockname", "sys/socket.h"},
+	{"getsockopt", "sys/socket.h"},
+	{"isfdtype", "sys/socket.h"},
+	{"listen", "sys/socket.h"},
+	{"recv", "sys/socket.h"},
+	{"recvfrom", "sys/socket.h"},
+	{"recvmsg", "sys/socket.h"},
+	{"send", "sys/socket.h"},
+	{"sendmsg", "sys/socket.h"},
+	{"sendto", "sys/socket.h"},
+	{"setsockopt", "sys/socket.h"},
+	{"shutdown", "sys/socket.h"},
+	{"sockatmark", "sys/socket.h"},
+	{"socket", "sys/socket.h"},
+	{"socketpair", "sys/socket.h"},
 
 	// sys/stat.h
-	static const char *SYS_STAT_H_FUNCS[] = {
-		"__fxstat",
-		"__fxstatat",
-		"__lxstat",
-		"__xmknod",
-		"__xmknodat",
-		"__xstat",
-		"chmod",
-		"fchmod",
-		"fchmodat",
-		"fstat",
-		"fstatat",
-		"futimens",
-		"lchmod",
-		"lstat",
-		"mkdir",
-		"mkdirat",
-		"mkfifo",
-		"mkfifoat",
-		"mknod",
-		"mknodat",
-		"stat",
-		"umask",
-		"utimensat",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_STAT_H_FUNCS, "sys/stat.h", m);
+	{"__fxstat", "sys/stat.h"},
+	{"__fxstatat", "sys/stat.h"},
+	{"__lxstat", "sys/stat.h"},
+	{"__xmknod", "sys/stat.h"},
+	{"__xmknodat", "sys/stat.h"},
+	{"__xstat", "sys/stat.h"},
+	{"chmod", "sys/stat.h"},
+	{"fchmod", "sys/stat.h"},
+	{"fchmodat", "sys/stat.h"},
+	{"fstat", "sys/stat.h"},
+	{"fstatat", "sys/stat.h"},
+	{"futimens", "sys/stat.h"},
+	{"lchmod", "sys/stat.h"},
+	{"lstat", "sys/stat.h"},
+	{"mkdir", "sys/stat.h"},
+	{"mkdirat", "sys/stat.h"},
+	{"mkfifo", "sys/stat.h"},
+	{"mkfifoat", "sys/stat.h"},
+	{"mknod", "sys/stat.h"},
+	{"mknodat", "sys/stat.h"},
+	{"stat", "sys/stat.h"},
+	{"umask", "sys/stat.h"},
+	{"utimensat", "sys/stat.h"},
 
 	// sys/statvfs.h
-	static const char *SYS_STATVFS_H_FUNCS[] = {
-		"fstatvfs",
-		"statvfs",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_STATVFS_H_FUNCS, "sys/statvfs.h", m);
+	{"fstatvfs", "sys/statvfs.h"},
+	{"statvfs", "sys/statvfs.h"},
 
 	// sys/syslog.h
-	static const char *SYS_SYSLOG_H_FUNCS[] = {
-		"closelog",
-		"openlog",
-		"setlogmask",
-		"syslog",
-		"vsyslog",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_SYSLOG_H_FUNCS, "sys/syslog.h", m);
+	{"closelog", "sys/syslog.h"},
+	{"openlog", "sys/syslog.h"},
+	{"setlogmask", "sys/syslog.h"},
+	{"syslog", "sys/syslog.h"},
+	{"vsyslog", "sys/syslog.h"},
 
 	// sys/sysmacros.h
-	static const char *SYS_SYSMACROS_H_FUNCS[] = {
-		"gnu_dev_major",
-		"gnu_dev_makedev",
-		"gnu_dev_minor",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_SYSMACROS_H_FUNCS, "sys/sysmacros.h", m);
+	{"gnu_dev_major", "sys/sysmacros.h"},
+	{"gnu_dev_makedev", "sys/sysmacros.h"},
+	{"gnu_dev_minor", "sys/sysmacros.h"},
 
 	// sys/time.h
-	static const char *SYS_TIME_H_FUNCS[] = {
-		"adjtime",
-		"futimes",
-		"getitimer",
-		"gettimeofday",
-		"lutimes",
-		"setitimer",
-		"settimeofday",
-		"utimes",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_TIME_H_FUNCS, "sys/time.h", m);
+	{"adjtime", "sys/time.h"},
+	{"futimes", "sys/time.h"},
+	{"getitimer", "sys/time.h"},
+	{"gettimeofday", "sys/time.h"},
+	{"lutimes", "sys/time.h"},
+	{"setitimer", "sys/time.h"},
+	{"settimeofday", "sys/time.h"},
+	{"utimes", "sys/time.h"},
 
 	// sys/times.h
-	static const char *SYS_TIMES_H_FUNCS[] = {
-		"times",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_TIMES_H_FUNCS, "sys/times.h", m);
+	{"times", "sys/times.h"},
 
 	// sys/uio.h
-	static const char *SYS_UIO_H_FUNCS[] = {
-		"preadv",
-		"pwritev",
-		"readv",
-		"writev",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_UIO_H_FUNCS, "sys/uio.h", m);
+	{"preadv", "sys/uio.h"},
+	{"pwritev", "sys/uio.h"},
+	{"readv", "sys/uio.h"},
+	{"writev", "sys/uio.h"},
 
 	// sys/utsname.h
-	static const char *SYS_UTSNAME_H_FUNCS[] = {
-		"uname",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_UTSNAME_H_FUNCS, "sys/utsname.h", m);
+	{"uname", "sys/utsname.h"},
 
 	// sys/wait.h
-	static const char *SYS_WAIT_H_FUNCS[] = {
-		"wait",
-		"wait3",
-		"wait4",
-		"waitid",
-		"waitpid",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SYS_WAIT_H_FUNCS, "sys/wait.h", m);
+	{"wait", "sys/wait.h"},
+	{"wait3", "sys/wait.h"},
+	{"wait4", "sys/wait.h"},
+	{"waitid", "sys/wait.h"},
+	{"waitpid", "sys/wait.h"},
 
 	// termios.h
-	static const char *TERMIOS_H_FUNCS[] = {
-		"cfgetispeed",
-		"cfgetospeed",
-		"cfmakeraw",
-		"cfsetispeed",
-		"cfsetospeed",
-		"cfsetspeed",
-		"tcdrain",
-		"tcflow",
-		"tcflush",
-		"tcgetattr",
-		"tcgetsid",
-		"tcsendbreak",
-		"tcsetattr",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(TERMIOS_H_FUNCS, "termios.h", m);
+	{"cfgetispeed", "termios.h"},
+	{"cfgetospeed", "termios.h"},
+	{"cfmakeraw", "termios.h"},
+	{"cfsetispeed", "termios.h"},
+	{"cfsetospeed", "termios.h"},
+	{"cfsetspeed", "termios.h"},
+	{"tcdrain", "termios.h"},
+	{"tcflow", "termios.h"},
+	{"tcflush", "termios.h"},
+	{"tcgetattr", "termios.h"},
+	{"tcgetsid", "termios.h"},
+	{"tcsendbreak", "termios.h"},
+	{"tcsetattr", "termios.h"},
 
 	// time.h
-	static const char *TIME_H_FUNCS[] = {
-		"asctime",
-		"asctime_r",
-		"clock",
-		"clock_getcpuclockid",
-		"clock_getres",
-		"clock_gettime",
-		"clock_nanosleep",
-		"clock_settime",
-		"ctime",
-		"ctime_r",
-		"difftime",
-		"dysize",
-		"gmtime",
-		"gmtime_r",
-		"localtime",
-		"localtime_r",
-		"mktime",
-		"nanosleep",
-		"stime",
-		"strftime",
-		"strftime_l",
-		"time",
-		"timegm",
-		"timelocal",
-		"timer_create",
-		"timer_delete",
-		"timer_getoverrun",
-		"timer_gettime",
-		"timer_settime",
-		"tzset",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(TIME_H_FUNCS, "time.h", m);
+	{"asctime", "time.h"},
+	{"asctime_r", "time.h"},
+	{"clock", "time.h"},
+	{"clock_getcpuclockid", "time.h"},
+	{"clock_getres", "time.h"},
+	{"clock_gettime", "time.h"},
+	{"clock_nanosleep", "time.h"},
+	{"clock_settime", "time.h"},
+	{"ctime", "time.h"},
+	{"ctime_r", "time.h"},
+	{"difftime", "time.h"},
+	{"dysize", "time.h"},
+	{"gmtime", "time.h"},
+	{"gmtime_r", "time.h"},
+	{"localtime", "time.h"},
+	{"localtime_r", "time.h"},
+	{"mktime", "time.h"},
+	{"nanosleep", "time.h"},
+	{"stime", "time.h"},
+	{"strftime", "time.h"},
+	{"strftime_l", "time.h"},
+	{"time", "time.h"},
+	{"timegm", "time.h"},
+	{"timelocal", "time.h"},
+	{"timer_create", "time.h"},
+	{"timer_delete", "time.h"},
+	{"timer_getoverrun", "time.h"},
+	{"timer_gettime", "time.h"},
+	{"timer_settime", "time.h"},
+	{"tzset", "time.h"},
 
 	// uchar.h
-	static const char *UCHAR_H_FUNCS[] = {
-		"c16rtomb",
-		"c32rtomb",
-		"mbrtoc16",
-		"mbrtoc32",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(UCHAR_H_FUNCS, "uchar.h", m);
+	{"c16rtomb", "uchar.h"},
+	{"c32rtomb", "uchar.h"},
+	{"mbrtoc16", "uchar.h"},
+	{"mbrtoc32", "uchar.h"},
 
 	// ulimit.h
-	static const char *ULIMIT_H_FUNCS[] = {
-		"ulimit",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ULIMIT_H_FUNCS, "ulimit.h", m);
+	{"ulimit", "ulimit.h"},
 
 	// unistd.h
-	static const char *UNISTD_H_FUNCS[] = {
-		"__getpgid",
-		"_exit",
-		"access",
-		"acct",
-		"alarm",
-		"brk",
-		"chdir",
-		"chown",
-		"chroot",
-		"close",
-		"confstr",
-		"daemon",
-		"dup",
-		"dup2",
-		"endusershell",
-		"execl",
-		"execle",
-		"execlp",
-		"execv",
-		"execve",
-		"execvp",
-		"faccessat",
-		"fchdir",
-		"fchown",
-		"fchownat",
-		"fdatasync",
-		"fexecve",
-		"fork",
-		"fpathconf",
-		"fsync",
-		"ftruncate",
-		"getcwd",
-		"getdomainname",
-		"getdtablesize",
-		"getegid",
-		"geteuid",
-		"getgid",
-		"getgroups",
-		"gethostid",
-		"gethostname",
-		"getlogin",
-		"getlogin_r",
-		"getpagesize",
-		"getpass",
-		"getpgid",
-		"getpgrp",
-		"getpid",
-		"getppid",
-		"getsid",
-		"getuid",
-		"getusershell",
-		"getwd",
-		"isatty",
-		"lchown",
-		"link",
-		"linkat",
-		"lseek",
-		"nice",
-		"pathconf",
-		"pause",
-		"pipe",
-		"pread",
-		"profil",
-		"pwrite",
-		"read",
-		"readlink",
-		"readlinkat",
-		"revoke",
-		"rmdir",
-		"sbrk",
-		"setdomainname",
-		"setegid",
-		"seteuid",
-		"setgid",
-		"sethostid",
-		"sethostname",
-		"setlogin",
-		"setpgid",
-		"setpgrp",
-		"setregid",
-		"setreuid",
-		"setsid",
-		"setuid",
-		"setusershell",
-		"sleep",
-		"symlink",
-		"symlinkat",
-		"sync",
-		"syscall",
-		"sysconf",
-		"tcgetpgrp",
-		"tcsetpgrp",
-		"truncate",
-		"ttyname",
-		"ttyname_r",
-		"ttyslot",
-		"ualarm",
-		"unlink",
-		"unlinkat",
-		"usleep",
-		"vfork",
-		"vhangup",
-		"write",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(UNISTD_H_FUNCS, "unistd.h", m);
+	{"__getpgid", "unistd.h"},
+	{"_exit", "unistd.h"},
+	{"access", "unistd.h"},
+	{"acct", "unistd.h"},
+	{"alarm", "unistd.h"},
+	{"brk", "unistd.h"},
+	{"chdir", "unistd.h"},
+	{"chown", "unistd.h"},
+	{"chroot", "unistd.h"},
+	{"close", "unistd.h"},
+	{"confstr", "unistd.h"},
+	{"daemon", "unistd.h"},
+	{"dup", "unistd.h"},
+	{"dup2", "unistd.h"},
+	{"endusershell", "unistd.h"},
+	{"execl", "unistd.h"},
+	{"execle", "unistd.h"},
+	{"execlp", "unistd.h"},
+	{"execv", "unistd.h"},
+	{"execve", "unistd.h"},
+	{"execvp", "unistd.h"},
+	{"faccessat", "unistd.h"},
+	{"fchdir", "unistd.h"},
+	{"fchown", "unistd.h"},
+	{"fchownat", "unistd.h"},
+	{"fdatasync", "unistd.h"},
+	{"fexecve", "unistd.h"},
+	{"fork", "unistd.h"},
+	{"fpathconf", "unistd.h"},
+	{"fsync", "unistd.h"},
+	{"ftruncate", "unistd.h"},
+	{"getcwd", "unistd.h"},
+	{"getdomainname", "unistd.h"},
+	{"getdtablesize", "unistd.h"},
+	{"getegid", "unistd.h"},
+	{"geteuid", "unistd.h"},
+	{"getgid", "unistd.h"},
+	{"getgroups", "unistd.h"},
+	{"gethostid", "unistd.h"},
+	{"gethostname", "unistd.h"},
+	{"getlogin", "unistd.h"},
+	{"getlogin_r", "unistd.h"},
+	{"getpagesize", "unistd.h"},
+	{"getpass", "unistd.h"},
+	{"getpgid", "unistd.h"},
+	{"getpgrp", "unistd.h"},
+	{"getpid", "unistd.h"},
+	{"getppid", "unistd.h"},
+	{"getsid", "unistd.h"},
+	{"getuid", "unistd.h"},
+	{"getusershell", "unistd.h"},
+	{"getwd", "unistd.h"},
+	{"isatty", "unistd.h"},
+	{"lchown", "unistd.h"},
+	{"link", "unistd.h"},
+	{"linkat", "unistd.h"},
+	{"lseek", "unistd.h"},
+	{"nice", "unistd.h"},
+	{"pathconf", "unistd.h"},
+	{"pause", "unistd.h"},
+	{"pipe", "unistd.h"},
+	{"pread", "unistd.h"},
+	{"profil", "unistd.h"},
+	{"pwrite", "unistd.h"},
+	{"read", "unistd.h"},
+	{"readlink", "unistd.h"},
+	{"readlinkat", "unistd.h"},
+	{"revoke", "unistd.h"},
+	{"rmdir", "unistd.h"},
+	{"sbrk", "unistd.h"},
+	{"setdomainname", "unistd.h"},
+	{"setegid", "unistd.h"},
+	{"seteuid", "unistd.h"},
+	{"setgid", "unistd.h"},
+	{"sethostid", "unistd.h"},
+	{"sethostname", "unistd.h"},
+	{"setlogin", "unistd.h"},
+	{"setpgid", "unistd.h"},
+	{"setpgrp", "unistd.h"},
+	{"setregid", "unistd.h"},
+	{"setreuid", "unistd.h"},
+	{"setsid", "unistd.h"},
+	{"setuid", "unistd.h"},
+	{"setusershell", "unistd.h"},
+	{"sleep", "unistd.h"},
+	{"symlink", "unistd.h"},
+	{"symlinkat", "unistd.h"},
+	{"sync", "unistd.h"},
+	{"syscall", "unistd.h"},
+	{"sysconf", "unistd.h"},
+	{"tcgetpgrp", "unistd.h"},
+	{"tcsetpgrp", "unistd.h"},
+	{"truncate", "unistd.h"},
+	{"ttyname", "unistd.h"},
+	{"ttyname_r", "unistd.h"},
+	{"ttyslot", "unistd.h"},
+	{"ualarm", "unistd.h"},
+	{"unlink", "unistd.h"},
+	{"unlinkat", "unistd.h"},
+	{"usleep", "unistd.h"},
+	{"vfork", "unistd.h"},
+	{"vhangup", "unistd.h"},
+	{"write", "unistd.h"},
 
 	// utime.h
-	static const char *UTIME_H_FUNCS[] = {
-		"utime",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(UTIME_H_FUNCS, "utime.h", m);
+	{"utime", "utime.h"},
 
 	// utmpx.h
-	static const char *UTMPX_H_FUNCS[] = {
-		"endutxent",
-		"getutxent",
-		"getutxid",
-		"getutxline",
-		"pututxline",
-		"setutxent",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(UTMPX_H_FUNCS, "utmpx.h", m);
+	{"endutxent", "utmpx.h"},
+	{"getutxent", "utmpx.h"},
+	{"getutxid", "utmpx.h"},
+	{"getutxline", "utmpx.h"},
+	{"pututxline", "utmpx.h"},
+	{"setutxent", "utmpx.h"},
 
 	// wchar.h
-	static const char *WCHAR_H_FUNCS[] = {
-		"__mbrlen",
-		"btowc",
-		"fgetwc",
-		"fgetws",
-		"fputwc",
-		"fputws",
-		"fwide",
-		"fwprintf",
-		"fwscanf",
-		"getwc",
-		"getwchar",
-		"mbrlen",
-		"mbrtowc",
-		"mbsinit",
-		"mbsnrtowcs",
-		"mbsrtowcs",
-		"open_wmemstream",
-		"putwc",
-		"putwchar",
-		"swprintf",
-		"swscanf",
-		"ungetwc",
-		"vfwprintf",
-		"vfwscanf",
-		"vswprintf",
-		"vswscanf",
-		"vwprintf",
-		"vwscanf",
-		"wcpcpy",
-		"wcpncpy",
-		"wcrtomb",
-		"wcscasecmp",
-		"wcscasecmp_l",
-		"wcscat",
-		"wcschr",
-		"wcscmp",
-		"wcscoll",
-		"wcscoll_l",
-		"wcscpy",
-		"wcscspn",
-		"wcsdup",
-		"wcsftime",
-		"wcslen",
-		"wcsncasecmp",
-		"wcsncasecmp_l",
-		"wcsncat",
-		"wcsncmp",
-		"wcsncpy",
-		"wcsnlen",
-		"wcsnrtombs",
-		"wcspbrk",
-		"wcsrchr",
-		"wcsrtombs",
-		"wcsspn",
-		"wcsstr",
-		"wcstod",
-		"wcstof",
-		"wcstok",
-		"wcstol",
-		"wcstold",
-		"wcstoll",
-		"wcstoul",
-		"wcstoull",
-		"wcsxfrm",
-		"wcsxfrm_l",
-		"wctob",
-		"wmemchr",
-		"wmemcmp",
-		"wmemcpy",
-		"wmemmove",
-		"wmemset",
-		"wprintf",
-		"wscanf",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(WCHAR_H_FUNCS, "wchar.h", m);
+	{"__mbrlen", "wchar.h"},
+	{"btowc", "wchar.h"},
+	{"fgetwc", "wchar.h"},
+	{"fgetws", "wchar.h"},
+	{"fputwc", "wchar.h"},
+	{"fputws", "wchar.h"},
+	{"fwide", "wchar.h"},
+	{"fwprintf", "wchar.h"},
+	{"fwscanf", "wchar.h"},
+	{"getwc", "wchar.h"},
+	{"getwchar", "wchar.h"},
+	{"mbrlen", "wchar.h"},
+	{"mbrtowc", "wchar.h"},
+	{"mbsinit", "wchar.h"},
+	{"mbsnrtowcs", "wchar.h"},
+	{"mbsrtowcs", "wchar.h"},
+	{"open_wmemstream", "wchar.h"},
+	{"putwc", "wchar.h"},
+	{"putwchar", "wchar.h"},
+	{"swprintf", "wchar.h"},
+	{"swscanf", "wchar.h"},
+	{"ungetwc", "wchar.h"},
+	{"vfwprintf", "wchar.h"},
+	{"vfwscanf", "wchar.h"},
+	{"vswprintf", "wchar.h"},
+	{"vswscanf", "wchar.h"},
+	{"vwprintf", "wchar.h"},
+	{"vwscanf", "wchar.h"},
+	{"wcpcpy", "wchar.h"},
+	{"wcpncpy", "wchar.h"},
+	{"wcrtomb", "wchar.h"},
+	{"wcscasecmp", "wchar.h"},
+	{"wcscasecmp_l", "wchar.h"},
+	{"wcscat", "wchar.h"},
+	{"wcschr", "wchar.h"},
+	{"wcscmp", "wchar.h"},
+	{"wcscoll", "wchar.h"},
+	{"wcscoll_l", "wchar.h"},
+	{"wcscpy", "wchar.h"},
+	{"wcscspn", "wchar.h"},
+	{"wcsdup", "wchar.h"},
+	{"wcsftime", "wchar.h"},
+	{"wcslen", "wchar.h"},
+	{"wcsncasecmp", "wchar.h"},
+	{"wcsncasecmp_l", "wchar.h"},
+	{"wcsncat", "wchar.h"},
+	{"wcsncmp", "wchar.h"},
+	{"wcsncpy", "wchar.h"},
+	{"wcsnlen", "wchar.h"},
+	{"wcsnrtombs", "wchar.h"},
+	{"wcspbrk", "wchar.h"},
+	{"wcsrchr", "wchar.h"},
+	{"wcsrtombs", "wchar.h"},
+	{"wcsspn", "wchar.h"},
+	{"wcsstr", "wchar.h"},
+	{"wcstod", "wchar.h"},
+	{"wcstof", "wchar.h"},
+	{"wcstok", "wchar.h"},
+	{"wcstol", "wchar.h"},
+	{"wcstold", "wchar.h"},
+	{"wcstoll", "wchar.h"},
+	{"wcstoul", "wchar.h"},
+	{"wcstoull", "wchar.h"},
+	{"wcsxfrm", "wchar.h"},
+	{"wcsxfrm_l", "wchar.h"},
+	{"wctob", "wchar.h"},
+	{"wmemchr", "wchar.h"},
+	{"wmemcmp", "wchar.h"},
+	{"wmemcpy", "wchar.h"},
+	{"wmemmove", "wchar.h"},
+	{"wmemset", "wchar.h"},
+	{"wprintf", "wchar.h"},
+	{"wscanf", "wchar.h"},
 
 	// wctype.h
-	static const char *WCTYPE_H_FUNCS[] = {
-		"iswalnum",
-		"iswalnum_l",
-		"iswalpha",
-		"iswalpha_l",
-		"iswblank",
-		"iswblank_l",
-		"iswcntrl",
-		"iswcntrl_l",
-		"iswctype",
-		"iswctype_l",
-		"iswdigit",
-		"iswdigit_l",
-		"iswgraph",
-		"iswgraph_l",
-		"iswlower",
-		"iswlower_l",
-		"iswprint",
-		"iswprint_l",
-		"iswpunct",
-		"iswpunct_l",
-		"iswspace",
-		"iswspace_l",
-		"iswupper",
-		"iswupper_l",
-		"iswxdigit",
-		"iswxdigit_l",
-		"towctrans",
-		"towctrans_l",
-		"towlower",
-		"towlower_l",
-		"towupper",
-		"towupper_l",
-		"wctrans",
-		"wctrans_l",
-		"wctype",
-		"wctype_l",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(WCTYPE_H_FUNCS, "wctype.h", m);
+	{"iswalnum", "wctype.h"},
+	{"iswalnum_l", "wctype.h"},
+	{"iswalpha", "wctype.h"},
+	{"iswalpha_l", "wctype.h"},
+	{"iswblank", "wctype.h"},
+	{"iswblank_l", "wctype.h"},
+	{"iswcntrl", "wctype.h"},
+	{"iswcntrl_l", "wctype.h"},
+	{"iswctype", "wctype.h"},
+	{"iswctype_l", "wctype.h"},
+	{"iswdigit", "wctype.h"},
+	{"iswdigit_l", "wctype.h"},
+	{"iswgraph", "wctype.h"},
+	{"iswgraph_l", "wctype.h"},
+	{"iswlower", "wctype.h"},
+	{"iswlower_l", "wctype.h"},
+	{"iswprint", "wctype.h"},
+	{"iswprint_l", "wctype.h"},
+	{"iswpunct", "wctype.h"},
+	{"iswpunct_l", "wctype.h"},
+	{"iswspace", "wctype.h"},
+	{"iswspace_l", "wctype.h"},
+	{"iswupper", "wctype.h"},
+	{"iswupper_l", "wctype.h"},
+	{"iswxdigit", "wctype.h"},
+	{"iswxdigit_l", "wctype.h"},
+	{"towctrans", "wctype.h"},
+	{"towctrans_l", "wctype.h"},
+	{"towlower", "wctype.h"},
+	{"towlower_l", "wctype.h"},
+	{"towupper", "wctype.h"},
+	{"towupper_l", "wctype.h"},
+	{"wctrans", "wctype.h"},
+	{"wctrans_l", "wctype.h"},
+	{"wctype", "wctype.h"},
+	{"wctype_l", "wctype.h"},
 
 	// wordexp.h
-	static const char *WORDEXP_H_FUNCS[] = {
-		"wordexp",
-		"wordfree",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(WORDEXP_H_FUNCS, "wordexp.h", m);
-
-	return m;
-}
+	{"wordexp", "wordexp.h"},
+	{"wordfree", "wordexp.h"},
+};
 
 /// Mapping of function names to their corresponding header files.
-const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
+constexpr ConstHashTable<StringStringEntry, arraySize(FUNC_C_HEADERS)>
+	FUNC_C_HEADER_MAP(FUNC_C_HEADERS);
 
 } // anonymous namespace
 
@@ -1970,7 +1736,7 @@ const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
 * See its description for more details.
 */
 Maybe<std::string> getCHeaderFileForFunc(const std::string &funcName) {
-	return getCHeaderFileForFuncFromMap(funcName, FUNC_C_HEADER_MAP);
+	return getCHeaderFileForFuncFromTable(funcName, FUNC_C_HEADER_MAP);
 }
 
 } // namespace gcc_general
@@ -7,6 +7,9 @@
 
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_var_storing_result.h"
 #include "retdec/llvmir2hll/semantics/semantics/libc_semantics/get_name_of_var_storing_result.h"
+#include "retdec/utils/array.h"
+
+using retdec::utils::arraySize;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -15,34 +18,28 @@ namespace gcc_general {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncVarNameMap() {
-	static StringStringUMap m;
-
+/// Function names and the names of variables storing their results.
+constexpr StringStringEntry FUNC_VAR_NAMES[] = {
 	// TODO Add more mappings.
 
 	// signal.h
-	m["signal"] = "prev_func_h";
+	{"signal", "prev_func_h"},
 
 	// sys/socket.h
-	m["accept"] = "accepted_sock_fd";
-	m["socket"] = "sock_fd";
+	{"accept", "accepted_sock_fd"},
+	{"socket", "sock_fd"},
 
 	// sys/stat.h
-	m["open"] = "fd";
+	{"open", "fd"},
 
 	// unistd.h
-	m["getpid"] = "pid";
-	m["getppid"] = "ppid";
-
-	return m;
-}
+	{"getpid", "pid"},
+	{"getppid", "ppid"},
+};
 
 /// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+constexpr ConstHashTable<StringStringEntry, arraySize(FUNC_VAR_NAMES)>
+	FUNC_VAR_NAME_MAP(FUNC_VAR_NAMES);
 
 } // anonymous namespace
 
@@ -52,7 +49,7 @@ const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 * See its description for more details.
 */
 Maybe<std::string> getNameOfVarStoringResult(const std::string &funcName) {
-	return getNameOfVarStoringResultFromMap(funcName, FUNC_VAR_NAME_MAP);
+	return getNameOfVarStoringResultFromTable(funcName, FUNC_VAR_NAME_MAP);
 }
 
 } // namespace gcc_general
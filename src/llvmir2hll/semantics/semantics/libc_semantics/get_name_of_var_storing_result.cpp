@@ -7,6 +7,9 @@
 
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_var_storing_result.h"
 #include "retdec/llvmir2hll/semantics/semantics/libc_semantics/get_name_of_var_storing_result.h"
+#include "retdec/utils/array.h"
+
+using retdec::utils::arraySize;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -15,13 +18,8 @@ namespace libc {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncVarNameMap() {
-	static StringStringUMap m;
-
+/// Function names and the names of variables storing their results.
+constexpr StringStringEntry FUNC_VAR_NAMES[] = {
 	// The following list is based on
 	//
 	//     - http://en.wikipedia.org/wiki/C_standard_library
@@ -34,51 +32,51 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// assert.h
 	//
-	// m["assert"] = ""; // void
+	// {"assert", ""}, // void
 
 	//
 	// complex.h
 	//
-	// m["cabs"] = "";
-	// m["carg"] = "";
-	// m["cimag"] = "";
-	// m["creal"] = "";
-	// m["conj"] = "";
-	// m["cproj"] = "";
-	// m["cexp"] = "";
-	// m["clog"] = "";
-	// m["csqrt"] = "";
-	// m["cpow"] = "";
-	// m["csin"] = "";
-	// m["ccos"] = "";
-	// m["ctan"] = "";
-	// m["casin"] = "";
-	// m["cacos"] = "";
-	// m["catan"] = "";
-	// m["csinh"] = "";
-	// m["ccosh"] = "";
-	// m["ctanh"] = "";
-	// m["casinh"] = "";
-	// m["cacosh"] = "";
-	// m["catanh"] = "";
+	// {"cabs", ""},
+	// {"carg", ""},
+	// {"cimag", ""},
+	// {"creal", ""},
+	// {"conj", ""},
+	// {"cproj", ""},
+	// {"cexp", ""},
+	// {"clog", ""},
+	// {"csqrt", ""},
+	// {"cpow", ""},
+	// {"csin", ""},
+	// {"ccos", ""},
+	// {"ctan", ""},
+	// {"casin", ""},
+	// {"cacos", ""},
+	// {"catan", ""},
+	// {"csinh", ""},
+	// {"ccosh", ""},
+	// {"ctanh", ""},
+	// {"casinh", ""},
+	// {"cacosh", ""},
+	// {"catanh", ""},
 
 	//
 	// ctype.h
 	//
-	// m["isalnum"] = "";
-	// m["isalpha"] = "";
-	// m["isblank"] = "";
-	// m["iscntrl"] = "";
-	// m["isdigit"] = "";
-	// m["isgraph"] = "";
-	// m["islower"] = "";
-	// m["isprint"] = "";
-	// m["ispunct"] = "";
-	// m["isspace"] = "";
-	// m["isupper"] = "";
-	// m["isxdigit"] = "";
-	// m["tolower"] = "";
-	// m["toupper"] = "";
+	// {"isalnum", ""},
+	// {"isalpha", ""},
+	// {"isblank", ""},
+	// {"iscntrl", ""},
+	// {"isdigit", ""},
+	// {"isgraph", ""},
+	// {"islower", ""},
+	// {"isprint", ""},
+	// {"ispunct", ""},
+	// {"isspace", ""},
+	// {"isupper", ""},
+	// {"isxdigit", ""},
+	// {"tolower", ""},
+	// {"toupper", ""},
 
 	//
 	// errno.h
@@ -88,17 +86,17 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// fenv.h
 	//
-	// m["feclearexcept"] = "";
-	// m["fegetenv"] = "";
-	// m["fegetexceptflag"] = "";
-	// m["fegetround "] = "";
-	// m["feholdexcept"] = "";
-	// m["feraiseexcept"] = "";
-	// m["fesetenv"] = "";
-	// m["fesetexceptflag"] = "";
-	// m["fesetround "] = "";
-	// m["fetestexcept"] = "";
-	// m["feupdateenv "] = "";
+	// {"feclearexcept", ""},
+	// {"fegetenv", ""},
+	// {"fegetexceptflag", ""},
+	// {"fegetround ", ""},
+	// {"feholdexcept", ""},
+	// {"feraiseexcept", ""},
+	// {"fesetenv", ""},
+	// {"fesetexceptflag", ""},
+	// {"fesetround ", ""},
+	// {"fetestexcept", ""},
+	// {"feupdateenv ", ""},
 
 	//
 	// float.h
@@ -123,95 +121,95 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// locale.h
 	//
-	m["localeconv"] = "locale_info";
-	m["setlocale"] = "locale";
+	{"localeconv", "locale_info"},
+	{"setlocale", "locale"},
 
 	//
 	// math.h
 	//
-	// m["abs"] = "";
-	// m["labs"] = "";
-	// m["llabs"] = "";
-	// m["fabs"] = "";
-	// m["div"] = "";
-	// m["ldiv"] = "";
-	// m["lldiv"] = "";
-	// m["fmod"] = "";
-	// m["remainder"] = "";
-	// m["remquo"] = "";
-	// m["fma"] = "";
-	// m["fmax"] = "";
-	// m["fmin"] = "";
-	// m["fdim"] = "";
-	// m["nan"] = "";
-	// m["nanf"] = "";
-	// m["nanl"] = "";
-	// m["exp"] = "";
-	// m["exp2"] = "";
-	// m["expm1"] = "";
-	// m["log"] = "";
-	// m["log2"] = "";
-	// m["log10"] = "";
-	// m["log1p"] = "";
-	// m["ilogb"] = "";
-	// m["logb"] = "";
-	// m["sqrt"] = "";
-	// m["cbrt"] = "";
-	// m["hypot"] = "";
-	// m["pow"] = "";
-	// m["sin"] = "";
-	// m["cos"] = "";
-	// m["tan"] = "";
-	// m["asin"] = "";
-	// m["acos"] = "";
-	// m["atan"] = "";
-	// m["atan2"] = "";
-	// m["sinh"] = "";
-	// m["cosh"] = "";
-	// m["tanh"] = "";
-	// m["asinh"] = "";
-	// m["acosh"] = "";
-	// m["atanh"] = "";
-	// m["erf"] = "";
-	// m["erfc"] = "";
-	// m["lgamma"] = "";
-	// m["tgamma"] = "";
-	// m["ceil"] = "";
-	// m["floor"] = "";
-	// m["trunc"] = "";
-	// m["round"] = "";
-	// m["lround"] = "";
-	// m["llround"] = "";
-	// m["nearbyint"] = "";
-	// m["rint"] = "";
-	// m["lrint"] = "";
-	// m["llrint"] = "";
-	// m["frexp"] = "";
-	// m["ldexp"] = "";
-	// m["modf"] = "";
-	// m["scalbn"] = "";
-	// m["scalbln"] = "";
-	// m["nextafter"] = "";
-	// m["nexttoward"] = "";
-	// m["copysign"] = "";
-	// m["fpclassify"] = "";
-	// m["isfinite"] = "";
-	// m["isinf"] = "";
-	// m["isnan"] = "";
-	// m["isnormal"] = "";
-	// m["signbit"] = "";
+	// {"abs", ""},
+	// {"labs", ""},
+	// {"llabs", ""},
+	// {"fabs", ""},
+	// {"div", ""},
+	// {"ldiv", ""},
+	// {"lldiv", ""},
+	// {"fmod", ""},
+	// {"remainder", ""},
+	// {"remquo", ""},
+	// {"fma", ""},
+	// {"fmax", ""},
+	// {"fmin", ""},
+	// {"fdim", ""},
+	// {"nan", ""},
+	// {"nanf", ""},
+	// {"nanl", ""},
+	// {"exp", ""},
+	// {"exp2", ""},
+	// {"expm1", ""},
+	// {"log", ""},
+	// {"log2", ""},
+	// {"log10", ""},
+	// {"log1p", ""},
+	// {"ilogb", ""},
+	// {"logb", ""},
+	// {"sqrt", ""},
+	// {"cbrt", ""},
+	// {"hypot", ""},
+	// {"pow", ""},
+	// {"sin", ""},
+	// {"cos", ""},
+	// {"tan", ""},
+	// {"asin", ""},
+	// {"acos", ""},
+	// {"atan", ""},
+	// {"atan2", ""},
+	// {"sinh", ""},
+	// {"cosh", ""},
+	// {"tanh", ""},
+	// {"asinh", ""},
+	// {"acosh", ""},
+	// {"atanh", ""},
+	// {"erf", ""},
+	// {"erfc", ""},
+	// {"lgamma", ""},
+	// {"tgamma", ""},
+	// {"ceil", ""},
+	// {"floor", ""},
+	// {"trunc", ""},
+	// {"round", ""},
+	// {"lround", ""},
+	// {"llround", ""},
+	// {"nearbyint", ""},
+	// {"rint", ""},
+	// {"lrint", ""},
+	// {"llrint", ""},
+	// {"frexp", ""},
+	// {"ldexp", ""},
+	// {"modf", ""},
+	// {"scalbn", ""},
+	// {"scalbln", ""},
+	// {"nextafter", ""},
+	// {"nexttoward", ""},
+	// {"copysign", ""},
+	// {"fpclassify", ""},
+	// {"isfinite", ""},
+	// {"isinf", ""},
+	// {"isnan", ""},
+	// {"isnormal", ""},
+	// {"signbit", ""},
 
 	//
 	// setjmp.h
 	//
-	m["setjmp"] = "val";
-	// m["longjmp"] = ""; // void
+	{"setjmp", "val"},
+	// {"longjmp", ""}, // void
 
 	//
 	// signal.h
 	//
-	m["signal"] = "prev_sig_handler";
-	m["raise"] = "raise_rc";
+	{"signal", "prev_sig_handler"},
+	{"raise", "raise_rc"},
 
 	//
 	// stdalign.h
@@ -221,10 +219,10 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// stdarg.h
 	//
-	// m["va_start"] = ""; // void
-	// m["va_arg"] = "";
-	// m["va_end"] = ""; // void
-	// m["va_copy"] = ""; // void
+	// {"va_start", ""}, // void
+	// {"va_arg", ""},
+	// {"va_end", ""}, // void
+	// {"va_copy", ""}, // void
 
 	//
 	// stdatomic.h
@@ -239,7 +237,7 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// stddef.h
 	//
-	// m["offsetof"] = "";
+	// {"offsetof", ""},
 
 	//
 	// stdint.h
@@ -249,83 +247,83 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// stdio.h
 	//
-	// m["clearerr"] = ""; // void
-	// m["fclose"] = ""; // void
-	m["feof"] = "is_feof";
-	m["ferror"] = "is_ferror";
-	m["fflush"] = "fflush_rc";
-	m["fgetc"] = "c";
-	m["fgetpos"] = "fgetpos_rc";
-	m["fgets"] = "str";
-	m["fopen"] = "file";
-	m["fprintf"] = "chars_printed";
-	m["fputc"] = "fputc_rc";
-	m["fputs"] = "fputs_rc";
-	m["fread"] = "items_read";
-	m["freopen"] = "file";
-	m["fscanf"] = "items_assigned";
-	m["fseek"] = "fseek_rc";
-	m["fsetpos"] = "fsetpos_rc";
-	m["ftell"] = "curr_file_offset";
-	m["fwrite"] = "items_written";
-	m["getc"] = "c";
-	m["getchar"] = "c";
-	m["gets"] = "str";
-	// m["perror"] = ""; // void
-	m["printf"] = "chars_printed";
-	m["putc"] = "putc_rc";
-	m["putchar"] = "putchar_rc";
-	m["puts"] = "puts_rc";
-	m["remove"] = "remove_rc";
-	m["rename"] = "rename_rc";
-	// m["rewind"] = ""; // void
-	m["scanf"] = "items_assigned";
-	// m["setbuf"] = ""; // void
-	m["setvbuf"] = "setvbuf_rc";
-	m["snprintf"] = "chars_printed";
-	m["sprintf"] = "chars_printed";
-	m["sscanf"] = "items_assigned";
-	m["tmpfile"] = "tmp_file";
-	m["tmpnam"] = "tmp_file_name";
-	m["ungetc"] = "ungetc_rc";
-	m["vfprintf"] = "chars_printed";
-	m["vfscanf"] = "items_assigned";
-	m["vprintf"] = "chars_printed";
-	m["vscanf"] = "items_assigned";
-	m["vsnprintf"] = "chars_printed";
-	m["vsprintf"] = "chars_printed";
-	m["vsscanf"] = "items_assigned";
+	// {"clearerr", ""}, // void
+	// {"fclose", ""}, // void
+	{"feof", "is_feof"},
+	{"ferror", "is_ferror"},
+	{"fflush", "fflush_rc"},
+	{"fgetc", "c"},
+	{"fgetpos", "fgetpos_rc"},
+	{"fgets", "str"},
+	{"fopen", "file"},
+	{"fprintf", "chars_printed"},
+	{"fputc", "fputc_rc"},
+	{"fputs", "fputs_rc"},
+	{"fread", "items_read"},
+	{"freopen", "file"},
+	{"fscanf", "items_assigned"},
+	{"fseek", "fseek_rc"},
+	{"fsetpos", "fsetpos_rc"},
+	{"ftell", "curr_file_offset"},
+	{"fwrite", "items_written"},
+	{"getc", "c"},
+	{"getchar", "c"},
+	{"gets", "str"},
+	// {"perror", ""}, // void
+	{"printf", "chars_printed"},
+	{"putc", "putc_rc"},
+	{"putchar", "putchar_rc"},
+	{"puts", "puts_rc"},
+	{"remove", "remove_rc"},
+	{"rename", "rename_rc"},
+	// {"rewind", ""}, // void
+	{"scanf", "items_assigned"},
+	// {"setbuf", ""}, // void
+	{"setvbuf", "setvbuf_rc"},
+	{"snprintf", "chars_printed"},
+	{"sprintf", "chars_printed"},
+	{"sscanf", "items_assigned"},
+	{"tmpfile", "tmp_file"},
+	{"tmpnam", "tmp_file_name"},
+	{"ungetc", "ungetc_rc"},
+	{"vfprintf", "chars_printed"},
+	{"vfscanf", "items_assigned"},
+	{"vprintf", "chars_printed"},
+	{"vscanf", "items_assigned"},
+	{"vsnprintf", "chars_printed"},
+	{"vsprintf", "chars_printed"},
+	{"vsscanf", "items_assigned"},
 
 	//
 	// stdlib.h
 	//
-	m["atof"] = "str_as_f";
-	m["atoi"] = "str_as_i";
-	m["atol"] = "str_as_l";
-	m["atoll"] = "str_as_ll";
-	m["strtof"] = "str_as_f";
-	m["strtod"] = "str_as_d";
-	m["strtold"] = "str_as_ld";
-	m["strtol"] = "str_as_l";
-	m["strtoll"] = "str_as_ll";
-	m["strtoul"] = "str_as_ul";
-	m["strtoull"] = "str_as_ull";
-	m["calloc"] = "mem";
-	m["malloc"] = "mem";
-	m["realloc"] = "mem";
-	// m["free"] = ""; // void
-	// m["abort"] = ""; // void
-	// m["exit"] = ""; // void
-	m["atexit"] = "atexit_rc";
-	// m["quick_exit"] = ""; // void
-	m["at_quick_exit"] = "at_quick_exit_rc";
-	m["system"] = "system_rc";
-	m["getenv"] = "env_val";
-	m["bsearch"] = "found_elem";
-	// m["qsort"] = ""; // void
-	// m["rand"] = "";
-	// m["srand"] = ""; // void
-	// m["_Exit"] = ""; // void
+	{"atof", "str_as_f"},
+	{"atoi", "str_as_i"},
+	{"atol", "str_as_l"},
+	{"atoll", "str_as_ll"},
+	{"strtof", "str_as_f"},
+	{"strtod", "str_as_d"},
+	{"strtold", "str_as_ld"},
+	{"strtol", "str_as_l"},
+	{"strtoll", "str_as_ll"},
+	{"strtoul", "str_as_ul"},
+	{"strtoull", "str_as_ull"},
+	{"calloc", "mem"},
+	{"malloc", "mem"},
+	{"realloc", "mem"},
+	// {"free", ""}, // void
+	// {"abort", ""}, // void
+	// {"exit", ""}, // void
+	{"atexit", "atexit_rc"},
+	// {"quick_exit", ""}, // void
+	{"at_quick_exit", "at_quick_exit_rc"},
+	{"system", "system_rc"},
+	{"getenv", "env_val"},
+	{"bsearch", "found_elem"},
+	// {"qsort", ""}, // void
+	// {"rand", ""},
+	// {"srand", ""}, // void
+	// {"_Exit", ""}, // void
 
 	//
 	// stdnoreturn.h
@@ -335,28 +333,28 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// string.h
 	//
-	m["memchr"] = "found_byte_pos";
-	m["memcmp"] = "memcmp_rc";
-	m["memcpy"] = "dest_mem";
-	m["memmove"] = "dest_mem";
-	m["memset"] = "set_mem";
-	m["strcat"] = "dest_str";
-	m["strchr"] = "found_char_pos";
-	m["strcmp"] = "strcmp_rc";
-	m["strcoll"] = "strcoll_rc";
-	m["strcpy"] = "dest_str";
-	m["strcspn"] = "ini_seg_bytes";
-	m["strerror"] = "err_str";
-	m["strlen"] = "len";
-	m["strncat"] = "dest_str";
-	m["strncmp"] = "strncmp_rc";
-	m["strncpy"] = "dest_str";
-	m["strpbrk"] = "found_byte_pos";
-	m["strrchr"] = "found_char_pos";
-	m["strspn"] = "ini_seg_bytes";
-	m["strstr"] = "substr_pos";
-	m["strtok"] = "next_token";
-	m["strxfrm"] = "req_bytes";
+	{"memchr", "found_byte_pos"},
+	{"memcmp", "memcmp_rc"},
+	{"memcpy", "dest_mem"},
+	{"memmove", "dest_mem"},
+	{"memset", "set_mem"},
+	{"strcat", "dest_str"},
+	{"strchr", "found_char_pos"},
+	{"strcmp", "strcmp_rc"},
+	{"strcoll", "strcoll_rc"},
+	{"strcpy", "dest_str"},
+	{"strcspn", "ini_seg_bytes"},
+	{"strerror", "err_str"},
+	{"strlen", "len"},
+	{"strncat", "dest_str"},
+	{"strncmp", "strncmp_rc"},
+	{"strncpy", "dest_str"},
+	{"strpbrk", "found_byte_pos"},
+	{"strrchr", "found_char_pos"},
+	{"strspn", "ini_seg_bytes"},
+	{"strstr", "substr_pos"},
+	{"strtok", "next_token"},
+	{"strxfrm", "req_bytes"},
 
 	//
 	// tgmath.h
@@ -371,106 +369,105 @@ const StringStringUMap &initFuncVarNameMap() {
 	//
 	// time.h
 	//
-	m["difftime"] = "time_diff";
-	m["time"] = "time_val";
-	m["clock"] = "proc_time";
-	m["asctime"] = "time_str";
-	m["ctime"] = "time_str";
-	m["strftime"] = "copied_chars";
-	m["gmtime"] = "time_info";
-	m["localtime"] = "time_info";
-	m["mktime"] = "time_info";
+	{"difftime", "time_diff"},
+	{"time", "time_val"},
+	{"clock", "proc_time"},
+	{"asctime", "time_str"},
+	{"ctime", "time_str"},
+	{"strftime", "copied_chars"},
+	{"gmtime", "time_info"},
+	{"localtime", "time_info"},
+	{"mktime", "time_info"},
 
 	//
 	// wchar.h
 	//
-	// m["btowc"] = "";
-	// m["fgetwc"] = "";
-	// m["fgetws"] = "";
-	// m["fputwc"] = "";
-	// m["fputws"] = "";
-	// m["fwide"] = "";
-	// m["fwprintf"] = "";
-	// m["fwscanf"] = "";
-	// m["getwc"] = "";
-	// m["getwchar"] = "";
-	// m["mbrlen"] = "";
-	// m["mbrtowc"] = "";
-	// m["mbsinit"] = "";
-	// m["mbsrtowcs"] = "";
-	// m["putwc"] = "";
-	// m["putwchar"] = "";
-	// m["swprintf"] = "";
-	// m["swscanf"] = "";
-	// m["ungetwc"] = "";
-	// m["vfwprintf"] = "";
-	// m["vfwscanf"] = "";
-	// m["vswprintf"] = "";
-	// m["vswscanf"] = "";
-	// m["vwprintf"] = "";
-	// m["vwscanf"] = "";
-	// m["wcrtomb"] = "";
-	// m["wcscat"] = "";
-	// m["wcschr"] = "";
-	// m["wcscmp"] = "";
-	// m["wcscoll"] = "";
-	// m["wcscpy"] = "";
-	// m["wcscspn"] = "";
-	// m["wcsftime"] = "";
-	// m["wcslen"] = "";
-	// m["wcsncat"] = "";
-	// m["wcsncmp"] = "";
-	// m["wcsncpy"] = "";
-	// m["wcspbrk"] = "";
-	// m["wcsrchr"] = "";
-	// m["wcsrtombs"] = "";
-	// m["wcsspn"] = "";
-	// m["wcsstr"] = "";
-	// m["wcstod"] = "";
-	// m["wcstof"] = "";
-	// m["wcstok"] = "";
-	// m["wcstol"] = "";
-	// m["wcstold"] = "";
-	// m["wcstoll"] = "";
-	// m["wcstoul"] = "";
-	// m["wcstoull"] = "";
-	// m["wcsxfrm"] = "";
-	// m["wctob"] = "";
-	// m["wmemchr"] = "";
-	// m["wmemcmp"] = "";
-	// m["wmemcpy"] = "";
-	// m["wmemmove"] = "";
-	// m["wmemset"] = "";
-	// m["wprintf"] = "";
-	// m["wscanf"] = "";
+	// {"btowc", ""},
+	// {"fgetwc", ""},
+	// {"fgetws", ""},
+	// {"fputwc", ""},
+	// {"fputws", ""},
+	// {"fwide", ""},
+	// {"fwprintf", ""},
+	// {"fwscanf", ""},
+	// {"getwc", ""},
+	// {"getwchar", ""},
+	// {"mbrlen", ""},
+	// {"mbrtowc", ""},
+	// {"mbsinit", ""},
+	// {"mbsrtowcs", ""},
+	// {"putwc", ""},
+	// {"putwchar", ""},
+	// {"swprintf", ""},
+	// {"swscanf", ""},
+	// {"ungetwc", ""},
+	// {"vfwprintf", ""},
+	// {"vfwscanf", ""},
+	// {"vswprintf", ""},
+	// {"vswscanf", ""},
+	// {"vwprintf", ""},
+	// {"vwscanf", ""},
+	// {"wcrtomb", ""},
+	// {"wcscat", ""},
+	// {"wcschr", ""},
+	// {"wcscmp", ""},
+	// {"wcscoll", ""},
+	// {"wcscpy", ""},
+	// {"wcscspn", ""},
+	// {"wcsftime", ""},
+	// {"wcslen", ""},
+	// {"wcsncat", ""},
+	// {"wcsncmp", ""},
+	// {"wcsncpy", ""},
+	// {"wcspbrk", ""},
+	// {"wcsrchr", ""},
+	// {"wcsrtombs", ""},
+	// {"wcsspn", ""},
+	// {"wcsstr", ""},
+	// {"wcstod", ""},
+	// {"wcstof", ""},
+	// {"wcstok", ""},
+	// {"wcstol", ""},
+	// {"wcstold", ""},
+	// {"wcstoll", ""},
+	// {"wcstoul", ""},
+	// {"wcstoull", ""},
+	// {"wcsxfrm", ""},
+	// {"wctob", ""},
+	// {"wmemchr", ""},
+	// {"wmemcmp", ""},
+	// {"wmemcpy", ""},
+	// {"wmemmove", ""},
+	// {"wmemset", ""},
+	// {"wprintf", ""},
+	// {"wscanf", ""},
 
 	//
 	// wctype.h
 	//
-	// m["iswalnum"] = "";
-	// m["iswalpha"] = "";
-	// m["iswblank"] = "";
-	// m["iswcntrl"] = "";
-	// m["iswctype"] = "";
-	// m["iswdigit"] = "";
-	// m["iswgraph"] = "";
-	// m["iswlower"] = "";
-	// m["iswprint"] = "";
-	// m["iswpunct"] = "";
-	// m["iswspace"] = "";
-	// m["iswupper"] = "";
-	// m["iswxdigit"] = "";
-	// m["towctrans"] = "";
-	// m["towlower"] = "";
-	// m["towupper"] = "";
-	// m["wctrans"] = "";
-	// m["wctype"] = "";
-
-	return m;
-}
+	// {"iswalnum", ""},
+	// {"iswalpha", ""},
+	// {"iswblank", ""},
+	// {"iswcntrl", ""},
+	// {"iswctype", ""},
+	// {"iswdigit", ""},
+	// {"iswgraph", ""},
+	// {"iswlower", ""},
+	// {"iswprint", ""},
+	// {"iswpunct", ""},
+	// {"iswspace", ""},
+	// {"iswupper", ""},
+	// {"iswxdigit", ""},
+	// {"towctrans", ""},
+	// {"towlower", ""},
+	// {"towupper", ""},
+	// {"wctrans", ""},
+	// {"wctype", ""},
+};
 
 /// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+constexpr ConstHashTable<StringStringEntry, arraySize(FUNC_VAR_NAMES)>
+	FUNC_VAR_NAME_MAP(FUNC_VAR_NAMES);
 
 } // anonymous namespace
 
@@ -480,7 +477,7 @@ const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 * See its description for more details.
 */
 Maybe<std::string> getNameOfVarStoringResult(const std::string &funcName) {
-	return getNameOfVarStoringResultFromMap(funcName, FUNC_VAR_NAME_MAP);
+	return getNameOfVarStoringResultFromTable(funcName, FUNC_VAR_NAME_MAP);
 }
 
 } // namespace libc
@@ -5,6 +5,10 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <cctype>
+#include <cstddef>
+#include <iterator>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param.h"
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/a.h"
@@ -43,61 +47,75 @@ namespace win_api {
 
 namespace {
 
+//
+// The base of the information for this type of semantics has been obtained
+// by using the
+// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
+// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h.
+// The resulting semantics has been updated manually. Useless mappings have
+// been commented out.
+//
+
+/// Functions finding names of parameters of WinAPI functions.
+using FindFuncParamNameFunc = const FuncParamName *(*)(const FuncParamName &);
+
+/// Functions finding names of parameters of WinAPI functions starting with
+/// the letters from @c A to @c Z (regardless of their case). Functions
+/// starting with @c _ are in the table for @c A. The tables of a letter are
+/// in the order in which they used to be merged into a single map, where a
+/// later table took precedence. There are no functions in more than one
+/// table, though.
+const FindFuncParamNameFunc FIND_FUNC_PARAM_NAME_FUNCS['Z' - 'A' + 1][2] = {
+	{findFuncParamName_A, nullptr},
+	{findFuncParamName_B, nullptr},
+	{findFuncParamName_C1, findFuncParamName_C2},
+	{findFuncParamName_D, nullptr},
+	{findFuncParamName_E, nullptr},
+	{findFuncParamName_F, nullptr},
+	{findFuncParamName_G1, findFuncParamName_G2},
+	{findFuncParamName_H, nullptr},
+	{findFuncParamName_I, nullptr},
+	{findFuncParamName_J, nullptr},
+	{findFuncParamName_K, nullptr},
+	{findFuncParamName_L, nullptr},
+	{findFuncParamName_M, nullptr},
+	{findFuncParamName_N, nullptr},
+	{findFuncParamName_O, nullptr},
+	{findFuncParamName_P, nullptr},
+	{findFuncParamName_Q, nullptr},
+	{findFuncParamName_R, nullptr},
+	{findFuncParamName_S, nullptr},
+	{findFuncParamName_T, nullptr},
+	{findFuncParamName_U, nullptr},
+	{findFuncParamName_V, nullptr},
+	{findFuncParamName_W, nullptr},
+	{findFuncParamName_X, nullptr},
+	{findFuncParamName_Y, nullptr},
+	{findFuncParamName_Z, nullptr},
+};
+
 /**
-* @brief This function is used to initialize FUNC_PARAM_NAMES_MAP later in the
-*        file.
+* @brief Returns the index of the tables of functions starting with the first
+*        character of @a funcName into @c FIND_FUNC_PARAM_NAME_FUNCS.
+*
+* If there are no such tables, it returns @c Nothing.
 */
-const FuncParamNamesMap &initFuncParamNamesMap() {
-	static FuncParamNamesMap funcParamNamesMap;
-
-	//
-	// The base of the information for this type of semantics has been obtained
-	// by using the
-	// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
-	// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h.
-	// The resulting semantics has been updated manually. Useless mappings have
-	// been commented out.
-	//
+Maybe<std::size_t> getFindFuncParamNameFuncsIndex(const std::string &funcName) {
+	if (funcName.empty()) {
+		return Nothing<std::size_t>();
+	}
 
-	// Since having 10 000 lines in a single file was found impossible to
-	// compile by using gcc in a reasonable amount of time and memory (even
-	// using -fno-var-tracking), we had to split the initialization into
-	// several modules.
-	initFuncParamNamesMap_A(funcParamNamesMap);
-	initFuncParamNamesMap_B(funcParamNamesMap);
-	initFuncParamNamesMap_C1(funcParamNamesMap);
-	initFuncParamNamesMap_C2(funcParamNamesMap);
-	initFuncParamNamesMap_D(funcParamNamesMap);
-	initFuncParamNamesMap_E(funcParamNamesMap);
-	initFuncParamNamesMap_F(funcParamNamesMap);
-	initFuncParamNamesMap_G1(funcParamNamesMap);
-	initFuncParamNamesMap_G2(funcParamNamesMap);
-	initFuncParamNamesMap_H(funcParamNamesMap);
-	initFuncParamNamesMap_I(funcParamNamesMap);
-	initFuncParamNamesMap_J(funcParamNamesMap);
-	initFuncParamNamesMap_K(funcParamNamesMap);
-	initFuncParamNamesMap_L(funcParamNamesMap);
-	initFuncParamNamesMap_M(funcParamNamesMap);
-	initFuncParamNamesMap_N(funcParamNamesMap);
-	initFuncParamNamesMap_O(funcParamNamesMap);
-	initFuncParamNamesMap_P(funcParamNamesMap);
-	initFuncParamNamesMap_Q(funcParamNamesMap);
-	initFuncParamNamesMap_R(funcParamNamesMap);
-	initFuncParamNamesMap_S(funcParamNamesMap);
-	initFuncParamNamesMap_T(funcParamNamesMap);
-	initFuncParamNamesMap_U(funcParamNamesMap);
-	initFuncParamNamesMap_V(funcParamNamesMap);
-	initFuncParamNamesMap_W(funcParamNamesMap);
-	initFuncParamNamesMap_X(funcParamNamesMap);
-	initFuncParamNamesMap_Y(funcParamNamesMap);
-	initFuncParamNamesMap_Z(funcParamNamesMap);
+	if (funcName[0] == '_') {
+		return Just<std::size_t>(0);
+	}
 
-	return funcParamNamesMap;
+	auto c = std::toupper(static_cast<unsigned char>(funcName[0]));
+	if (c < 'A' || c > 'Z') {
+		return Nothing<std::size_t>();
+	}
+	return Just<std::size_t>(c - 'A');
 }
 
-/// Mapping of function parameter positions into the names of parameters.
-const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
-
 } // anonymous namespace
 
 /**
@@ -107,7 +125,22 @@ const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
 */
 Maybe<std::string> getNameOfParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getNameOfParamFromMap(funcName, paramPos, FUNC_PARAM_NAMES_MAP);
+	auto index = getFindFuncParamNameFuncsIndex(funcName);
+	if (!index) {
+		return Nothing<std::string>();
+	}
+
+	FuncParamName key = {funcName.c_str(), paramPos, nullptr};
+	const auto &findFuncs = FIND_FUNC_PARAM_NAME_FUNCS[index.get()];
+	// The later table takes precedence.
+	for (auto it = std::rbegin(findFuncs); it != std::rend(findFuncs); ++it) {
+		if (*it) {
+			if (auto entry = (*it)(key)) {
+				return Just(std::string(entry->paramName));
+			}
+		}
+	}
+	return Nothing<std::string>();
 }
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/j.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Implementation of the names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -12,12 +12,12 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with J.
+* @brief Finds the name of the parameter given by @a key of functions starting
+*        with J.
 */
-void initFuncParamNamesMap_J(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
+const FuncParamName *findFuncParamName_J(const FuncParamName &) {
+	// There are no such functions in windows.h.
+	return nullptr;
 }
 
 } // namespace win_api
@@ -1,223 +1,240 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/o.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Implementation of the names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/o.h"
+#include "retdec/utils/array.h"
+
+using retdec::utils::arraySize;
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with O.
-*/
-void initFuncParamNamesMap_O(FuncParamNamesMap &funcParamNamesMap) {
+namespace {
+
+/// Names of parameters of functions starting with O.
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("ObjectCloseAuditAlarmA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("ObjectCloseAuditAlarmA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectCloseAuditAlarmA", 3, "GenerateOnClose"); // WINBOOL
-	ADD_PARAM_NAME("ObjectCloseAuditAlarmW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("ObjectCloseAuditAlarmW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectCloseAuditAlarmW", 3, "GenerateOnClose"); // WINBOOL
-	ADD_PARAM_NAME("ObjectDeleteAuditAlarmA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("ObjectDeleteAuditAlarmA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectDeleteAuditAlarmA", 3, "GenerateOnClose"); // WINBOOL
-	ADD_PARAM_NAME("ObjectDeleteAuditAlarmW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("ObjectDeleteAuditAlarmW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectDeleteAuditAlarmW", 3, "GenerateOnClose"); // WINBOOL
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 3, "ObjectTypeName"); // LPSTR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 4, "ObjectName"); // LPSTR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 5, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 6, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 7, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 8, "GrantedAccess"); // DWORD
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 9, "Privileges"); // PPRIVILEGE_SET
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 10, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 11, "AccessGranted"); // WINBOOL
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmA", 12, "GenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 3, "ObjectTypeName"); // LPWSTR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 4, "ObjectName"); // LPWSTR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 5, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 6, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 7, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 8, "GrantedAccess"); // DWORD
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 9, "Privileges"); // PPRIVILEGE_SET
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 10, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 11, "AccessGranted"); // WINBOOL
-	ADD_PARAM_NAME("ObjectOpenAuditAlarmW", 12, "GenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmA", 3, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmA", 4, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmA", 5, "Privileges"); // PPRIVILEGE_SET
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmA", 6, "AccessGranted"); // WINBOOL
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmW", 3, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmW", 4, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmW", 5, "Privileges"); // PPRIVILEGE_SET
-	ADD_PARAM_NAME("ObjectPrivilegeAuditAlarmW", 6, "AccessGranted"); // WINBOOL
-	ADD_PARAM_NAME("OemKeyScan", 1, "wOemChar"); // WORD
-	ADD_PARAM_NAME("OemToCharA", 1, "lpszSrc"); // LPCSTR
-	ADD_PARAM_NAME("OemToCharA", 2, "lpszDst"); // LPSTR
-	ADD_PARAM_NAME("OemToCharBuffA", 1, "lpszSrc"); // LPCSTR
-	ADD_PARAM_NAME("OemToCharBuffA", 2, "lpszDst"); // LPSTR
-	ADD_PARAM_NAME("OemToCharBuffA", 3, "cchDstLength"); // DWORD
-	ADD_PARAM_NAME("OemToCharBuffW", 1, "lpszSrc"); // LPCSTR
-	ADD_PARAM_NAME("OemToCharBuffW", 2, "lpszDst"); // LPWSTR
-	ADD_PARAM_NAME("OemToCharBuffW", 3, "cchDstLength"); // DWORD
-	ADD_PARAM_NAME("OemToCharW", 1, "lpszSrc"); // LPCSTR
-	ADD_PARAM_NAME("OemToCharW", 2, "lpszDst"); // LPWSTR
-	ADD_PARAM_NAME("OffsetClipRgn", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("OffsetClipRgn", 2, "x"); // int
-	ADD_PARAM_NAME("OffsetClipRgn", 3, "y"); // int
-	ADD_PARAM_NAME("OffsetRect", 1, "lprc"); // LPRECT
-	ADD_PARAM_NAME("OffsetRect", 2, "dx"); // int
-	ADD_PARAM_NAME("OffsetRect", 3, "dy"); // int
-	ADD_PARAM_NAME("OffsetRgn", 1, "hrgn"); // HRGN
-	ADD_PARAM_NAME("OffsetRgn", 2, "x"); // int
-	ADD_PARAM_NAME("OffsetRgn", 3, "y"); // int
-	ADD_PARAM_NAME("OffsetViewportOrgEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("OffsetViewportOrgEx", 2, "x"); // int
-	ADD_PARAM_NAME("OffsetViewportOrgEx", 3, "y"); // int
-	ADD_PARAM_NAME("OffsetViewportOrgEx", 4, "lppt"); // LPPOINT
-	ADD_PARAM_NAME("OffsetWindowOrgEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("OffsetWindowOrgEx", 2, "x"); // int
-	ADD_PARAM_NAME("OffsetWindowOrgEx", 3, "y"); // int
-	ADD_PARAM_NAME("OffsetWindowOrgEx", 4, "lppt"); // LPPOINT
-	ADD_PARAM_NAME("OpenBackupEventLogA", 1, "lpUNCServerName"); // LPCSTR
-	ADD_PARAM_NAME("OpenBackupEventLogA", 2, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("OpenBackupEventLogW", 1, "lpUNCServerName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenBackupEventLogW", 2, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenClipboard", 1, "hWndNewOwner"); // HWND
-	ADD_PARAM_NAME("OpenDesktopA", 1, "lpszDesktop"); // LPCSTR
-	ADD_PARAM_NAME("OpenDesktopA", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("OpenDesktopA", 3, "fInherit"); // WINBOOL
-	ADD_PARAM_NAME("OpenDesktopA", 4, "dwDesiredAccess"); // ACCESS_MASK
-	ADD_PARAM_NAME("OpenDesktopW", 1, "lpszDesktop"); // LPCWSTR
-	ADD_PARAM_NAME("OpenDesktopW", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("OpenDesktopW", 3, "fInherit"); // WINBOOL
-	ADD_PARAM_NAME("OpenDesktopW", 4, "dwDesiredAccess"); // ACCESS_MASK
-	ADD_PARAM_NAME("OpenEncryptedFileRawA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("OpenEncryptedFileRawA", 2, "ulFlags"); // ULONG
-	ADD_PARAM_NAME("OpenEncryptedFileRawA", 3, "pvContext"); // PVOID *
-	ADD_PARAM_NAME("OpenEncryptedFileRawW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenEncryptedFileRawW", 2, "ulFlags"); // ULONG
-	ADD_PARAM_NAME("OpenEncryptedFileRawW", 3, "pvContext"); // PVOID *
-	ADD_PARAM_NAME("OpenEventA", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenEventA", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenEventA", 3, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("OpenEventLogA", 1, "lpUNCServerName"); // LPCSTR
-	ADD_PARAM_NAME("OpenEventLogA", 2, "lpSourceName"); // LPCSTR
-	ADD_PARAM_NAME("OpenEventLogW", 1, "lpUNCServerName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenEventLogW", 2, "lpSourceName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenEventW", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenEventW", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenEventW", 3, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenFile", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("OpenFile", 2, "lpReOpenBuff"); // LPOFSTRUCT
-	ADD_PARAM_NAME("OpenFile", 3, "uStyle"); // UINT
-	ADD_PARAM_NAME("OpenFileById", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("OpenFileById", 2, "lpFileID"); // LPFILE_ID_DESCRIPTOR
-	ADD_PARAM_NAME("OpenFileById", 3, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenFileById", 4, "dwShareMode"); // DWORD
-	ADD_PARAM_NAME("OpenFileById", 5, "lpSecurityAttributes"); // LPSECURITY_ATTRIBUTES
-	ADD_PARAM_NAME("OpenFileById", 6, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("OpenFileMappingA", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenFileMappingA", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenFileMappingA", 3, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("OpenFileMappingW", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenFileMappingW", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenFileMappingW", 3, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenIcon", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("OpenInputDesktop", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("OpenInputDesktop", 2, "fInherit"); // WINBOOL
-	ADD_PARAM_NAME("OpenInputDesktop", 3, "dwDesiredAccess"); // ACCESS_MASK
-	ADD_PARAM_NAME("OpenJobObjectA", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenJobObjectA", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenJobObjectA", 3, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("OpenJobObjectW", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenJobObjectW", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenJobObjectW", 3, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenMutexA", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenMutexA", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenMutexA", 3, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("OpenMutexW", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenMutexW", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenMutexW", 3, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenPrinter2A", 1, "pPrinterName"); // LPCSTR
-	ADD_PARAM_NAME("OpenPrinter2A", 2, "phPrinter"); // LPHANDLE
-	ADD_PARAM_NAME("OpenPrinter2A", 3, "pDefault"); // LPPRINTER_DEFAULTS
-	ADD_PARAM_NAME("OpenPrinter2A", 4, "pOptions"); // PPRINTER_OPTIONS
-	ADD_PARAM_NAME("OpenPrinter2W", 1, "pPrinterName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenPrinter2W", 2, "phPrinter"); // LPHANDLE
-	ADD_PARAM_NAME("OpenPrinter2W", 3, "pDefault"); // LPPRINTER_DEFAULTS
-	ADD_PARAM_NAME("OpenPrinter2W", 4, "pOptions"); // PPRINTER_OPTIONS
-	ADD_PARAM_NAME("OpenPrinterA", 1, "pPrinterName"); // LPSTR
-	ADD_PARAM_NAME("OpenPrinterA", 2, "phPrinter"); // LPHANDLE
-	ADD_PARAM_NAME("OpenPrinterA", 3, "pDefault"); // LPPRINTER_DEFAULTSA
-	ADD_PARAM_NAME("OpenPrinterToken", 1, "phToken"); // PHANDLE
-	ADD_PARAM_NAME("OpenPrinterW", 1, "pPrinterName"); // LPWSTR
-	ADD_PARAM_NAME("OpenPrinterW", 2, "phPrinter"); // LPHANDLE
-	ADD_PARAM_NAME("OpenPrinterW", 3, "pDefault"); // LPPRINTER_DEFAULTSW
-	ADD_PARAM_NAME("OpenPrivateNamespaceA", 1, "lpBoundaryDescriptor"); // LPVOID
-	ADD_PARAM_NAME("OpenPrivateNamespaceA", 2, "lpAliasPrefix"); // LPCSTR
-	ADD_PARAM_NAME("OpenPrivateNamespaceW", 1, "lpBoundaryDescriptor"); // LPVOID
-	ADD_PARAM_NAME("OpenPrivateNamespaceW", 2, "lpAliasPrefix"); // LPCWSTR
-	ADD_PARAM_NAME("OpenProcess", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenProcess", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenProcess", 3, "dwProcessId"); // DWORD
-	ADD_PARAM_NAME("OpenProcessToken", 1, "ProcessHandle"); // HANDLE
-	ADD_PARAM_NAME("OpenProcessToken", 2, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenProcessToken", 3, "TokenHandle"); // PHANDLE
-	ADD_PARAM_NAME("OpenSCManagerA", 1, "lpMachineName"); // LPCSTR
-	ADD_PARAM_NAME("OpenSCManagerA", 2, "lpDatabaseName"); // LPCSTR
-	ADD_PARAM_NAME("OpenSCManagerA", 3, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenSCManagerW", 1, "lpMachineName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenSCManagerW", 2, "lpDatabaseName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenSCManagerW", 3, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenSemaphoreA", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenSemaphoreA", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenSemaphoreA", 3, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("OpenSemaphoreW", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenSemaphoreW", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenSemaphoreW", 3, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenServiceA", 1, "hSCManager"); // SC_HANDLE
-	ADD_PARAM_NAME("OpenServiceA", 2, "lpServiceName"); // LPCSTR
-	ADD_PARAM_NAME("OpenServiceA", 3, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenServiceW", 1, "hSCManager"); // SC_HANDLE
-	ADD_PARAM_NAME("OpenServiceW", 2, "lpServiceName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenServiceW", 3, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenThread", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenThread", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenThread", 3, "dwThreadId"); // DWORD
-	ADD_PARAM_NAME("OpenThreadToken", 1, "ThreadHandle"); // HANDLE
-	ADD_PARAM_NAME("OpenThreadToken", 2, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenThreadToken", 3, "OpenAsSelf"); // WINBOOL
-	ADD_PARAM_NAME("OpenThreadToken", 4, "TokenHandle"); // PHANDLE
-	ADD_PARAM_NAME("OpenWaitableTimerA", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenWaitableTimerA", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenWaitableTimerA", 3, "lpTimerName"); // LPCSTR
-	ADD_PARAM_NAME("OpenWaitableTimerW", 1, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("OpenWaitableTimerW", 2, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("OpenWaitableTimerW", 3, "lpTimerName"); // LPCWSTR
-	ADD_PARAM_NAME("OpenWindowStationA", 1, "lpszWinSta"); // LPCSTR
-	ADD_PARAM_NAME("OpenWindowStationA", 2, "fInherit"); // WINBOOL
-	ADD_PARAM_NAME("OpenWindowStationA", 3, "dwDesiredAccess"); // ACCESS_MASK
-	ADD_PARAM_NAME("OpenWindowStationW", 1, "lpszWinSta"); // LPCWSTR
-	ADD_PARAM_NAME("OpenWindowStationW", 2, "fInherit"); // WINBOOL
-	ADD_PARAM_NAME("OpenWindowStationW", 3, "dwDesiredAccess"); // ACCESS_MASK
-	ADD_PARAM_NAME("OutputDebugStringA", 1, "lpOutputString"); // LPCSTR
-	ADD_PARAM_NAME("OutputDebugStringW", 1, "lpOutputString"); // LPCWSTR
+	{"ObjectCloseAuditAlarmA", 1, "SubsystemName"}, // LPCSTR
+	{"ObjectCloseAuditAlarmA", 2, "HandleId"}, // LPVOID
+	{"ObjectCloseAuditAlarmA", 3, "GenerateOnClose"}, // WINBOOL
+	{"ObjectCloseAuditAlarmW", 1, "SubsystemName"}, // LPCWSTR
+	{"ObjectCloseAuditAlarmW", 2, "HandleId"}, // LPVOID
+	{"ObjectCloseAuditAlarmW", 3, "GenerateOnClose"}, // WINBOOL
+	{"ObjectDeleteAuditAlarmA", 1, "SubsystemName"}, // LPCSTR
+	{"ObjectDeleteAuditAlarmA", 2, "HandleId"}, // LPVOID
+	{"ObjectDeleteAuditAlarmA", 3, "GenerateOnClose"}, // WINBOOL
+	{"ObjectDeleteAuditAlarmW", 1, "SubsystemName"}, // LPCWSTR
+	{"ObjectDeleteAuditAlarmW", 2, "HandleId"}, // LPVOID
+	{"ObjectDeleteAuditAlarmW", 3, "GenerateOnClose"}, // WINBOOL
+	{"ObjectOpenAuditAlarmA", 1, "SubsystemName"}, // LPCSTR
+	{"ObjectOpenAuditAlarmA", 2, "HandleId"}, // LPVOID
+	{"ObjectOpenAuditAlarmA", 3, "ObjectTypeName"}, // LPSTR
+	{"ObjectOpenAuditAlarmA", 4, "ObjectName"}, // LPSTR
+	{"ObjectOpenAuditAlarmA", 5, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"ObjectOpenAuditAlarmA", 6, "ClientToken"}, // HANDLE
+	{"ObjectOpenAuditAlarmA", 7, "DesiredAccess"}, // DWORD
+	{"ObjectOpenAuditAlarmA", 8, "GrantedAccess"}, // DWORD
+	{"ObjectOpenAuditAlarmA", 9, "Privileges"}, // PPRIVILEGE_SET
+	{"ObjectOpenAuditAlarmA", 10, "ObjectCreation"}, // WINBOOL
+	{"ObjectOpenAuditAlarmA", 11, "AccessGranted"}, // WINBOOL
+	{"ObjectOpenAuditAlarmA", 12, "GenerateOnClose"}, // LPBOOL
+	{"ObjectOpenAuditAlarmW", 1, "SubsystemName"}, // LPCWSTR
+	{"ObjectOpenAuditAlarmW", 2, "HandleId"}, // LPVOID
+	{"ObjectOpenAuditAlarmW", 3, "ObjectTypeName"}, // LPWSTR
+	{"ObjectOpenAuditAlarmW", 4, "ObjectName"}, // LPWSTR
+	{"ObjectOpenAuditAlarmW", 5, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"ObjectOpenAuditAlarmW", 6, "ClientToken"}, // HANDLE
+	{"ObjectOpenAuditAlarmW", 7, "DesiredAccess"}, // DWORD
+	{"ObjectOpenAuditAlarmW", 8, "GrantedAccess"}, // DWORD
+	{"ObjectOpenAuditAlarmW", 9, "Privileges"}, // PPRIVILEGE_SET
+	{"ObjectOpenAuditAlarmW", 10, "ObjectCreation"}, // WINBOOL
+	{"ObjectOpenAuditAlarmW", 11, "AccessGranted"}, // WINBOOL
+	{"ObjectOpenAuditAlarmW", 12, "GenerateOnClose"}, // LPBOOL
+	{"ObjectPrivilegeAuditAlarmA", 1, "SubsystemName"}, // LPCSTR
+	{"ObjectPrivilegeAuditAlarmA", 2, "HandleId"}, // LPVOID
+	{"ObjectPrivilegeAuditAlarmA", 3, "ClientToken"}, // HANDLE
+	{"ObjectPrivilegeAuditAlarmA", 4, "DesiredAccess"}, // DWORD
+	{"ObjectPrivilegeAuditAlarmA", 5, "Privileges"}, // PPRIVILEGE_SET
+	{"ObjectPrivilegeAuditAlarmA", 6, "AccessGranted"}, // WINBOOL
+	{"ObjectPrivilegeAuditAlarmW", 1, "SubsystemName"}, // LPCWSTR
+	{"ObjectPrivilegeAuditAlarmW", 2, "HandleId"}, // LPVOID
+	{"ObjectPrivilegeAuditAlarmW", 3, "ClientToken"}, // HANDLE
+	{"ObjectPrivilegeAuditAlarmW", 4, "DesiredAccess"}, // DWORD
+	{"ObjectPrivilegeAuditAlarmW", 5, "Privileges"}, // PPRIVILEGE_SET
+	{"ObjectPrivilegeAuditAlarmW", 6, "AccessGranted"}, // WINBOOL
+	{"OemKeyScan", 1, "wOemChar"}, // WORD
+	{"OemToCharA", 1, "lpszSrc"}, // LPCSTR
+	{"OemToCharA", 2, "lpszDst"}, // LPSTR
+	{"OemToCharBuffA", 1, "lpszSrc"}, // LPCSTR
+	{"OemToCharBuffA", 2, "lpszDst"}, // LPSTR
+	{"OemToCharBuffA", 3, "cchDstLength"}, // DWORD
+	{"OemToCharBuffW", 1, "lpszSrc"}, // LPCSTR
+	{"OemToCharBuffW", 2, "lpszDst"}, // LPWSTR
+	{"OemToCharBuffW", 3, "cchDstLength"}, // DWORD
+	{"OemToCharW", 1, "lpszSrc"}, // LPCSTR
+	{"OemToCharW", 2, "lpszDst"}, // LPWSTR
+	{"OffsetClipRgn", 1, "hdc"}, // HDC
+	{"OffsetClipRgn", 2, "x"}, // int
+	{"OffsetClipRgn", 3, "y"}, // int
+	{"OffsetRect", 1, "lprc"}, // LPRECT
+	{"OffsetRect", 2, "dx"}, // int
+	{"OffsetRect", 3, "dy"}, // int
+	{"OffsetRgn", 1, "hrgn"}, // HRGN
+	{"OffsetRgn", 2, "x"}, // int
+	{"OffsetRgn", 3, "y"}, // int
+	{"OffsetViewportOrgEx", 1, "hdc"}, // HDC
+	{"OffsetViewportOrgEx", 2, "x"}, // int
+	{"OffsetViewportOrgEx", 3, "y"}, // int
+	{"OffsetViewportOrgEx", 4, "lppt"}, // LPPOINT
+	{"OffsetWindowOrgEx", 1, "hdc"}, // HDC
+	{"OffsetWindowOrgEx", 2, "x"}, // int
+	{"OffsetWindowOrgEx", 3, "y"}, // int
+	{"OffsetWindowOrgEx", 4, "lppt"}, // LPPOINT
+	{"OpenBackupEventLogA", 1, "lpUNCServerName"}, // LPCSTR
+	{"OpenBackupEventLogA", 2, "lpFileName"}, // LPCSTR
+	{"OpenBackupEventLogW", 1, "lpUNCServerName"}, // LPCWSTR
+	{"OpenBackupEventLogW", 2, "lpFileName"}, // LPCWSTR
+	{"OpenClipboard", 1, "hWndNewOwner"}, // HWND
+	{"OpenDesktopA", 1, "lpszDesktop"}, // LPCSTR
+	{"OpenDesktopA", 2, "dwFlags"}, // DWORD
+	{"OpenDesktopA", 3, "fInherit"}, // WINBOOL
+	{"OpenDesktopA", 4, "dwDesiredAccess"}, // ACCESS_MASK
+	{"OpenDesktopW", 1, "lpszDesktop"}, // LPCWSTR
+	{"OpenDesktopW", 2, "dwFlags"}, // DWORD
+	{"OpenDesktopW", 3, "fInherit"}, // WINBOOL
+	{"OpenDesktopW", 4, "dwDesiredAccess"}, // ACCESS_MASK
+	{"OpenEncryptedFileRawA", 1, "lpFileName"}, // LPCSTR
+	{"OpenEncryptedFileRawA", 2, "ulFlags"}, // ULONG
+	{"OpenEncryptedFileRawA", 3, "pvContext"}, // PVOID *
+	{"OpenEncryptedFileRawW", 1, "lpFileName"}, // LPCWSTR
+	{"OpenEncryptedFileRawW", 2, "ulFlags"}, // ULONG
+	{"OpenEncryptedFileRawW", 3, "pvContext"}, // PVOID *
+	{"OpenEventA", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenEventA", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenEventA", 3, "lpName"}, // LPCSTR
+	{"OpenEventLogA", 1, "lpUNCServerName"}, // LPCSTR
+	{"OpenEventLogA", 2, "lpSourceName"}, // LPCSTR
+	{"OpenEventLogW", 1, "lpUNCServerName"}, // LPCWSTR
+	{"OpenEventLogW", 2, "lpSourceName"}, // LPCWSTR
+	{"OpenEventW", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenEventW", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenEventW", 3, "lpName"}, // LPCWSTR
+	{"OpenFile", 1, "lpFileName"}, // LPCSTR
+	{"OpenFile", 2, "lpReOpenBuff"}, // LPOFSTRUCT
+	{"OpenFile", 3, "uStyle"}, // UINT
+	{"OpenFileById", 1, "hFile"}, // HANDLE
+	{"OpenFileById", 2, "lpFileID"}, // LPFILE_ID_DESCRIPTOR
+	{"OpenFileById", 3, "dwDesiredAccess"}, // DWORD
+	{"OpenFileById", 4, "dwShareMode"}, // DWORD
+	{"OpenFileById", 5, "lpSecurityAttributes"}, // LPSECURITY_ATTRIBUTES
+	{"OpenFileById", 6, "dwFlags"}, // DWORD
+	{"OpenFileMappingA", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenFileMappingA", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenFileMappingA", 3, "lpName"}, // LPCSTR
+	{"OpenFileMappingW", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenFileMappingW", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenFileMappingW", 3, "lpName"}, // LPCWSTR
+	{"OpenIcon", 1, "hWnd"}, // HWND
+	{"OpenInputDesktop", 1, "dwFlags"}, // DWORD
+	{"OpenInputDesktop", 2, "fInherit"}, // WINBOOL
+	{"OpenInputDesktop", 3, "dwDesiredAccess"}, // ACCESS_MASK
+	{"OpenJobObjectA", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenJobObjectA", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenJobObjectA", 3, "lpName"}, // LPCSTR
+	{"OpenJobObjectW", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenJobObjectW", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenJobObjectW", 3, "lpName"}, // LPCWSTR
+	{"OpenMutexA", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenMutexA", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenMutexA", 3, "lpName"}, // LPCSTR
+	{"OpenMutexW", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenMutexW", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenMutexW", 3, "lpName"}, // LPCWSTR
+	{"OpenPrinter2A", 1, "pPrinterName"}, // LPCSTR
+	{"OpenPrinter2A", 2, "phPrinter"}, // LPHANDLE
+	{"OpenPrinter2A", 3, "pDefault"}, // LPPRINTER_DEFAULTS
+	{"OpenPrinter2A", 4, "pOptions"}, // PPRINTER_OPTIONS
+	{"OpenPrinter2W", 1, "pPrinterName"}, // LPCWSTR
+	{"OpenPrinter2W", 2, "phPrinter"}, // LPHANDLE
+	{"OpenPrinter2W", 3, "pDefault"}, // LPPRINTER_DEFAULTS
+	{"OpenPrinter2W", 4, "pOptions"}, // PPRINTER_OPTIONS
+	{"OpenPrinterA", 1, "pPrinterName"}, // LPSTR
+	{"OpenPrinterA", 2, "phPrinter"}, // LPHANDLE
+	{"OpenPrinterA", 3, "pDefault"}, // LPPRINTER_DEFAULTSA
+	{"OpenPrinterToken", 1, "phToken"}, // PHANDLE
+	{"OpenPrinterW", 1, "pPrinterName"}, // LPWSTR
+	{"OpenPrinterW", 2, "phPrinter"}, // LPHANDLE
+	{"OpenPrinterW", 3, "pDefault"}, // LPPRINTER_DEFAULTSW
+	{"OpenPrivateNamespaceA", 1, "lpBoundaryDescriptor"}, // LPVOID
+	{"OpenPrivateNamespaceA", 2, "lpAliasPrefix"}, // LPCSTR
+	{"OpenPrivateNamespaceW", 1, "lpBoundaryDescriptor"}, // LPVOID
+	{"OpenPrivateNamespaceW", 2, "lpAliasPrefix"}, // LPCWSTR
+	{"OpenProcess", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenProcess", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenProcess", 3, "dwProcessId"}, // DWORD
+	{"OpenProcessToken", 1, "ProcessHandle"}, // HANDLE
+	{"OpenProcessToken", 2, "DesiredAccess"}, // DWORD
+	{"OpenProcessToken", 3, "TokenHandle"}, // PHANDLE
+	{"OpenSCManagerA", 1, "lpMachineName"}, // LPCSTR
+	{"OpenSCManagerA", 2, "lpDatabaseName"}, // LPCSTR
+	{"OpenSCManagerA", 3, "dwDesiredAccess"}, // DWORD
+	{"OpenSCManagerW", 1, "lpMachineName"}, // LPCWSTR
+	{"OpenSCManagerW", 2, "lpDatabaseName"}, // LPCWSTR
+	{"OpenSCManagerW", 3, "dwDesiredAccess"}, // DWORD
+	{"OpenSemaphoreA", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenSemaphoreA", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenSemaphoreA", 3, "lpName"}, // LPCSTR
+	{"OpenSemaphoreW", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenSemaphoreW", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenSemaphoreW", 3, "lpName"}, // LPCWSTR
+	{"OpenServiceA", 1, "hSCManager"}, // SC_HANDLE
+	{"OpenServiceA", 2, "lpServiceName"}, // LPCSTR
+	{"OpenServiceA", 3, "dwDesiredAccess"}, // DWORD
+	{"OpenServiceW", 1, "hSCManager"}, // SC_HANDLE
+	{"OpenServiceW", 2, "lpServiceName"}, // LPCWSTR
+	{"OpenServiceW", 3, "dwDesiredAccess"}, // DWORD
+	{"OpenThread", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenThread", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenThread", 3, "dwThreadId"}, // DWORD
+	{"OpenThreadToken", 1, "ThreadHandle"}, // HANDLE
+	{"OpenThreadToken", 2, "DesiredAccess"}, // DWORD
+	{"OpenThreadToken", 3, "OpenAsSelf"}, // WINBOOL
+	{"OpenThreadToken", 4, "TokenHandle"}, // PHANDLE
+	{"OpenWaitableTimerA", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenWaitableTimerA", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenWaitableTimerA", 3, "lpTimerName"}, // LPCSTR
+	{"OpenWaitableTimerW", 1, "dwDesiredAccess"}, // DWORD
+	{"OpenWaitableTimerW", 2, "bInheritHandle"}, // WINBOOL
+	{"OpenWaitableTimerW", 3, "lpTimerName"}, // LPCWSTR
+	{"OpenWindowStationA", 1, "lpszWinSta"}, // LPCSTR
+	{"OpenWindowStationA", 2, "fInherit"}, // WINBOOL
+	{"OpenWindowStationA", 3, "dwDesiredAccess"}, // ACCESS_MASK
+	{"OpenWindowStationW", 1, "lpszWinSta"}, // LPCWSTR
+	{"OpenWindowStationW", 2, "fInherit"}, // WINBOOL
+	{"OpenWindowStationW", 3, "dwDesiredAccess"}, // ACCESS_MASK
+	{"OutputDebugStringA", 1, "lpOutputString"}, // LPCSTR
+	{"OutputDebugStringW", 1, "lpOutputString"}, // LPCWSTR
+};
+
+/// Mapping of function parameter positions into the names of parameters.
+constexpr ConstHashTable<FuncParamName, arraySize(FUNC_PARAM_NAMES)>
+	FUNC_PARAM_NAMES_MAP(FUNC_PARAM_NAMES);
+
+} // anonymous namespace
+
+/**
+* @brief Finds the name of the parameter given by @a key of functions starting
+*        with O.
+*/
+const FuncParamName *findFuncParamName_O(const FuncParamName &key) {
+	return FUNC_PARAM_NAMES_MAP.find(key);
 }
 
 } // namespace win_api
@@ -7,6 +7,9 @@
 
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_var_storing_result.h"
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_var_storing_result.h"
+#include "retdec/utils/array.h"
+
+using retdec::utils::arraySize;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -15,13 +18,8 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncVarNameMap() {
-	static StringStringUMap m;
-
+/// Function names and the names of variables storing their results.
+constexpr StringStringEntry FUNC_VAR_NAMES[] = {
 	// The following list is based on
 	//
 	//     - MSDN database (http://msdn.microsoft.com/en-US/windows/)
@@ -30,60 +28,59 @@ const StringStringUMap &initFuncVarNameMap() {
 	// find a function which is missing, please, add it.
 
 	// windows.h
-	m["ClientToScreen"] = "clientToScreenSuccess";
-	m["CloseHandle"] = "handleClosed";
-	m["CopyFile"] = "copyFileSuccess";
-	m["CopyFileA"] = "copyFileSuccess";
-	m["CreateFile"] = "fileHandle";
-	m["CreateFileA"] = "fileHandle";
-	m["CreateThread"] = "threadHandle";
-	m["CreateWindowEx"] = "windowHandle";
-	m["CreateWindowExA"] = "windowHandle";
-	m["EqualRect"] = "equalRect";
-	m["GetActiveWindow"] = "windowHandle";
-	m["GetBkColor"] = "color";
-	m["GetBkMode"] = "mode";
-	m["GetCommandLine"] = "commandLine";
-	m["GetCommandLineA"] = "commandLine";
-	m["GetCurrentProcess"] = "processHandle";
-	m["GetCurrentProcessId"] = "processId";
-	m["GetCurrentThread"] = "threadHandle";
-	m["GetCurrentThreadId"] = "threadId";
-	m["GetDriveType"] = "driveType";
-	m["GetDriveTypeA"] = "driveType";
-	m["GetFocus"] = "windowHandle";
-	m["GetForegroundWindow"] = "windowHandle";
-	m["GetLastError"] = "errorCode";
-	m["GetLogicalDrives"] = "availDiskDrives";
-	m["GetModuleFileName"] = "nameSize";
-	m["GetModuleFileNameA"] = "nameSize";
-	m["GetModuleHandle"] = "moduleHandle";
-	m["GetModuleHandleA"] = "moduleHandle";
-	m["GetProcAddress"] = "func";
-	m["GetSystemDefaultLangID"] = "langId";
-	m["GetTempPath"] = "pathSize";
-	m["GetTempPathA"] = "pathSize";
-	m["GetThreadPriority"] = "threadPriority";
-	m["IsValidCodePage"] = "validCodePage";
-	m["IsWindowVisible"] = "isVisible";
-	m["LoadCursor"] = "cursorHandle";
-	m["LoadCursorA"] = "cursorHandle";
-	m["LoadIcon"] = "iconHandle";
-	m["LoadIconA"] = "iconHandle";
-	m["LoadLibrary"] = "moduleHandle";
-	m["LoadLibraryA"] = "moduleHandle";
-	m["LocalAlloc"] = "memoryHandle";
-	m["RegisterClassEx"] = "classAtom";
-	m["RegisterClassExA"] = "classAtom";
-	m["SetTimer"] = "timerId";
-	m["SetUnhandledExceptionFilter"] = "prevExceptionFilter";
-	m["VirtualAlloc"] = "memory";
-
-	return m;
-}
+	{"ClientToScreen", "clientToScreenSuccess"},
+	{"CloseHandle", "handleClosed"},
+	{"CopyFile", "copyFileSuccess"},
+	{"CopyFileA", "copyFileSuccess"},
+	{"CreateFile", "fileHandle"},
+	{"CreateFileA", "fileHandle"},
+	{"CreateThread", "threadHandle"},
+	{"CreateWindowEx", "windowHandle"},
+	{"CreateWindowExA", "windowHandle"},
+	{"EqualRect", "equalRect"},
+	{"GetActiveWindow", "windowHandle"},
+	{"GetBkColor", "color"},
+	{"GetBkMode", "mode"},
+	{"GetCommandLine", "commandLine"},
+	{"GetCommandLineA", "commandLine"},
+	{"GetCurrentProcess", "processHandle"},
+	{"GetCurrentProcessId", "processId"},
+	{"GetCurrentThread", "threadHandle"},
+	{"GetCurrentThreadId", "threadId"},
+	{"GetDriveType", "driveType"},
+	{"GetDriveTypeA", "driveType"},
+	{"GetFocus", "windowHandle"},
+	{"GetForegroundWindow", "windowHandle"},
+	{"GetLastError", "errorCode"},
+	{"GetLogicalDrives", "availDiskDrives"},
+	{"GetModuleFileName", "nameSize"},
+	{"GetModuleFileNameA", "nameSize"},
+	{"GetModuleHandle", "moduleHandle"},
+	{"GetModuleHandleA", "moduleHandle"},
+	{"GetProcAddress", "func"},
+	{"GetSystemDefaultLangID", "langId"},
+	{"GetTempPath", "pathSize"},
+	{"GetTempPathA", "pathSize"},
+	{"GetThreadPriority", "threadPriority"},
+	{"IsValidCodePage", "validCodePage"},
+	{"IsWindowVisible", "isVisible"},
+	{"LoadCursor", "cursorHandle"},
+	{"LoadCursorA", "cursorHandle"},
+	{"LoadIcon", "iconHandle"},
+	{"LoadIconA", "iconHandle"},
+	{"LoadLibrary", "moduleHandle"},
+	{"LoadLibraryA", "moduleHandle"},
+	{"LocalAlloc", "memoryHandle"},
+	{"RegisterClassEx", "classAtom"},
+	{"RegisterClassExA", "classAtom"},
+	{"SetTimer", "timerId"},
+	{"SetUnhandledExceptionFilter", "prevExceptionFilter"},
+	{"VirtualAlloc", "memory"},
+};
 
 /// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+constexpr ConstHashTable<StringStringEntry, arraySize(FUNC_VAR_NAMES)>
+	FUNC_VAR_NAME_MAP(FUNC_VAR_NAMES);
 
 } // anonymous namespace
 
@@ -93,7 +90,7 @@ const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 * See its description for more details.
 */
 Maybe<std::string> getNameOfVarStoringResult(const std::string &funcName) {
-	return getNameOfVarStoringResultFromMap(funcName, FUNC_VAR_NAME_MAP);
+	return getNameOfVarStoringResultFromTable(funcName, FUNC_VAR_NAME_MAP);
 }
 
 } // namespace win_api
@@ -16,10 +16,11 @@ namespace win_api {
 namespace {
 
 /**
-* @brief This function is used to initialize FUNC_PARAMS_MAP later in the file.
+* @brief This function is used to create the mapping returned by
+*        getFuncParamsMap().
 */
-const FuncParamsMap &initFuncParamsMap() {
-	static FuncParamsMap funcParamsMap;
+FuncParamsMap createFuncParamsMap() {
+	FuncParamsMap funcParamsMap;
 
 	// Temporary maps used to store the symbols for the current parameter of
 	// the current function. In this way, we don't have to keep separate maps
@@ -85,8 +86,17 @@ const FuncParamsMap &initFuncParamsMap() {
 	return funcParamsMap;
 }
 
-/// Mapping of function names into symbolic names of their parameters.
-const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
+/**
+* @brief Returns the mapping of function names into symbolic names of their
+*        parameters.
+*
+* The mapping is created when it is needed for the first time, so it does not
+* slow down the start of the program.
+*/
+const FuncParamsMap &getFuncParamsMap() {
+	static const FuncParamsMap funcParamsMap(createFuncParamsMap());
+	return funcParamsMap;
+}
 
 } // anonymous namespace
 
@@ -97,7 +107,7 @@ const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
 */
 Maybe<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getSymbolicNamesForParamFromMap(funcName, paramPos, FUNC_PARAMS_MAP);
+	return getSymbolicNamesForParamFromMap(funcName, paramPos, getFuncParamsMap());
 }
 
 } // namespace win_api
@@ -7,6 +7,7 @@
 #include "retdec/llvmir2hll/analysis/goto_target_analysis.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
 #include "retdec/llvmir2hll/ir/empty_stmt.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
@@ -26,8 +27,14 @@ namespace llvmir2hll {
 *
 * See removeCode() for the description of all parameters and preconditions.
 */
-UnreachableCodeInCFGRemover::UnreachableCodeInCFGRemover(ShPtr<Module> module):
-	module(module), cfg(), cfgBuilder(NonRecursiveCFGBuilder::create()) {}
+UnreachableCodeInCFGRemover::UnreachableCodeInCFGRemover(ShPtr<Module> module,
+		ShPtr<CFGCache> cfgCache):
+	module(module), cfg(), cfgCache(cfgCache) {
+	// If we don't have a cache of CFGs, create one.
+	if (!this->cfgCache) {
+		this->cfgCache = CFGCache::create(NonRecursiveCFGBuilder::create());
+	}
+}
 
 /**
 * @brief Destructs the remover.
@@ -39,6 +46,11 @@ UnreachableCodeInCFGRemover::~UnreachableCodeInCFGRemover() {}
 *        in the CFG.
 *
 * @param[in,out] module Module in which the code is to be removed.
+* @param[in] cfgCache Cache from which CFGs of the functions are obtained.
+*
+* If @a cfgCache is not provided, a new cache is created. If it is provided,
+* it keeps the CFGs of the functions from which nothing has been removed, so
+* they do not have to be built again by other users of the cache.
 *
 * For example, the last return in the following piece of code can be removed:
 * @code
@@ -58,11 +70,12 @@ UnreachableCodeInCFGRemover::~UnreachableCodeInCFGRemover() {}
 * @par Preconditions
 *  - @a module is non-null
 */
-void UnreachableCodeInCFGRemover::removeCode(ShPtr<Module> module) {
+void UnreachableCodeInCFGRemover::removeCode(ShPtr<Module> module,
+		ShPtr<CFGCache> cfgCache) {
 	PRECONDITION_NON_NULL(module);
 
 	ShPtr<UnreachableCodeInCFGRemover> remover(new UnreachableCodeInCFGRemover(
-		module));
+		module, cfgCache));
 	remover->performRemoval();
 }
 
@@ -82,7 +95,7 @@ void UnreachableCodeInCFGRemover::performRemoval() {
 * @brief Performs the removal of code in the given function.
 */
 void UnreachableCodeInCFGRemover::performRemovalInFunc(ShPtr<Function> func) {
-	cfg = cfgBuilder->getCFG(func);
+	cfg = cfgCache->getCFG(func);
 
 	ShPtr<Statement> body(func->getBody());
 	if (!skipEmptyStmts(body)) {
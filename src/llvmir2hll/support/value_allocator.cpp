@@ -0,0 +1,365 @@
+/**
+* @file src/llvmir2hll/support/value_allocator.cpp
+* @brief Implementation of ValueAllocator.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "retdec/llvmir2hll/support/value_allocator.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/// Sizes of blocks are multiples of this number.
+constexpr std::size_t BLOCK_GRANULARITY = 16;
+
+/// Size of the largest pooled block.
+constexpr std::size_t MAX_POOLED_SIZE = 512;
+
+/// Number of different sizes of blocks.
+constexpr std::size_t NUM_OF_SIZE_CLASSES = MAX_POOLED_SIZE / BLOCK_GRANULARITY;
+
+/// Size of a slab that is split into blocks.
+constexpr std::size_t SLAB_SIZE = 16 * 1024;
+
+/**
+* @brief A free block.
+*/
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+/**
+* @brief Free blocks that are not owned by any thread.
+*/
+struct GlobalPool {
+	std::mutex mutex;
+	FreeBlock *freeBlocks[NUM_OF_SIZE_CLASSES] = {};
+	/// All allocated slabs of every size class.
+	std::vector<char *> slabs[NUM_OF_SIZE_CLASSES];
+};
+
+/**
+* @brief Free blocks owned by a thread.
+*
+* The structure is trivially destructible, so it can be used even after the
+* thread's free blocks have been released (e.g. when static objects holding
+* values are destroyed).
+*/
+struct ThreadCache {
+	FreeBlock *freeBlocks[NUM_OF_SIZE_CLASSES];
+	bool releaserRegistered;
+	bool released;
+};
+
+thread_local ThreadCache threadCache;
+
+/**
+* @brief Returns the pool of free blocks that are not owned by any thread.
+*/
+GlobalPool &getGlobalPool() {
+	// The pool is never destroyed because values may be freed during the
+	// destruction of static objects.
+	static GlobalPool *pool = new GlobalPool();
+	return *pool;
+}
+
+/**
+* @brief Returns the index of the list of free blocks for values of the given
+*        size.
+*/
+std::size_t getSizeClass(std::size_t size) {
+	return size == 0 ? 0 : (size - 1) / BLOCK_GRANULARITY;
+}
+
+/**
+* @brief Returns the size of blocks of the given size class.
+*/
+std::size_t getBlockSize(std::size_t sizeClass) {
+	return (sizeClass + 1) * BLOCK_GRANULARITY;
+}
+
+/**
+* @brief Returns the number of blocks in a slab of the given size class.
+*/
+std::size_t getNumOfBlocksInSlab(std::size_t sizeClass) {
+	return SLAB_SIZE / getBlockSize(sizeClass);
+}
+
+/**
+* @brief Allocates a new slab of the given size class, registers it in the
+*        global pool, and splits it into blocks.
+*
+* The mutex of the pool has to be locked.
+*
+* @return The first block of the list of created blocks.
+*/
+FreeBlock *allocateSlab(GlobalPool &pool, std::size_t sizeClass) {
+	const std::size_t blockSize = getBlockSize(sizeClass);
+	const std::size_t numOfBlocks = getNumOfBlocksInSlab(sizeClass);
+	char *slab = static_cast<char *>(::operator new(numOfBlocks * blockSize));
+	try {
+		pool.slabs[sizeClass].push_back(slab);
+	} catch (...) {
+		::operator delete(slab);
+		throw;
+	}
+
+	FreeBlock *first = nullptr;
+	for (std::size_t i = numOfBlocks; i > 0; --i) {
+		auto block = reinterpret_cast<FreeBlock *>(slab + (i - 1) * blockSize);
+		block->next = first;
+		first = block;
+	}
+	return first;
+}
+
+/**
+* @brief Returns the index of the slab containing the given block.
+*
+* @a slabs have to be sorted.
+*/
+std::size_t getSlabIndex(const std::vector<char *> &slabs,
+		const FreeBlock *block) {
+	auto it = std::upper_bound(slabs.begin(), slabs.end(),
+		reinterpret_cast<const char *>(block), std::less<const char *>());
+	return it - slabs.begin() - 1;
+}
+
+/**
+* @brief Frees slabs of the given size class all of whose blocks are in the
+*        global pool.
+*
+* The mutex of the pool has to be locked. Blocks owned by threads are not
+* considered free, so slabs containing them are kept.
+*/
+void releaseEmptySlabs(GlobalPool &pool, std::size_t sizeClass) noexcept {
+	std::vector<char *> &slabs = pool.slabs[sizeClass];
+	FreeBlock *&freeBlocks = pool.freeBlocks[sizeClass];
+	if (slabs.empty() || !freeBlocks) {
+		return;
+	}
+
+	std::sort(slabs.begin(), slabs.end(), std::less<const char *>());
+	std::vector<std::size_t> numOfFreeBlocks;
+	try {
+		numOfFreeBlocks.resize(slabs.size());
+	} catch (const std::bad_alloc &) {
+		// Nothing is released, which is still correct.
+		return;
+	}
+	for (FreeBlock *block = freeBlocks; block; block = block->next) {
+		++numOfFreeBlocks[getSlabIndex(slabs, block)];
+	}
+
+	// Unlink the blocks of empty slabs from the list of free blocks.
+	const std::size_t numOfBlocks = getNumOfBlocksInSlab(sizeClass);
+	FreeBlock **link = &freeBlocks;
+	while (*link) {
+		if (numOfFreeBlocks[getSlabIndex(slabs, *link)] == numOfBlocks) {
+			*link = (*link)->next;
+		} else {
+			link = &(*link)->next;
+		}
+	}
+
+	std::size_t numOfKeptSlabs = 0;
+	for (std::size_t i = 0; i < slabs.size(); ++i) {
+		if (numOfFreeBlocks[i] == numOfBlocks) {
+			::operator delete(slabs[i]);
+		} else {
+			slabs[numOfKeptSlabs++] = slabs[i];
+		}
+	}
+	slabs.resize(numOfKeptSlabs);
+}
+
+/**
+* @brief Hands over all free blocks of the given thread cache to the global
+*        pool.
+*/
+void moveToGlobalPool(ThreadCache &cache) {
+	GlobalPool &pool = getGlobalPool();
+	for (std::size_t i = 0; i < NUM_OF_SIZE_CLASSES; ++i) {
+		FreeBlock *first = cache.freeBlocks[i];
+		if (!first) {
+			continue;
+		}
+
+		FreeBlock *last = first;
+		while (last->next) {
+			last = last->next;
+		}
+
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		last->next = pool.freeBlocks[i];
+		pool.freeBlocks[i] = first;
+		cache.freeBlocks[i] = nullptr;
+	}
+}
+
+/**
+* @brief Hands over all free blocks of the current thread to the global pool
+*        for good.
+*/
+void releaseThreadCache() {
+	ThreadCache &cache = threadCache;
+	moveToGlobalPool(cache);
+	cache.released = true;
+}
+
+/**
+* @brief Releases free blocks of a thread when the thread finishes.
+*/
+struct ThreadCacheReleaser {
+	~ThreadCacheReleaser() {
+		releaseThreadCache();
+	}
+};
+
+/**
+* @brief Returns the free blocks of the current thread.
+*/
+ThreadCache &getThreadCache() {
+	ThreadCache &cache = threadCache;
+	if (!cache.releaserRegistered) {
+		static thread_local ThreadCacheReleaser releaser;
+		static_cast<void>(releaser);
+		cache.releaserRegistered = true;
+	}
+	return cache;
+}
+
+/**
+* @brief Returns a list of free blocks of the given size class from the global
+*        pool, allocating a new slab if there are none.
+*
+* If @a takeAll is @c true, all the free blocks are taken from the pool.
+* Otherwise, just the first one is taken.
+*/
+FreeBlock *takeFromGlobalPool(std::size_t sizeClass, bool takeAll) {
+	GlobalPool &pool = getGlobalPool();
+	std::lock_guard<std::mutex> lock(pool.mutex);
+	FreeBlock *&freeBlocks = pool.freeBlocks[sizeClass];
+	if (!freeBlocks) {
+		freeBlocks = allocateSlab(pool, sizeClass);
+	}
+
+	FreeBlock *first = freeBlocks;
+	if (takeAll) {
+		freeBlocks = nullptr;
+	} else {
+		freeBlocks = first->next;
+		first->next = nullptr;
+	}
+	return first;
+}
+
+} // anonymous namespace
+
+/**
+* @brief Allocates memory for a value of the given size.
+*
+* @throws std::bad_alloc When there is not enough memory.
+*/
+void *ValueAllocator::allocate(std::size_t size) {
+	if (size > MAX_POOLED_SIZE) {
+		return ::operator new(size);
+	}
+
+	std::size_t sizeClass = getSizeClass(size);
+	ThreadCache &cache = getThreadCache();
+	if (cache.released) {
+		return takeFromGlobalPool(sizeClass, false);
+	}
+
+	FreeBlock *&freeBlocks = cache.freeBlocks[sizeClass];
+	if (!freeBlocks) {
+		freeBlocks = takeFromGlobalPool(sizeClass, true);
+	}
+	FreeBlock *block = freeBlocks;
+	freeBlocks = block->next;
+	return block;
+}
+
+/**
+* @brief Frees memory of a value.
+*
+* @param[in] ptr Memory returned by allocate().
+* @param[in] size The size passed to allocate().
+*/
+void ValueAllocator::deallocate(void *ptr, std::size_t size) noexcept {
+	if (!ptr) {
+		return;
+	}
+
+	if (size > MAX_POOLED_SIZE) {
+		::operator delete(ptr);
+		return;
+	}
+
+	auto block = static_cast<FreeBlock *>(ptr);
+	std::size_t sizeClass = getSizeClass(size);
+	ThreadCache &cache = getThreadCache();
+	if (cache.released) {
+		GlobalPool &pool = getGlobalPool();
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		block->next = pool.freeBlocks[sizeClass];
+		pool.freeBlocks[sizeClass] = block;
+		return;
+	}
+
+	block->next = cache.freeBlocks[sizeClass];
+	cache.freeBlocks[sizeClass] = block;
+}
+
+/**
+* @brief Returns memory of slabs that contain no values to the system.
+*
+* Free blocks of the current thread are handed over to the global pool first.
+* Free blocks of other running threads stay with them, so slabs containing
+* such blocks are not returned. Call this when a lot of values have been
+* freed, e.g. when a module has been destroyed.
+*/
+void ValueAllocator::releaseUnusedMemory() noexcept {
+	ThreadCache &cache = getThreadCache();
+	if (!cache.released) {
+		moveToGlobalPool(cache);
+	}
+
+	GlobalPool &pool = getGlobalPool();
+	std::lock_guard<std::mutex> lock(pool.mutex);
+	for (std::size_t i = 0; i < NUM_OF_SIZE_CLASSES; ++i) {
+		releaseEmptySlabs(pool, i);
+	}
+}
+
+/**
+* @brief Returns the number of slabs from which blocks are allocated.
+*/
+std::size_t ValueAllocator::getNumOfSlabs() {
+	GlobalPool &pool = getGlobalPool();
+	std::lock_guard<std::mutex> lock(pool.mutex);
+	std::size_t numOfSlabs = 0;
+	for (auto &slabs : pool.slabs) {
+		numOfSlabs += slabs.size();
+	}
+	return numOfSlabs;
+}
+
+/**
+* @brief Returns the size of the largest values whose memory is pooled.
+*/
+std::size_t ValueAllocator::getMaxPooledSize() {
+	return MAX_POOLED_SIZE;
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
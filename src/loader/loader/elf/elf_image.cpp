@@ -64,6 +64,7 @@ bool ElfImage::load()
 
 	// Fix sizes of BSS segments after we have loaded and sorted everything
 	fixBssSegments();
+	invalidateSegmentIndex();
 
 	return true;
 }
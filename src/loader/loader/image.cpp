@@ -4,8 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <climits>
 #include <cstring>
+#include <map>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
@@ -18,7 +20,8 @@ namespace retdec {
 namespace loader {
 
 Image::Image(const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat) : _fileFormat(fileFormat), _segments(),
-	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage()
+	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage(), _segmentIndex(), _segmentIndexValid(false),
+	_segmentIndexMutex(), _lastSegmentIndexHit(0)
 {
 }
 
@@ -334,19 +337,15 @@ std::pair<const std::uint8_t*, std::uint64_t> Image::getRawSegmentData(std::uint
  */
 bool Image::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t& res, Endianness e/* = UNKNOWN*/) const
 {
-	const auto *seg = getSegmentFromAddress(address);
-	if (!seg || x * getByteLength() > sizeof(res) * CHAR_BIT)
-	{
-		return false;
-	}
+	if (e == Endianness::UNKNOWN)
+		e = getEndianness();
 
-	std::vector<std::uint8_t> data;
-	if (!seg->getBytes(data, address - seg->getAddress(), x) || data.size() != x)
-	{
+	if (e == Endianness::LITTLE)
+		return getXByteImpl<Endianness::LITTLE>(address, x, res);
+	else if (e == Endianness::BIG)
+		return getXByteImpl<Endianness::BIG>(address, x, res);
+	else
 		return false;
-	}
-
-	return createValueFromBytes(data, res, e);
 }
 
 /**
@@ -442,6 +441,7 @@ const retdec::fileformat::LoaderErrorInfo & Image::getLoaderErrorInfo() const
 Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 {
 	_segments.push_back(std::move(segment));
+	invalidateSegmentIndex();
 
 	// We have used move constructor, segment is no longer valid pointer
 	// Now give segment name
@@ -457,6 +457,7 @@ void Image::removeSegment(Segment* segment)
 		if (itr->get() == segment)
 		{
 			_segments.erase(itr);
+			invalidateSegmentIndex();
 			return;
 		}
 	}
@@ -476,6 +477,123 @@ void Image::sortSegments()
 			{
 				return seg1->getAddress() < seg2->getAddress();
 			});
+	invalidateSegmentIndex();
+}
+
+template <Endianness E>
+bool Image::getXByteImpl(std::uint64_t address, std::uint64_t x, std::uint64_t& res) const
+{
+	switch (x)
+	{
+		case 1: return getWord<1, E>(address, res);
+		case 2: return getWord<2, E>(address, res);
+		case 3: return getWord<3, E>(address, res);
+		case 4: return getWord<4, E>(address, res);
+		case 5: return getWord<5, E>(address, res);
+		case 6: return getWord<6, E>(address, res);
+		case 7: return getWord<7, E>(address, res);
+		case 8: return getWord<8, E>(address, res);
+		default: return false;
+	}
+}
+
+/**
+ * Returns pointer to @a size bytes of data located at provided address. The data must lie in a single segment.
+ * If they are directly in the data of the segment, pointer to them is returned. Otherwise (the data are partially
+ * or fully beyond the physical data of the segment), they are copied to @a buffer and the missing bytes are filled
+ * with zeroes, the same way as Segment::getBytes() does.
+ *
+ * @param address Address of the data.
+ * @param size Size of the data.
+ * @param buffer Buffer of at least @a size bytes, or @c nullptr if the data should not be copied.
+ *
+ * @return Pointer to the data, or @c nullptr if they cannot be read.
+ */
+const std::uint8_t* Image::getDataOnAddress(std::uint64_t address, std::uint64_t size, std::uint8_t* buffer) const
+{
+	const auto* seg = getSegmentFromAddress(address);
+	if (!seg)
+		return nullptr;
+
+	auto offset = address - seg->getAddress();
+	if (offset >= seg->getSize() || size > seg->getSize() - offset)
+		return nullptr;
+
+	auto rawData = seg->getRawData();
+	if (rawData.first && offset < rawData.second && size <= rawData.second - offset)
+		return rawData.first + offset;
+
+	if (!buffer)
+		return nullptr;
+
+	std::fill_n(buffer, size, 0);
+	if (rawData.first && offset < rawData.second)
+		std::copy(rawData.first + offset, rawData.first + rawData.second, buffer);
+
+	return buffer;
+}
+
+/**
+ * Marks the address index of segments as outdated, so it is rebuilt on the next lookup.
+ * Must be called whenever the address range of some segment changes (e.g. after resizing it).
+ * Inserting, removing and sorting segments invalidates the index automatically.
+ */
+void Image::invalidateSegmentIndex()
+{
+	_segmentIndexValid = false;
+}
+
+/**
+ * Builds the sorted index of address ranges of segments. Segments may overlap -- in such a case,
+ * the overlapped range belongs to the segment which comes first in the list of segments, so lookups
+ * give the same results as the linear search over the segments.
+ */
+void Image::buildSegmentIndex() const
+{
+	std::lock_guard<std::mutex> lock(_segmentIndexMutex);
+	if (_segmentIndexValid)
+		return;
+
+	// Mapping: start address -> entry. Entries are never overlapping.
+	std::map<std::uint64_t, SegmentIndexEntry> covered;
+	for (const auto& segment : _segments)
+	{
+		auto start = segment->getAddress();
+		auto end = segment->getEndAddress();
+
+		// Skip the part which is already covered by the preceding entry.
+		auto itr = covered.upper_bound(start);
+		if (itr != covered.begin())
+		{
+			auto prev = std::prev(itr);
+			if (prev->second.end > start)
+				start = prev->second.end;
+		}
+
+		// Fill the gaps between the following entries.
+		while (start < end)
+		{
+			if (itr == covered.end() || itr->first >= end)
+			{
+				covered.emplace_hint(itr, start, SegmentIndexEntry{start, end, segment.get()});
+				break;
+			}
+
+			if (itr->first > start)
+				covered.emplace_hint(itr, start, SegmentIndexEntry{start, itr->first, segment.get()});
+
+			start = itr->second.end;
+			++itr;
+		}
+	}
+
+	_segmentIndex.clear();
+	_segmentIndex.reserve(covered.size());
+	for (const auto& item : covered)
+		_segmentIndex.push_back(item.second);
+
+	_lastSegmentIndexHit = 0;
+	_segmentIndexValid = true;
 }
 
 const Segment* Image::_getSegment(std::size_t index) const
@@ -510,13 +628,29 @@ const Segment* Image::_getSegmentWithIndex(std::size_t index) const
 
 const Segment* Image::_getSegmentFromAddress(std::uint64_t address) const
 {
-	for (const auto& segment : getSegments())
-	{
-		if (segment->containsAddress(address))
-			return segment.get();
-	}
+	if (!_segmentIndexValid)
+		buildSegmentIndex();
 
-	return nullptr;
+	// Consecutive reads usually hit the same segment.
+	std::size_t hit = _lastSegmentIndexHit.load(std::memory_order_relaxed);
+	if (hit < _segmentIndex.size()
+			&& _segmentIndex[hit].start <= address && address < _segmentIndex[hit].end)
+		return _segmentIndex[hit].segment;
+
+	auto itr = std::upper_bound(_segmentIndex.begin(), _segmentIndex.end(), address,
+			[](std::uint64_t addr, const SegmentIndexEntry& entry)
+			{
+				return addr < entry.start;
+			});
+	if (itr == _segmentIndex.begin())
+		return nullptr;
+
+	--itr;
+	if (address >= itr->end)
+		return nullptr;
+
+	_lastSegmentIndexHit.store(itr - _segmentIndex.begin(), std::memory_order_relaxed);
+	return itr->segment;
 }
 
 } // namespace loader
@@ -4,14 +4,20 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
 #include "retdec/stacofin/stacofin.h"
 #include "yaracpp/yara_detector/yara_detector.h"
 #include "retdec/loader/loader/image.h"
+#include "retdec/utils/parallel.h"
+#include "retdec/utils/scope_exit.h"
 #include "retdec/utils/string.h"
+#include "retdec/yara-cache/yara_rule_cache.h"
 
 /**
  * Set \c debug_enabled to \c true to enable this LOG macro.
@@ -333,6 +339,93 @@ std::set<std::string> selectSignaturePaths(
 	return sigs;
 }
 
+/**
+ * libyara initialization and rule compilation are not thread-safe, so
+ * detectors are created and destroyed one at a time. Only the scanning
+ * itself runs concurrently.
+ */
+std::mutex yaraMutex;
+
+/**
+ * Scan @a bytes with rules from @a ruleFile (which is either @a yaraFile or
+ * its compiled version from the cache).
+ *
+ * @return One detected function per match, in the order of YARA's results.
+ *         Only offsets are set, addresses are filled when the detections
+ *         are added to the finder.
+ */
+std::vector<DetectedFunction> scanSignatureFile(
+		const std::vector<std::uint8_t>& bytes,
+		const std::string& yaraFile,
+		const std::string& ruleFile)
+{
+	std::vector<DetectedFunction> result;
+
+	std::unique_ptr<YaraDetector> detector;
+	{
+		std::lock_guard<std::mutex> lock(yaraMutex);
+		detector = std::make_unique<YaraDetector>();
+		detector->addRuleFile(ruleFile);
+	}
+	SCOPE_EXIT {
+		std::lock_guard<std::mutex> lock(yaraMutex);
+		detector.reset();
+	};
+
+	// YaraDetector::analyze() takes a non-const reference, but it only reads
+	// the bytes. Scan the loaded content in place instead of copying the
+	// whole input for every signature file.
+	detector->analyze(const_cast<std::vector<std::uint8_t>&>(bytes));
+	if (!detector->isInValidState())
+	{
+		return result;
+	}
+
+	// Iterate over detected rules.
+	for (const YaraRule &detectedRule : detector->getDetectedRules())
+	{
+		DetectedFunction detectedFunction;
+		detectedFunction.signaturePath = yaraFile;
+
+		for (const YaraMeta &ruleMeta : detectedRule.getMetas())
+		{
+			if (ruleMeta.getId() == "name")
+			{
+				detectedFunction.names.push_back(ruleMeta.getStringValue());
+			}
+			if (ruleMeta.getId() == "size")
+			{
+				detectedFunction.size = ruleMeta.getIntValue();
+			}
+			if (ruleMeta.getId() == "refs")
+			{
+				const auto &refs = ruleMeta.getStringValue();
+				detectedFunction.setReferences(refs);
+			}
+			if (ruleMeta.getId() == "altNames")
+			{
+				std::string name;
+				const auto &altNames = ruleMeta.getStringValue();
+				std::istringstream ss(altNames, std::istringstream::in);
+				while(ss >> name)
+				{
+					detectedFunction.names.push_back(name);
+				}
+			}
+		}
+
+		// Iterate over all matches.
+		for (const YaraMatch &ruleMatch : detectedRule.getMatches())
+		{
+			// This is different for every match.
+			detectedFunction.offset = ruleMatch.getOffset();
+			result.push_back(detectedFunction);
+		}
+	}
+
+	return result;
+}
+
 void collectImports(
 		const retdec::loader::Image* image,
 		std::map<utils::Address, std::string>& imports)
@@ -578,6 +671,38 @@ Finder::~Finder()
 {
 }
 
+/**
+ * Set directory where compiled signatures are cached between runs.
+ *
+ * @param dir existing directory (empty disables caching)
+ */
+void Finder::setYaraCacheDirectory(const std::string& dir)
+{
+	_yaraCacheDirectory = dir;
+}
+
+/**
+ * Set the maximal number of signature files scanned concurrently.
+ *
+ * @param jobs number of threads (@c 0 means one per hardware thread)
+ */
+void Finder::setJobs(std::size_t jobs)
+{
+	_jobs = jobs;
+}
+
+/**
+ * Return the number of signature files scanned concurrently.
+ */
+std::size_t Finder::getJobs() const
+{
+	if (_jobs == 0)
+	{
+		return utils::getHardwareJobs();
+	}
+	return _jobs;
+}
+
 /**
  * Return detected code coverage.
  *
@@ -615,86 +740,106 @@ void Finder::search(
 		return;
 	}
 
-	// Start Yara detector.
-	YaraDetector detector;
-	detector.addRuleFile(yaraFile);
-	auto inputBytes = fileFormat->getLoadedBytes();
-	detector.analyze(inputBytes);
-	if (!detector.isInValidState())
+	yara_cache::YaraRuleCache cache(_yaraCacheDirectory);
+	addDetections(*fileFormat, scanSignatureFile(
+			fileFormat->getLoadedBytes(),
+			yaraFile,
+			cache.getRuleFile(yaraFile)));
+}
+
+/**
+ * Search for static code in input file.
+ *
+ * @param image input file image
+ * @param yaraFiles static code signature files
+ */
+void Finder::search(
+	const retdec::loader::Image& image,
+	const std::set<std::string>& yaraFiles)
+{
+	search(image, std::vector<std::string>(yaraFiles.begin(), yaraFiles.end()));
+}
+
+/**
+ * Search for static code in input file.
+ *
+ * If more than one job is allowed (see setJobs()), signature files are
+ * scanned concurrently. Their detections are merged in the order of
+ * @a yaraFiles, so the result is the same as for the sequential search.
+ * An exception thrown while scanning a file is rethrown after all the
+ * threads finish, and no detections are added.
+ *
+ * @param image input file image
+ * @param yaraFiles static code signature files
+ */
+void Finder::search(
+	const retdec::loader::Image& image,
+	const std::vector<std::string>& yaraFiles)
+{
+	std::size_t jobs = std::min(getJobs(), yaraFiles.size());
+	if (jobs <= 1)
 	{
+		for (const auto& f : yaraFiles)
+		{
+			search(image, f);
+		}
 		return;
 	}
 
-	// Iterate over detected rules.
-	for (const YaraRule &detectedRule : detector.getDetectedRules())
+	const auto* fileFormat = image.getFileFormat();
+	if (!fileFormat)
 	{
-		DetectedFunction detectedFunction;
-		detectedFunction.signaturePath = yaraFile;
-
-		for (const YaraMeta &ruleMeta : detectedRule.getMetas())
-		{
-			if (ruleMeta.getId() == "name")
-			{
-				detectedFunction.names.push_back(ruleMeta.getStringValue());
-			}
-			if (ruleMeta.getId() == "size")
-			{
-				detectedFunction.size = ruleMeta.getIntValue();
-			}
-			if (ruleMeta.getId() == "refs")
-			{
-				const auto &refs = ruleMeta.getStringValue();
-				detectedFunction.setReferences(refs);
-			}
-			if (ruleMeta.getId() == "altNames")
-			{
-				std::string name;
-				const auto &altNames = ruleMeta.getStringValue();
-				std::istringstream ss(altNames, std::istringstream::in);
-				while(ss >> name)
-				{
-					detectedFunction.names.push_back(name);
-				}
-			}
-		}
+		return;
+	}
 
-		// Iterate over all matches.
-		for (const YaraMatch &ruleMatch : detectedRule.getMatches())
-		{
-			// This is different for every match.
-			detectedFunction.offset = ruleMatch.getOffset();
-			unsigned long long address = 0;
-			if (!fileFormat->getAddressFromOffset(
-						address, detectedFunction.offset))
-			{
-				// Cannot get address. Maybe report error?
-				continue;
-			}
+	// Resolve (and possibly compile) cached rules before the scanning
+	// starts so that workers do not wait for each other on the cache.
+	yara_cache::YaraRuleCache cache(_yaraCacheDirectory);
+	std::vector<std::string> ruleFiles;
+	for (const auto& f : yaraFiles)
+	{
+		ruleFiles.push_back(cache.getRuleFile(f));
+	}
 
-			// Store data.
-			detectedFunction.setAddress(address);
-			coveredCode.insert(AddressRange(
-					address,
-					address + detectedFunction.size));
+	std::vector<std::vector<DetectedFunction>> results(yaraFiles.size());
+	utils::runInParallel(yaraFiles.size(), jobs, [&](std::size_t i) {
+		results[i] = scanSignatureFile(
+				fileFormat->getLoadedBytes(),
+				yaraFiles[i],
+				ruleFiles[i]);
+	});
 
-			_allDetections.emplace(detectedFunction.getAddress(), detectedFunction);
-		}
+	for (const auto& r : results)
+	{
+		addDetections(*fileFormat, r);
 	}
 }
 
 /**
- * Search for static code in input file.
- *
- * @param image input file image
- * @param yaraFiles static code signature files
+ * Compute addresses of the given detections and add them to the detected
+ * functions and covered code.
  */
-void Finder::search(
-	const retdec::loader::Image& image,
-	const std::set<std::string>& yaraFiles)
+void Finder::addDetections(
+		const retdec::fileformat::FileFormat& fileFormat,
+		const std::vector<DetectedFunction>& detections)
 {
-	for (const auto& f : yaraFiles)
+	for (auto detectedFunction : detections)
 	{
-		search(image, f);
+		unsigned long long address = 0;
+		if (!fileFormat.getAddressFromOffset(
+					address, detectedFunction.offset))
+		{
+			// Cannot get address. Maybe report error?
+			continue;
+		}
+
+		// Store data.
+		detectedFunction.setAddress(address);
+		coveredCode.insert(AddressRange(
+				address,
+				address + detectedFunction.size));
+
+		_allDetections.emplace(detectedFunction.getAddress(), detectedFunction);
 	}
 }
 
@@ -708,6 +853,15 @@ void Finder::search(
 	const retdec::loader::Image& image,
 	const retdec::config::Config& config)
 {
+	if (!config.parameters.getYaraCacheDirectory().empty())
+	{
+		setYaraCacheDirectory(config.parameters.getYaraCacheDirectory());
+	}
+	if (config.parameters.getStaticCodeJobs() != 1)
+	{
+		setJobs(config.parameters.getStaticCodeJobs());
+	}
+
 	auto sigPaths = selectSignaturePaths(image, config);
 	search(image, sigPaths);
 }
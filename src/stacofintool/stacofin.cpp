@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "retdec/utils/conversion.h"
 #include "retdec/utils/filesystem_path.h"
 #include "retdec/stacofin/stacofin.h"
 #include "retdec/loader/image_factory.h"
@@ -23,7 +24,11 @@ using namespace retdec::loader;
 void printUsage()
 {
 	std::cout << "\nStatic code detection tool.\n"
-		<< "Usage: stacofin -b BINARY_FILE YARA_FILE [YARA_FILE ...]\n\n";
+		<< "Usage: stacofin [--yara-cache DIR] [--jobs N] -b BINARY_FILE YARA_FILE [YARA_FILE ...]\n\n"
+		<< "  --yara-cache DIR  Keep compiled YARA files in the existing directory DIR\n"
+		<< "                    and reuse them in the following runs.\n"
+		<< "  -j, --jobs N      Scan up to N YARA files concurrently\n"
+		<< "                    (0 means one per hardware thread, default is 1).\n\n";
 }
 
 /**
@@ -123,6 +128,8 @@ int doActions(
 {
 	bool debugOn = false;
 	std::string binaryPath;
+	std::string yaraCacheDir;
+	std::size_t jobs = 1;
 	std::vector<std::string> yaraPaths;
 
 	for (std::size_t i = 0; i < args.size(); ++i) {
@@ -133,6 +140,17 @@ int doActions(
 		else if (args[i] == "-d" || args[i] == "--debug") {
 			debugOn = true;
 		}
+		else if (args[i] == "--yara-cache" && i + 1 < args.size()) {
+			yaraCacheDir = args[++i];
+			if (!FilesystemPath(yaraCacheDir).isDirectory()) {
+				return printError("invalid cache directory '" + yaraCacheDir + "'");
+			}
+		}
+		else if ((args[i] == "-j" || args[i] == "--jobs") && i + 1 < args.size()) {
+			if (!strToNum(args[++i], jobs)) {
+				return printError("invalid number of jobs '" + args[i] + "'");
+			}
+		}
 		else if (args[i] == "-b" && i + 1 < args.size()) {
 			binaryPath = args[++i];
 			if (!FilesystemPath(binaryPath).isFile()) {
@@ -155,9 +173,9 @@ int doActions(
 
 	// Do search.
 	Finder codeFinder;
-	for (const auto &yaraPath : yaraPaths) {
-		codeFinder.search(*image.get(), yaraPath);
-	}
+	codeFinder.setYaraCacheDirectory(yaraCacheDir);
+	codeFinder.setJobs(jobs);
+	codeFinder.search(*image.get(), yaraPaths);
 
 	// Print detections.
 	if (debugOn) {
@@ -23,40 +23,50 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 	// Reset just in case decompress() is called more times in row
 	reset();
 
+	return decompressWith(outputBuffer, [this](auto& bits, uint8_t* output, uint32_t outputSize) {
+			return decompressImpl(bits, output, outputSize);
+		});
+}
+
+template <typename BitReaderT> bool Nrv2dData::decompressImpl(BitReaderT& bits, uint8_t* output, uint32_t outputSize)
+{
+	const uint8_t* input = _buffer.getRawBuffer();
+	uint32_t inputSize = _buffer.getRealDataSize();
+
 	int32_t lastDist = 1;
 	uint8_t bit;
 
 	while (true)
 	{
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bits.getBit(bit, _readPos))
 			return false;
 
 		while (bit == 1)
 		{
-			if (_writePos >= outputBuffer.getCapacity() || _readPos >= _buffer.getRealDataSize())
+			if (_writePos >= outputSize || _readPos >= inputSize)
 				return false;
 
-			outputBuffer.write<uint8_t>(_buffer.read<uint8_t>(_readPos++), _writePos++);
+			output[_writePos++] = input[_readPos++];
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bits.getBit(bit, _readPos))
 				return false;
 		}
 
 		int32_t dist = 1;
 		while (true)
 		{
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bits.getBit(bit, _readPos))
 				return false;
 
 			dist += dist + bit;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bits.getBit(bit, _readPos))
 				return false;
 
 			if (bit == 1)
 				break;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bits.getBit(bit, _readPos))
 				return false;
 
 			dist = ((dist - 1) << 1) + bit;
@@ -67,17 +77,17 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 		{
 			dist = lastDist;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bits.getBit(bit, _readPos))
 				return false;
 
 			count = bit;
 		}
 		else
 		{
-			if (_readPos >= _buffer.getRealDataSize())
+			if (_readPos >= inputSize)
 				return false;
 
-			dist = ((dist - 3) << 8) | _buffer.read<uint8_t>(_readPos++);
+			dist = ((dist - 3) << 8) | input[_readPos++];
 
 			if (dist == -1)
 				return true;
@@ -87,7 +97,7 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 			lastDist = ++dist;
 		}
 
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bits.getBit(bit, _readPos))
 			return false;
 
 		count += count + bit;
@@ -98,12 +108,12 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 
 			do
 			{
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bits.getBit(bit, _readPos))
 					return false;
 
 				count += count + bit;
 
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bits.getBit(bit, _readPos))
 					return false;
 			} while (bit == 0);
 
@@ -112,15 +122,8 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 
 		count += (dist > 0x500) + 1;
 
-		uint32_t srcPos = static_cast<int32_t>(_writePos) - dist;
-		do
-		{
-			if (_writePos >= outputBuffer.getCapacity())
-				return false;
-
-			outputBuffer.write<uint8_t>(outputBuffer.read<uint8_t>(srcPos++), _writePos++);
-		}
-		while (--count);
+		if (!copyMatch(output, outputSize, dist, count))
+			return false;
 	}
 }
 
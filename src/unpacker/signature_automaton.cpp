@@ -0,0 +1,267 @@
+/**
+ * @file src/unpacker/signature_automaton.cpp
+ * @brief Definition of class for matching many signatures at once.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <queue>
+
+#include "retdec/unpacker/signature_automaton.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+
+const uint64_t SignatureAutomaton::MAX_ANCHOR_SIZE;
+
+/**
+ * Constructor.
+ */
+SignatureAutomaton::SignatureAutomaton() : _matchedAreaSize(0), _built(false)
+{
+}
+
+/**
+ * Destructor.
+ */
+SignatureAutomaton::~SignatureAutomaton()
+{
+}
+
+/**
+ * Adds the signature into the automaton. Signatures added earlier have higher priority.
+ * @ref build() has to be called after all the signatures are added.
+ *
+ * @param signature Signature to add.
+ * @param searchDistance Maximum searching distance. No searching if this is set 0.
+ */
+void SignatureAutomaton::addSignature(const Signature* signature, uint64_t searchDistance /*= 0*/)
+{
+	Entry entry = { signature, searchDistance, 0, 0 };
+
+	// Find the longest run of exact bytes
+	const auto& bytes = signature->_buffer;
+	for (uint64_t i = 0; i < bytes.size(); )
+	{
+		if (!isExact(bytes[i]))
+		{
+			++i;
+			continue;
+		}
+
+		uint64_t runSize = 0;
+		while (i + runSize < bytes.size() && isExact(bytes[i + runSize]))
+			++runSize;
+
+		if (runSize > entry.anchorSize)
+		{
+			entry.anchorOffset = i;
+			entry.anchorSize = runSize;
+		}
+
+		i += runSize;
+	}
+	entry.anchorSize = std::min(entry.anchorSize, MAX_ANCHOR_SIZE);
+
+	_matchedAreaSize = std::max(_matchedAreaSize, signature->getSize() + std::max(searchDistance, uint64_t(1)) - 1);
+	_entries.push_back(entry);
+	_built = false;
+}
+
+/**
+ * Builds the automaton from the anchors of all added signatures.
+ */
+void SignatureAutomaton::build()
+{
+	_nodes.assign(1, Node());
+	_nodes[0].next.fill(0);
+	_unanchored.clear();
+
+	// Trie of anchors, 0 stands for missing transition (root is never a child)
+	for (uint64_t id = 0; id < _entries.size(); ++id)
+	{
+		const Entry& entry = _entries[id];
+		if (entry.anchorSize == 0)
+		{
+			_unanchored.push_back(id);
+			continue;
+		}
+
+		uint32_t state = 0;
+		for (uint64_t i = 0; i < entry.anchorSize; ++i)
+		{
+			uint8_t byte = entry.signature->_buffer[entry.anchorOffset + i].getExpectedValue();
+			if (_nodes[state].next[byte] == 0)
+			{
+				_nodes[state].next[byte] = static_cast<uint32_t>(_nodes.size());
+				_nodes.emplace_back();
+				_nodes.back().next.fill(0);
+			}
+
+			state = _nodes[state].next[byte];
+		}
+
+		_nodes[state].entries.push_back(id);
+	}
+
+	// Failure transitions in breadth-first order, so the failure node of every node is completed before the node itself
+	std::vector<uint32_t> failure(_nodes.size(), 0);
+	std::queue<uint32_t> queue;
+	for (uint32_t child : _nodes[0].next)
+	{
+		if (child != 0)
+			queue.push(child);
+	}
+
+	while (!queue.empty())
+	{
+		uint32_t state = queue.front();
+		queue.pop();
+
+		for (std::size_t byte = 0; byte < 256; ++byte)
+		{
+			uint32_t child = _nodes[state].next[byte];
+			if (child == 0)
+			{
+				_nodes[state].next[byte] = _nodes[failure[state]].next[byte];
+				continue;
+			}
+
+			failure[child] = _nodes[failure[state]].next[byte];
+			const auto& suffixEntries = _nodes[failure[child]].entries;
+			_nodes[child].entries.insert(_nodes[child].entries.end(), suffixEntries.begin(), suffixEntries.end());
+			queue.push(child);
+		}
+	}
+
+	_built = true;
+}
+
+/**
+ * Returns the number of signatures in the automaton.
+ *
+ * @return Number of signatures.
+ */
+uint64_t SignatureAutomaton::getNumberOfSignatures() const
+{
+	return _entries.size();
+}
+
+/**
+ * Returns the number of bytes from the matching offset that any signature may span.
+ * Bytes beyond are never read, so it is enough to provide only this amount of data.
+ *
+ * @return Size of matched area in bytes.
+ */
+uint64_t SignatureAutomaton::getMatchedAreaSize() const
+{
+	return _matchedAreaSize;
+}
+
+/**
+ * Matches all the signatures against the bytes. Every signature is matched at the offset or, if its search distance
+ * is greater than 0, searched up to its search distance from the offset.
+ *
+ * @param bytesToMatch Input bytes.
+ * @param offset Offset in the bytes where to start matching.
+ * @param capturedData Buffer where to capture the capture bytes of the matched signature.
+ *
+ * @return Index of the first added signature that matched, otherwise -1.
+ */
+int64_t SignatureAutomaton::match(const std::vector<uint8_t>& bytesToMatch, uint64_t offset, DynamicBuffer* capturedData /*= nullptr*/) const
+{
+	assert(_built && "SignatureAutomaton::build() has to be called before matching");
+	if (!_built || offset > bytesToMatch.size())
+		return -1;
+
+	uint64_t best = _entries.size();
+	uint64_t bestOffset = 0;
+
+	for (uint64_t id : _unanchored)
+	{
+		const Entry& entry = _entries[id];
+		for (uint64_t i = 0; i < std::max(entry.searchDistance, uint64_t(1)); ++i)
+		{
+			if (matchesOnOffset(entry, bytesToMatch, offset + i))
+			{
+				best = id;
+				bestOffset = offset + i;
+				break;
+			}
+		}
+
+		if (best < _entries.size())
+			break;
+	}
+
+	uint64_t end = std::min(static_cast<uint64_t>(bytesToMatch.size()), offset + _matchedAreaSize);
+	uint32_t state = 0;
+	for (uint64_t pos = offset; pos < end && best != 0; ++pos)
+	{
+		state = _nodes[state].next[bytesToMatch[pos]];
+		for (uint64_t id : _nodes[state].entries)
+		{
+			// Occurences come in the increasing order, so only the first one of every signature is interesting
+			if (id >= best)
+				continue;
+
+			const Entry& entry = _entries[id];
+			uint64_t anchorEnd = pos + 1;
+			if (anchorEnd < offset + entry.anchorOffset + entry.anchorSize)
+				continue;
+
+			uint64_t start = anchorEnd - entry.anchorSize - entry.anchorOffset;
+			if (start - offset >= std::max(entry.searchDistance, uint64_t(1)))
+				continue;
+
+			if (matchesOnOffset(entry, bytesToMatch, start))
+			{
+				best = id;
+				bestOffset = start;
+			}
+		}
+	}
+
+	if (best == _entries.size())
+		return -1;
+
+	if (capturedData != nullptr)
+		_entries[best].signature->matchImpl(bytesToMatch, bestOffset, capturedData);
+
+	return static_cast<int64_t>(best);
+}
+
+/**
+ * Checks whether the signature byte can be matched only by one value.
+ *
+ * @param byte Signature byte.
+ *
+ * @return True if the byte is exact, otherwise false.
+ */
+bool SignatureAutomaton::isExact(const Signature::Byte& byte) const
+{
+	return byte.getType() == Signature::Byte::Type::NORMAL || byte.getWildcardMask() == 0;
+}
+
+/**
+ * Checks whether the whole signature of the entry matches the bytes at the offset.
+ *
+ * @param entry Entry to match.
+ * @param bytesToMatch Input bytes.
+ * @param offset Offset in the bytes.
+ *
+ * @return True if the signature matched, otherwise false.
+ */
+bool SignatureAutomaton::matchesOnOffset(const Entry& entry, const std::vector<uint8_t>& bytesToMatch, uint64_t offset) const
+{
+	if (offset > bytesToMatch.size() || bytesToMatch.size() - offset < entry.signature->getSize())
+		return false;
+
+	return entry.signature->matchImpl(bytesToMatch, offset, nullptr) == static_cast<int64_t>(entry.signature->getSize());
+}
+
+} // namespace unpacker
+} // namespace retdec
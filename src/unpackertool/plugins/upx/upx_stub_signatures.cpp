@@ -1726,6 +1726,39 @@ std::vector<UpxStubData> UpxStubSignatures::allStubs =
 	{ Architecture::X86,    Format::PE,     &pushaNop_x86PeNrv2bSignature,      UpxStubVersion::NRV2B,   0xCB,  0x0 }
 };
 
+std::map<std::pair<Architecture, Format>, UpxStubSignatures::StubMatcher> UpxStubSignatures::stubMatchers;
+
+/**
+ * Returns the automaton matching all supported signatures for the architecture and the file format.
+ * The automaton is built only once, when it is requested for the first time.
+ *
+ * @param architecture Architecture of the file. Unknown architecture stands for all architectures.
+ * @param format File format of the file. Unknown file format stands for all file formats.
+ *
+ * @return The stub matcher.
+ */
+const UpxStubSignatures::StubMatcher& UpxStubSignatures::getStubMatcher(Architecture architecture, Format format)
+{
+	auto key = std::make_pair(architecture, format);
+	auto itr = stubMatchers.find(key);
+	if (itr != stubMatchers.end())
+		return itr->second;
+
+	StubMatcher& matcher = stubMatchers[key];
+	for (const UpxStubData& stubData : allStubs)
+	{
+		if ((architecture != Architecture::UNKNOWN && stubData.architecture != architecture)
+				|| (format != Format::UNKNOWN && stubData.format != format))
+			continue;
+
+		matcher.stubs.push_back(&stubData);
+		matcher.automaton.addSignature(stubData.signature, stubData.searchDistance);
+	}
+	matcher.automaton.build();
+
+	return matcher;
+}
+
 /**
  * Matches all supported signatures against the input packed file at its entry point. In the case of
  * non-matched signature with searchDistance greather than 0, the searching of the signature is performed
@@ -1741,6 +1774,10 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 	Architecture architecture = file->getFileFormat()->getTargetArchitecture();
 	Format format = file->getFileFormat()->getFileFormat();
 
+	// There are no stubs for unknown architecture or file format
+	if (architecture == Architecture::UNKNOWN || format == Format::UNKNOWN)
+		return nullptr;
+
 	// Find out whether file has entry point section or segment
 	const retdec::loader::Segment* epSeg = file->getEpSegment();
 	if (epSeg == nullptr)
@@ -1751,21 +1788,19 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 	file->getFileFormat()->getEpAddress(ep);
 	ep -= epSeg->getAddress();
 
-	for (const UpxStubData& stubData : allStubs)
-	{
-		if (stubData.architecture != architecture || stubData.format != format)
-			continue;
+	const StubMatcher& matcher = getStubMatcher(architecture, format);
 
-		Signature::MatchSettings settings(ep, stubData.searchDistance);
-		DynamicBuffer localCaptureData(file->getFileFormat()->getEndianness());
-		if (stubData.signature->match(settings, file, localCaptureData))
-		{
-			captureData = localCaptureData;
-			return &stubData;
-		}
-	}
+	// Read all the bytes that any of the signatures may need only once
+	std::vector<uint8_t> bytesToMatch;
+	epSeg->getBytes(bytesToMatch, ep, matcher.automaton.getMatchedAreaSize());
+
+	DynamicBuffer localCaptureData(file->getFileFormat()->getEndianness());
+	int64_t index = matcher.automaton.match(bytesToMatch, 0, &localCaptureData);
+	if (index < 0)
+		return nullptr;
 
-	return nullptr;
+	captureData = localCaptureData;
+	return matcher.stubs[index];
 }
 
 /**
@@ -1783,22 +1818,15 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 const UpxStubData* UpxStubSignatures::matchSignatures(const DynamicBuffer& data, DynamicBuffer& captureData,
 		retdec::fileformat::Architecture architecture /*= Architecture::UNKNOWN*/, retdec::fileformat::Format format /*= Format::UNKNOWN*/)
 {
-	for (const UpxStubData& stubData : allStubs)
-	{
-		if ((architecture != Architecture::UNKNOWN && stubData.architecture != architecture)
-				|| (format != Format::UNKNOWN && stubData.format != format))
-			continue;
+	const StubMatcher& matcher = getStubMatcher(architecture, format);
 
-		Signature::MatchSettings settings(0, stubData.searchDistance);
-		DynamicBuffer localCaptureData(data.getEndianness());
-		if (stubData.signature->match(settings, data, localCaptureData))
-		{
-			captureData = localCaptureData;
-			return &stubData;
-		}
-	}
+	DynamicBuffer localCaptureData(data.getEndianness());
+	int64_t index = matcher.automaton.match(data.getBuffer(), 0, &localCaptureData);
+	if (index < 0)
+		return nullptr;
 
-	return nullptr;
+	captureData = localCaptureData;
+	return matcher.stubs[index];
 }
 
 } // namespace upx
@@ -7,10 +7,14 @@
 #ifndef UNPACKERTOOL_PLUGINS_UPX_UPX_STUB_SIGNATURES_H
 #define UNPACKERTOOL_PLUGINS_UPX_UPX_STUB_SIGNATURES_H
 
+#include <map>
+#include <utility>
+
 #include "retdec/fileformat/fileformat.h"
 #include "retdec/loader/loader.h"
 #include "unpackertool/plugins/upx/upx_stub.h"
 #include "retdec/unpacker/signature.h"
+#include "retdec/unpacker/signature_automaton.h"
 
 using namespace retdec::utils;
 
@@ -61,9 +65,21 @@ public:
 			retdec::fileformat::Architecture architecture = retdec::fileformat::Architecture::UNKNOWN, retdec::fileformat::Format format = retdec::fileformat::Format::UNKNOWN);
 
 private:
+	/**
+	 * All unpacking stubs for one architecture and file format compiled into one automaton.
+	 */
+	struct StubMatcher
+	{
+		std::vector<const UpxStubData*> stubs; ///< Stubs in the order of the automaton signatures.
+		retdec::unpacker::SignatureAutomaton automaton; ///< Automaton matching all stubs at once.
+	};
+
 	UpxStubSignatures& operator =(const UpxStubSignatures&);
 
+	static const StubMatcher& getStubMatcher(retdec::fileformat::Architecture architecture, retdec::fileformat::Format format);
+
 	static std::vector<UpxStubData> allStubs; ///< All supported unpacking stubs.
+	static std::map<std::pair<retdec::fileformat::Architecture, retdec::fileformat::Format>, StubMatcher> stubMatchers; ///< Automata built for architectures and file formats.
 };
 
 } // namespace upx
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/utils/dynamic_buffer.h"
 
 using namespace retdec::utils;
@@ -62,7 +64,7 @@ DynamicBuffer::DynamicBuffer(const DynamicBuffer& dynamicBuffer)
  */
 DynamicBuffer::DynamicBuffer(const DynamicBuffer& dynamicBuffer, uint32_t startPos, uint32_t amount)
 {
-	std::vector<uint8_t> tmpBuffer = dynamicBuffer.getBuffer();
+	const std::vector<uint8_t>& tmpBuffer = dynamicBuffer.getBuffer();
 	std::vector<uint8_t> buffer(tmpBuffer.begin() + startPos, tmpBuffer.begin() + startPos + amount);
 
 	_data = buffer;
@@ -146,6 +148,17 @@ uint32_t DynamicBuffer::getRealDataSize() const
 	return static_cast<uint32_t>(_data.size());
 }
 
+/**
+ * Resizes the data that are actually written to the buffer. New bytes are filled with default (0) value.
+ * The size cannot be greater than the capacity of the buffer.
+ *
+ * @param size The new size of the written data.
+ */
+void DynamicBuffer::setRealDataSize(uint32_t size)
+{
+	_data.resize(std::min(size, _capacity));
+}
+
 /**
  * Erases the bytes from the buffer. Also reduces the capacity of the buffer.
  *
@@ -166,7 +179,7 @@ void DynamicBuffer::erase(uint32_t startPos, uint32_t amount)
  *
  * @return The vector with the bytes.
  */
-std::vector<uint8_t> DynamicBuffer::getBuffer() const
+const std::vector<uint8_t>& DynamicBuffer::getBuffer() const
 {
 	return _data;
 }
@@ -181,6 +194,17 @@ const uint8_t* DynamicBuffer::getRawBuffer() const
 	return _data.data();
 }
 
+/**
+ * Gets the raw pointer to the bytes in the buffer. The bytes can be modified through it, but the size of the
+ * data can be changed only through the methods of the buffer.
+ *
+ * @return The pointer to the bytes in the buffer.
+ */
+uint8_t* DynamicBuffer::getRawBuffer()
+{
+	return _data.data();
+}
+
 /**
  * Runs the specified function for every single byte in the DynamicBuffer.
  *
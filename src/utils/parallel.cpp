@@ -0,0 +1,89 @@
+/**
+* @file src/utils/parallel.cpp
+* @brief Implementation of running independent work items on several threads.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "retdec/utils/parallel.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Returns the number of threads to be used when one thread per hardware
+*        thread is requested.
+*
+* It is at least @c 1, even if the number of hardware threads is unknown.
+*/
+std::size_t getHardwareJobs() {
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+* @brief Calls @a work for every index in <tt>[0, count)</tt> using up to
+*        @a jobs threads.
+*
+* The calling thread is one of the threads. The indexes are assigned to the
+* threads dynamically, so the order in which @a work is called is unspecified
+* when @a jobs is greater than @c 1. Storing results by the given index keeps
+* them in the original order.
+*
+* If @a work throws an exception, no other work items are started, all threads
+* are joined, and the first exception is rethrown on the calling thread.
+*/
+void runInParallel(std::size_t count, std::size_t jobs,
+		const std::function<void(std::size_t)> &work) {
+	jobs = std::min(jobs, count);
+	if (jobs <= 1) {
+		for (std::size_t i = 0; i < count; ++i) {
+			work(i);
+		}
+		return;
+	}
+
+	std::atomic<std::size_t> next(0);
+	std::exception_ptr exception;
+	std::mutex exceptionMutex;
+	auto worker = [&]() {
+		try {
+			for (auto i = next++; i < count; i = next++) {
+				work(i);
+			}
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(exceptionMutex);
+			if (!exception) {
+				exception = std::current_exception();
+			}
+			next = count;
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (std::size_t i = 1; i < jobs; ++i) {
+		try {
+			threads.emplace_back(worker);
+		} catch (const std::system_error &) {
+			// Fewer threads than requested only make the work slower.
+			break;
+		}
+	}
+	worker();
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	if (exception) {
+		std::rethrow_exception(exception);
+	}
+}
+
+} // namespace utils
+} // namespace retdec
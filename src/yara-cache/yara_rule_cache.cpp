@@ -0,0 +1,364 @@
+/**
+ * @file src/yara-cache/yara_rule_cache.cpp
+ * @brief Persistent cache of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <sys/stat.h>
+#include <yara.h>
+
+#include "retdec/crypto/crypto.h"
+#include "retdec/utils/file_io.h"
+#include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/scope_exit.h"
+#include "retdec/utils/string.h"
+#include "retdec/yara-cache/yara_rule_cache.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace yara_cache {
+
+namespace {
+
+const std::string COMPILED_SUFFIX = ".yarac";
+const std::string KEY_SUFFIX = ".key";
+
+/**
+ * Key of one cached rule file.
+ */
+struct CacheKey
+{
+	/// Version of YARA that compiled the rules.
+	std::string yaraVersion = YR_VERSION;
+	long long mtime = 0;
+	long long size = 0;
+	/// SHA256 of the rule file contents.
+	std::string hash;
+
+	bool sameStamp(const CacheKey& o) const
+	{
+		return yaraVersion == o.yaraVersion
+				&& mtime == o.mtime
+				&& size == o.size;
+	}
+};
+
+/**
+ * Rule files that were already resolved in this process, so a batch of
+ * inputs does not need to re-read the key files.
+ * Mapping: key path -> key.
+ *
+ * The mutex guards only the map. Rules are compiled without holding it, so
+ * parallel callers compile different rule files at the same time.
+ */
+std::map<std::string, CacheKey> resolvedRules;
+std::mutex resolvedRulesMutex;
+
+/**
+ * Guards yr_initialize() and yr_finalize(), which count their calls in an
+ * unsynchronized global counter.
+ */
+std::mutex yaraInitMutex;
+
+/**
+ * Find the key of the rules resolved in this process for @a keyFile that
+ * still describes the rule file with the stamp @a actual.
+ */
+bool findResolvedRules(
+		const std::string& keyFile,
+		const CacheKey& actual,
+		CacheKey& key)
+{
+	std::lock_guard<std::mutex> lock(resolvedRulesMutex);
+	auto it = resolvedRules.find(keyFile);
+	if (it == resolvedRules.end() || !it->second.sameStamp(actual))
+	{
+		return false;
+	}
+
+	key = it->second;
+	return true;
+}
+
+void addResolvedRules(const std::string& keyFile, const CacheKey& key)
+{
+	std::lock_guard<std::mutex> lock(resolvedRulesMutex);
+	resolvedRules[keyFile] = key;
+}
+
+bool getStamp(const std::string& path, CacheKey& key)
+{
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0)
+	{
+		return false;
+	}
+
+	key.mtime = static_cast<long long>(st.st_mtime);
+	key.size = static_cast<long long>(st.st_size);
+	return true;
+}
+
+bool computeHash(const std::string& path, CacheKey& key)
+{
+	std::vector<unsigned char> content;
+	if (!readFile(path, content))
+	{
+		return false;
+	}
+
+	key.hash = retdec::crypto::getSha256(content.data(), content.size());
+	return true;
+}
+
+bool isHash(const std::string& str)
+{
+	return str.size() == 64
+			&& str.find_first_not_of("0123456789abcdefABCDEF") == std::string::npos;
+}
+
+bool readKey(const std::string& path, CacheKey& key)
+{
+	std::ifstream in(path);
+	// The hash becomes a part of a file name, so check it (the key file may
+	// be corrupted).
+	return in >> key.yaraVersion >> key.mtime >> key.size >> key.hash
+			&& isHash(key.hash);
+}
+
+std::string getTemporaryPath(const std::string& path)
+{
+	// Rules are compiled and keys written by parallel callers.
+	static thread_local std::random_device rd;
+	return path + "." + std::to_string(rd()) + ".tmp";
+}
+
+/**
+ * Atomically replace @a dst with @a src.
+ */
+bool replaceFile(const std::string& src, const std::string& dst)
+{
+	if (std::rename(src.c_str(), dst.c_str()) == 0)
+	{
+		return true;
+	}
+
+	// rename() does not overwrite existing files on MS Windows.
+	std::remove(dst.c_str());
+	if (std::rename(src.c_str(), dst.c_str()) == 0)
+	{
+		return true;
+	}
+
+	std::remove(src.c_str());
+	return false;
+}
+
+bool writeKey(const std::string& path, const CacheKey& key)
+{
+	auto tmp = getTemporaryPath(path);
+	{
+		std::ofstream out(tmp);
+		out << key.yaraVersion << "\n"
+				<< key.mtime << "\n"
+				<< key.size << "\n"
+				<< key.hash << "\n";
+		if (!out)
+		{
+			out.close();
+			std::remove(tmp.c_str());
+			return false;
+		}
+	}
+
+	return replaceFile(tmp, path);
+}
+
+/**
+ * Compile @a ruleFile into @a outFile. Callers that compile the same rules
+ * at the same time write them into different temporary files, and the last
+ * one atomically replaces @a outFile with the same rules.
+ */
+bool compileRuleFile(const std::string& ruleFile, const std::string& outFile)
+{
+	{
+		std::lock_guard<std::mutex> lock(yaraInitMutex);
+		if (yr_initialize() != ERROR_SUCCESS)
+		{
+			return false;
+		}
+	}
+	SCOPE_EXIT {
+		std::lock_guard<std::mutex> lock(yaraInitMutex);
+		yr_finalize();
+	};
+
+	YR_COMPILER* compiler = nullptr;
+	if (yr_compiler_create(&compiler) != ERROR_SUCCESS)
+	{
+		return false;
+	}
+	SCOPE_EXIT {
+		yr_compiler_destroy(compiler);
+	};
+
+	FILE* file = std::fopen(ruleFile.c_str(), "r");
+	if (file == nullptr)
+	{
+		return false;
+	}
+	auto errors = yr_compiler_add_file(compiler, file, nullptr, ruleFile.c_str());
+	std::fclose(file);
+	if (errors != 0)
+	{
+		return false;
+	}
+
+	YR_RULES* rules = nullptr;
+	if (yr_compiler_get_rules(compiler, &rules) != ERROR_SUCCESS)
+	{
+		return false;
+	}
+	SCOPE_EXIT {
+		yr_rules_destroy(rules);
+	};
+
+	auto tmp = getTemporaryPath(outFile);
+	if (yr_rules_save(rules, tmp.c_str()) != ERROR_SUCCESS)
+	{
+		std::remove(tmp.c_str());
+		return false;
+	}
+
+	return replaceFile(tmp, outFile);
+}
+
+/**
+ * Get the path to the cache entry of @a ruleFile without a suffix. Its name
+ * contains the base name of the rule file (for readability) and a checksum
+ * of its absolute path (to distinguish rule files with the same name).
+ */
+std::string getEntryPath(
+		const std::string& cacheDirectory,
+		const std::string& ruleFile)
+{
+	auto absPath = FilesystemPath(ruleFile).getAbsolutePath();
+	auto baseName = absPath.substr(absPath.find_last_of("/\\") + 1);
+	auto pathCrc = retdec::crypto::getCrc32(
+			reinterpret_cast<const unsigned char*>(absPath.data()),
+			absPath.size());
+
+	FilesystemPath entryPath(cacheDirectory);
+	entryPath.append(baseName + "-" + pathCrc);
+	return entryPath.getPath();
+}
+
+/**
+ * Get the path to the compiled rules described by @a key. The name contains
+ * the hash of the rule file and the version of YARA, so a compiled file is
+ * never replaced by different rules and every key points to the rules that
+ * were compiled from the contents it describes.
+ */
+std::string getCompiledPath(const std::string& entryPath, const CacheKey& key)
+{
+	return entryPath + "-" + key.hash + "-" + key.yaraVersion + COMPILED_SUFFIX;
+}
+
+} // anonymous namespace
+
+/**
+ * Constructor.
+ *
+ * @param cacheDirectory Directory with the compiled rules. It has to exist.
+ *        If it is empty, nothing is cached.
+ */
+YaraRuleCache::YaraRuleCache(const std::string& cacheDirectory) :
+		_cacheDirectory(cacheDirectory)
+{
+
+}
+
+/**
+ * Get the file with rules that should be passed to the YARA detector
+ * instead of @a ruleFile.
+ *
+ * @return Path to the compiled rules from the cache (they are compiled if
+ *         they are not in the cache yet or if they are outdated). If the
+ *         rules cannot be cached, @a ruleFile is returned.
+ */
+std::string YaraRuleCache::getRuleFile(const std::string& ruleFile) const
+{
+	if (_cacheDirectory.empty()
+			|| endsWith(ruleFile, COMPILED_SUFFIX)
+			|| !FilesystemPath(_cacheDirectory).isDirectory())
+	{
+		return ruleFile;
+	}
+
+	CacheKey actual;
+	if (!getStamp(ruleFile, actual))
+	{
+		return ruleFile;
+	}
+
+	auto entryPath = getEntryPath(_cacheDirectory, ruleFile);
+	auto keyFile = entryPath + KEY_SUFFIX;
+
+	CacheKey resolved;
+	if (findResolvedRules(keyFile, actual, resolved))
+	{
+		return getCompiledPath(entryPath, resolved);
+	}
+
+	// Same timestamp -> no need to read the rule file at all.
+	CacheKey cached;
+	if (readKey(keyFile, cached) && cached.sameStamp(actual))
+	{
+		auto compiled = getCompiledPath(entryPath, cached);
+		if (FilesystemPath(compiled).isFile())
+		{
+			addResolvedRules(keyFile, cached);
+			return compiled;
+		}
+	}
+
+	if (!computeHash(ruleFile, actual))
+	{
+		return ruleFile;
+	}
+
+	// The rules may already be compiled, e.g. when the rule file was only
+	// touched or when another process has compiled them.
+	auto compiled = getCompiledPath(entryPath, actual);
+	if (!FilesystemPath(compiled).isFile()
+			&& !compileRuleFile(ruleFile, compiled))
+	{
+		return ruleFile;
+	}
+
+	// If the key cannot be written, the rule file is only hashed again the
+	// next time.
+	writeKey(keyFile, actual);
+	addResolvedRules(keyFile, actual);
+	return compiled;
+}
+
+/**
+ * Get the directory with the compiled rules.
+ */
+const std::string& YaraRuleCache::getCacheDirectory() const
+{
+	return _cacheDirectory;
+}
+
+} // namespace yara_cache
+} // namespace retdec
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+
+"""Generate binary databases of ordinal numbers from the *.ord files.
+Usage: install-ordinals.py ordinals-path install-path
+    ordinals-path Path to the source directory with one subdirectory of *.ord files per architecture.
+    install-path  Path to the installation directory where to place the results.
+
+For every architecture, <install-path>/<arch>/ords/ordinals.db is generated.
+It is used by bin2llvmir (see ImportOrdDatabase) and has the following layout.
+All numbers are little-endian 32-bit unsigned integers, all offsets are from
+the start of the file:
+
+    magic                "RDORDDB1"
+    number of slots      power of two, at least twice the number of libraries
+    number of libraries
+    library slots        number of slots x (name offset, name size,
+                         first ordinal, number of ordinals, ordinal table offset),
+                         empty slots are all zeros
+    ordinal tables       number of ordinals x function name offset,
+                         zero if there is no function with the ordinal
+    strings              library names and null-terminated function names
+
+A library (file name of its *.ord file without the suffix) is in the slot given
+by the 32-bit FNV-1a hash of its name modulo the number of slots, or in the
+first following empty slot (linear probing).
+"""
+
+import os
+import struct
+import sys
+
+
+MAGIC = b'RDORDDB1'
+DB_NAME = 'ordinals.db'
+INPUTS_SUFFIX = '.inputs'
+ORD_SUFFIX = '.ord'
+
+
+def print_help():
+    print('Usage: %s ordinals-path install-path' % sys.argv[0])
+
+
+def get_arguments():
+    if len(sys.argv) != 3:
+        print_help()
+        sys.exit(1)
+    return sys.argv[1], sys.argv[2]
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h
+
+
+def parse_ordinal(token):
+    """ Parse the leading integer of the given token the same way as C++
+    streams do, return -1 if there is none.
+    """
+    end = 1 if token[:1] in (b'+', b'-') else 0
+    while end < len(token) and token[end:end + 1].isdigit():
+        end += 1
+    try:
+        return int(token[:end])
+    except ValueError:
+        return -1
+
+
+def read_ord_file(path):
+    """ Read <ordinal number, function name> pairs from the given *.ord file.
+    """
+    ords = {}
+    with open(path, 'rb') as f:
+        for line in f:
+            tokens = line.split()
+            if not tokens:
+                continue
+            ord = parse_ordinal(tokens[0])
+            # Ordinals in PE files are 16-bit.
+            if 0 <= ord <= 0xffff:
+                ords[ord] = tokens[1] if len(tokens) > 1 else b''
+    return ords
+
+
+def get_ord_files(ordinals_dir):
+    """ Get sorted names of all the *.ord files in the given directory.
+    """
+    return [f for f in sorted(os.listdir(ordinals_dir))
+            if f.endswith(ORD_SUFFIX) and os.path.isfile(os.path.join(ordinals_dir, f))]
+
+
+def build_database(ordinals_dir):
+    """ Build the contents of the binary database from all the *.ord files in
+    the given directory.
+    """
+    libs = []
+    for filename in get_ord_files(ordinals_dir):
+        path = os.path.join(ordinals_dir, filename)
+        libs.append((os.fsencode(filename[:-len(ORD_SUFFIX)]), read_ord_file(path)))
+
+    slot_count = 1
+    while slot_count < 2 * len(libs):
+        slot_count *= 2
+
+    header_size = len(MAGIC) + 8
+    tables_offset = header_size + slot_count * 20
+    tables_size = sum(max(ords) - min(ords) + 1 for _, ords in libs if ords) * 4
+    strings = bytearray()
+    string_offsets = {}
+
+    def add_string(s, null_terminated):
+        key = (s, null_terminated)
+        if key not in string_offsets:
+            string_offsets[key] = tables_offset + tables_size + len(strings)
+            strings.extend(s + (b'\0' if null_terminated else b''))
+        return string_offsets[key]
+
+    slots = [(0, 0, 0, 0, 0)] * slot_count
+    tables = bytearray()
+    for name, ords in libs:
+        first = min(ords) if ords else 0
+        count = max(ords) - first + 1 if ords else 0
+        table_offset = tables_offset + len(tables)
+        for ord in range(first, first + count):
+            func_name = ords.get(ord)
+            offset = add_string(func_name, True) if func_name else 0
+            tables.extend(struct.pack('<I', offset))
+
+        slot = fnv1a(name) & (slot_count - 1)
+        while slots[slot][0] != 0:
+            slot = (slot + 1) & (slot_count - 1)
+        slots[slot] = (add_string(name, False), len(name), first, count, table_offset)
+
+    data = bytearray(MAGIC)
+    data.extend(struct.pack('<II', slot_count, len(libs)))
+    for slot in slots:
+        data.extend(struct.pack('<IIIII', *slot))
+    data.extend(tables)
+    data.extend(strings)
+    return bytes(data)
+
+
+def read_inputs_list(path):
+    """ Read the list of *.ord files from which the database was generated,
+    return None if there is no such list.
+    """
+    try:
+        with open(path, 'r', encoding='utf-8') as f:
+            return f.read().splitlines()
+    except (OSError, UnicodeDecodeError):
+        return None
+
+
+def install_database(ordinals_dir, output):
+    """ Generate the database from the given directory into the given file.
+    The database is generated only if it does not exist, if any of the *.ord
+    files is newer (timestamp), or if *.ord files were added or removed since
+    it was generated. Names of the *.ord files are stored next to the
+    database (<output>.inputs) to detect the last case.
+    """
+    ord_files = get_ord_files(ordinals_dir)
+    inputs_list = output + INPUTS_SUFFIX
+    inputs = [os.path.join(ordinals_dir, f) for f in ord_files]
+    if (os.path.isfile(output)
+            and read_inputs_list(inputs_list) == ord_files
+            and all(os.path.getmtime(output) >= os.path.getmtime(i) for i in inputs)):
+        return
+
+    print('-- Installing:', output)
+    os.makedirs(os.path.dirname(output), exist_ok=True)
+    data = build_database(ordinals_dir)
+    with open(output, 'wb') as f:
+        f.write(data)
+    # Written after the database, so an interrupted run generates it again.
+    with open(inputs_list, 'w', encoding='utf-8') as f:
+        f.write(''.join(name + '\n' for name in ord_files))
+
+
+def main():
+    ordinals_dir, install_dir = get_arguments()
+    for arch in sorted(os.listdir(ordinals_dir)):
+        arch_dir = os.path.join(ordinals_dir, arch)
+        if os.path.isdir(arch_dir):
+            install_database(arch_dir, os.path.join(install_dir, arch, 'ords', DB_NAME))
+
+    sys.exit(0)
+
+
+if __name__ == '__main__':
+    main()
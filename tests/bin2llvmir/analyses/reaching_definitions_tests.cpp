@@ -44,6 +44,161 @@ DummyTest)
 	EXPECT_EQ( nullptr, module->getGlobalVariable("glob1") );
 }
 
+TEST_F(ReachingDefinitionsTests,
+DefinitionsReachUsesThroughLoops)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		@glob1 = global i32 0
+		define void @func1() {
+		entry:
+			store i32 1, i32* @glob0
+			store i32 1, i32* @glob1
+			br label %loop
+		loop:
+			%x = load i32, i32* @glob0
+			%y = load i32, i32* @glob1
+			store i32 2, i32* @glob0
+			%c = icmp eq i32 %x, 0
+			br i1 %c, label %loop, label %exit
+		exit:
+			%z = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s0 = getNthInstruction<StoreInst>(0);
+	auto* s1 = getNthInstruction<StoreInst>(1);
+	auto* s2 = getNthInstruction<StoreInst>(2);
+	auto* x = getNthInstruction<LoadInst>(0);
+	auto* y = getNthInstruction<LoadInst>(1);
+	auto* z = getNthInstruction<LoadInst>(2);
+
+	RDA.runOnModule(*module);
+
+	std::set<Instruction*> xDefs;
+	for (auto* d : RDA.defsFromUse(x))
+	{
+		xDefs.insert(d->def);
+	}
+	EXPECT_EQ(std::set<Instruction*>({s0, s2}), xDefs);
+	ASSERT_EQ(1, RDA.defsFromUse(y).size());
+	EXPECT_EQ(s1, (*RDA.defsFromUse(y).begin())->def);
+	ASSERT_EQ(1, RDA.defsFromUse(z).size());
+	EXPECT_EQ(s2, (*RDA.defsFromUse(z).begin())->def);
+	EXPECT_EQ(2, RDA.usesFromDef(s2).size());
+}
+
+TEST_F(ReachingDefinitionsTests,
+UpdateWithoutChangesKeepsResults)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+			store i32 1, i32* @glob0
+			%x = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s = getNthInstruction<StoreInst>();
+	auto* l = getNthInstruction<LoadInst>();
+
+	RDA.runOnModule(*module);
+	auto* def = RDA.getDef(s);
+
+	EXPECT_FALSE(RDA.update(*module));
+	EXPECT_EQ(def, RDA.getDef(s));
+	ASSERT_EQ(1, RDA.defsFromUse(l).size());
+	EXPECT_EQ(s, (*RDA.defsFromUse(l).begin())->def);
+}
+
+TEST_F(ReachingDefinitionsTests,
+UpdateRecomputesOnlyChangedFunctions)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+			store i32 1, i32* @glob0
+			%x = load i32, i32* @glob0
+			ret void
+		}
+		define void @func2() {
+			store i32 2, i32* @glob0
+			%y = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* f1 = getFunctionByName("func1");
+	auto* f2 = getFunctionByName("func2");
+	auto* l1 = getNthInstruction<LoadInst>(f1);
+	auto* s2 = getNthInstruction<StoreInst>(f2);
+
+	RDA.runOnModule(*module);
+	auto* def2 = RDA.getDef(s2);
+
+	auto* s1 = new StoreInst(
+			ConstantInt::get(Type::getInt32Ty(context), 3),
+			getGlobalByName("glob0"),
+			l1);
+
+	EXPECT_TRUE(RDA.update(*module));
+	EXPECT_EQ(def2, RDA.getDef(s2));
+	ASSERT_EQ(1, RDA.defsFromUse(l1).size());
+	EXPECT_EQ(s1, (*RDA.defsFromUse(l1).begin())->def);
+}
+
+TEST_F(ReachingDefinitionsTests,
+UpdateRecomputesInvalidatedFunctions)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+			store i32 1, i32* @glob0
+			ret void
+		}
+	)");
+	auto* f1 = getFunctionByName("func1");
+
+	RDA.runOnModule(*module);
+	RDA.invalidateFunction(f1);
+
+	EXPECT_TRUE(RDA.update(*module));
+	EXPECT_FALSE(RDA.update(*module));
+}
+
+TEST_F(ReachingDefinitionsTests,
+FunctionsCanBeAnalyzedInParallel)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+			store i32 1, i32* @glob0
+			%x = load i32, i32* @glob0
+			ret void
+		}
+		define void @func2() {
+			store i32 2, i32* @glob0
+			%y = load i32, i32* @glob0
+			ret void
+		}
+		declare void @func3()
+	)");
+	auto* f1 = getFunctionByName("func1");
+	auto* f2 = getFunctionByName("func2");
+	auto* s1 = getNthInstruction<StoreInst>(f1);
+	auto* l1 = getNthInstruction<LoadInst>(f1);
+	auto* s2 = getNthInstruction<StoreInst>(f2);
+	auto* l2 = getNthInstruction<LoadInst>(f2);
+
+	RDA.setJobs(4);
+	RDA.runOnModule(*module);
+
+	ASSERT_EQ(1, RDA.defsFromUse(l1).size());
+	EXPECT_EQ(s1, (*RDA.defsFromUse(l1).begin())->def);
+	ASSERT_EQ(1, RDA.defsFromUse(l2).size());
+	EXPECT_EQ(s2, (*RDA.defsFromUse(l2).begin())->def);
+	EXPECT_FALSE(RDA.update(*module));
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
@@ -0,0 +1,183 @@
+/**
+* @file tests/bin2llvmir/optimizations/decoder/dry_run_insn_cache_tests.cpp
+* @brief Tests for the @c DryRunInsnCache.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/optimizations/decoder/dry_run_insn_cache.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c DryRunInsnCache.
+ */
+class DryRunInsnCacheTests: public Test
+{
+	public:
+		DryRunInsnCacheTests()
+		{
+			cs_open(CS_ARCH_X86, CS_MODE_32, &ce);
+			cs_option(ce, CS_OPT_DETAIL, CS_OPT_ON);
+		}
+
+		~DryRunInsnCacheTests()
+		{
+			cs_close(&ce);
+		}
+
+	protected:
+		/// Disassemble the first instruction of @p bytes on @p a as a dry run
+		/// does it.
+		cs_insn* disasm(Address a, const std::vector<std::uint8_t>& bytes)
+		{
+			const std::uint8_t* code = bytes.data();
+			std::size_t size = bytes.size();
+			std::uint64_t addr = a;
+			cs_insn* insn = cache.getScratch(ce);
+			if (!cs_disasm_iter(ce, &code, &size, &addr, insn))
+			{
+				return nullptr;
+			}
+			return cache.keepScratch(a, CS_MODE_32);
+		}
+
+	protected:
+		csh ce = 0;
+		DryRunInsnCache cache;
+		/// push ebp
+		const std::vector<std::uint8_t> push = {0x55};
+		/// mov ebp, esp
+		const std::vector<std::uint8_t> mov = {0x89, 0xe5};
+		/// mov eax, 1
+		const std::vector<std::uint8_t> movImm = {0xb8, 0x01, 0x00, 0x00, 0x00};
+};
+
+TEST_F(DryRunInsnCacheTests, keptInstructionIsTaken)
+{
+	auto* insn = disasm(0x1000, mov);
+	ASSERT_NE(nullptr, insn);
+
+	auto* taken = cache.take(0x1000, CS_MODE_32, 16);
+
+	EXPECT_EQ(insn, taken);
+	EXPECT_EQ(2, taken->size);
+	EXPECT_EQ(X86_INS_MOV, taken->id);
+	EXPECT_EQ(0, cache.size());
+	cs_free(taken, 1);
+}
+
+TEST_F(DryRunInsnCacheTests, instructionIsTakenOnlyOnce)
+{
+	disasm(0x1000, push);
+
+	auto* taken = cache.take(0x1000, CS_MODE_32, 16);
+
+	EXPECT_NE(nullptr, taken);
+	EXPECT_EQ(nullptr, cache.take(0x1000, CS_MODE_32, 16));
+	cs_free(taken, 1);
+}
+
+TEST_F(DryRunInsnCacheTests, instructionIsNotTakenOnOtherAddressOrInOtherMode)
+{
+	disasm(0x1000, push);
+
+	EXPECT_EQ(nullptr, cache.take(0x1001, CS_MODE_32, 16));
+	EXPECT_EQ(nullptr, cache.take(0x1000, CS_MODE_64, 16));
+	EXPECT_EQ(1, cache.size());
+}
+
+TEST_F(DryRunInsnCacheTests, instructionLongerThanAvailableBytesIsNotTaken)
+{
+	disasm(0x1000, movImm);
+
+	EXPECT_EQ(nullptr, cache.take(0x1000, CS_MODE_32, 4));
+	auto* taken = cache.take(0x1000, CS_MODE_32, 5);
+	EXPECT_NE(nullptr, taken);
+	cs_free(taken, 1);
+}
+
+TEST_F(DryRunInsnCacheTests, scratchIsSameUntilItIsKept)
+{
+	auto* scratch = cache.getScratch(ce);
+
+	EXPECT_EQ(scratch, cache.getScratch(ce));
+	EXPECT_EQ(scratch, disasm(0x1000, push));
+	EXPECT_NE(scratch, cache.getScratch(ce));
+}
+
+TEST_F(DryRunInsnCacheTests, failedDisassemblyKeepsNothing)
+{
+	// An incomplete instruction.
+	EXPECT_EQ(nullptr, disasm(0x1000, {0xb8, 0x01}));
+
+	EXPECT_EQ(0, cache.size());
+}
+
+TEST_F(DryRunInsnCacheTests, clearDropsKeptInstructions)
+{
+	disasm(0x1000, push);
+	disasm(0x1001, mov);
+	disasm(0x1003, movImm);
+
+	cache.clear();
+
+	EXPECT_EQ(0, cache.size());
+	EXPECT_EQ(3, cache.freeSize());
+	EXPECT_EQ(nullptr, cache.take(0x1000, CS_MODE_32, 16));
+	EXPECT_EQ(nullptr, cache.take(0x1001, CS_MODE_32, 16));
+	EXPECT_EQ(nullptr, cache.take(0x1003, CS_MODE_32, 16));
+}
+
+TEST_F(DryRunInsnCacheTests, instructionsDroppedByClearAreReusedByNextDryRun)
+{
+	std::vector<cs_insn*> dropped = {
+			disasm(0x1000, push),
+			disasm(0x1001, mov),
+			disasm(0x1003, movImm)};
+	cache.clear();
+
+	std::vector<cs_insn*> reused = {
+			disasm(0x2000, push),
+			disasm(0x2001, mov),
+			disasm(0x2003, movImm)};
+
+	EXPECT_EQ(0, cache.freeSize());
+	for (auto* insn : reused)
+	{
+		EXPECT_NE(dropped.end(), std::find(dropped.begin(), dropped.end(), insn));
+	}
+	// There is nothing more to reuse.
+	auto* scratch = cache.getScratch(ce);
+	EXPECT_EQ(dropped.end(), std::find(dropped.begin(), dropped.end(), scratch));
+}
+
+TEST_F(DryRunInsnCacheTests, instructionKeptAgainOnSameAddressReplacesPreviousOne)
+{
+	auto* first = disasm(0x1000, push);
+
+	auto* second = disasm(0x1000, mov);
+
+	EXPECT_NE(first, second);
+	EXPECT_EQ(1, cache.size());
+	// The replaced instruction is reused.
+	EXPECT_EQ(first, cache.getScratch(ce));
+	auto* taken = cache.take(0x1000, CS_MODE_32, 16);
+	EXPECT_EQ(second, taken);
+	EXPECT_EQ(X86_INS_MOV, taken->id);
+	cs_free(taken, 1);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -0,0 +1,331 @@
+/**
+* @file tests/bin2llvmir/optimizations/idioms/idioms_analysis_tests.cpp
+* @brief Tests for the @c IdiomsAnalysis.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/optimizations/idioms/idioms_analysis.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c IdiomsAnalysis.
+ */
+class IdiomsAnalysisTests: public LlvmIrTests
+{
+	protected:
+		bool runAnalysis(CC_compiler cc, CC_arch arch)
+		{
+			IdiomsAnalysis analysis(module.get(), cc, arch);
+			return analysis.doAnalysis(*getFunctionByName("fnc"), nullptr);
+		}
+};
+
+TEST_F(IdiomsAnalysisTests, noIdiomReturnsFalse)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = add i32 %a, 1
+			ret i32 %b
+		}
+	)");
+
+	bool ret = runAnalysis(CC_LLVM, ARCH_ANY);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%b = add i32 %a, 1
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_FALSE(ret);
+}
+
+//
+// One idiom of every family of exchangers.
+//
+
+TEST_F(IdiomsAnalysisTests, commonBitShiftMul)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = shl i32 %a, 3
+			ret i32 %b
+		}
+	)");
+
+	bool ret = runAnalysis(CC_ANY, ARCH_ANY);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%b = mul i32 %a, 8
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, commonGreaterEqualZeroWithXorRoot)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = lshr i32 %a, 31
+			%c = xor i32 %b, 1
+			ret i32 %c
+		}
+	)");
+
+	bool ret = runAnalysis(CC_GCC, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%1 = icmp sge i32 %a, 0
+			%c = zext i1 %1 to i32
+			ret i32 %c
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, commonGreaterEqualZeroWithLShrRoot)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = xor i32 %a, -1
+			%c = lshr i32 %b, 31
+			ret i32 %c
+		}
+	)");
+
+	bool ret = runAnalysis(CC_GCC, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%1 = sub i32 0, %a
+			%b = sub i32 %1, 1
+			%2 = icmp sge i32 %a, 0
+			%c = zext i1 %2 to i32
+			ret i32 %c
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, gccXorMinusOne)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = xor i32 %a, -1
+			ret i32 %b
+		}
+	)");
+
+	bool ret = runAnalysis(CC_GCC, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%1 = sub i32 0, %a
+			%b = sub i32 %1, 1
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, llvmIsGreaterThanMinusOne)
+{
+	parseInput(R"(
+		define i1 @fnc(i32 %a) {
+			%b = and i32 %a, -2147483648
+			%c = icmp eq i32 %b, 0
+			ret i1 %c
+		}
+	)");
+
+	bool ret = runAnalysis(CC_LLVM, ARCH_ANY);
+
+	std::string exp = R"(
+		define i1 @fnc(i32 %a) {
+			%c = icmp sgt i32 %a, -1
+			ret i1 %c
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, magicDivModUnsignedMod)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = udiv i32 %a, 10
+			%c = sub i32 %a, %b
+			ret i32 %c
+		}
+	)");
+
+	bool ret = runAnalysis(CC_VStudio, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%c = urem i32 %a, 10
+			ret i32 %c
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, vstudioAndZeroAssign)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = and i32 %a, 0
+			ret i32 %b
+		}
+	)");
+
+	bool ret = runAnalysis(CC_VStudio, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%b = add i32 0, 0
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, exchangersForOtherCompilersAreNotUsed)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = and i32 %a, 0
+			ret i32 %b
+		}
+	)");
+
+	bool ret = runAnalysis(CC_LLVM, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%b = and i32 %a, 0
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_FALSE(ret);
+}
+
+//
+// Order of exchanges.
+//
+
+TEST_F(IdiomsAnalysisTests, earlierRegisteredExchangerWinsOverLaterOneRootedAfterIt)
+{
+	// unsigned modulo (x & 7) is registered before the signed division
+	// ((x >> 31) & mask) | (x >> 3), so the division is not exchanged, even
+	// though its root is later in the basic block.
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = ashr i32 %a, 31
+			%c = and i32 %b, 7
+			%d = lshr i32 %a, 3
+			%e = or i32 %c, %d
+			ret i32 %e
+		}
+	)");
+
+	bool ret = runAnalysis(CC_GCC, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%b = ashr i32 %a, 31
+			%c = urem i32 %b, 8
+			%d = udiv i32 %a, 8
+			%e = or i32 %c, %d
+			ret i32 %e
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, erasedInstructionsOfExchangedIdiomAreNotExchanged)
+{
+	// The signed division erases the ashr and lshr instructions, which would
+	// be exchanged by the later registered shift exchangers.
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = ashr i32 %a, 31
+			%c = and i32 %b, 7
+			%d = lshr i32 %a, 3
+			%e = or i32 %c, %d
+			ret i32 %e
+		}
+	)");
+
+	bool ret = runAnalysis(CC_LLVM, ARCH_x86);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%e = sdiv i32 %a, 8
+			ret i32 %e
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(ret);
+}
+
+TEST_F(IdiomsAnalysisTests, idiomCreatedByLaterRegisteredExchangerIsExchangedInNextRun)
+{
+	// The unsigned modulo needs the division created from the shift, but it is
+	// registered before the shift exchanger. The idioms pass is therefore run
+	// twice in the decompilation.
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = lshr i32 %a, 3
+			%c = sub i32 %a, %b
+			ret i32 %c
+		}
+	)");
+
+	bool ret1 = runAnalysis(CC_VStudio, ARCH_x86);
+
+	std::string exp1 = R"(
+		define i32 @fnc(i32 %a) {
+			%b = udiv i32 %a, 8
+			%c = sub i32 %a, %b
+			ret i32 %c
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp1);
+	EXPECT_TRUE(ret1);
+
+	bool ret2 = runAnalysis(CC_VStudio, ARCH_x86);
+
+	std::string exp2 = R"(
+		define i32 @fnc(i32 %a) {
+			%c = urem i32 %a, 8
+			ret i32 %c
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp2);
+	EXPECT_TRUE(ret2);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
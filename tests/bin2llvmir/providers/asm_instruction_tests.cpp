@@ -357,6 +357,49 @@ TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsValidForGoodAddre
 	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
 }
 
+TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsInvalidForErasedInstruction)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	ASSERT_TRUE(AsmInstruction(module.get(), 1234).isValid());
+
+	getNthInstruction<StoreInst>()->eraseFromParent();
+	auto a = AsmInstruction(module.get(), 1234);
+
+	EXPECT_TRUE(a.isInvalid());
+}
+
+TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsValidForAddedInstruction)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	ASSERT_TRUE(AsmInstruction(module.get(), 5678).isInvalid());
+
+	auto* ref = new StoreInst(
+			ConstantInt::get(Type::getInt64Ty(context), 5678),
+			mapGv,
+			getNthInstruction<ReturnInst>());
+	AsmInstruction::addLlvmToAsmInstruction(ref);
+	auto a = AsmInstruction(module.get(), 5678);
+
+	EXPECT_TRUE(a.isValid());
+	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
+}
+
 //
 // AsmInstruction(llvm::Function*)
 //
@@ -1706,6 +1749,56 @@ TEST_F(AsmInstructionTests, getInstructionFirstReturnsNullptrIfItDoesNotContainI
 	EXPECT_EQ(nullptr, ai.getInstructionFirst<llvm::CallInst>());
 }
 
+//
+// getCapstoneInsn()
+//
+
+TEST_F(AsmInstructionTests, getCapstoneInsnReturnsStoredCopyOfInstruction)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 4096, i64* @llvm2asm
+			store volatile i64 4097, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* s1 = getNthInstruction<StoreInst>(0);
+	auto* s2 = getNthInstruction<StoreInst>(1);
+
+	csh ce;
+	ASSERT_EQ(CS_ERR_OK, cs_open(CS_ARCH_X86, CS_MODE_32, &ce));
+	cs_option(ce, CS_OPT_DETAIL, CS_OPT_ON);
+	std::vector<uint8_t> bytes = {0x6a, 0x05}; // push 5
+	const uint8_t* code = bytes.data();
+	std::size_t size = bytes.size();
+	uint64_t address = 4096;
+	cs_insn* insn = cs_malloc(ce);
+	ASSERT_TRUE(cs_disasm_iter(ce, &code, &size, &address, insn));
+
+	auto& insnMap = AsmInstruction::getLlvmToCapstoneInsnMap(module.get());
+	insnMap.setArchitecture(CS_ARCH_X86);
+	auto* stored = insnMap.emplace(s1, insn);
+	cs_close(&ce);
+
+	ASSERT_NE(nullptr, stored);
+	EXPECT_EQ(stored, AsmInstruction(s1).getCapstoneInsn());
+	EXPECT_EQ(nullptr, AsmInstruction(s2).getCapstoneInsn());
+	EXPECT_EQ(X86_INS_PUSH, stored->id);
+	EXPECT_EQ(4096, stored->address);
+	EXPECT_EQ(2, stored->size);
+	EXPECT_EQ("push 5", AsmInstruction(s1).getDsm());
+	ASSERT_NE(nullptr, stored->detail);
+	EXPECT_EQ(1, stored->detail->x86.op_count);
+	EXPECT_EQ(X86_OP_IMM, stored->detail->x86.operands[0].type);
+	EXPECT_EQ(5, stored->detail->x86.operands[0].imm);
+
+	insnMap.clear();
+	EXPECT_EQ(nullptr, AsmInstruction(s1).getCapstoneInsn());
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
@@ -0,0 +1,128 @@
+/**
+* @file tests/bin2llvmir/providers/tests/names_tests.cpp
+* @brief Tests for the @c ImportOrdDatabase.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/providers/names.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c ImportOrdDatabase.
+ */
+class ImportOrdDatabaseTests: public Test
+{
+	protected:
+		void append32(std::string& data, uint32_t value)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				data.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+			}
+		}
+
+		/**
+		 * Create a database in the same way as support/install-ordinals.py
+		 * does, with one library whose function names are @a names
+		 * (ordinals from @a firstOrd, empty name = no function).
+		 */
+		std::unique_ptr<ImportOrdDatabase> createDatabase(
+				const std::string& libName,
+				uint32_t firstOrd,
+				const std::vector<std::string>& names)
+		{
+			const uint32_t slotCount = 2;
+			const uint32_t tablesOffset = 16 + slotCount * 20;
+			const uint32_t stringsOffset = tablesOffset + 4 * names.size();
+
+			std::string table;
+			std::string strings = libName;
+			for (auto& n : names)
+			{
+				if (n.empty())
+				{
+					append32(table, 0);
+				}
+				else
+				{
+					append32(table, stringsOffset + strings.size());
+					strings += n + '\0';
+				}
+			}
+
+			uint32_t hash = 2166136261u;
+			for (unsigned char c : libName)
+			{
+				hash = (hash ^ c) * 16777619u;
+			}
+
+			std::string data = "RDORDDB1";
+			append32(data, slotCount);
+			append32(data, 1);
+			for (uint32_t i = 0; i < slotCount; ++i)
+			{
+				bool used = i == (hash & (slotCount - 1));
+				append32(data, used ? stringsOffset : 0);
+				append32(data, used ? libName.size() : 0);
+				append32(data, used ? firstOrd : 0);
+				append32(data, used ? names.size() : 0);
+				append32(data, used ? tablesOffset : 0);
+			}
+			data += table + strings;
+
+			return ImportOrdDatabase::fromBuffer(
+					MemoryBuffer::getMemBufferCopy(data));
+		}
+};
+
+TEST_F(ImportOrdDatabaseTests, fromBufferReturnsNullptrForInvalidData)
+{
+	EXPECT_EQ(nullptr, ImportOrdDatabase::fromBuffer(
+			MemoryBuffer::getMemBufferCopy("")));
+	EXPECT_EQ(nullptr, ImportOrdDatabase::fromBuffer(
+			MemoryBuffer::getMemBufferCopy("1 DummyEntryPoint\n")));
+}
+
+TEST_F(ImportOrdDatabaseTests, hasLibraryReturnsTrueOnlyForLibrariesInDatabase)
+{
+	auto db = createDatabase("ws2_32", 1, {"accept", "bind"});
+	ASSERT_NE(nullptr, db);
+
+	EXPECT_TRUE(db->hasLibrary("ws2_32"));
+	EXPECT_FALSE(db->hasLibrary("ws2_3"));
+	EXPECT_FALSE(db->hasLibrary("kernel32"));
+}
+
+TEST_F(ImportOrdDatabaseTests, getFunctionNameReturnsNameOfFunctionWithOrdinal)
+{
+	auto db = createDatabase("ws2_32", 1, {"accept", "bind", "", "closesocket"});
+	ASSERT_NE(nullptr, db);
+
+	EXPECT_EQ("accept", db->getFunctionName("ws2_32", 1));
+	EXPECT_EQ("bind", db->getFunctionName("ws2_32", 2));
+	EXPECT_EQ("closesocket", db->getFunctionName("ws2_32", 4));
+}
+
+TEST_F(ImportOrdDatabaseTests, getFunctionNameReturnsEmptyStringForUnknownFunction)
+{
+	auto db = createDatabase("ws2_32", 1, {"accept", "bind", "", "closesocket"});
+	ASSERT_NE(nullptr, db);
+
+	EXPECT_EQ("", db->getFunctionName("ws2_32", -1));
+	EXPECT_EQ("", db->getFunctionName("ws2_32", 0));
+	EXPECT_EQ("", db->getFunctionName("ws2_32", 3));
+	EXPECT_EQ("", db->getFunctionName("ws2_32", 5));
+	EXPECT_EQ("", db->getFunctionName("kernel32", 1));
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -20,6 +20,7 @@
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
 #include "retdec/loader/loader.h"
@@ -62,6 +63,7 @@ class LlvmIrTests : public ::testing::Test
 			FileImageProvider::clear();
 			AsmInstruction::clear();
 			LtiProvider::clear();
+			ReachingDefinitionsProvider::clear();
 		}
 
 		/**
@@ -0,0 +1,275 @@
+/**
+* @file tests/cpdetect/search_tests.cpp
+* @brief Tests for the @c search module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/compiler_detector/search/search.h"
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/utils/conversion.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+namespace
+{
+
+/**
+ * Generate pseudo-random bytes with only a few distinct nibbles, so that
+ * signatures match on many offsets
+ */
+std::vector<std::uint8_t> generateBytes(std::size_t size, std::uint32_t seed)
+{
+	std::vector<std::uint8_t> bytes;
+	for(std::size_t i = 0; i < size; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		bytes.push_back(((seed >> 16) & 0x33) | 0x40);
+	}
+
+	return bytes;
+}
+
+} // anonymous namespace
+
+/**
+ * Tests for the @c search module
+ */
+class SearchTests : public Test
+{
+	protected:
+		std::vector<std::uint8_t> bytes;
+		std::unique_ptr<RawDataFormat> parser;
+		std::unique_ptr<Search> search;
+
+		void createSearch(const std::vector<std::uint8_t> &content, Endianness endianness = Endianness::LITTLE, std::size_t bytesPerWord = 4)
+		{
+			search.reset();
+			bytes = content;
+			parser = std::make_unique<RawDataFormat>(bytes.data(), bytes.size());
+			parser->setEndianness(endianness);
+			parser->setBytesPerWord(bytesPerWord);
+			search = std::make_unique<Search>(*parser);
+		}
+
+		/**
+		 * Find signature the way it was found before signatures were compiled
+		 * into byte patterns - by a scalar search in the hexadecimal
+		 * representation of the file
+		 */
+		unsigned long long findInNibbles(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const
+		{
+			std::string nibbles;
+			bytesToHexString(parser->getLoadedBytes(), nibbles);
+			parser->hexToLittle(nibbles);
+
+			if(startOffset > stopOffset)
+			{
+				return 0;
+			}
+
+			const auto startIterator = nibbles.begin() + std::min(parser->nibblesFromBytes(startOffset), nibbles.size());
+			const auto stopIndex = parser->nibblesFromBytes(stopOffset) + 1;
+			const auto stopIterator = stopIndex < nibbles.size() ? nibbles.begin() + stopIndex : nibbles.end();
+			if(startIterator >= stopIterator)
+			{
+				return 0;
+			}
+
+			const auto it = std::search(startIterator, stopIterator, signPattern.begin(), signPattern.end(),
+				[] (const char fileNibble, const char signatureNibble)
+				{
+					return fileNibble == signatureNibble || signatureNibble == '-' || signatureNibble == '?' || signatureNibble == ';';
+				}
+			);
+			return (it != stopIterator) ? search->countImpNibbles(signPattern) : 0;
+		}
+
+		/**
+		 * Check that @a signPattern is found in the same areas of the file
+		 * as by the scalar search in the hexadecimal representation
+		 */
+		void expectSameResultsAsInNibbles(const std::string &signPattern)
+		{
+			for(std::size_t start = 0; start < bytes.size(); ++start)
+			{
+				for(std::size_t stop = start; stop <= bytes.size() + 1; ++stop)
+				{
+					ASSERT_EQ(findInNibbles(signPattern, start, stop), search->findUnslashedSignature(signPattern, start, stop))
+						<< "signature " << signPattern << ", area <" << start << ", " << stop << ">";
+				}
+			}
+		}
+};
+
+TEST_F(SearchTests, SignatureOnEvenNibbleOffsetIsFound)
+{
+	createSearch({0x12, 0x34, 0x56, 0x78, 0x9A});
+
+	EXPECT_EQ(4, search->findUnslashedSignature("3456", 0, 4));
+	EXPECT_EQ(0, search->findUnslashedSignature("3456", 2, 4));
+	expectSameResultsAsInNibbles("3456");
+}
+
+TEST_F(SearchTests, SignatureOnOddNibbleOffsetIsFound)
+{
+	createSearch({0x12, 0x34, 0x56, 0x78, 0x9A});
+
+	EXPECT_EQ(4, search->findUnslashedSignature("2345", 0, 4));
+	EXPECT_EQ(3, search->findUnslashedSignature("89A", 0, 5));
+	EXPECT_EQ(0, search->findUnslashedSignature("2345", 1, 4));
+	expectSameResultsAsInNibbles("2345");
+	expectSameResultsAsInNibbles("789");
+}
+
+TEST_F(SearchTests, SignatureWithWildcardsAtStartAndEndIsFound)
+{
+	createSearch({0x12, 0x34, 0x56, 0x78, 0x9A});
+
+	EXPECT_EQ(2, search->findUnslashedSignature("--45--", 0, 4));
+	EXPECT_EQ(2, search->findUnslashedSignature("??45??", 0, 4));
+	EXPECT_EQ(2, search->findUnslashedSignature("?78;", 0, 4));
+	// There is no nibble after the last one
+	EXPECT_EQ(0, search->findUnslashedSignature("9A-", 0, 5));
+	// There is no nibble before the first one in the area
+	EXPECT_EQ(0, search->findUnslashedSignature("-34", 1, 4));
+	expectSameResultsAsInNibbles("--45--");
+	expectSameResultsAsInNibbles("-3-5-");
+	expectSameResultsAsInNibbles("?78;");
+	expectSameResultsAsInNibbles("?9A;");
+	expectSameResultsAsInNibbles("9A-");
+	expectSameResultsAsInNibbles("----");
+}
+
+TEST_F(SearchTests, SignatureShorterThanSixteenBytesIsFoundInAllPartsOfLongFile)
+{
+	std::vector<std::uint8_t> content(100, 0x00);
+	// In the first block of 16 offsets, in the last full block and after it
+	content[3] = 0xAB;
+	content[4] = 0xCD;
+	content[70] = 0xAB;
+	content[71] = 0xCE;
+	content[98] = 0xAB;
+	content[99] = 0xCF;
+	createSearch(content);
+
+	EXPECT_EQ(4, search->findUnslashedSignature("ABCD", 0, 100));
+	EXPECT_EQ(0, search->findUnslashedSignature("ABCD", 4, 100));
+	EXPECT_EQ(4, search->findUnslashedSignature("ABCE", 0, 100));
+	EXPECT_EQ(4, search->findUnslashedSignature("ABCF", 0, 100));
+	EXPECT_EQ(3, search->findUnslashedSignature("BCF", 0, 100));
+	EXPECT_EQ(1, search->findUnslashedSignature("F", 0, 100));
+	expectSameResultsAsInNibbles("ABCD");
+	expectSameResultsAsInNibbles("BCE");
+	expectSameResultsAsInNibbles("ABCF");
+	expectSameResultsAsInNibbles("F");
+}
+
+TEST_F(SearchTests, SignatureLongerThanSixteenBytesIsFound)
+{
+	const auto content = generateBytes(100, 1);
+	createSearch(content);
+
+	std::string signature;
+	bytesToHexString(content, signature, 50, 20);
+	signature[0] = '-';
+	signature.back() = '?';
+
+	EXPECT_EQ(38, search->findUnslashedSignature(signature, 0, 99));
+	expectSameResultsAsInNibbles(signature);
+	expectSameResultsAsInNibbles(signature.substr(1));
+}
+
+TEST_F(SearchTests, SignatureOnLastOffsetOfAreaIsFound)
+{
+	std::vector<std::uint8_t> content(40, 0x00);
+	content[20] = 0x12;
+	content[21] = 0x34;
+	createSearch(content);
+
+	// The area ends with the first nibble of the byte on the stop offset
+	EXPECT_EQ(2, search->findUnslashedSignature("12", 0, 21));
+	EXPECT_EQ(2, search->findUnslashedSignature("23", 0, 21));
+	EXPECT_EQ(0, search->findUnslashedSignature("12", 0, 20));
+	EXPECT_EQ(0, search->findUnslashedSignature("23", 0, 20));
+	EXPECT_EQ(4, search->findUnslashedSignature("1234", 20, 22));
+	EXPECT_EQ(0, search->findUnslashedSignature("1234", 20, 21));
+	EXPECT_EQ(0, search->findUnslashedSignature("1234", 21, 39));
+	// Signature ends on the last nibble of the file
+	EXPECT_EQ(2, search->findUnslashedSignature("00", 39, 40));
+	EXPECT_EQ(1, search->findUnslashedSignature("-0", 39, 100));
+	EXPECT_EQ(0, search->findUnslashedSignature("00", 39, 39));
+	expectSameResultsAsInNibbles("12");
+	expectSameResultsAsInNibbles("23");
+	expectSameResultsAsInNibbles("1234");
+	expectSameResultsAsInNibbles("234");
+	expectSameResultsAsInNibbles("4000");
+}
+
+TEST_F(SearchTests, SignatureWithInvalidCharacterIsNotFound)
+{
+	createSearch({0x12, 0x34, 0x56, 0x78, 0x9A});
+
+	EXPECT_EQ(0, search->findUnslashedSignature("12X4", 0, 4));
+	EXPECT_EQ(0, search->findUnslashedSignature("12a4", 0, 4));
+	expectSameResultsAsInNibbles("12X4");
+}
+
+TEST_F(SearchTests, SignatureIsFoundInBigEndianFileInLittleEndianOrder)
+{
+	createSearch({0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x11}, Endianness::BIG);
+
+	EXPECT_EQ(8, search->findUnslashedSignature("78563412", 0, 8));
+	EXPECT_EQ(4, search->findUnslashedSignature("12F0", 0, 8));
+	EXPECT_EQ(0, search->findUnslashedSignature("12345678", 0, 8));
+	// Bytes after the last whole word are not searched
+	EXPECT_EQ(0, search->findUnslashedSignature("11", 0, 8));
+	expectSameResultsAsInNibbles("78563412");
+	expectSameResultsAsInNibbles("2F0DEB");
+	expectSameResultsAsInNibbles("9A");
+	expectSameResultsAsInNibbles("11");
+}
+
+TEST_F(SearchTests, GeneratedSignaturesAreFoundAsInNibbles)
+{
+	const std::vector<Endianness> endiannesses = {Endianness::LITTLE, Endianness::BIG};
+	for(const auto endianness : endiannesses)
+	{
+		const auto content = generateBytes(70, 2);
+		createSearch(content, endianness, 2);
+
+		std::string nibbles;
+		bytesToHexString(content, nibbles);
+		parser->hexToLittle(nibbles);
+		for(std::size_t offset = 0; offset < 24; offset += 3)
+		{
+			for(std::size_t length = 1; length < 40; length += 7)
+			{
+				auto signature = nibbles.substr(offset, length);
+				expectSameResultsAsInNibbles(signature);
+				signature[length / 2] = '-';
+				expectSameResultsAsInNibbles(signature);
+				// Change one nibble, so that signature is not found in some areas
+				signature[length - 1] = signature[length - 1] == '4' ? '7' : '4';
+				expectSameResultsAsInNibbles(signature);
+			}
+		}
+	}
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
@@ -1952,6 +1952,247 @@ ParsingCircularTypedefsBreaksLoopAndSetsTypedefToUnknownType)
 	EXPECT_EQ(retdec::ctypes::UnknownType::create(), type3->getAliasedType());
 }
 
+TEST_F(JSONCTypesParserTests,
+IndexFunctionsDoesNotParseFunctions)
+{
+	std::stringstream json(R"(
+		{
+			"functions": {
+				"ff": {
+					"decl": "int ff(int b);",
+					"header": "CHeader.h",
+					"name": "ff",
+					"params": [
+						{
+							"name": "b",
+							"type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+						}
+					],
+					"ret_type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+				}
+			},
+			"types": {
+				"46f8ab7c0cff9df7cd124852e26022a6bf89e315": {
+					"name": "int",
+					"type": "integral_type"
+				}
+			}
+		}
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+
+	parser.indexFunctions(json, context);
+
+	EXPECT_TRUE(parser.hasIndexedFunction("ff"));
+	EXPECT_FALSE(parser.hasIndexedFunction("gg"));
+	EXPECT_FALSE(context->hasFunctionWithName("ff"));
+}
+
+TEST_F(JSONCTypesParserTests,
+ParseIndexedFunctionParsesFunctionWhenAskedFor)
+{
+	std::stringstream json(R"(
+		{
+			"functions": {
+				"ff": {
+					"decl": "int ff(int b);",
+					"header": "CHeader.h",
+					"name": "ff",
+					"params": [
+						{
+							"name": "b",
+							"type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+						}
+					],
+					"ret_type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+				},
+				"gg": {
+					"decl": "void gg();",
+					"header": "CHeader.h",
+					"name": "gg",
+					"params": [],
+					"ret_type": "5f3cd4ee5d0e5b8ad5e1c2a0b0ee5a0f7a93c0c1"
+				}
+			},
+			"types": {
+				"46f8ab7c0cff9df7cd124852e26022a6bf89e315": {
+					"name": "int",
+					"type": "integral_type"
+				},
+				"5f3cd4ee5d0e5b8ad5e1c2a0b0ee5a0f7a93c0c1": {
+					"type": "void"
+				}
+			}
+		}
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+	JSONCTypesParser::TypeWidths typeWidths{{"int", 32}};
+	parser.indexFunctions(json, context, typeWidths);
+
+	auto func = parser.parseIndexedFunction("ff");
+
+	ASSERT_TRUE(func);
+	EXPECT_EQ("int", func->getReturnType()->getName());
+	EXPECT_EQ(32, func->getReturnType()->getBitWidth());
+	ASSERT_EQ(1, func->getParameterCount());
+	EXPECT_EQ("b", func->getParameterName(1));
+	EXPECT_EQ("int ff(int b);", std::string(func->getDeclaration()));
+	EXPECT_TRUE(context->hasFunctionWithName("ff"));
+	EXPECT_FALSE(context->hasFunctionWithName("gg"));
+	EXPECT_EQ(func, parser.parseIndexedFunction("ff"));
+}
+
+TEST_F(JSONCTypesParserTests,
+ParseIndexedFunctionReturnsNullptrForFunctionThatIsNotIndexed)
+{
+	std::stringstream json(R"(
+		{
+			"functions": {},
+			"types": {}
+		}
+	)");
+	parser.indexFunctions(json, std::make_shared<retdec::ctypes::Context>());
+
+	EXPECT_EQ(nullptr, parser.parseIndexedFunction("ff"));
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexingJSONWithoutFunctionsItemThrowsException)
+{
+	std::stringstream json(R"(
+		{
+			"types": {}
+		}
+	)");
+
+	ASSERT_THROW(
+		parser.indexFunctions(json, std::make_shared<retdec::ctypes::Context>()),
+		CTypesParseError
+	);
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexedJSONCanBeSharedByParsersWithDifferentContexts)
+{
+	std::stringstream json(R"(
+		{
+			"functions": {
+				"ff": {
+					"decl": "int ff(int b);",
+					"header": "CHeader.h",
+					"name": "ff",
+					"params": [
+						{
+							"name": "b",
+							"type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+						}
+					],
+					"ret_type": "46f8ab7c0cff9df7cd124852e26022a6bf89e315"
+				}
+			},
+			"types": {
+				"46f8ab7c0cff9df7cd124852e26022a6bf89e315": {
+					"name": "int",
+					"type": "integral_type"
+				}
+			}
+		}
+	)");
+	auto indexedJson = JSONCTypesParser::indexJson(json);
+	auto context1 = std::make_shared<retdec::ctypes::Context>();
+	auto context2 = std::make_shared<retdec::ctypes::Context>();
+	JSONCTypesParser::TypeWidths typeWidths{{"int", 32}};
+	JSONCTypesParser parser1;
+	JSONCTypesParser parser2;
+	parser1.indexFunctions(indexedJson, context1, typeWidths);
+	parser2.indexFunctions(indexedJson, context2, typeWidths);
+
+	auto func1 = parser1.parseIndexedFunction("ff");
+	auto func2 = parser2.parseIndexedFunction("ff");
+
+	ASSERT_TRUE(func1);
+	ASSERT_TRUE(func2);
+	EXPECT_NE(func1, func2);
+	EXPECT_EQ("int ff(int b);", std::string(func2->getDeclaration()));
+	EXPECT_EQ(32, func2->getReturnType()->getBitWidth());
+	EXPECT_TRUE(context1->hasFunctionWithName("ff"));
+	EXPECT_TRUE(context2->hasFunctionWithName("ff"));
+}
+
+TEST_F(JSONCTypesParserTests,
+ParserKeepsSharedIndexedJSONAlive)
+{
+	std::stringstream json(R"(
+		{
+			"functions": {
+				"gg": {
+					"decl": "void gg();",
+					"header": "CHeader.h",
+					"name": "gg",
+					"params": [],
+					"ret_type": "5f3cd4ee5d0e5b8ad5e1c2a0b0ee5a0f7a93c0c1"
+				}
+			},
+			"types": {
+				"5f3cd4ee5d0e5b8ad5e1c2a0b0ee5a0f7a93c0c1": {
+					"type": "void"
+				}
+			}
+		}
+	)");
+	auto indexedJson = JSONCTypesParser::indexJson(json);
+	parser.indexFunctions(indexedJson, std::make_shared<retdec::ctypes::Context>());
+	indexedJson.reset();
+
+	auto func = parser.parseIndexedFunction("gg");
+
+	ASSERT_TRUE(func);
+	EXPECT_EQ("void gg();", std::string(func->getDeclaration()));
+}
+
+TEST_F(JSONCTypesParserTests,
+ParsingJSONDiscardsIndexedFunctions)
+{
+	std::stringstream indexed(R"(
+		{
+			"functions": {
+				"gg": {
+					"decl": "void gg();",
+					"header": "CHeader.h",
+					"name": "gg",
+					"params": [],
+					"ret_type": "5f3cd4ee5d0e5b8ad5e1c2a0b0ee5a0f7a93c0c1"
+				}
+			},
+			"types": {
+				"5f3cd4ee5d0e5b8ad5e1c2a0b0ee5a0f7a93c0c1": {
+					"type": "void"
+				}
+			}
+		}
+	)");
+	std::stringstream parsed(R"(
+		{
+			"functions": {},
+			"types": {}
+		}
+	)");
+	parser.indexFunctions(indexed, std::make_shared<retdec::ctypes::Context>());
+
+	parser.parse(parsed);
+
+	EXPECT_FALSE(parser.hasIndexedFunction("gg"));
+	EXPECT_EQ(nullptr, parser.parseIndexedFunction("gg"));
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexingInvalidJSONThrowsException)
+{
+	std::stringstream json(R"({"functions": )");
+
+	ASSERT_THROW(JSONCTypesParser::indexJson(json), CTypesParseError);
+}
+
 } // namespace tests
 } // namespace ctypesparser
 } // namespace retdec
@@ -0,0 +1,113 @@
+/**
+* @file tests/decompiler/decompiler_tests.cpp
+* @brief Tests for the @c decompiler module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/decompiler/decompiler.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace decompiler {
+namespace tests {
+
+namespace {
+
+/// A small 32-bit x86 ELF executable that writes a string and exits.
+const std::vector<uint8_t> ELF_BYTES = {
+	0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x48, 0x69, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x0a,
+	0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x02, 0x00, 0x28, 0x00,
+	0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+	0x00, 0x80, 0x04, 0x08, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x90, 0x04, 0x08,
+	0xa4, 0x90, 0x04, 0x08, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x09, 0x00, 0x00, 0x00, 0xb9, 0x07, 0x90, 0x04, 0x08, 0xbb, 0x01, 0x00, 0x00, 0x00, 0xb8,
+	0x04, 0x00, 0x00, 0x00, 0xcd, 0x80, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00,
+	0xcd, 0x80, 0x00, 0x00
+};
+
+std::string readWholeFile(const std::string& path)
+{
+	std::ifstream in(path, std::ios::binary);
+	std::stringstream content;
+	content << in.rdbuf();
+	return content.str();
+}
+
+} // anonymous namespace
+
+/**
+ * @brief Tests for the @c decompiler module.
+ */
+class DecompilerTests : public Test
+{
+	public:
+		DecompilerTests() :
+			inputFile(TempDir() + "retdec-decompiler-tests-input.elf")
+		{
+			std::ofstream out(inputFile, std::ios::binary);
+			out.write(
+					reinterpret_cast<const char*>(ELF_BYTES.data()),
+					ELF_BYTES.size());
+		}
+
+		~DecompilerTests()
+		{
+			std::remove(inputFile.c_str());
+			for (auto& f : outputFiles)
+			{
+				std::remove(f.c_str());
+			}
+		}
+
+	protected:
+		DecompilationParams createParams(const std::string& name)
+		{
+			DecompilationParams params;
+			params.inputFile = inputFile;
+			params.outputFile = TempDir() + name + ".c";
+			params.outputConfigFile = TempDir() + name + ".config.json";
+			// There is no support package in the tests.
+			params.supportDirectory = TempDir();
+			params.noDefaultStaticSignatures = true;
+			// The outputs of the decompilations are compared.
+			params.backend.noTimeVaryingInfo = true;
+
+			outputFiles.push_back(params.outputFile);
+			outputFiles.push_back(params.outputConfigFile);
+			return params;
+		}
+
+	protected:
+		std::string inputFile;
+		std::vector<std::string> outputFiles;
+};
+
+TEST_F(DecompilerTests, SecondDecompilationInSameProcessGivesSameOutputAsFirstOne)
+{
+	auto first = createParams("retdec-decompiler-tests-first");
+	auto second = createParams("retdec-decompiler-tests-second");
+
+	ASSERT_EQ(ReturnCode::OK, decompile(first));
+	ASSERT_EQ(ReturnCode::OK, decompile(second));
+
+	auto firstOutput = readWholeFile(first.outputFile);
+	EXPECT_FALSE(firstOutput.empty());
+	EXPECT_EQ(firstOutput, readWholeFile(second.outputFile));
+}
+
+} // namespace tests
+} // namespace decompiler
+} // namespace retdec
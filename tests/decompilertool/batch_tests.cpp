@@ -0,0 +1,303 @@
+/**
+* @file tests/decompilertool/batch_tests.cpp
+* @brief Tests for the @c batch module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "decompilertool/batch.h"
+
+#ifdef OS_POSIX
+	#include <cerrno>
+	#include <csignal>
+	#include <sys/stat.h>
+	#include <sys/types.h>
+	#include <unistd.h>
+#endif
+
+using namespace ::testing;
+
+namespace decompilertool {
+namespace tests {
+
+/**
+* @brief Tests for the @c batch module.
+*/
+class BatchTests: public Test {
+public:
+	BatchTests():
+		inputFile(TempDir() + "retdec-decompilertool-batch-tests-input") {
+		std::ofstream(inputFile) << "input";
+		defaults.params.backend.targetHll = "c";
+	}
+
+	~BatchTests() {
+		std::remove(inputFile.c_str());
+	}
+
+protected:
+	std::string inputFile;
+	Options defaults;
+	Job job;
+	std::string error;
+};
+
+//
+// parseJob()
+//
+
+TEST_F(BatchTests,
+ValidJobIsParsed) {
+	ASSERT_TRUE(parseJob(
+		R"({"id": "job1", "args": ["-o", "out.c", ")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_EQ("job1", job.id.asString());
+	EXPECT_EQ(inputFile, job.options.params.inputFile);
+	EXPECT_EQ("out.c", job.options.params.outputFile);
+	EXPECT_EQ("out.c.json", job.options.params.outputConfigFile);
+	EXPECT_EQ(0, job.timeout);
+}
+
+TEST_F(BatchTests,
+IdIsOptional) {
+	ASSERT_TRUE(parseJob(R"({"args": [")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_TRUE(job.id.isNull());
+}
+
+TEST_F(BatchTests,
+NumericIdIsKept) {
+	ASSERT_TRUE(parseJob(R"({"id": 42, "args": [")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_EQ(42, job.id.asInt());
+}
+
+TEST_F(BatchTests,
+OutputFileIsDerivedFromInputFileWhenNotGiven) {
+	ASSERT_TRUE(parseJob(R"({"args": [")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_EQ(inputFile + ".c", job.options.params.outputFile);
+}
+
+TEST_F(BatchTests,
+OptionsFromCommandLineAreUsedAsDefaults) {
+	defaults.params.backend.targetHll = "py";
+	defaults.cleanup = true;
+
+	ASSERT_TRUE(parseJob(R"({"args": [")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_EQ(inputFile + ".py", job.options.params.outputFile);
+	EXPECT_TRUE(job.options.params.outputConfigFile.empty());
+}
+
+TEST_F(BatchTests,
+ArgsOfJobOverrideDefaults) {
+	defaults.params.backend.targetHll = "py";
+
+	ASSERT_TRUE(parseJob(
+		R"({"args": ["-l", "c", ")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_EQ(inputFile + ".c", job.options.params.outputFile);
+}
+
+TEST_F(BatchTests,
+TimeoutOfJobOverridesDefaultTimeout) {
+	defaults.jobTimeout = 10;
+
+	ASSERT_TRUE(parseJob(
+		R"({"args": [")" + inputFile + R"("], "timeout": 5})",
+		defaults, job, error));
+
+	EXPECT_EQ(5, job.timeout);
+}
+
+TEST_F(BatchTests,
+DefaultTimeoutIsUsedWhenJobHasNone) {
+	defaults.jobTimeout = 10;
+
+	ASSERT_TRUE(parseJob(R"({"args": [")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_EQ(10, job.timeout);
+}
+
+TEST_F(BatchTests,
+JobTimeoutOptionInArgsIsUsed) {
+	ASSERT_TRUE(parseJob(
+		R"({"args": ["--job-timeout", "7", ")" + inputFile + R"("]})",
+		defaults, job, error));
+
+	EXPECT_EQ(7, job.timeout);
+}
+
+TEST_F(BatchTests,
+InvalidJsonIsRejectedWithoutId) {
+	job.id = "previous";
+
+	EXPECT_FALSE(parseJob(R"({"id": "job1", "args": [)", defaults, job, error));
+	EXPECT_EQ("invalid JSON", error);
+	EXPECT_TRUE(job.id.isNull());
+}
+
+TEST_F(BatchTests,
+JsonThatIsNotObjectIsRejected) {
+	EXPECT_FALSE(parseJob(R"(["-o", "out.c"])", defaults, job, error));
+	EXPECT_EQ("invalid JSON", error);
+}
+
+TEST_F(BatchTests,
+JobWithoutArgsIsRejectedWithItsId) {
+	EXPECT_FALSE(parseJob(R"({"id": "job1"})", defaults, job, error));
+	EXPECT_EQ("missing \"args\"", error);
+	EXPECT_EQ("job1", job.id.asString());
+}
+
+TEST_F(BatchTests,
+JobWithNonStringArgIsRejected) {
+	EXPECT_FALSE(parseJob(R"({"id": "job1", "args": ["-o", 1]})",
+		defaults, job, error));
+	EXPECT_EQ("non-string argument", error);
+	EXPECT_EQ("job1", job.id.asString());
+}
+
+TEST_F(BatchTests,
+JobWithInvalidOptionIsRejected) {
+	EXPECT_FALSE(parseJob(
+		R"({"args": ["--no-such-option", ")" + inputFile + R"("]})",
+		defaults, job, error));
+	EXPECT_EQ("invalid option '--no-such-option'", error);
+}
+
+TEST_F(BatchTests,
+JobWithoutInputFileIsRejected) {
+	EXPECT_FALSE(parseJob(R"({"args": ["-o", "out.c"]})",
+		defaults, job, error));
+	EXPECT_EQ("no input file", error);
+}
+
+TEST_F(BatchTests,
+JobWithNonexistingInputFileIsRejected) {
+	EXPECT_FALSE(parseJob(
+		R"({"args": [")" + inputFile + R"(-nonexisting"]})",
+		defaults, job, error));
+	EXPECT_EQ("invalid input file '" + inputFile + "-nonexisting'", error);
+}
+
+TEST_F(BatchTests,
+JobWithNegativeTimeoutIsRejected) {
+	EXPECT_FALSE(parseJob(
+		R"({"args": [")" + inputFile + R"("], "timeout": -1})",
+		defaults, job, error));
+	EXPECT_EQ("invalid \"timeout\"", error);
+}
+
+TEST_F(BatchTests,
+JobWithNonNumericTimeoutIsRejected) {
+	EXPECT_FALSE(parseJob(
+		R"({"args": [")" + inputFile + R"("], "timeout": "5"})",
+		defaults, job, error));
+	EXPECT_EQ("invalid \"timeout\"", error);
+}
+
+//
+// formatJobResult()
+//
+
+TEST_F(BatchTests,
+ResultIsFormattedAsOneJsonLine) {
+	EXPECT_EQ(R"({"id":"job1","status":"timeout"})",
+		formatJobResult("job1", JobStatus::TIMEOUT));
+}
+
+TEST_F(BatchTests,
+ResultContainsMessageWhenGiven) {
+	EXPECT_EQ(R"({"id":null,"message":"invalid JSON","status":"invalid"})",
+		formatJobResult(Json::Value(), JobStatus::INVALID, "invalid JSON"));
+}
+
+#ifdef OS_POSIX
+
+//
+// runInChildProcess()
+//
+
+TEST_F(BatchTests,
+WorkThatSucceedsInChildProcessIsOk) {
+	EXPECT_EQ(JobStatus::OK, runInChildProcess([]() { return 0; }, 0));
+}
+
+TEST_F(BatchTests,
+WorkThatFailsInChildProcessIsFailed) {
+	EXPECT_EQ(JobStatus::FAILED, runInChildProcess([]() { return 1; }, 0));
+}
+
+TEST_F(BatchTests,
+WorkThatAbortsInChildProcessIsCrashed) {
+	EXPECT_EQ(JobStatus::CRASHED, runInChildProcess([]() {
+		std::abort();
+		return 0;
+	}, 0));
+}
+
+TEST_F(BatchTests,
+WorkThatFinishesBeforeTimeoutIsOk) {
+	EXPECT_EQ(JobStatus::OK, runInChildProcess([]() { return 0; }, 10));
+}
+
+TEST_F(BatchTests,
+WorkThatExceedsTimeoutIsKilledAndReaped) {
+	std::string pidFile(TempDir() + "retdec-decompilertool-batch-tests-pid");
+	std::string doneFile(TempDir() + "retdec-decompilertool-batch-tests-done");
+	std::remove(doneFile.c_str());
+
+	auto start = std::chrono::steady_clock::now();
+	auto status = runInChildProcess([&]() {
+		std::ofstream(pidFile) << getpid();
+		std::this_thread::sleep_for(std::chrono::seconds(30));
+		std::ofstream(doneFile) << "done";
+		return 0;
+	}, 1);
+	auto elapsed = std::chrono::steady_clock::now() - start;
+
+	EXPECT_EQ(JobStatus::TIMEOUT, status);
+	EXPECT_LT(elapsed, std::chrono::seconds(10));
+	pid_t pid = 0;
+	std::ifstream(pidFile) >> pid;
+	ASSERT_GT(pid, 0);
+	// A child that has not been reaped (a zombie) would still exist.
+	EXPECT_EQ(-1, kill(pid, 0));
+	EXPECT_EQ(ESRCH, errno);
+	EXPECT_FALSE(std::ifstream(doneFile).good());
+	std::remove(pidFile.c_str());
+}
+
+TEST_F(BatchTests,
+StandardOutputOfChildProcessIsRedirectedToStandardError) {
+	auto status = runInChildProcess([&]() {
+		struct stat out, err;
+		fstat(STDOUT_FILENO, &out);
+		fstat(STDERR_FILENO, &err);
+		return out.st_dev == err.st_dev && out.st_ino == err.st_ino ? 0 : 1;
+	}, 0);
+
+	EXPECT_EQ(JobStatus::OK, status);
+}
+
+#endif
+
+} // namespace tests
+} // namespace decompilertool
@@ -9,6 +9,7 @@
 
 #include "llvmir2hll/analysis/alias_analysis/alias_analysis_mock.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/address_op_expr.h"
 #include "retdec/llvmir2hll/ir/array_index_op_expr.h"
 #include "retdec/llvmir2hll/ir/array_type.h"
@@ -18,6 +19,7 @@
 #include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/deref_op_expr.h"
 #include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
 #include "retdec/llvmir2hll/ir/pointer_type.h"
 #include "retdec/llvmir2hll/ir/return_stmt.h"
 #include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
@@ -652,20 +654,182 @@ Caching) {
 
 	ShPtr<ValueData> dataAfterChange(va->getValueData(varDefStmt));
 	VarSet refDirWrittenVarsAfterChange;
-	refDirWrittenVarsAfterChange.insert(varA);
+	refDirWrittenVarsAfterChange.insert(varB);
 	EXPECT_EQ(refDirWrittenVarsAfterChange, dataAfterChange->getDirWrittenVars()) <<
-		"before clearing the cache, there should still be `a`";
+		"the change should be detected even without clearing the cache";
 
 	va->clearCache();
 
 	ShPtr<ValueData> dataAfterCacheClear(va->getValueData(varDefStmt));
-	VarSet refDirWrittenVarsAfterCacheClear;
-	refDirWrittenVarsAfterCacheClear.insert(varB);
-	EXPECT_EQ(refDirWrittenVarsAfterCacheClear,
+	EXPECT_EQ(refDirWrittenVarsAfterChange,
 		dataAfterCacheClear->getDirWrittenVars()) <<
 		"after clearing the cache, there should be `b`";
 }
 
+TEST_F(ValueAnalysisTests,
+CachedResultsOfUnchangedValuesAreReused) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignA(AssignStmt::create(
+		varA, ConstInt::create(1, 32), returnA));
+	testFunc->setBody(assignA);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	ShPtr<ValueData> assignAData(va->getValueData(assignA));
+	ShPtr<ValueData> returnAData(va->getValueData(returnA));
+
+	// Change the module.
+	//
+	// def test():
+	//    a = 1
+	//    return 2
+	//
+	returnA->setRetVal(ConstInt::create(2, 32));
+
+	EXPECT_EQ(assignAData, va->getValueData(assignA));
+	EXPECT_NE(returnAData, va->getValueData(returnA));
+	EXPECT_EQ(VarSet(), va->getValueData(returnA)->getDirReadVars());
+}
+
+TEST_F(ValueAnalysisTests,
+ChangeOfNestedExpressionChangesCachedResultsOfItsParents) {
+	// Set-up the module.
+	//
+	// def test():
+	//    return (a + 1) * 2
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<AddOpExpr> addOpExpr(AddOpExpr::create(varA, ConstInt::create(1, 32)));
+	ShPtr<MulOpExpr> mulOpExpr(MulOpExpr::create(
+		addOpExpr, ConstInt::create(2, 32)));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
+	testFunc->setBody(returnStmt);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	EXPECT_EQ(VarSet({varA}), va->getValueData(returnStmt)->getDirReadVars());
+	EXPECT_EQ(VarSet({varA}), va->getValueData(mulOpExpr)->getDirReadVars());
+	EXPECT_EQ(VarSet({varA}), va->getValueData(addOpExpr)->getDirReadVars());
+
+	// Change the module.
+	//
+	// def test():
+	//    return (b + 1) * 2
+	//
+	addOpExpr->setFirstOperand(varB);
+
+	EXPECT_EQ(VarSet({varB}), va->getValueData(returnStmt)->getDirReadVars());
+	EXPECT_EQ(VarSet({varB}), va->getValueData(mulOpExpr)->getDirReadVars());
+	EXPECT_EQ(VarSet({varB}), va->getValueData(addOpExpr)->getDirReadVars());
+
+	// Change the module.
+	//
+	// def test():
+	//    return (b + a) * 2
+	//
+	Expression::replaceExpression(addOpExpr->getSecondOperand(), varA);
+
+	EXPECT_EQ(VarSet({varA, varB}),
+		va->getValueData(returnStmt)->getDirReadVars());
+}
+
+TEST_F(ValueAnalysisTests,
+InitOfAliasAnalysisRemovesOnlyCachedResultsContainingDereferences) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    return *p
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varP(Variable::create("p",
+		PointerType::create(IntType::create(32))));
+	testFunc->addLocalVar(varP);
+	ShPtr<ReturnStmt> returnP(ReturnStmt::create(DerefOpExpr::create(varP)));
+	ShPtr<AssignStmt> assignA(AssignStmt::create(
+		varA, ConstInt::create(1, 32), returnP));
+	testFunc->setBody(assignA);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	ShPtr<ValueData> assignAData(va->getValueData(assignA));
+	ShPtr<ValueData> returnPData(va->getValueData(returnP));
+	EXPECT_FALSE(returnPData->mayBeIndirRead(varA));
+
+	// Now, p may point to a.
+	const VarSet refPMayPointTo{varA};
+	ON_CALL(*aliasAnalysisMock, mayPointTo(varP))
+		.WillByDefault(ReturnRef(refPMayPointTo));
+	va->initAliasAnalysis(module);
+
+	EXPECT_EQ(assignAData, va->getValueData(assignA));
+	EXPECT_NE(returnPData, va->getValueData(returnP));
+	EXPECT_TRUE(va->getValueData(returnP)->mayBeIndirRead(varA));
+}
+
+TEST_F(ValueAnalysisTests,
+RemoveUnusedValuesFromCacheRemovesOnlyValuesNotUsedOutsideOfCache) {
+	// Set-up the module.
+	//
+	// def test():
+	//    return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	testFunc->setBody(returnA);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	ShPtr<ValueData> returnAData(va->getValueData(returnA));
+	WkPtr<Value> removedStmt;
+	{
+		ShPtr<ReturnStmt> otherReturnStmt(ReturnStmt::create());
+		va->getValueData(otherReturnStmt);
+		removedStmt = otherReturnStmt;
+	}
+	EXPECT_FALSE(removedStmt.expired());
+
+	va->removeUnusedValuesFromCache();
+
+	EXPECT_TRUE(removedStmt.expired());
+	EXPECT_EQ(returnAData, va->getValueData(returnA));
+}
+
+TEST_F(ValueAnalysisTests,
+RemoveUnusedValuesFromCacheRemovesValuesReferencedOnlyFromRemovedResults) {
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	WkPtr<Value> removedStmt;
+	WkPtr<Value> removedCall;
+	{
+		// The result for the statement refers to the call.
+		ShPtr<CallExpr> callExpr(CallExpr::create(testFunc->getAsVar()));
+		ShPtr<CallStmt> callStmt(CallStmt::create(callExpr));
+		va->getValueData(callExpr);
+		va->getValueData(callStmt);
+		removedStmt = callStmt;
+		removedCall = callExpr;
+	}
+
+	va->removeUnusedValuesFromCache();
+
+	EXPECT_TRUE(removedStmt.expired());
+	EXPECT_TRUE(removedCall.expired());
+}
+
 TEST_F(ValueAnalysisTests,
 AfterStatementChangeAndCacheUpdateCorrectResultsAreReturned) {
 	// Set-up the module.
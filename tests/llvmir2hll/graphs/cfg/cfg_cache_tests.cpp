@@ -0,0 +1,218 @@
+/**
+* @file tests/llvmir2hll/graphs/cfg/cfg_cache_tests.cpp
+* @brief Tests for the @c cfg_cache module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/graphs/cfg/cfg.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/empty_stmt.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/if_stmt.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/ir/while_loop_stmt.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c cfg_cache module.
+*/
+class CFGCacheTests: public TestsWithModule {
+protected:
+	CFGCacheTests();
+
+protected:
+	/// Variable @c a.
+	ShPtr<Variable> varA;
+
+	/// <tt>a = 1</tt>
+	ShPtr<AssignStmt> assignA1;
+
+	/// <tt>return</tt>
+	ShPtr<ReturnStmt> returnStmt;
+
+	/// The tested cache.
+	ShPtr<CFGCache> cache;
+};
+
+CFGCacheTests::CFGCacheTests():
+	varA(Variable::create("a", IntType::create(32))),
+	assignA1(AssignStmt::create(varA, ConstInt::create(1, 32))),
+	returnStmt(ReturnStmt::create()),
+	cache(CFGCache::create(NonRecursiveCFGBuilder::create())) {
+	// void test() {
+	//     a = 1;
+	//     return;
+	// }
+	testFunc->addLocalVar(varA);
+	assignA1->setSuccessor(returnStmt);
+	testFunc->setBody(assignA1);
+}
+
+TEST_F(CFGCacheTests,
+CFGOfUnchangedFunctionIsReused) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	ASSERT_TRUE(cfg != nullptr);
+	EXPECT_EQ(testFunc, cfg->getCorrespondingFunction());
+	EXPECT_TRUE(cache->hasCFG(testFunc));
+	EXPECT_EQ(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+CFGIsRebuiltAfterExpressionInStatementChanges) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	assignA1->setRhs(ConstInt::create(2, 32));
+
+	EXPECT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+CFGIsRebuiltAfterNestedExpressionInStatementChanges) {
+	ShPtr<AddOpExpr> addOpExpr(AddOpExpr::create(varA,
+		ConstInt::create(1, 32)));
+	assignA1->setRhs(addOpExpr);
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	addOpExpr->setSecondOperand(ConstInt::create(2, 32));
+
+	EXPECT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+CFGIsRebuiltAfterStatementIsAdded) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA,
+		ConstInt::create(2, 32)));
+	assignA1->appendStatement(assignA2);
+
+	ShPtr<CFG> newCFG(cache->getCFG(testFunc));
+	EXPECT_NE(cfg, newCFG);
+	EXPECT_TRUE(newCFG->getNodeForStmt(assignA2).first != nullptr);
+}
+
+TEST_F(CFGCacheTests,
+CFGIsRebuiltAfterStatementIsRemoved) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	Statement::removeStatement(assignA1);
+
+	EXPECT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+CFGIsRebuiltAfterStatementInNestedBlockChanges) {
+	// void test() {
+	//     while (true) {
+	//         a = 1;
+	//     }
+	//     return;
+	// }
+	assignA1->setSuccessor(ShPtr<Statement>());
+	ShPtr<WhileLoopStmt> whileLoopStmt(WhileLoopStmt::create(
+		ConstBool::create(true), assignA1, returnStmt));
+	testFunc->setBody(whileLoopStmt);
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+	ASSERT_EQ(cfg, cache->getCFG(testFunc));
+
+	assignA1->setSuccessor(EmptyStmt::create());
+
+	EXPECT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+CFGIsRebuiltAfterElseClauseIsRemoved) {
+	// void test() {
+	//     if (true) {
+	//         a = 1;
+	//     } else {
+	//         return;
+	//     }
+	// }
+	assignA1->setSuccessor(ShPtr<Statement>());
+	ShPtr<IfStmt> ifStmt(IfStmt::create(ConstBool::create(true), assignA1));
+	ifStmt->setElseClause(returnStmt);
+	testFunc->setBody(ifStmt);
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	ifStmt->removeElseClause();
+
+	EXPECT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+CFGIsRebuiltAfterParameterIsAdded) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	testFunc->addParam(Variable::create("p", IntType::create(32)));
+
+	EXPECT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+ChangeOfOneFunctionDoesNotRebuildCFGOfOtherFunction) {
+	ShPtr<Function> otherFunc(addFuncDef("other"));
+	otherFunc->setBody(ReturnStmt::create());
+	ShPtr<CFG> testFuncCFG(cache->getCFG(testFunc));
+	ShPtr<CFG> otherFuncCFG(cache->getCFG(otherFunc));
+
+	assignA1->setRhs(ConstInt::create(2, 32));
+
+	EXPECT_NE(testFuncCFG, cache->getCFG(testFunc));
+	EXPECT_EQ(otherFuncCFG, cache->getCFG(otherFunc));
+}
+
+TEST_F(CFGCacheTests,
+RemoveCFGRemovesCFGOfFunction) {
+	ShPtr<CFG> cfg(cache->getCFG(testFunc));
+
+	cache->removeCFG(testFunc);
+
+	EXPECT_FALSE(cache->hasCFG(testFunc));
+	EXPECT_NE(cfg, cache->getCFG(testFunc));
+}
+
+TEST_F(CFGCacheTests,
+RemoveCFGsOfFuncsNotInModuleRemovesOnlyCFGsOfRemovedFunctions) {
+	ShPtr<Function> otherFunc(addFuncDef("other"));
+	cache->getCFG(testFunc);
+	cache->getCFG(otherFunc);
+
+	module->removeFunc(otherFunc);
+	cache->removeCFGsOfFuncsNotInModule(module);
+
+	EXPECT_TRUE(cache->hasCFG(testFunc));
+	EXPECT_FALSE(cache->hasCFG(otherFunc));
+	EXPECT_EQ(1, cache->getNumOfCFGs());
+}
+
+TEST_F(CFGCacheTests,
+ClearRemovesAllCFGs) {
+	cache->getCFG(testFunc);
+
+	cache->clear();
+
+	EXPECT_FALSE(cache->hasCFG(testFunc));
+	EXPECT_EQ(0, cache->getNumOfCFGs());
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
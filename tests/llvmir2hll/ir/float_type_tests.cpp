@@ -0,0 +1,66 @@
+/**
+* @file tests/llvmir2hll/ir/float_type_tests.cpp
+* @brief Tests for the @c float_type module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/float_type.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c float_type module.
+*/
+class FloatTypeTests: public Test {};
+
+//
+// create()
+//
+
+TEST_F(FloatTypeTests,
+CreateReturnsSameInstancesForSameSizes) {
+	auto type1 = FloatType::create(64);
+	auto type2 = FloatType::create(64);
+
+	ASSERT_EQ(type1, type2);
+}
+
+TEST_F(FloatTypeTests,
+CreateReturnsSameInstancesWhenCalledFromSeveralThreads) {
+	const unsigned FIRST_SIZE = 1000;
+	const unsigned NUM_OF_SIZES = 200;
+	const unsigned NUM_OF_THREADS = 8;
+	std::vector<std::vector<ShPtr<FloatType>>> createdTypes(NUM_OF_THREADS);
+	std::vector<std::thread> threads;
+	for (unsigned t = 0; t < NUM_OF_THREADS; ++t) {
+		threads.emplace_back([&, t]() {
+			for (unsigned i = 0; i < NUM_OF_SIZES; ++i) {
+				createdTypes[t].push_back(FloatType::create(FIRST_SIZE + i));
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	for (const auto &types : createdTypes) {
+		for (unsigned i = 0; i < NUM_OF_SIZES; ++i) {
+			EXPECT_EQ(createdTypes[0][i], types[i]);
+			EXPECT_EQ(FIRST_SIZE + i, types[i]->getSize());
+		}
+	}
+	EXPECT_TRUE(createdTypes[0][0]->existsFloatTypeWith(FIRST_SIZE));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/ir/int_type.h"
@@ -69,6 +72,40 @@ IsUnsignedReturnsFalseWhenTypeIsSigned) {
 	ASSERT_FALSE(type->isUnsigned());
 }
 
+//
+// create()
+//
+
+TEST_F(IntTypeTests,
+CreateReturnsSameInstancesWhenCalledFromSeveralThreads) {
+	// Use sizes that have not been created by other tests so the threads
+	// insert new types at the same time.
+	const unsigned FIRST_SIZE = 1000;
+	const unsigned NUM_OF_SIZES = 200;
+	const unsigned NUM_OF_THREADS = 8;
+	std::vector<std::vector<ShPtr<IntType>>> createdTypes(NUM_OF_THREADS);
+	std::vector<std::thread> threads;
+	for (unsigned t = 0; t < NUM_OF_THREADS; ++t) {
+		threads.emplace_back([&, t]() {
+			for (unsigned size = FIRST_SIZE; size < FIRST_SIZE + NUM_OF_SIZES;
+					++size) {
+				createdTypes[t].push_back(IntType::create(size, t % 2 == 0));
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	for (unsigned t = 0; t < NUM_OF_THREADS; ++t) {
+		for (unsigned i = 0; i < NUM_OF_SIZES; ++i) {
+			EXPECT_EQ(IntType::create(FIRST_SIZE + i, t % 2 == 0),
+				createdTypes[t][i]);
+			EXPECT_EQ(FIRST_SIZE + i, createdTypes[t][i]->getSize());
+		}
+	}
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
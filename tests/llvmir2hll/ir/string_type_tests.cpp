@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/ir/string_type.h"
@@ -32,6 +35,32 @@ CreateReturnsSameInstancesForSameSizes) {
 	ASSERT_EQ(type1, type2);
 }
 
+TEST_F(StringTypeTests,
+CreateReturnsSameInstancesWhenCalledFromSeveralThreads) {
+	const std::size_t FIRST_CHAR_SIZE = 1000;
+	const std::size_t NUM_OF_SIZES = 200;
+	const std::size_t NUM_OF_THREADS = 8;
+	std::vector<std::vector<ShPtr<StringType>>> createdTypes(NUM_OF_THREADS);
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < NUM_OF_THREADS; ++t) {
+		threads.emplace_back([&, t]() {
+			for (std::size_t i = 0; i < NUM_OF_SIZES; ++i) {
+				createdTypes[t].push_back(StringType::create(FIRST_CHAR_SIZE + i));
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	for (const auto &types : createdTypes) {
+		for (std::size_t i = 0; i < NUM_OF_SIZES; ++i) {
+			EXPECT_EQ(createdTypes[0][i], types[i]);
+			EXPECT_EQ(FIRST_CHAR_SIZE + i, types[i]->getCharSize());
+		}
+	}
+}
+
 #if DEATH_TESTS_ENABLED
 TEST_F(StringTypeTests,
 CreateFailsWithViolatedPreconditionWhenSizeIsZero) {
@@ -0,0 +1,164 @@
+/**
+* @file tests/llvmir2hll/optimizer/func_optimizer_tests.cpp
+* @brief Tests for the @c func_optimizer module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/optimizer/func_optimizer.h"
+#include "retdec/llvmir2hll/optimizer/optimizers/self_assign_optimizer.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+namespace {
+
+/**
+* @brief An optimizer recording functions on which it has been run.
+*/
+class RecordingOptimizer: public FuncOptimizer {
+public:
+	RecordingOptimizer(ShPtr<Module> module, FuncVector &optimizedFuncs,
+		std::mutex &mutex, const std::string &failingFuncName = ""):
+			FuncOptimizer(module), optimizedFuncs(optimizedFuncs),
+			mutex(mutex), failingFuncName(failingFuncName) {}
+
+	virtual std::string getId() const override { return "Recording"; }
+
+private:
+	virtual void runOnFunction(ShPtr<Function> func) override {
+		if (func->getName() == failingFuncName) {
+			throw std::runtime_error("failure");
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		optimizedFuncs.push_back(func);
+	}
+
+private:
+	FuncVector &optimizedFuncs;
+	std::mutex &mutex;
+	std::string failingFuncName;
+};
+
+} // anonymous namespace
+
+/**
+* @brief Tests for the @c func_optimizer module.
+*/
+class FuncOptimizerTests: public TestsWithModule {
+protected:
+	void addFuncDefs(std::size_t count);
+};
+
+/**
+* @brief Adds @a count function definitions named @c f0, @c f1, ... into the
+*        module.
+*/
+void FuncOptimizerTests::addFuncDefs(std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i) {
+		addFuncDef("f" + std::to_string(i));
+	}
+}
+
+TEST_F(FuncOptimizerTests,
+OptimizerWithWorkersRunsOnEveryFunctionExactlyOnce) {
+	addFuncDefs(20);
+	FuncVector optimizedFuncs;
+	std::mutex mutex;
+	auto optimizer = std::make_shared<RecordingOptimizer>(module,
+		optimizedFuncs, mutex);
+	for (int i = 0; i < 3; ++i) {
+		optimizer->addWorker(std::make_shared<RecordingOptimizer>(module,
+			optimizedFuncs, mutex));
+	}
+
+	optimizer->optimize();
+
+	FuncSet uniqueOptimizedFuncs(optimizedFuncs.begin(), optimizedFuncs.end());
+	EXPECT_EQ(module->getNumOfFuncDefinitions(), optimizedFuncs.size());
+	EXPECT_EQ(optimizedFuncs.size(), uniqueOptimizedFuncs.size());
+}
+
+TEST_F(FuncOptimizerTests,
+OptimizerWithMoreWorkersThanFunctionsRunsOnEveryFunction) {
+	FuncVector optimizedFuncs;
+	std::mutex mutex;
+	auto optimizer = std::make_shared<RecordingOptimizer>(module,
+		optimizedFuncs, mutex);
+	for (int i = 0; i < 7; ++i) {
+		optimizer->addWorker(std::make_shared<RecordingOptimizer>(module,
+			optimizedFuncs, mutex));
+	}
+
+	optimizer->optimize();
+
+	ASSERT_EQ(1u, optimizedFuncs.size());
+	EXPECT_EQ(testFunc, optimizedFuncs.front());
+}
+
+TEST_F(FuncOptimizerTests,
+ExceptionThrownByWorkerIsRethrownFromOptimize) {
+	addFuncDefs(20);
+	FuncVector optimizedFuncs;
+	std::mutex mutex;
+	auto optimizer = std::make_shared<RecordingOptimizer>(module,
+		optimizedFuncs, mutex, "f10");
+	for (int i = 0; i < 3; ++i) {
+		optimizer->addWorker(std::make_shared<RecordingOptimizer>(module,
+			optimizedFuncs, mutex, "f10"));
+	}
+
+	EXPECT_THROW(optimizer->optimize(), std::runtime_error);
+}
+
+TEST_F(FuncOptimizerTests,
+ExistingOptimizerWithWorkersOptimizesAllFunctions) {
+	// Add bodies to functions f0, f1, ...:
+	//
+	//   a = a
+	//   return
+	//
+	// where the variable a is global.
+	addFuncDefs(50);
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	module->addGlobalVar(varA);
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		(*i)->setBody(AssignStmt::create(varA, varA, ReturnStmt::create()));
+	}
+
+	auto optimizer = std::make_shared<SelfAssignOptimizer>(module);
+	for (int i = 0; i < 3; ++i) {
+		optimizer->addWorker(std::make_shared<SelfAssignOptimizer>(module));
+	}
+	optimizer->optimize();
+
+	// Check that the output is correct.
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		EXPECT_TRUE(isa<ReturnStmt>((*i)->getBody())) <<
+			"expected ReturnStmt in " << (*i)->getName() << ", got " <<
+			(*i)->getBody();
+	}
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,97 @@
+/**
+* @file tests/llvmir2hll/semantics/semantics/impl_support/const_hash_table_tests.cpp
+* @brief Tests for the @c const_hash_table module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/const_hash_table.h"
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
+#include "retdec/utils/array.h"
+
+using namespace ::testing;
+using namespace retdec::llvmir2hll::semantics;
+using retdec::utils::arraySize;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+namespace {
+
+constexpr StringStringEntry STRING_ENTRIES[] = {
+	{"printf", "stdio.h"},
+	{"malloc", "stdlib.h"},
+	{"strlen", "string.h"},
+	{"malloc", "malloc.h"},
+};
+
+constexpr ConstHashTable<StringStringEntry, arraySize(STRING_ENTRIES)>
+	STRING_TABLE(STRING_ENTRIES);
+
+constexpr FuncParamName PARAM_ENTRIES[] = {
+	{"fopen", 1, "file_path"},
+	{"fopen", 2, "mode"},
+	{"fclose", 1, "stream"},
+};
+
+constexpr ConstHashTable<FuncParamName, arraySize(PARAM_ENTRIES)>
+	PARAM_TABLE(PARAM_ENTRIES);
+
+} // anonymous namespace
+
+/**
+* @brief Tests for the @c const_hash_table module.
+*/
+class ConstHashTableTests: public Test {};
+
+TEST_F(ConstHashTableTests,
+ConstHashTableSizeIsPowerOfTwoAtLeastTwiceNumberOfEntries) {
+	EXPECT_EQ(1u, constHashTableSize(0));
+	EXPECT_EQ(2u, constHashTableSize(1));
+	EXPECT_EQ(8u, constHashTableSize(3));
+	EXPECT_EQ(8u, constHashTableSize(4));
+	EXPECT_EQ(16u, constHashTableSize(5));
+}
+
+TEST_F(ConstHashTableTests,
+FindReturnsEntryWithSameKey) {
+	auto entry = STRING_TABLE.find({"printf", nullptr});
+	ASSERT_TRUE(entry != nullptr);
+	EXPECT_EQ("stdio.h", std::string(entry->value));
+
+	entry = STRING_TABLE.find({"strlen", nullptr});
+	ASSERT_TRUE(entry != nullptr);
+	EXPECT_EQ("string.h", std::string(entry->value));
+}
+
+TEST_F(ConstHashTableTests,
+FindReturnsNullptrWhenThereIsNoEntryWithSameKey) {
+	EXPECT_EQ(nullptr, STRING_TABLE.find({"puts", nullptr}));
+	EXPECT_EQ(nullptr, STRING_TABLE.find({"", nullptr}));
+	EXPECT_EQ(nullptr, STRING_TABLE.find({"printf_", nullptr}));
+}
+
+TEST_F(ConstHashTableTests,
+FindReturnsLastEntryWhenThereAreMoreEntriesWithSameKey) {
+	auto entry = STRING_TABLE.find({"malloc", nullptr});
+	ASSERT_TRUE(entry != nullptr);
+	EXPECT_EQ("malloc.h", std::string(entry->value));
+}
+
+TEST_F(ConstHashTableTests,
+GetNameOfParamFromTableDistinguishesParamPositions) {
+	Maybe<std::string> name(getNameOfParamFromTable("fopen", 2, PARAM_TABLE));
+	ASSERT_TRUE(name);
+	EXPECT_EQ("mode", name.get());
+
+	EXPECT_FALSE(getNameOfParamFromTable("fopen", 3, PARAM_TABLE));
+	EXPECT_FALSE(getNameOfParamFromTable("fclose", 2, PARAM_TABLE));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
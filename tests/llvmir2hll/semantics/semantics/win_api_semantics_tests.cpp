@@ -127,11 +127,43 @@ GetNameOfParamForKnownFunctionsReturnsCorrectAnswer) {
 	EXPECT_EQ("uStyle", openFileParam3Name.get());
 }
 
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForKnownFunctionsFromAllKindsOfTablesReturnsCorrectAnswer) {
+	// _hread (functions starting with '_' are in the table for 'A')
+	Maybe<std::string> hreadParam2Name(semantics->getNameOfParam("_hread", 2));
+	ASSERT_TRUE(hreadParam2Name) << "no name of the second parameter of `_hread`";
+	EXPECT_EQ("lpBuffer", hreadParam2Name.get());
+
+	// keybd_event (lower-case first letter)
+	Maybe<std::string> keybdEventParam1Name(semantics->getNameOfParam("keybd_event", 1));
+	ASSERT_TRUE(keybdEventParam1Name) << "no name of the first parameter of `keybd_event`";
+	EXPECT_EQ("bVk", keybdEventParam1Name.get());
+
+	// wWinMain (lower-case first letter)
+	Maybe<std::string> wWinMainParam2Name(semantics->getNameOfParam("wWinMain", 2));
+	ASSERT_TRUE(wWinMainParam2Name) << "no name of the second parameter of `wWinMain`";
+	EXPECT_EQ("hPrevInstance", wWinMainParam2Name.get());
+
+	// CreateProcessA (the second table for 'C')
+	Maybe<std::string> createProcessAParam1Name(semantics->getNameOfParam("CreateProcessA", 1));
+	ASSERT_TRUE(createProcessAParam1Name) << "no name of the first parameter of `CreateProcessA`";
+	EXPECT_EQ("lpApplicationName", createProcessAParam1Name.get());
+
+	// GetNamedPipeClientComputerNameA (the second table for 'G')
+	Maybe<std::string> getNamedPipeParam1Name(semantics->getNameOfParam("GetNamedPipeClientComputerNameA", 1));
+	ASSERT_TRUE(getNamedPipeParam1Name) << "no name of the first parameter of `GetNamedPipeClientComputerNameA`";
+	EXPECT_EQ("Pipe", getNamedPipeParam1Name.get());
+}
+
 TEST_F(WinAPISemanticsTests,
 GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
 	Maybe<std::string> fooParam1Name(semantics->getNameOfParam("foo", 1));
 	EXPECT_FALSE(fooParam1Name) << "there should be no information for `foo`";
+
+	// Functions not starting with a letter or '_'
+	EXPECT_FALSE(semantics->getNameOfParam("", 1));
+	EXPECT_FALSE(semantics->getNameOfParam("1OpenFile", 1));
 }
 
 //
@@ -0,0 +1,223 @@
+/**
+* @file tests/llvmir2hll/support/smart_ptr_tests.cpp
+* @brief Tests for the @c smart_ptr module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/bit_cast_expr.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/empty_stmt.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/not_op_expr.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/ir/void_type.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/visitable.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+namespace {
+
+class Base {
+public:
+	virtual ~Base() = default;
+};
+
+class Derived: public Base {};
+
+} // anonymous namespace
+
+/**
+* @brief Tests for the @c smart_ptr module.
+*/
+class SmartPtrTests: public Test {};
+
+TEST_F(SmartPtrTests,
+IsaReturnsTrueForInstancesOfConcreteClassAndItsBaseClasses) {
+	ShPtr<Value> value(AddOpExpr::create(ConstInt::create(1, 32),
+		ConstInt::create(2, 32)));
+
+	EXPECT_TRUE(isa<AddOpExpr>(value));
+	EXPECT_TRUE(isa<BinaryOpExpr>(value));
+	EXPECT_TRUE(isa<Expression>(value));
+	EXPECT_TRUE(isa<Value>(value));
+	EXPECT_FALSE(isa<MulOpExpr>(value));
+	EXPECT_FALSE(isa<UnaryOpExpr>(value));
+	EXPECT_FALSE(isa<Constant>(value));
+	EXPECT_FALSE(isa<Statement>(value));
+	EXPECT_FALSE(isa<Type>(value));
+}
+
+TEST_F(SmartPtrTests,
+IsaReturnsCorrectResultsForFirstAndLastKindsOfRanges) {
+	ShPtr<Variable> var(Variable::create("a", IntType::create(32)));
+	EXPECT_TRUE(isa<Expression>(var));
+	EXPECT_FALSE(isa<Constant>(var));
+
+	ShPtr<Expression> cast(BitCastExpr::create(var, IntType::create(32)));
+	EXPECT_TRUE(isa<Expression>(cast));
+	EXPECT_TRUE(isa<CastExpr>(cast));
+	EXPECT_FALSE(isa<UnaryOpExpr>(cast));
+
+	ShPtr<Value> voidType(VoidType::create());
+	EXPECT_TRUE(isa<Type>(voidType));
+	EXPECT_FALSE(isa<Statement>(voidType));
+	EXPECT_FALSE(isa<Expression>(voidType));
+}
+
+TEST_F(SmartPtrTests,
+IsaReturnsFalseForNullPointer) {
+	EXPECT_FALSE(isa<Expression>(ShPtr<Value>()));
+	EXPECT_FALSE(isa<Expression>(static_cast<Value *>(nullptr)));
+	EXPECT_FALSE(isa<Derived>(ShPtr<Base>()));
+}
+
+TEST_F(SmartPtrTests,
+CastReturnsPointerSharingOwnershipWhenValueIsInstanceOfClass) {
+	ShPtr<Statement> stmt(ReturnStmt::create());
+
+	ShPtr<ReturnStmt> returnStmt(cast<ReturnStmt>(stmt));
+	ASSERT_TRUE(returnStmt != nullptr);
+	EXPECT_EQ(stmt, returnStmt);
+	EXPECT_EQ(2, stmt.use_count());
+}
+
+TEST_F(SmartPtrTests,
+CastReturnsNullPointerWhenValueIsNotInstanceOfClass) {
+	ShPtr<Statement> stmt(EmptyStmt::create());
+
+	EXPECT_EQ(nullptr, cast<ReturnStmt>(stmt));
+	EXPECT_EQ(nullptr, cast<Expression>(ShPtr<Value>()));
+	EXPECT_EQ(1, stmt.use_count());
+}
+
+TEST_F(SmartPtrTests,
+CastOfRawPointerDoesNotTouchReferenceCount) {
+	ShPtr<Value> value(NotOpExpr::create(ConstInt::create(1, 32)));
+
+	UnaryOpExpr *unaryOpExpr = cast<UnaryOpExpr>(value.get());
+	ASSERT_TRUE(unaryOpExpr != nullptr);
+	EXPECT_EQ(value.get(), unaryOpExpr);
+	EXPECT_EQ(nullptr, cast<BinaryOpExpr>(value.get()));
+	EXPECT_EQ(1, value.use_count());
+}
+
+TEST_F(SmartPtrTests,
+CastOfRawPointerToConstValueWorks) {
+	ShPtr<Value> value(ConstInt::create(1, 32));
+	const Value *constValue = value.get();
+
+	EXPECT_EQ(value.get(), cast<const ConstInt>(constValue));
+	EXPECT_EQ(nullptr, cast<const Variable>(constValue));
+}
+
+TEST_F(SmartPtrTests,
+CastAndIsaWorkForClassesWithoutClassof) {
+	ShPtr<Base> derived(std::make_shared<Derived>());
+	ShPtr<Base> base(std::make_shared<Base>());
+	EXPECT_TRUE(isa<Derived>(derived));
+	EXPECT_FALSE(isa<Derived>(base));
+	EXPECT_EQ(derived, cast<Derived>(derived));
+	EXPECT_EQ(nullptr, cast<Derived>(base));
+
+	// A cross cast from a class without kinds.
+	ShPtr<Visitable> visitable(EmptyStmt::create());
+	EXPECT_TRUE(isa<Statement>(visitable));
+	EXPECT_FALSE(isa<Expression>(visitable));
+}
+
+//
+// A micro-benchmark comparing kind-based and RTTI-based type checks. It is
+// disabled by default; run it by passing --gtest_also_run_disabled_tests and
+// --gtest_filter=*Benchmark* to the tests.
+//
+
+TEST_F(SmartPtrTests,
+DISABLED_BenchmarkOfTypeChecks) {
+	// Values appearing in bodies of functions in the other tests:
+	//
+	//   a = (a + 1) * b
+	//   return
+	//
+	std::vector<ShPtr<Value>> values;
+	for (int i = 0; i < 100000; ++i) {
+		ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+		ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+		ShPtr<AddOpExpr> addOpExpr(AddOpExpr::create(varA,
+			ConstInt::create(1, 32)));
+		ShPtr<MulOpExpr> mulOpExpr(MulOpExpr::create(addOpExpr, varB));
+		ShPtr<ReturnStmt> returnStmt(ReturnStmt::create());
+		ShPtr<AssignStmt> assignStmt(AssignStmt::create(varA, mulOpExpr,
+			returnStmt));
+		values.insert(values.end(), {assignStmt, varA, mulOpExpr, addOpExpr,
+			varA, addOpExpr->getSecondOperand(), varB, returnStmt});
+	}
+
+	const int NUM_OF_ROUNDS = 20;
+	auto measure = [&](const char *name, auto check) {
+		std::size_t count = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int round = 0; round < NUM_OF_ROUNDS; ++round) {
+			for (const auto &value : values) {
+				count += check(value);
+			}
+		}
+		auto end = std::chrono::steady_clock::now();
+		std::cout << name << ": " << std::chrono::duration_cast<
+			std::chrono::milliseconds>(end - start).count() << " ms\n";
+		return count;
+	};
+
+	auto dynCount = measure("std::dynamic_pointer_cast<>()",
+		[](const ShPtr<Value> &value) {
+			return (std::dynamic_pointer_cast<Variable>(value) ? 1 : 0) +
+				(std::dynamic_pointer_cast<Expression>(value) ? 1 : 0) +
+				(std::dynamic_pointer_cast<BinaryOpExpr>(value) ? 1 : 0) +
+				(std::dynamic_pointer_cast<Statement>(value) ? 1 : 0);
+		}
+	);
+	auto isaCount = measure("isa<>()",
+		[](const ShPtr<Value> &value) {
+			return isa<Variable>(value) + isa<Expression>(value) +
+				isa<BinaryOpExpr>(value) + isa<Statement>(value);
+		}
+	);
+	auto castCount = measure("cast<>()",
+		[](const ShPtr<Value> &value) {
+			return (cast<Variable>(value) ? 1 : 0) +
+				(cast<Expression>(value) ? 1 : 0) +
+				(cast<BinaryOpExpr>(value) ? 1 : 0) +
+				(cast<Statement>(value) ? 1 : 0);
+		}
+	);
+	auto rawCastCount = measure("cast<>() of raw pointers",
+		[](const ShPtr<Value> &value) {
+			return (cast<Variable>(value.get()) ? 1 : 0) +
+				(cast<Expression>(value.get()) ? 1 : 0) +
+				(cast<BinaryOpExpr>(value.get()) ? 1 : 0) +
+				(cast<Statement>(value.get()) ? 1 : 0);
+		}
+	);
+
+	EXPECT_EQ(dynCount, isaCount);
+	EXPECT_EQ(dynCount, castCount);
+	EXPECT_EQ(dynCount, rawCastCount);
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include "retdec/llvmir2hll/graphs/cfg/cfg.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_cache.h"
 #include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/empty_stmt.h"
 #include "retdec/llvmir2hll/ir/function.h"
@@ -138,6 +141,26 @@ EmptyStatementWhoseSuccessorIsNotRemovedIsKept) {
 	EXPECT_EQ(return2, ifStmt->getElseClause());
 }
 
+TEST_F(UnreachableCodeInCFGRemoverTests,
+CFGsOfFunctionsAreKeptInGivenCache) {
+	// Set-up the module.
+	//
+	// void test() {
+	//     return 1;
+	// }
+	//
+	ShPtr<ReturnStmt> return1(ReturnStmt::create(ConstInt::create(1, 32)));
+	testFunc->setBody(return1);
+	ShPtr<CFGCache> cfgCache(CFGCache::create(NonRecursiveCFGBuilder::create()));
+
+	// Perform the removal.
+	UnreachableCodeInCFGRemover::removeCode(module, cfgCache);
+
+	// Check that the CFG is in the cache.
+	ASSERT_TRUE(cfgCache->hasCFG(testFunc));
+	EXPECT_TRUE(cfgCache->getCFG(testFunc)->hasNodeForStmt(return1));
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -0,0 +1,191 @@
+/**
+* @file tests/llvmir2hll/support/value_allocator_tests.cpp
+* @brief Tests for the @c value_allocator module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/support/value_allocator.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c value_allocator module.
+*/
+class ValueAllocatorTests: public Test {};
+
+TEST_F(ValueAllocatorTests,
+AllocatedBlocksAreDistinctAndAligned) {
+	std::vector<std::pair<char *, std::size_t>> blocks;
+	std::set<char *> uniqueBlocks;
+	for (std::size_t size = 8; size <= ValueAllocator::getMaxPooledSize() + 16;
+			size += 8) {
+		auto block = static_cast<char *>(ValueAllocator::allocate(size));
+		EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(block) % alignof(double));
+		EXPECT_TRUE(uniqueBlocks.insert(block).second);
+		blocks.emplace_back(block, size);
+	}
+
+	// Writing into the blocks must not overwrite anything.
+	for (auto &block : blocks) {
+		block.first[0] = 'x';
+		block.first[block.second - 1] = 'y';
+	}
+	for (auto &block : blocks) {
+		EXPECT_EQ('x', block.first[0]);
+		EXPECT_EQ('y', block.first[block.second - 1]);
+	}
+	for (auto &block : blocks) {
+		ValueAllocator::deallocate(block.first, block.second);
+	}
+}
+
+TEST_F(ValueAllocatorTests,
+FreedBlockIsReusedForValueOfSameSize) {
+	void *block = ValueAllocator::allocate(40);
+	ValueAllocator::deallocate(block, 40);
+
+	EXPECT_EQ(block, ValueAllocator::allocate(40));
+	ValueAllocator::deallocate(block, 40);
+}
+
+TEST_F(ValueAllocatorTests,
+DeallocationOfNullptrDoesNothing) {
+	ValueAllocator::deallocate(nullptr, 40);
+}
+
+TEST_F(ValueAllocatorTests,
+ReleaseUnusedMemoryReturnsSlabsWhoseBlocksAreAllFree) {
+	ValueAllocator::releaseUnusedMemory();
+	std::size_t numOfSlabsBefore = ValueAllocator::getNumOfSlabs();
+	std::vector<void *> blocks;
+	for (int i = 0; i < 10000; ++i) {
+		blocks.push_back(ValueAllocator::allocate(40));
+	}
+	ASSERT_LT(numOfSlabsBefore, ValueAllocator::getNumOfSlabs());
+
+	for (auto block : blocks) {
+		ValueAllocator::deallocate(block, 40);
+	}
+	ValueAllocator::releaseUnusedMemory();
+
+	EXPECT_EQ(numOfSlabsBefore, ValueAllocator::getNumOfSlabs());
+}
+
+TEST_F(ValueAllocatorTests,
+ReleaseUnusedMemoryKeepsSlabsWithAllocatedBlocks) {
+	std::vector<void *> blocks;
+	for (int i = 0; i < 10000; ++i) {
+		blocks.push_back(ValueAllocator::allocate(40));
+	}
+	// Keep every 1000th block allocated.
+	std::set<void *> keptBlocks;
+	for (std::size_t i = 0; i < blocks.size(); ++i) {
+		if (i % 1000 == 0) {
+			keptBlocks.insert(blocks[i]);
+			static_cast<char *>(blocks[i])[39] = 'x';
+		} else {
+			ValueAllocator::deallocate(blocks[i], 40);
+		}
+	}
+	std::size_t numOfSlabsBefore = ValueAllocator::getNumOfSlabs();
+
+	ValueAllocator::releaseUnusedMemory();
+
+	EXPECT_LT(ValueAllocator::getNumOfSlabs(), numOfSlabsBefore);
+	// The kept blocks must not be handed out again.
+	std::vector<void *> newBlocks;
+	for (int i = 0; i < 10000; ++i) {
+		newBlocks.push_back(ValueAllocator::allocate(40));
+		EXPECT_EQ(0u, keptBlocks.count(newBlocks.back()));
+	}
+	for (auto block : keptBlocks) {
+		EXPECT_EQ('x', static_cast<char *>(block)[39]);
+		ValueAllocator::deallocate(block, 40);
+	}
+	for (auto block : newBlocks) {
+		ValueAllocator::deallocate(block, 40);
+	}
+}
+
+TEST_F(ValueAllocatorTests,
+ReleaseUnusedMemoryKeepsFreeBlocksOfOtherThreads) {
+	ValueAllocator::releaseUnusedMemory();
+	std::size_t numOfSlabsBefore = ValueAllocator::getNumOfSlabs();
+	std::vector<void *> blocks;
+	for (int i = 0; i < 10000; ++i) {
+		blocks.push_back(ValueAllocator::allocate(40));
+	}
+
+	// The other thread frees the blocks into its own list and reuses them
+	// after the memory is released by this thread.
+	std::thread other([&blocks]() {
+		for (auto block : blocks) {
+			ValueAllocator::deallocate(block, 40);
+		}
+		std::size_t numOfSlabsBeforeRelease = ValueAllocator::getNumOfSlabs();
+		std::thread releaser(ValueAllocator::releaseUnusedMemory);
+		releaser.join();
+		EXPECT_EQ(numOfSlabsBeforeRelease, ValueAllocator::getNumOfSlabs());
+		for (auto &block : blocks) {
+			block = ValueAllocator::allocate(40);
+			static_cast<char *>(block)[0] = 'x';
+		}
+		for (auto block : blocks) {
+			ValueAllocator::deallocate(block, 40);
+		}
+	});
+	other.join();
+
+	// The blocks of the finished thread have been handed over to the global
+	// pool, so they can be released now.
+	ValueAllocator::releaseUnusedMemory();
+	EXPECT_EQ(numOfSlabsBefore, ValueAllocator::getNumOfSlabs());
+}
+
+TEST_F(ValueAllocatorTests,
+ValuesCanBeFreedByDifferentThreadThanTheOneThatAllocatedThem) {
+	std::vector<ShPtr<ConstInt>> values;
+	std::thread producer([&values]() {
+		for (int i = 0; i < 10000; ++i) {
+			values.push_back(ConstInt::create(i, 32));
+		}
+	});
+	producer.join();
+
+	for (int i = 0; i < 10000; ++i) {
+		EXPECT_EQ(i, values[i]->getValue().getSExtValue());
+	}
+	values.clear();
+
+	// The threads have to be able to reuse the freed blocks.
+	std::vector<std::thread> consumers;
+	for (int t = 0; t < 4; ++t) {
+		consumers.emplace_back([]() {
+			for (int i = 0; i < 10000; ++i) {
+				ShPtr<ConstInt> value(ConstInt::create(i, 32));
+				ASSERT_EQ(i, value->getValue().getSExtValue());
+			}
+		});
+	}
+	for (auto &consumer : consumers) {
+		consumer.join();
+	}
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
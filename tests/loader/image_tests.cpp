@@ -0,0 +1,169 @@
+/**
+ * @file tests/loader/image_tests.cpp
+ * @brief Tests for the @c image module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/loader/loader/image.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace loader {
+namespace tests {
+
+class TestImage : public Image
+{
+public:
+	TestImage() : Image(nullptr) {}
+
+	virtual bool load() override { return true; }
+
+	Segment* addSegment(std::uint64_t address, std::uint64_t size)
+	{
+		return insertSegment(std::make_unique<Segment>(nullptr, address, size, nullptr));
+	}
+
+	Segment* addSegment(std::uint64_t address, std::uint64_t size, const std::vector<std::uint8_t>& data)
+	{
+		llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(data.data()), data.size());
+		return insertSegment(std::make_unique<Segment>(nullptr, address, size, std::make_unique<SegmentDataSource>(dataRef)));
+	}
+
+	using Image::removeSegment;
+	using Image::sortSegments;
+	using Image::invalidateSegmentIndex;
+};
+
+class ImageTests : public Test
+{
+public:
+	TestImage image;
+};
+
+TEST_F(ImageTests,
+GetSegmentFromAddressWorksWithoutSegments) {
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1000));
+}
+
+TEST_F(ImageTests,
+GetSegmentFromAddressWorksForDisjointSegments) {
+	auto* seg1 = image.addSegment(0x3000, 0x100);
+	auto* seg2 = image.addSegment(0x1000, 0x100);
+	auto* seg3 = image.addSegment(0x2000, 0x100);
+
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x0fff));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x1000));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x10ff));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1100));
+	EXPECT_EQ(seg3, image.getSegmentFromAddress(0x2050));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x3000));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x3000));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x3100));
+}
+
+TEST_F(ImageTests,
+GetSegmentFromAddressPrefersFirstOfOverlappingSegments) {
+	auto* seg1 = image.addSegment(0x1100, 0x100);
+	auto* seg2 = image.addSegment(0x1000, 0x400);
+
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x10ff));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1100));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x11ff));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x1200));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x13ff));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1400));
+}
+
+TEST_F(ImageTests,
+GetSegmentFromAddressWorksForEmptySegment) {
+	auto* seg = image.addSegment(0x1000, 0);
+
+	EXPECT_EQ(seg, image.getSegmentFromAddress(0x1000));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1001));
+}
+
+TEST_F(ImageTests,
+GetSegmentFromAddressReflectsChangesOfSegments) {
+	auto* seg1 = image.addSegment(0x1000, 0x100);
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1000));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x2000));
+
+	auto* seg2 = image.addSegment(0x2000, 0x100);
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x2000));
+
+	image.removeSegment(seg1);
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1000));
+
+	seg2->resize(0x200);
+	image.invalidateSegmentIndex();
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x21ff));
+}
+
+TEST_F(ImageTests,
+GetWordWorks) {
+	std::vector<std::uint8_t> data = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+	image.addSegment(0x1000, 0x8, data);
+
+	std::uint64_t res = 0;
+	EXPECT_TRUE((image.getWord<4, retdec::utils::Endianness::LITTLE>(0x1000, res)));
+	EXPECT_EQ(0x04030201, res);
+	EXPECT_TRUE((image.getWord<4, retdec::utils::Endianness::BIG>(0x1000, res)));
+	EXPECT_EQ(0x01020304, res);
+	EXPECT_TRUE((image.getWord<8, retdec::utils::Endianness::LITTLE>(0x1000, res)));
+	EXPECT_EQ(0x0807060504030201, res);
+	EXPECT_TRUE((image.getWord<1, retdec::utils::Endianness::BIG>(0x1007, res)));
+	EXPECT_EQ(0x08, res);
+	EXPECT_FALSE((image.getWord<2, retdec::utils::Endianness::BIG>(0x1007, res)));
+	EXPECT_FALSE((image.getWord<1, retdec::utils::Endianness::BIG>(0x0fff, res)));
+}
+
+TEST_F(ImageTests,
+GetWordFillsDataBeyondPhysicalSizeWithZeroes) {
+	std::vector<std::uint8_t> data = { 0x01, 0x02 };
+	image.addSegment(0x1000, 0x8, data);
+
+	std::uint64_t res = 0;
+	EXPECT_TRUE((image.getWord<4, retdec::utils::Endianness::LITTLE>(0x1001, res)));
+	EXPECT_EQ(0x02, res);
+	EXPECT_TRUE((image.getWord<4, retdec::utils::Endianness::BIG>(0x1004, res)));
+	EXPECT_EQ(0x0, res);
+	EXPECT_FALSE((image.getWord<4, retdec::utils::Endianness::BIG>(0x1006, res)));
+}
+
+TEST_F(ImageTests,
+GetWordsWorks) {
+	std::vector<std::uint8_t> data = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+	image.addSegment(0x1000, 0x8, data);
+
+	std::uint64_t res[4] = {};
+	EXPECT_TRUE((image.getWords<2, retdec::utils::Endianness::LITTLE>(0x1000, res, 3)));
+	EXPECT_EQ(0x0201, res[0]);
+	EXPECT_EQ(0x0403, res[1]);
+	EXPECT_EQ(0x0605, res[2]);
+	EXPECT_TRUE((image.getWords<2, retdec::utils::Endianness::BIG>(0x1000, res, 4)));
+	EXPECT_EQ(0x0102, res[0]);
+	EXPECT_EQ(0x0000, res[3]);
+	EXPECT_FALSE((image.getWords<2, retdec::utils::Endianness::BIG>(0x1002, res, 4)));
+}
+
+TEST_F(ImageTests,
+GetXByteWorks) {
+	std::vector<std::uint8_t> data = { 0x01, 0x02, 0x03, 0x04 };
+	image.addSegment(0x1000, 0x4, data);
+
+	std::uint64_t res = 0;
+	EXPECT_TRUE(image.getXByte(0x1001, 3, res, retdec::utils::Endianness::BIG));
+	EXPECT_EQ(0x020304, res);
+	EXPECT_TRUE(image.getXByte(0x1001, 3, res, retdec::utils::Endianness::LITTLE));
+	EXPECT_EQ(0x040302, res);
+	EXPECT_FALSE(image.getXByte(0x1002, 3, res, retdec::utils::Endianness::LITTLE));
+	EXPECT_FALSE(image.getXByte(0x1000, 0, res, retdec::utils::Endianness::LITTLE));
+	EXPECT_FALSE(image.getXByte(0x1000, 9, res, retdec::utils::Endianness::LITTLE));
+}
+
+} // namespace tests
+} // namespace loader
+} // namespace retdec
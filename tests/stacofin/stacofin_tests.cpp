@@ -0,0 +1,180 @@
+/**
+* @file tests/stacofin/stacofin_tests.cpp
+* @brief Tests for the @c stacofin module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/loader/image_factory.h"
+#include "retdec/stacofin/stacofin.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::loader;
+
+namespace retdec {
+namespace stacofin {
+namespace tests {
+
+namespace {
+
+/// Two functions: <tt>push ebp; mov ebp, esp; pop ebp; ret</tt> on offsets
+/// @c 0x4 and @c 0xc.
+const std::vector<std::uint8_t> CODE_BYTES = {
+	0x90, 0x90, 0x90, 0x90, 0x55, 0x89, 0xe5, 0x5d,
+	0xc3, 0x90, 0x90, 0x90, 0x55, 0x89, 0xe5, 0x5d,
+	0xc3, 0x90, 0x90, 0x90
+};
+
+const std::uint64_t BASE_ADDRESS = 0x1000;
+
+const std::size_t SIGNATURE_FILE_COUNT = 16;
+
+} // anonymous namespace
+
+/**
+ * @brief Tests for the @c stacofin module.
+ */
+class FinderTests : public Test
+{
+	public:
+		FinderTests() :
+			fileFormat(std::make_shared<RawDataFormat>(
+					CODE_BYTES.data(),
+					CODE_BYTES.size()))
+		{
+			fileFormat->setTargetArchitecture(Architecture::X86);
+			fileFormat->setBaseAddress(BASE_ADDRESS);
+			image = createImage(fileFormat);
+
+			for (std::size_t i = 0; i < SIGNATURE_FILE_COUNT; ++i)
+			{
+				signatureFiles.push_back(writeSignatureFile(i));
+			}
+		}
+
+		~FinderTests()
+		{
+			for (auto& f : signatureFiles)
+			{
+				std::remove(f.c_str());
+			}
+		}
+
+	protected:
+		/// Writes a signature file with one rule that detects both functions
+		/// as the function named after @a index.
+		static std::string writeSignatureFile(std::size_t index)
+		{
+			auto name = "function" + std::to_string(index);
+			auto path = TempDir() + "retdec-stacofin-tests-" + name + ".yar";
+			std::ofstream(path)
+					<< "rule " << name << "\n"
+					<< "{\n"
+					<< "\tmeta:\n"
+					<< "\t\tname = \"" << name << "\"\n"
+					<< "\t\tsize = 5\n"
+					<< "\tstrings:\n"
+					<< "\t\t$1 = { 55 89 E5 5D C3 }\n"
+					<< "\tcondition:\n"
+					<< "\t\t$1\n"
+					<< "}\n";
+			return path;
+		}
+
+		/// Returns names and signature files of detections in the order in
+		/// which they were added.
+		static std::vector<std::string> getDetectionsInOrder(
+				const Finder& finder,
+				std::uint64_t address)
+		{
+			std::vector<std::string> result;
+			auto range = finder.getAllDetections().equal_range(address);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				result.push_back(
+						it->second.getName() + " " + it->second.signaturePath);
+			}
+			return result;
+		}
+
+	protected:
+		std::shared_ptr<RawDataFormat> fileFormat;
+		std::unique_ptr<Image> image;
+		std::vector<std::string> signatureFiles;
+};
+
+TEST_F(FinderTests, SignatureFilesAreScannedSequentiallyInTheirOrder)
+{
+	ASSERT_NE(nullptr, image);
+	Finder finder;
+	finder.setJobs(1);
+
+	finder.search(*image, signatureFiles);
+
+	auto detections = getDetectionsInOrder(finder, BASE_ADDRESS + 0x4);
+	ASSERT_EQ(SIGNATURE_FILE_COUNT, detections.size());
+	for (std::size_t i = 0; i < SIGNATURE_FILE_COUNT; ++i)
+	{
+		EXPECT_EQ(
+				"function" + std::to_string(i) + " " + signatureFiles[i],
+				detections[i]);
+	}
+}
+
+TEST_F(FinderTests, SignatureFilesScannedConcurrentlyAreMergedInTheirOrder)
+{
+	ASSERT_NE(nullptr, image);
+	Finder sequentialFinder;
+	sequentialFinder.setJobs(1);
+	sequentialFinder.search(*image, signatureFiles);
+	Finder concurrentFinder;
+	concurrentFinder.setJobs(4);
+
+	concurrentFinder.search(*image, signatureFiles);
+
+	for (auto address : {BASE_ADDRESS + 0x4, BASE_ADDRESS + 0xc})
+	{
+		auto detections = getDetectionsInOrder(concurrentFinder, address);
+		ASSERT_EQ(SIGNATURE_FILE_COUNT, detections.size());
+		EXPECT_EQ(getDetectionsInOrder(sequentialFinder, address), detections);
+	}
+	EXPECT_EQ(
+			sequentialFinder.getAllDetections().size(),
+			concurrentFinder.getAllDetections().size());
+}
+
+TEST_F(FinderTests, SignatureFilesInReversedOrderAreMergedInReversedOrder)
+{
+	ASSERT_NE(nullptr, image);
+	std::vector<std::string> reversedFiles(
+			signatureFiles.rbegin(),
+			signatureFiles.rend());
+	Finder finder;
+	finder.setJobs(4);
+
+	finder.search(*image, reversedFiles);
+
+	auto detections = getDetectionsInOrder(finder, BASE_ADDRESS + 0xc);
+	ASSERT_EQ(SIGNATURE_FILE_COUNT, detections.size());
+	for (std::size_t i = 0; i < SIGNATURE_FILE_COUNT; ++i)
+	{
+		EXPECT_EQ(
+				"function" + std::to_string(SIGNATURE_FILE_COUNT - 1 - i)
+						+ " " + reversedFiles[i],
+				detections[i]);
+	}
+}
+
+} // namespace tests
+} // namespace stacofin
+} // namespace retdec
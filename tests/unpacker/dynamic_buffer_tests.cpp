@@ -335,6 +335,34 @@ BigEndianWriteOnLittleEndianBufferWorks) {
 	EXPECT_EQ(std::vector<uint8_t>({ 0xC3, 0xC2, 0xC1, 0xC0 }), buffer.getBuffer());
 }
 
+TEST_F(DynamicBufferTests,
+SetRealDataSizeWorks) {
+	DynamicBuffer buffer({ 0xD0, 0xD1, 0xD2, 0xD3 });
+	buffer.setCapacity(6);
+
+	buffer.setRealDataSize(6);
+	EXPECT_EQ(std::vector<uint8_t>({ 0xD0, 0xD1, 0xD2, 0xD3, 0x00, 0x00 }), buffer.getBuffer());
+
+	buffer.setRealDataSize(2);
+	EXPECT_EQ(std::vector<uint8_t>({ 0xD0, 0xD1 }), buffer.getBuffer());
+}
+
+TEST_F(DynamicBufferTests,
+SetRealDataSizeOverCapacityWorks) {
+	DynamicBuffer buffer({ 0xD0, 0xD1, 0xD2, 0xD3 });
+
+	buffer.setRealDataSize(6);
+	EXPECT_EQ(std::vector<uint8_t>({ 0xD0, 0xD1, 0xD2, 0xD3 }), buffer.getBuffer());
+}
+
+TEST_F(DynamicBufferTests,
+WriteThroughRawBufferWorks) {
+	DynamicBuffer buffer({ 0xD0, 0xD1, 0xD2, 0xD3 });
+
+	buffer.getRawBuffer()[1] = 0xE1;
+	EXPECT_EQ(std::vector<uint8_t>({ 0xD0, 0xE1, 0xD2, 0xD3 }), buffer.getBuffer());
+}
+
 TEST_F(DynamicBufferTests,
 ForEachWorks) {
 	uint8_t count = 0;
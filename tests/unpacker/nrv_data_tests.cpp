@@ -0,0 +1,219 @@
+/**
+* @file tests/unpacker/nrv_data_tests.cpp
+* @brief Tests for the @c nrv_data module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/unpacker/decompression/nrv/bit_parsers.h"
+#include "retdec/unpacker/decompression/nrv/nrv2b_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2d_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2e_data.h"
+#include "retdec/utils/dynamic_buffer.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+namespace tests {
+
+namespace {
+
+/**
+ * Data compressed by all the NRV algorithms below. They contain literals,
+ * overlapping matches, a match with the last used distance, and matches with
+ * distances over 0x500 and 0xD00, after which the lengths are encoded
+ * differently.
+ */
+std::vector<uint8_t> getDecompressedData()
+{
+	std::string data = "Hello, NRV! Hello, NRV! ";
+	data += std::string(0xE00, '\0');
+	data += "Hello, NRV! abcabcabcabcabcabcabcab wxyz1wxyz2wxyz";
+	return std::vector<uint8_t>(data.begin(), data.end());
+}
+
+const std::vector<uint8_t> NRV2B_BIT8 = {
+	0xFF, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x2C, 0x20, 0x4E, 0xF6, 0x52, 0x56, 0x21, 0x20, 0x0B, 0x07,
+	0x00, 0x64, 0x00, 0x55, 0x54, 0x20, 0x30, 0x0B, 0x1E, 0x61, 0x62, 0x63, 0xC0, 0x02, 0x3F, 0x20,
+	0x77, 0x78, 0x79, 0xDF, 0x7A, 0x31, 0x04, 0x32, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF
+};
+
+const std::vector<uint8_t> NRV2B_LE32 = {
+	0x64, 0x07, 0xF6, 0xFF, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x2C, 0x20, 0x4E, 0x52, 0x56, 0x21, 0x20,
+	0x0B, 0x00, 0x00, 0x30, 0x20, 0x54, 0x55, 0x0B, 0xDF, 0x3F, 0xC0, 0x1E, 0x61, 0x62, 0x63, 0x02,
+	0x20, 0x77, 0x78, 0x79, 0x7A, 0x31, 0x04, 0x32, 0x00, 0x00, 0x00, 0x38, 0x00, 0x24, 0x00, 0x00,
+	0xFF
+};
+
+const std::vector<uint8_t> NRV2D_BIT8 = {
+	0xFF, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x2C, 0x20, 0x4E, 0xF6, 0x52, 0x56, 0x21, 0x20, 0x17, 0x0E,
+	0x00, 0xD1, 0x01, 0x55, 0x50, 0xA1, 0xC0, 0x17, 0xF6, 0x61, 0x62, 0x63, 0x05, 0x03, 0xFD, 0x20,
+	0x77, 0x78, 0x79, 0x7A, 0x31, 0xE7, 0x08, 0x32, 0x09, 0x24, 0x92, 0x49, 0x2A, 0xFF
+};
+
+const std::vector<uint8_t> NRV2D_LE32 = {
+	0xD1, 0x0E, 0xF6, 0xFF, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x2C, 0x20, 0x4E, 0x52, 0x56, 0x21, 0x20,
+	0x17, 0x00, 0x01, 0xC0, 0xA1, 0x50, 0x55, 0x17, 0xE7, 0xFD, 0x03, 0xF6, 0x61, 0x62, 0x63, 0x05,
+	0x20, 0x77, 0x78, 0x79, 0x7A, 0x31, 0x08, 0x32, 0x49, 0x92, 0x24, 0x09, 0x00, 0x00, 0x00, 0x2A,
+	0xFF
+};
+
+const std::vector<uint8_t> NRV2E_BIT8 = {
+	0xFF, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x2C, 0x20, 0x4E, 0xF6, 0x52, 0x56, 0x21, 0x20, 0x17, 0x06,
+	0x00, 0xD1, 0x01, 0x55, 0x45, 0xA1, 0xD7, 0x17, 0x61, 0xD8, 0x62, 0x63, 0x05, 0x07, 0x20, 0x77,
+	0xF7, 0x78, 0x79, 0x7A, 0x31, 0x09, 0x4A, 0x32, 0x09, 0x24, 0x92, 0x49, 0x2A, 0xFF
+};
+
+const std::vector<uint8_t> NRV2E_LE32 = {
+	0xD1, 0x06, 0xF6, 0xFF, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x2C, 0x20, 0x4E, 0x52, 0x56, 0x21, 0x20,
+	0x17, 0x00, 0x01, 0xD7, 0xA1, 0x45, 0x55, 0x17, 0x61, 0x4A, 0xF7, 0x07, 0xD8, 0x62, 0x63, 0x05,
+	0x20, 0x77, 0x78, 0x79, 0x7A, 0x31, 0x09, 0x32, 0x49, 0x92, 0x24, 0x09, 0x00, 0x00, 0x00, 0x2A,
+	0xFF
+};
+
+/**
+ * Bit parser whose type is not known to the decompression, so its bits are
+ * parsed through the virtual getBit().
+ */
+class OtherBitParser8 : public BitParser
+{
+public:
+	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	{
+		return _bitParser.getBit(bit, data, pos);
+	}
+
+private:
+	BitParser8 _bitParser;
+};
+
+} // anonymous namespace
+
+class NrvDataTests : public Test
+{
+protected:
+	template <typename NrvDataT> bool decompress(const std::vector<uint8_t>& compressed, BitParser* bitParser,
+		DynamicBuffer& output)
+	{
+		NrvDataT data(DynamicBuffer(compressed), bitParser);
+		return data.decompress(output);
+	}
+
+	template <typename NrvDataT> std::vector<uint8_t> decompress(const std::vector<uint8_t>& compressed,
+		BitParser* bitParser)
+	{
+		DynamicBuffer output(static_cast<uint32_t>(getDecompressedData().size() + 16));
+		EXPECT_TRUE(decompress<NrvDataT>(compressed, bitParser, output));
+		return output.getBuffer();
+	}
+};
+
+TEST_F(NrvDataTests,
+Nrv2bWithBitParser8Works) {
+	BitParser8 bitParser;
+
+	EXPECT_EQ(getDecompressedData(), decompress<Nrv2bData>(NRV2B_BIT8, &bitParser));
+}
+
+TEST_F(NrvDataTests,
+Nrv2bWithBitParserLe32Works) {
+	BitParserLe32 bitParser;
+
+	EXPECT_EQ(getDecompressedData(), decompress<Nrv2bData>(NRV2B_LE32, &bitParser));
+}
+
+TEST_F(NrvDataTests,
+Nrv2dWithBitParser8Works) {
+	BitParser8 bitParser;
+
+	EXPECT_EQ(getDecompressedData(), decompress<Nrv2dData>(NRV2D_BIT8, &bitParser));
+}
+
+TEST_F(NrvDataTests,
+Nrv2dWithBitParserLe32Works) {
+	BitParserLe32 bitParser;
+
+	EXPECT_EQ(getDecompressedData(), decompress<Nrv2dData>(NRV2D_LE32, &bitParser));
+}
+
+TEST_F(NrvDataTests,
+Nrv2eWithBitParser8Works) {
+	BitParser8 bitParser;
+
+	EXPECT_EQ(getDecompressedData(), decompress<Nrv2eData>(NRV2E_BIT8, &bitParser));
+}
+
+TEST_F(NrvDataTests,
+Nrv2eWithBitParserLe32Works) {
+	BitParserLe32 bitParser;
+
+	EXPECT_EQ(getDecompressedData(), decompress<Nrv2eData>(NRV2E_LE32, &bitParser));
+}
+
+TEST_F(NrvDataTests,
+OtherBitParserWorks) {
+	OtherBitParser8 bitParser;
+
+	EXPECT_EQ(getDecompressedData(), decompress<Nrv2bData>(NRV2B_BIT8, &bitParser));
+}
+
+TEST_F(NrvDataTests,
+DecompressingAgainWithResetBitParserWorks) {
+	BitParser8 bitParser;
+	Nrv2bData data(DynamicBuffer(NRV2B_BIT8), &bitParser);
+	DynamicBuffer output1(static_cast<uint32_t>(getDecompressedData().size()));
+	DynamicBuffer output2(static_cast<uint32_t>(getDecompressedData().size()));
+
+	EXPECT_TRUE(data.decompress(output1));
+	bitParser.setValue(0);
+	EXPECT_TRUE(data.decompress(output2));
+	EXPECT_EQ(getDecompressedData(), output2.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+OutputOverCapacityIsNotWritten) {
+	BitParser8 bitParser;
+	DynamicBuffer output(16);
+
+	EXPECT_FALSE(decompress<Nrv2bData>(NRV2B_BIT8, &bitParser, output));
+	auto expected = getDecompressedData();
+	expected.resize(16);
+	EXPECT_EQ(expected, output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+TruncatedDataAreDecompressedAsFarAsPossible) {
+	BitParser8 bitParser;
+	auto compressed = NRV2B_BIT8;
+	compressed.resize(compressed.size() / 2);
+	DynamicBuffer output(static_cast<uint32_t>(getDecompressedData().size()));
+
+	EXPECT_FALSE(decompress<Nrv2bData>(compressed, &bitParser, output));
+	auto expected = getDecompressedData();
+	ASSERT_LT(output.getRealDataSize(), expected.size());
+	expected.resize(output.getRealDataSize());
+	EXPECT_EQ(expected, output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+DataInOutputAfterDecompressedDataAreKept) {
+	BitParser8 bitParser;
+	auto expected = getDecompressedData();
+	std::vector<uint8_t> original(expected.size() + 4, 0xAA);
+	DynamicBuffer output(original);
+
+	EXPECT_TRUE(decompress<Nrv2bData>(NRV2B_BIT8, &bitParser, output));
+	expected.insert(expected.end(), 4, 0xAA);
+	EXPECT_EQ(expected, output.getBuffer());
+}
+
+} // namespace tests
+} // namespace unpacker
+} // namespace retdec
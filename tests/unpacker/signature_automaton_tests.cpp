@@ -0,0 +1,166 @@
+/**
+* @file tests/unpacker/signature_automaton_tests.cpp
+* @brief Tests for the @c signature_automaton module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/dynamic_buffer.h"
+#include "retdec/unpacker/signature.h"
+#include "retdec/unpacker/signature_automaton.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+namespace tests {
+
+class SignatureAutomatonTests : public Test {
+protected:
+	/// Signature with its searching distance.
+	using SearchedSignature = std::pair<const Signature*, uint64_t>;
+
+	/// Matches the signatures one after another, as they were matched before
+	/// the automaton was used, and returns the index of the first one that
+	/// matches, or -1.
+	static int64_t matchSequentially(const std::vector<SearchedSignature>& signatures,
+			const std::vector<uint8_t>& bytes, DynamicBuffer& capturedData) {
+		DynamicBuffer data(bytes);
+		for (std::size_t i = 0; i < signatures.size(); ++i) {
+			Signature::MatchSettings settings(0, signatures[i].second);
+			DynamicBuffer localCapturedData;
+			if (signatures[i].first->match(settings, data, localCapturedData)) {
+				capturedData = localCapturedData;
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/// Checks that the automaton built from the signatures matches them in
+	/// the bytes exactly as they are matched one after another.
+	static void expectSameResultAsSequentially(const std::vector<SearchedSignature>& signatures,
+			const std::vector<uint8_t>& bytes, int64_t expectedIndex) {
+		SignatureAutomaton automaton;
+		for (const auto& signature : signatures)
+			automaton.addSignature(signature.first, signature.second);
+		automaton.build();
+
+		DynamicBuffer expectedCapturedData, capturedData;
+		EXPECT_EQ(expectedIndex, matchSequentially(signatures, bytes, expectedCapturedData));
+		EXPECT_EQ(expectedIndex, automaton.match(bytes, 0, &capturedData));
+		EXPECT_EQ(expectedCapturedData.getBuffer(), capturedData.getBuffer());
+	}
+};
+
+TEST_F(SignatureAutomatonTests,
+ExactMatchWorks) {
+	Signature sig1 = { 0x10, 0x11, 0x12 };
+	Signature sig2 = { 0x20, 0x21, 0x22 };
+	SignatureAutomaton automaton;
+	automaton.addSignature(&sig1);
+	automaton.addSignature(&sig2);
+	automaton.build();
+
+	EXPECT_EQ(2, automaton.getNumberOfSignatures());
+	EXPECT_EQ(3, automaton.getMatchedAreaSize());
+	EXPECT_EQ(1, automaton.match({ 0x20, 0x21, 0x22, 0x23 }, 0));
+	EXPECT_EQ(0, automaton.match({ 0x00, 0x10, 0x11, 0x12 }, 1));
+	EXPECT_EQ(-1, automaton.match({ 0x00, 0x10, 0x11, 0x12 }, 0));
+	EXPECT_EQ(-1, automaton.match({ 0x20, 0x21 }, 0));
+}
+
+TEST_F(SignatureAutomatonTests,
+FirstAddedSignatureHasPriority) {
+	Signature sig1 = { 0x10, ANY, 0x12 };
+	Signature sig2 = { 0x10, 0x11, 0x12 };
+	SignatureAutomaton automaton;
+	automaton.addSignature(&sig1);
+	automaton.addSignature(&sig2);
+	automaton.build();
+
+	EXPECT_EQ(0, automaton.match({ 0x10, 0x11, 0x12 }, 0));
+}
+
+TEST_F(SignatureAutomatonTests,
+SearchWorks) {
+	Signature sig1 = { 0x30, 0x31, ANY, 0x33 };
+	Signature sig2 = { 0x40, 0x41 };
+	SignatureAutomaton automaton;
+	automaton.addSignature(&sig1, 3);
+	automaton.addSignature(&sig2);
+	automaton.build();
+
+	EXPECT_EQ(6, automaton.getMatchedAreaSize());
+	EXPECT_EQ(0, automaton.match({ 0x40, 0x41, 0x30, 0x31, 0xFF, 0x33 }, 0));
+	EXPECT_EQ(1, automaton.match({ 0x40, 0x41, 0x00, 0x30, 0x31, 0xFF, 0x33 }, 0));
+	EXPECT_EQ(-1, automaton.match({ 0x00, 0x00, 0x00, 0x30, 0x31, 0xFF, 0x33 }, 0));
+}
+
+TEST_F(SignatureAutomatonTests,
+CaptureOfNearestOccurenceWorks) {
+	Signature sig = { 0x50, CAP, 0x52 };
+	SignatureAutomaton automaton;
+	automaton.addSignature(&sig, 5);
+	automaton.build();
+
+	DynamicBuffer capturedData;
+	EXPECT_EQ(0, automaton.match({ 0x00, 0x50, 0xAA, 0x52, 0x50, 0xBB, 0x52 }, 0, &capturedData));
+	EXPECT_EQ(0xAA, capturedData.read<uint8_t>(0));
+}
+
+TEST_F(SignatureAutomatonTests,
+SignatureWithoutExactBytesWorks) {
+	Signature sig1 = { 0x60, 0x61, 0x62 };
+	Signature sig2 = { ANY, ANYB(0x70, 0x0F) };
+	SignatureAutomaton automaton;
+	automaton.addSignature(&sig1);
+	automaton.addSignature(&sig2, 2);
+	automaton.build();
+
+	EXPECT_EQ(1, automaton.match({ 0x00, 0x00, 0x7F }, 0));
+	EXPECT_EQ(0, automaton.match({ 0x60, 0x61, 0x62 }, 0));
+	EXPECT_EQ(-1, automaton.match({ 0x00, 0x00, 0x00 }, 0));
+}
+
+TEST_F(SignatureAutomatonTests,
+SelfOverlappingOccurrenceIsFound) {
+	// The first occurrence starts inside a partial occurrence, so the search
+	// must not skip past it after the mismatch.
+	Signature sig1 = { 0x10, 0x10, 0x11 };
+	Signature sig2 = { 0x10, 0x11, 0x10, 0x11, 0x12 };
+	Signature sig3 = { 0x10, CAP, 0x10, 0x11 };
+
+	expectSameResultAsSequentially({ { &sig1, 5 } }, { 0x10, 0x10, 0x10, 0x11 }, 0);
+	expectSameResultAsSequentially({ { &sig2, 5 } }, { 0x10, 0x11, 0x10, 0x11, 0x10, 0x11, 0x12 }, 0);
+	expectSameResultAsSequentially({ { &sig3, 5 } }, { 0x10, 0x10, 0x10, 0x10, 0x11, 0x10 }, 0);
+	expectSameResultAsSequentially({ { &sig1, 1 } }, { 0x10, 0x10, 0x10, 0x11 }, -1);
+}
+
+TEST_F(SignatureAutomatonTests,
+OverlappingSignaturesAreMatchedAsOneAfterAnother) {
+	// Anchors of the signatures overlap each other, so one of them is found
+	// inside (or across) an occurrence of another one.
+	Signature sig1 = { 0x20, 0x21, 0x22, 0x23 };
+	Signature sig2 = { 0x22, 0x23, CAP, 0x25 };
+	Signature sig3 = { 0x21, 0x22 };
+	Signature sig4 = { ANY, 0x23, 0x22, 0x23 };
+	std::vector<SearchedSignature> signatures = { { &sig1, 4 }, { &sig2, 4 }, { &sig3, 0 }, { &sig4, 3 } };
+
+	expectSameResultAsSequentially(signatures, { 0x00, 0x20, 0x21, 0x22, 0x23, 0x25 }, 0);
+	expectSameResultAsSequentially(signatures, { 0x00, 0x21, 0x22, 0x23, 0xAA, 0x25 }, 1);
+	expectSameResultAsSequentially(signatures, { 0x21, 0x22, 0x23, 0x22, 0x23, 0xBB, 0x25 }, 1);
+	expectSameResultAsSequentially(signatures, { 0x21, 0x22, 0x23, 0x22, 0x00 }, 2);
+	expectSameResultAsSequentially(signatures, { 0x00, 0x23, 0x22, 0x23, 0x22, 0x23 }, 3);
+	expectSameResultAsSequentially(signatures, { 0x00, 0x21, 0x23, 0x22, 0x00, 0x23 }, -1);
+}
+
+} // namespace tests
+} // namespace unpacker
+} // namespace retdec
@@ -0,0 +1,110 @@
+/**
+* @file tests/utils/parallel_tests.cpp
+* @brief Tests for the @c parallel module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/parallel.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c parallel module.
+*/
+class ParallelTests: public Test {};
+
+//
+// getHardwareJobs()
+//
+
+TEST_F(ParallelTests,
+GetHardwareJobsReturnsAtLeastOne) {
+	EXPECT_GE(getHardwareJobs(), 1);
+}
+
+//
+// runInParallel()
+//
+
+TEST_F(ParallelTests,
+RunInParallelDoesNothingWhenThereAreNoWorkItems) {
+	bool called = false;
+
+	runInParallel(0, 4, [&](std::size_t) { called = true; });
+
+	EXPECT_FALSE(called);
+}
+
+TEST_F(ParallelTests,
+RunInParallelCallsWorkForEveryIndexInOrderWithOneJob) {
+	std::vector<std::size_t> indexes;
+
+	runInParallel(5, 1, [&](std::size_t i) { indexes.push_back(i); });
+
+	EXPECT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4}), indexes);
+}
+
+TEST_F(ParallelTests,
+RunInParallelCallsWorkExactlyOnceForEveryIndexWithSeveralJobs) {
+	std::vector<std::atomic<unsigned>> calls(1000);
+
+	runInParallel(calls.size(), 4, [&](std::size_t i) { ++calls[i]; });
+
+	for (auto &c : calls) {
+		EXPECT_EQ(1, c);
+	}
+}
+
+TEST_F(ParallelTests,
+RunInParallelRethrowsExceptionFromWorkWithOneJob) {
+	EXPECT_THROW(
+		runInParallel(3, 1, [](std::size_t i) {
+			if (i == 1) {
+				throw std::runtime_error("failure");
+			}
+		}),
+		std::runtime_error
+	);
+}
+
+TEST_F(ParallelTests,
+RunInParallelRethrowsExceptionFromWorkOnAnyThreadWithSeveralJobs) {
+	// Every work item throws, so all the threads (including the calling one)
+	// throw while the others are still running.
+	EXPECT_THROW(
+		runInParallel(100, 4, [](std::size_t) {
+			throw std::runtime_error("failure");
+		}),
+		std::runtime_error
+	);
+}
+
+TEST_F(ParallelTests,
+RunInParallelStopsStartingWorkItemsAfterException) {
+	std::atomic<std::size_t> calls(0);
+
+	EXPECT_THROW(
+		runInParallel(10000, 4, [&](std::size_t) {
+			++calls;
+			throw std::runtime_error("failure");
+		}),
+		std::runtime_error
+	);
+
+	// Every thread stops after its first failed work item.
+	EXPECT_LE(calls, 4);
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
@@ -0,0 +1,370 @@
+/**
+* @file tests/yara-cache/yara_rule_cache_tests.cpp
+* @brief Tests for the @c yara_rule_cache module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#ifdef _MSC_VER
+	#include <sys/utime.h>
+#else
+	#include <utime.h>
+#endif
+
+#include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/string.h"
+#include "retdec/yara-cache/yara_rule_cache.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace yara_cache {
+namespace tests {
+
+namespace {
+
+const std::string RULES = R"(
+rule first
+{
+	strings:
+		$a = "first"
+	condition:
+		$a
+}
+)";
+
+const std::string OTHER_RULES = R"(
+rule second
+{
+	strings:
+		$a = "second"
+	condition:
+		$a
+}
+)";
+
+/// Rules of the same size as @c RULES.
+const std::string OTHER_RULES_OF_SAME_SIZE = R"(
+rule third
+{
+	strings:
+		$a = "third"
+	condition:
+		$a
+}
+)";
+
+const std::string INVALID_RULES = "rule {";
+
+} // anonymous namespace
+
+/**
+* @brief Tests for the @c yara_rule_cache module.
+*/
+class YaraRuleCacheTests: public Test {
+public:
+	YaraRuleCacheTests():
+		cacheDirectory(TempDir()),
+		ruleFile(TempDir() + "retdec-yara-cache-tests-"
+			+ UnitTest::GetInstance()->current_test_info()->name() + ".yar"),
+		cache(cacheDirectory) {}
+
+	~YaraRuleCacheTests() {
+		std::remove(ruleFile.c_str());
+		for (const auto &f : createdFiles) {
+			std::remove(f.c_str());
+		}
+	}
+
+protected:
+	/// Writes @a rules into the rule file and sets its modification time.
+	void writeRuleFile(const std::string &rules, std::time_t mtime) {
+		{
+			std::ofstream out(ruleFile, std::ios::binary);
+			out << rules;
+		}
+		setModificationTime(ruleFile, mtime);
+	}
+
+	/// Returns the compiled rules for the rule file and remembers the files
+	/// to be removed.
+	std::string getRuleFile() {
+		auto compiled = cache.getRuleFile(ruleFile);
+		if (compiled != ruleFile) {
+			createdFiles.push_back(compiled);
+			createdFiles.push_back(getKeyFile(compiled));
+		}
+		return compiled;
+	}
+
+	/// Returns the path to the key file belonging to @a compiled
+	/// (<tt><entry>-<hash>-<version>.yarac</tt> -> <tt><entry>.key</tt>).
+	static std::string getKeyFile(const std::string &compiled) {
+		auto versionStart = compiled.rfind('-');
+		auto hashStart = compiled.rfind('-', versionStart - 1);
+		return compiled.substr(0, hashStart) + ".key";
+	}
+
+	/// Returns the hash stored in the name of @a compiled.
+	static std::string getHashFromName(const std::string &compiled) {
+		auto versionStart = compiled.rfind('-');
+		auto hashStart = compiled.rfind('-', versionStart - 1);
+		return compiled.substr(hashStart + 1, versionStart - hashStart - 1);
+	}
+
+	static std::vector<std::string> readKeyFile(const std::string &path) {
+		std::ifstream in(path);
+		std::vector<std::string> items;
+		std::string item;
+		while (in >> item) {
+			items.push_back(item);
+		}
+		return items;
+	}
+
+	static void writeFile(const std::string &path, const std::string &content) {
+		std::ofstream out(path, std::ios::binary);
+		out << content;
+	}
+
+	static void setModificationTime(const std::string &path, std::time_t mtime) {
+		struct utimbuf times;
+		times.actime = mtime;
+		times.modtime = mtime;
+		utime(path.c_str(), &times);
+	}
+
+	static bool isFile(const std::string &path) {
+		return FilesystemPath(path).isFile();
+	}
+
+protected:
+	std::string cacheDirectory;
+	std::string ruleFile;
+	YaraRuleCache cache;
+	std::vector<std::string> createdFiles;
+};
+
+//
+// Miss.
+//
+
+TEST_F(YaraRuleCacheTests,
+TextRuleFileIsCompiledIntoCacheDirectory) {
+	writeRuleFile(RULES, 1000000000);
+
+	auto compiled = getRuleFile();
+
+	ASSERT_NE(ruleFile, compiled);
+	EXPECT_TRUE(startsWith(compiled, cacheDirectory));
+	EXPECT_TRUE(endsWith(compiled, ".yarac"));
+	EXPECT_TRUE(isFile(compiled));
+	EXPECT_TRUE(isFile(getKeyFile(compiled)));
+}
+
+TEST_F(YaraRuleCacheTests,
+KeyFileDescribesRuleFileFromWhichRulesWereCompiled) {
+	writeRuleFile(RULES, 1000000000);
+
+	auto compiled = getRuleFile();
+
+	auto key = readKeyFile(getKeyFile(compiled));
+	ASSERT_EQ(4, key.size());
+	EXPECT_EQ("1000000000", key[1]);
+	EXPECT_EQ(std::to_string(RULES.size()), key[2]);
+	EXPECT_EQ(getHashFromName(compiled), key[3]);
+}
+
+//
+// Hit.
+//
+
+TEST_F(YaraRuleCacheTests,
+SameCompiledRulesAreReturnedForUnchangedRuleFile) {
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+
+	EXPECT_EQ(compiled, getRuleFile());
+	EXPECT_EQ(compiled, YaraRuleCache(cacheDirectory).getRuleFile(ruleFile));
+}
+
+TEST_F(YaraRuleCacheTests,
+SameCompiledRulesAreReturnedWhenOnlyModificationTimeChanges) {
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+
+	setModificationTime(ruleFile, 1000000100);
+
+	EXPECT_EQ(compiled, getRuleFile());
+	EXPECT_EQ("1000000100", readKeyFile(getKeyFile(compiled)).at(1));
+}
+
+//
+// Miss after a change.
+//
+
+TEST_F(YaraRuleCacheTests,
+RulesAreCompiledAgainWhenModificationTimeAndContentChange) {
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+
+	writeRuleFile(OTHER_RULES, 1000000100);
+	auto newCompiled = getRuleFile();
+
+	EXPECT_NE(compiled, newCompiled);
+	EXPECT_TRUE(isFile(newCompiled));
+	EXPECT_EQ(getHashFromName(newCompiled),
+		readKeyFile(getKeyFile(newCompiled)).at(3));
+}
+
+TEST_F(YaraRuleCacheTests,
+RulesAreCompiledAgainWhenSizeChangesWithinSameModificationTime) {
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+
+	writeRuleFile(OTHER_RULES, 1000000000);
+	auto newCompiled = getRuleFile();
+
+	EXPECT_NE(compiled, newCompiled);
+	EXPECT_TRUE(isFile(newCompiled));
+}
+
+TEST_F(YaraRuleCacheTests,
+RulesAreCompiledAgainWhenContentOfSameSizeChanges) {
+	ASSERT_EQ(RULES.size(), OTHER_RULES_OF_SAME_SIZE.size());
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+
+	writeRuleFile(OTHER_RULES_OF_SAME_SIZE, 1000000100);
+	auto newCompiled = getRuleFile();
+
+	EXPECT_NE(compiled, newCompiled);
+	EXPECT_TRUE(isFile(newCompiled));
+}
+
+TEST_F(YaraRuleCacheTests,
+PreviouslyCompiledRulesAreKeptWhenContentChanges) {
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+
+	writeRuleFile(OTHER_RULES, 1000000100);
+	getRuleFile();
+
+	// Another process may still be using them.
+	EXPECT_TRUE(isFile(compiled));
+}
+
+//
+// Parallel callers.
+//
+
+TEST_F(YaraRuleCacheTests,
+ParallelCallersGetSameCompiledRules) {
+	writeRuleFile(RULES, 1000000000);
+
+	std::vector<std::string> compiled(8);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < compiled.size(); ++i) {
+		threads.emplace_back([this, &compiled, i]() {
+			compiled[i] = YaraRuleCache(cacheDirectory).getRuleFile(ruleFile);
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	createdFiles.push_back(compiled[0]);
+	createdFiles.push_back(getKeyFile(compiled[0]));
+
+	ASSERT_NE(ruleFile, compiled[0]);
+	EXPECT_TRUE(isFile(compiled[0]));
+	for (const auto &c : compiled) {
+		EXPECT_EQ(compiled[0], c);
+	}
+	EXPECT_EQ(getHashFromName(compiled[0]),
+		readKeyFile(getKeyFile(compiled[0])).at(3));
+}
+
+//
+// Corrupted key.
+//
+
+TEST_F(YaraRuleCacheTests,
+CorruptedKeyFileIsReplacedAndCompiledRulesAreReused) {
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+	writeFile(getKeyFile(compiled), "garbage");
+	// A new modification time prevents the use of the rules that have
+	// already been resolved in this process.
+	setModificationTime(ruleFile, 1000000100);
+
+	EXPECT_EQ(compiled, getRuleFile());
+	auto key = readKeyFile(getKeyFile(compiled));
+	ASSERT_EQ(4, key.size());
+	EXPECT_EQ("1000000100", key[1]);
+	EXPECT_EQ(getHashFromName(compiled), key[3]);
+}
+
+TEST_F(YaraRuleCacheTests,
+KeyFileWithInvalidHashIsNotUsed) {
+	writeRuleFile(RULES, 1000000000);
+	auto compiled = getRuleFile();
+	auto key = readKeyFile(getKeyFile(compiled));
+	ASSERT_EQ(4, key.size());
+	setModificationTime(ruleFile, 1000000100);
+	std::ostringstream corruptedKey;
+	corruptedKey << key[0] << "\n1000000100\n" << key[2] << "\n../invalid\n";
+	writeFile(getKeyFile(compiled), corruptedKey.str());
+
+	EXPECT_EQ(compiled, getRuleFile());
+	EXPECT_EQ(getHashFromName(compiled),
+		readKeyFile(getKeyFile(compiled)).at(3));
+}
+
+//
+// Files that are not cached.
+//
+
+TEST_F(YaraRuleCacheTests,
+CompiledRuleFileIsReturnedUnchanged) {
+	EXPECT_EQ("rules.yarac", cache.getRuleFile("rules.yarac"));
+}
+
+TEST_F(YaraRuleCacheTests,
+RuleFileIsReturnedWhenCacheDirectoryIsEmpty) {
+	writeRuleFile(RULES, 1000000000);
+
+	EXPECT_EQ(ruleFile, YaraRuleCache("").getRuleFile(ruleFile));
+}
+
+TEST_F(YaraRuleCacheTests,
+RuleFileIsReturnedWhenCacheDirectoryDoesNotExist) {
+	writeRuleFile(RULES, 1000000000);
+
+	EXPECT_EQ(ruleFile, YaraRuleCache(TempDir() + "retdec-nonexisting-dir")
+		.getRuleFile(ruleFile));
+}
+
+TEST_F(YaraRuleCacheTests,
+RuleFileIsReturnedWhenItDoesNotExist) {
+	EXPECT_EQ(ruleFile, getRuleFile());
+}
+
+TEST_F(YaraRuleCacheTests,
+RuleFileIsReturnedWhenItContainsErrors) {
+	writeRuleFile(INVALID_RULES, 1000000000);
+
+	EXPECT_EQ(ruleFile, getRuleFile());
+}
+
+} // namespace tests
+} // namespace yara_cache
+} // namespace retdec